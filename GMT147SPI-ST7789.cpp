@@ -49,13 +49,46 @@
  */
 
 #include <stdio.h>
+#include <string.h>
+#include <math.h>
 #include "pico/stdlib.h"
+#include "pico/multicore.h"
 #include "hardware/spi.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "hardware/clocks.h"
 #include "lib/oled/st7789.h"  // OLED display library
 #include "lib/oled/gfx.h"     // Graphics library for OLED
 #include "lib/oled/gfxfont.h" // Font definitions for graphics library
+#include "lib/oled/gfxarena.h" // Display memory arena
+#include "lib/oled/gfxblit.h"  // Affine sprite blitter
+#include "lib/oled/gfxtile.h"  // Tile-map renderer
+#include "lib/oled/gfxtextbox.h" // Word-wrapped text box
+#include "lib/oled/gfxoutline.h" // Scalable outline fonts
+#include "lib/oled/outlinesans.h" // Outline font data
+#include "lib/oled/gfxline.h"  // Thick and anti-aliased lines
+#include "lib/oled/gfxpath.h"  // Bezier curves and paths
+#include "lib/oled/readcache.h" // Panel readback tile cache
+#include "lib/oled/st7789pio.h" // PIO display transmitter
+#include "lib/oled/lcdqueue.h"  // Background flush queue
+#include "lib/oled/lcdstream.h" // Streaming window writes
+#include "lib/oled/gfxdefer.h"  // Deferred frame mode
+#include "lib/oled/gfxconfig.h" // Render configuration under a RAM budget
+#include "lib/oled/gfxquality.h" // Adaptive rendering quality
+#include "lib/oled/gfxtransition.h" // Screen transitions
+#include "lib/oled/gfxaafont.h" // Anti-aliased bitmap fonts
+#include "lib/oled/sans24.h"    // 24 px 1-bpp font data
+#include "lib/oled/sans24aa.h"  // 24 px 4-bpp font data
+#include "lib/oled/gfxsegment.h" // Segment displays
+#include "lib/oled/gfxasset.h"   // Decoded image asset cache
+#include "lib/oled/gfxwaterfall.h" // Waterfall widget
+#include "lib/oled/gfxstencil.h"   // Stencil masks
 #include "lib/hardware.h"     // Hardware configuration for OLED
 
+/** @brief Set to 0 to skip the one-off rendering benchmarks at startup */
+#ifndef RUN_BENCHMARKS
+#define RUN_BENCHMARKS 1
+#endif
+
 /** @brief Display dimensions for ST7789P3 1.47" display (172x320 pixels) */
 const int lcd_width = 172;  ///< Display width in pixels (ST7789P3 variant)
 const int lcd_height = 320; ///< Display height in pixels
@@ -86,6 +119,48 @@ const int lcd_height = 320; ///< Display height in pixels
  */
 const int SAFE_MARGIN = 10; ///< Safe margin in pixels for rounded corners (verified)
 
+/**
+ * Corner radius of the glass for the rounded-corner stencil. A 10 px margin
+ * clears a corner of radius r where the arc comes closest, at 45 degrees,
+ * r * (1 - 1/sqrt(2)) from each edge; 34 px is the largest radius that fits.
+ */
+const int PANEL_CORNER_RADIUS = 34;
+
+/**
+ * @brief Flush the framebuffer and report how long the transfer took
+ *
+ * Used by every test screen so flush cost can be compared on the serial
+ * console. The frame is then sent again as if the screen had been cleared
+ * eagerly: the rows nothing drew into are filled in the framebuffer and
+ * every row goes out as a bitmap, and the difference to the lazy flush is
+ * printed. With auto damage enabled it also shows how many rows the row
+ * hashes let through and what the hashing cost.
+ */
+void timedFlush()
+{
+    GFXflushStats stats;
+
+    GFX_resetFlushStats();
+    absolute_time_t start = get_absolute_time();
+    GFX_flush();
+    GFX_flushQueueWait();
+    int64_t lazyUs = absolute_time_diff_us(start, get_absolute_time());
+    printf("Flush time: %lu us\n", (unsigned long)lazyUs);
+
+    GFX_getFlushStats(&stats);
+    printf("Rows sent: %lu/%d (hash %lu us)\n", (unsigned long)stats.rowsSent, lcd_height,
+           (unsigned long)stats.hashUs);
+
+    // Same frame, eagerly cleared: fill the untouched rows, then send them all
+    start = get_absolute_time();
+    GFX_resolveClear();
+    GFX_invalidatePanel();
+    GFX_flush();
+    GFX_flushQueueWait();
+    int64_t eagerUs = absolute_time_diff_us(start, get_absolute_time());
+    printf("Eager clear: %lu us (lazy saves %ld us)\n", (unsigned long)eagerUs, (long)(eagerUs - lazyUs));
+}
+
 /**
  * @brief Test function to determine character capacity of the display
  * @param textSize Font size multiplier (1 = 6x8 pixels per char, 2 = 12x16, etc.)
@@ -189,7 +264,7 @@ void testCharacterCapacity(uint8_t textSize)
     // This is the "second box from outside" that the user confirmed is perfect
     GFX_drawRect(10, 10, lcd_width - 20, lcd_height - 20, ST77XX_ORANGE);
 
-    GFX_flush();
+    timedFlush();
     printf("Test pattern complete!\n");
     printf("All rows should be fully visible within orange border (10px margin from edges).\n");
 }
@@ -242,7 +317,7 @@ void testReadability()
     GFX_setCursor(5, 290);
     GFX_printf("Yellow=Sz3");
 
-    GFX_flush();
+    timedFlush();
     printf("Readability test complete!\n");
     printf("Look at display to compare sizes.\n");
     printf("================================\n\n");
@@ -350,7 +425,7 @@ void testSafeZone()
     GFX_setCursor(20, lcd_height - 40);
     GFX_printf("Bottom 20px");
 
-    GFX_flush();
+    timedFlush();
 
     printf("Border colors:\n");
     printf("  Red: Display edges (cropped by rounded corners)\n");
@@ -446,7 +521,7 @@ void testPracticalLayout()
     int usableRows = usableHeight / LINE_HEIGHT;
     GFX_printf("~%d rows", usableRows);
 
-    GFX_flush();
+    timedFlush();
 
     printf("Safe area dimensions:\n");
     printf("  Width: %d pixels (%d margin each side)\n", lcd_width - (2 * SAFE_MARGIN), SAFE_MARGIN);
@@ -456,6 +531,984 @@ void testPracticalLayout()
     printf("================================\n\n");
 }
 
+/**
+ * @brief Time text rendering with a cold and a warm XIP cache
+ *
+ * Draws the same line of size-1 text repeatedly, once flushing the XIP cache
+ * before every pass (worst case: application code has evicted the font and
+ * raster code) and once warm. The classic font and the raster kernels are
+ * placed in SRAM, so the two figures should be close; a large gap means some
+ * hot path is still executing or reading from flash.
+ */
+void benchmarkTextXip()
+{
+    const int passes = 50;
+    uint64_t coldUs = 0, warmUs = 0;
+
+    GFX_setTextSize(1);
+    GFX_setTextColor(ST77XX_WHITE);
+    for (int i = 0; i < passes; i++)
+    {
+        xip_ctrl_hw->flush = 1;
+        (void)xip_ctrl_hw->flush; // Read back blocks until the flush completes
+        absolute_time_t t0 = get_absolute_time();
+        GFX_setCursor(0, 0);
+        GFX_printf("The quick brown fox 0123");
+        coldUs += absolute_time_diff_us(t0, get_absolute_time());
+    }
+    for (int i = 0; i < passes; i++)
+    {
+        absolute_time_t t0 = get_absolute_time();
+        GFX_setCursor(0, 0);
+        GFX_printf("The quick brown fox 0123");
+        warmUs += absolute_time_diff_us(t0, get_absolute_time());
+    }
+    printf("Text (24 chars): cold XIP %lu us, warm %lu us\n",
+           (unsigned long)(coldUs / passes), (unsigned long)(warmUs / passes));
+}
+
+/**
+ * @brief Measure affine blitter throughput for common angles and scales
+ *
+ * Rotates a generated 48x48 needle sprite around its centre into a 96x96
+ * destination box and prints destination pixels per second for nearest and
+ * bilinear sampling.
+ */
+void benchmarkAffine()
+{
+    static uint16_t sprite[48 * 48];
+    for (int y = 0; y < 48; y++)
+        for (int x = 0; x < 48; x++)
+            sprite[y * 48 + x] = (x > 20 && x < 28) ? ST77XX_RED : (((x ^ y) & 8) ? ST77XX_WHITE : ST77XX_BLUE);
+    GFXimage img = {sprite, 48, 48, 48};
+
+    const int16_t angles[] = {0, 30, 45, 90};
+    const int32_t scales[] = {0x10000, 0x18000}; // 1.0x and 1.5x
+    for (int s = 0; s < 2; s++)
+        for (int a = 0; a < 4; a++)
+            for (uint8_t flags = GFX_BLIT_NEAREST; flags <= GFX_BLIT_BILINEAR; flags++)
+            {
+                GFXaffine m;
+                GFX_affineRotateScale(&m, angles[a], scales[s], 24, 24, 86, 160);
+                absolute_time_t t0 = get_absolute_time();
+                GFX_blitAffine(&img, &m, 38, 112, 96, 96, flags, 0);
+                int64_t us = absolute_time_diff_us(t0, get_absolute_time());
+                printf("Affine %3d deg x%s %-8s: %lu px/s\n", angles[a], s ? "1.5" : "1.0",
+                       flags ? "bilinear" : "nearest", (unsigned long)(96 * 96 * 1000000LL / (us ? us : 1)));
+            }
+}
+
+/**
+ * @brief Compare a tile-map grid against the same grid drawn with primitives
+ *
+ * A 10x18 grid of 16x16 cells (each a filled square with a border) is drawn
+ * once with GFX_fillRect()/GFX_drawRect() and once as a tile map, then a
+ * single cell is changed and re-rendered. Prints times and memory footprint.
+ */
+void benchmarkTilemap()
+{
+    static uint16_t tilePixels[4 * 16 * 16];
+    const uint16_t fills[4] = {ST77XX_BLUE, ST77XX_GREEN, ST77XX_RED, ST77XX_YELLOW};
+    for (int t = 0; t < 4; t++)
+        for (int y = 0; y < 16; y++)
+            for (int x = 0; x < 16; x++)
+                tilePixels[t * 256 + y * 16 + x] =
+                    (x == 15 || y == 15) ? ST77XX_BLACK : ((x == 0 || y == 0 || x == 14 || y == 14) ? ST77XX_WHITE : fills[t]);
+    GFXtileset tiles = {tilePixels, NULL, NULL, 16, 4};
+
+    absolute_time_t t0 = get_absolute_time();
+    for (int r = 0; r < 18; r++)
+        for (int c = 0; c < 10; c++)
+        {
+            GFX_fillRect(6 + c * 16, 16 + r * 16, 15, 15, fills[(r + c) & 3]);
+            GFX_drawRect(6 + c * 16, 16 + r * 16, 15, 15, ST77XX_WHITE);
+        }
+    int64_t primUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    GFXtilemap map;
+    if (!GFX_tilemapInit(&map, &tiles, 10, 18, 6, 16))
+    {
+        printf("Tile map: no arena space\n");
+        return;
+    }
+    for (int r = 0; r < 18; r++)
+        for (int c = 0; c < 10; c++)
+            GFX_tilemapSet(&map, c, r, (r + c) & 3);
+    t0 = get_absolute_time();
+    GFX_tilemapRender(&map);
+    int64_t tileUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    GFX_tilemapSet(&map, 4, 7, 3);
+    t0 = get_absolute_time();
+    uint16_t drawn = GFX_tilemapRender(&map);
+    int64_t oneUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    printf("Grid 10x18: primitives %lu us, tile map %lu us, 1-cell update %lu us (%u tile)\n",
+           (unsigned long)primUs, (unsigned long)tileUs, (unsigned long)oneUs, drawn);
+    printf("Tile map RAM %u bytes, tile set %u bytes (flash)\n",
+           (unsigned)GFX_tilemapMemory(&map), (unsigned)sizeof(tilePixels));
+}
+
+/**
+ * @brief Append throughput of a log-style text box
+ *
+ * Appends 100 short log lines to an auto-scrolling box, once with the
+ * incremental update and once forcing a full box redraw after every append.
+ */
+void benchmarkTextbox()
+{
+    GFXtextbox box;
+    if (!GFX_textboxInit(&box, 6, 16, 160, 288, NULL, 1, 1024, 64))
+    {
+        printf("Text box: no arena space\n");
+        return;
+    }
+    GFX_textboxSetAutoScroll(&box, true);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        uint32_t chars = 0;
+        absolute_time_t t0 = get_absolute_time();
+        for (int i = 0; i < 100; i++)
+        {
+            char line[32];
+            chars += snprintf(line, sizeof(line), "%03d: adc=%4d ok\n", i, (i * 37) % 4096);
+            GFX_textboxAppend(&box, line);
+            if (pass)
+                GFX_textboxDraw(&box);
+        }
+        int64_t us = absolute_time_diff_us(t0, get_absolute_time());
+        printf("Text box append (%s): %lu chars/s\n", pass ? "full redraw" : "incremental",
+               (unsigned long)(chars * 1000000ULL / (us ? us : 1)));
+    }
+}
+
+/**
+ * @brief Outline font flash use and per-glyph cost
+ *
+ * Flash: the outline font against the 1-bpp GFXfont bitmaps (plus 7-byte
+ * glyph entries) that four fixed sizes would need. Speed: the same string
+ * drawn with an empty glyph cache (rasterise), then again (cache hits).
+ */
+void benchmarkOutlineFont()
+{
+    const uint8_t sizes[4] = {16, 24, 32, 48};
+    size_t bitmaps = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        size_t bytes = 0;
+        GFXoutlineBitmap info;
+        for (uint8_t c = OutlineSans.first; c <= OutlineSans.last; c++)
+            bytes += GFX_outlineRasterize(&OutlineSans, c, sizes[i], 1, NULL, 0, &info) + sizeof(GFXglyph);
+        printf("Bitmap font %2upx: %u bytes\n", sizes[i], (unsigned)bytes);
+        bitmaps += bytes;
+    }
+    printf("4 bitmap sizes: %u bytes, outline font: %u bytes\n", (unsigned)bitmaps,
+           (unsigned)GFX_outlineFontBytes(&OutlineSans));
+
+    const char *text = "Gauge 0123";
+    int glyphs = strlen(text);
+    for (uint8_t bpp = 1; bpp <= 4; bpp += 3)
+    {
+        GFX_outlineCacheClear();
+        absolute_time_t t0 = get_absolute_time();
+        GFX_drawOutlineText(8, 100, &OutlineSans, text, 32, ST77XX_WHITE, ST77XX_BLACK, bpp);
+        int64_t missUs = absolute_time_diff_us(t0, get_absolute_time());
+        t0 = get_absolute_time();
+        GFX_drawOutlineText(8, 150, &OutlineSans, text, 32, ST77XX_WHITE, ST77XX_BLACK, bpp);
+        int64_t hitUs = absolute_time_diff_us(t0, get_absolute_time());
+        printf("Outline 32px %ubpp: miss %lu us/glyph, hit %lu us/glyph\n", bpp,
+               (unsigned long)(missUs / glyphs), (unsigned long)(hitUs / glyphs));
+    }
+
+    GFXoutlineCacheStats stats;
+    GFX_getOutlineCacheStats(&stats);
+    printf("Glyph cache: %u glyphs, %u bytes\n", stats.entries, stats.bytes);
+}
+
+/**
+ * @brief Gauge needles: offset-line workaround vs thick and anti-aliased lines
+ *
+ * Draws 36 needles of width 5 around a dial, first as five offset
+ * GFX_drawLine() passes each (the old workaround, which leaves gaps on
+ * diagonals), then with GFX_drawThickLine(). Also compares a 1-pixel
+ * GFX_drawLine() sweep with GFX_drawLineAA().
+ */
+void benchmarkLines()
+{
+    int16_t ex[36], ey[36];
+    for (int i = 0; i < 36; i++)
+    {
+        ex[i] = 86 + (int16_t)(70 * cosf(i * 10 * (float)M_PI / 180));
+        ey[i] = 160 + (int16_t)(70 * sinf(i * 10 * (float)M_PI / 180));
+    }
+
+    absolute_time_t t0 = get_absolute_time();
+    for (int i = 0; i < 36; i++)
+    {
+        bool steep = abs(ey[i] - 160) > abs(ex[i] - 86);
+        for (int o = -2; o <= 2; o++)
+            GFX_drawLine(86 + (steep ? o : 0), 160 + (steep ? 0 : o),
+                         ex[i] + (steep ? o : 0), ey[i] + (steep ? 0 : o), ST77XX_YELLOW);
+    }
+    int64_t offsetUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    t0 = get_absolute_time();
+    for (int i = 0; i < 36; i++)
+        GFX_drawThickLine(86, 160, ex[i], ey[i], 5, GFX_CAP_ROUND, ST77XX_YELLOW);
+    int64_t thickUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    t0 = get_absolute_time();
+    for (int i = 0; i < 36; i++)
+        GFX_drawLine(86, 160, ex[i], ey[i], ST77XX_WHITE);
+    int64_t lineUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    t0 = get_absolute_time();
+    for (int i = 0; i < 36; i++)
+        GFX_drawLineAA(86, 160, ex[i], ey[i], ST77XX_WHITE, ST77XX_BLACK);
+    int64_t aaUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    printf("36 needles w5: 5 offset lines %lu us, thick line %lu us\n",
+           (unsigned long)offsetUs, (unsigned long)thickUs);
+    printf("36 needles w1: Bresenham %lu us, anti-aliased %lu us\n",
+           (unsigned long)lineUs, (unsigned long)aaUs);
+}
+
+/**
+ * @brief Envelope curve: uniform float steps vs adaptive fixed-point flattening
+ *
+ * Draws an attack/decay/release envelope made of three cubic curves, first
+ * the old way (100 float steps per curve, one GFX_drawLine() per step) and
+ * then as a path flattened in fixed point, stroked and filled.
+ */
+void benchmarkCurves()
+{
+    // Start, control 1, control 2, end of each curve
+    static const int16_t env[3][8] = {
+        {10, 300, 20, 200, 30, 120, 50, 110},
+        {50, 110, 70, 100, 80, 220, 110, 220},
+        {110, 220, 130, 220, 140, 290, 160, 300},
+    };
+
+    absolute_time_t t0 = get_absolute_time();
+    uint32_t floatSegments = 0;
+    for (int c = 0; c < 3; c++)
+    {
+        const int16_t *e = env[c];
+        int16_t px = e[0], py = e[1];
+        for (int i = 1; i <= 100; i++)
+        {
+            float t = i / 100.0f, u = 1 - t;
+            float x = u * u * u * e[0] + 3 * u * u * t * e[2] + 3 * u * t * t * e[4] + t * t * t * e[6];
+            float y = u * u * u * e[1] + 3 * u * u * t * e[3] + 3 * u * t * t * e[5] + t * t * t * e[7];
+            GFX_drawLine(px, py, (int16_t)(x + 0.5f), (int16_t)(y + 0.5f), ST77XX_CYAN);
+            px = (int16_t)(x + 0.5f);
+            py = (int16_t)(y + 0.5f);
+            floatSegments++;
+        }
+    }
+    int64_t floatUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    GFXpath path;
+    if (!GFX_pathInit(&path, 200, 2))
+    {
+        printf("Curves: no arena room for the path\n");
+        return;
+    }
+
+    t0 = get_absolute_time();
+    GFX_pathMoveTo(&path, env[0][0], env[0][1]);
+    for (int c = 0; c < 3; c++)
+        GFX_pathCubicTo(&path, env[c][2], env[c][3], env[c][4], env[c][5], env[c][6], env[c][7]);
+    GFX_strokePath(&path, 1, GFX_CAP_BUTT, ST77XX_CYAN);
+    int64_t pathUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    t0 = get_absolute_time();
+    GFX_strokePath(&path, 3, GFX_CAP_ROUND, ST77XX_CYAN);
+    int64_t thickUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    t0 = get_absolute_time();
+    GFX_fillPath(&path, ST77XX_BLUE);
+    int64_t fillUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    printf("Envelope, float steps: %lu segments, %lu us\n", (unsigned long)floatSegments, (unsigned long)floatUs);
+    printf("Envelope, adaptive: %u segments, %lu us (width 3: %lu us, filled: %lu us)\n", path.segments,
+           (unsigned long)pathUs, (unsigned long)thickUs, (unsigned long)fillUs);
+}
+
+/**
+ * @brief Panel readback: single-pixel reads vs the tile cache
+ *
+ * Only runs when the board has a read path (OLED_READ_MODE). Reads a 64x64
+ * area one RAMRD per pixel, then through LCD_readPixelCached(), and prints
+ * the tile loads it needed.
+ */
+void benchmarkReadback()
+{
+    if (!LCD_canRead())
+    {
+        printf("Readback: panel is write-only on this board (OLED_READ_MODE)\n");
+        return;
+    }
+    printf("Readback: display ID %06lX\n", (unsigned long)LCD_ReadID());
+
+    uint16_t px;
+    absolute_time_t t0 = get_absolute_time();
+    for (int y = 0; y < 64; y++)
+        for (int x = 0; x < 64; x++)
+            LCD_ReadBitmap(x, y, 1, 1, &px);
+    int64_t singleUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    LCD_readCacheInvalidate();
+    LCD_resetReadCacheStats();
+    t0 = get_absolute_time();
+    for (int y = 0; y < 64; y++)
+        for (int x = 0; x < 64; x++)
+            px = LCD_readPixelCached(x, y);
+    int64_t cachedUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    ReadCacheStats st;
+    LCD_getReadCacheStats(&st);
+    printf("Readback 64x64: per pixel %lu us, tile cache %lu us (%lu tile loads)\n",
+           (unsigned long)singleUs, (unsigned long)cachedUs, (unsigned long)st.misses);
+}
+
+/**
+ * @brief Multi-rectangle flush: SPI per rectangle vs one PIO/DMA chain
+ *
+ * Sends the same three framebuffer rectangles both ways at the same SCK
+ * rate. For the PIO transmitter it prints the CPU time until
+ * LCD_pioWriteRects() returns and the time until the panel has everything.
+ */
+void benchmarkPioFlush()
+{
+    if (gfxFramebuffer == NULL)
+    {
+        printf("PIO flush: needs a framebuffer\n");
+        return;
+    }
+    uint16_t w = GFX_getWidth(); // Framebuffer stride in the current rotation
+    GFX_fillScreen(ST77XX_BLACK);
+    GFX_fillRect(0, 0, w, 20, ST77XX_BLUE);
+    GFX_fillCircle(52, 132, 30, ST77XX_GREEN);
+    GFX_fillRect(100, 250, 60, 40, ST77XX_RED);
+    GFX_resolveClear();
+
+    LCDrect rects[3] = {
+        {0, 0, w, 20, GFX_getRow(0), w},
+        {20, 100, 64, 64, GFX_getRow(100) + 20, w},
+        {100, 250, 60, 40, GFX_getRow(250) + 100, w},
+    };
+
+    absolute_time_t t0 = get_absolute_time();
+    for (int i = 0; i < 3; i++)
+    {
+        // LCD_WriteBitmap wants rows packed; send one row at a time
+        for (int row = 0; row < rects[i].h; row++)
+            LCD_WriteBitmap(rects[i].x, rects[i].y + row, rects[i].w, 1,
+                            (uint16_t *)rects[i].pixels + row * rects[i].stride);
+    }
+    int64_t spiUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    float clkdiv = clock_get_hz(clk_sys) / (2.0f * spi_get_baudrate(OLED_SPI_PORT));
+    if (!LCD_pioInit(pio0, clkdiv))
+    {
+        printf("PIO flush: no state machine, or DC/CS not consecutive\n");
+        return;
+    }
+    t0 = get_absolute_time();
+    LCD_pioWriteRects(rects, 3);
+    int64_t cpuUs = absolute_time_diff_us(t0, get_absolute_time());
+    LCD_pioWait();
+    int64_t pioUs = absolute_time_diff_us(t0, get_absolute_time());
+    LCD_pioRelease();
+
+    printf("Flush 3 rects: SPI %lu us, PIO %lu us (CPU %lu us)\n",
+           (unsigned long)spiUs, (unsigned long)pioUs, (unsigned long)cpuUs);
+}
+
+/**
+ * @brief Full-frame flush: blocking vs the background flush queue
+ *
+ * Sends the whole framebuffer both ways. For the queue it prints the CPU
+ * time until GFX_flush() returns and the time until the panel has the frame.
+ */
+void benchmarkFlushQueue()
+{
+    if (gfxFramebuffer == NULL)
+    {
+        printf("Flush queue: needs a framebuffer\n");
+        return;
+    }
+    GFX_setAutoDamage(false); // Send every row both times
+    GFX_fillScreen(ST77XX_BLACK);
+    GFX_fillRect(10, 10, 152, 300, ST77XX_BLUE);
+
+    absolute_time_t t0 = get_absolute_time();
+    GFX_flush();
+    int64_t blockingUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    GFX_setFlushQueue(true);
+    t0 = get_absolute_time();
+    GFX_flush();
+    int64_t cpuUs = absolute_time_diff_us(t0, get_absolute_time());
+    GFX_flushQueueWait();
+    int64_t queuedUs = absolute_time_diff_us(t0, get_absolute_time());
+    GFX_setFlushQueue(false);
+    GFX_setAutoDamage(true);
+
+    LCDqueueStats st;
+    LCD_getQueueStats(&st);
+    printf("Full flush: blocking %lu us, queued %lu us (CPU %lu us, %lu transfers)\n",
+           (unsigned long)blockingUs, (unsigned long)queuedUs, (unsigned long)cpuUs,
+           (unsigned long)st.transfers);
+}
+
+// Plasma-style pattern for benchmarkStream(); ctx is the window width
+static void plasmaProducer(uint16_t *buf, uint32_t first, uint16_t n, void *ctx)
+{
+    uint16_t w = *(uint16_t *)ctx;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint16_t x = (first + i) % w, y = (first + i) / w;
+        buf[i] = GFX_color565((uint8_t)(x * 3), (uint8_t)y, (uint8_t)((x ^ y) * 4));
+    }
+}
+
+/**
+ * @brief Generated full-screen pattern: row-by-row LCD_WriteBitmap vs streaming
+ *
+ * Both use one line of RAM per buffer. The blocking version generates a row
+ * and waits for it to be sent; the stream generates the next buffer while
+ * the previous one is on the bus.
+ */
+void benchmarkStream()
+{
+    uint16_t w = lcd_width;
+    static uint16_t row[lcd_width];
+
+    absolute_time_t t0 = get_absolute_time();
+    for (uint16_t y = 0; y < lcd_height; y++)
+    {
+        plasmaProducer(row, (uint32_t)y * w, w, &w);
+        LCD_WriteBitmap(0, y, w, 1, row);
+    }
+    int64_t rowsUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    t0 = get_absolute_time();
+    LCD_streamWindow(0, 0, w, lcd_height, plasmaProducer, &w);
+    int64_t streamUs = absolute_time_diff_us(t0, get_absolute_time());
+
+    printf("Generated frame: per row %lu us, streamed %lu us (%u bytes of buffers)\n",
+           (unsigned long)rowsUs, (unsigned long)streamUs, (unsigned)(4 * LCD_STREAM_PIXELS));
+}
+
+/**
+ * @brief Overdraw on the test screens: immediate vs deferred frame mode
+ *
+ * Draws each test screen (including its flush) both ways and prints the
+ * time, the overdraw ratio (pixels drawn per screen pixel) before and after
+ * culling, and how many primitives were culled or trimmed.
+ */
+void benchmarkOverdraw()
+{
+    void (*screens[])() = {testSafeZone, testPracticalLayout};
+    const char *names[] = {"Safe zone", "Practical layout"};
+    uint32_t area = (uint32_t)lcd_width * lcd_height;
+
+    for (int i = 0; i < 2; i++)
+    {
+        absolute_time_t t0 = get_absolute_time();
+        screens[i]();
+        int64_t immediateUs = absolute_time_diff_us(t0, get_absolute_time());
+
+        if (!GFX_setDeferred(true))
+        {
+            printf("Overdraw: no arena space for the display list\n");
+            return;
+        }
+        GFX_resetDeferStats();
+        t0 = get_absolute_time();
+        screens[i]();
+        int64_t deferredUs = absolute_time_diff_us(t0, get_absolute_time());
+        GFX_setDeferred(false);
+
+        GFXdeferStats st;
+        GFX_getDeferStats(&st);
+        printf("%s: immediate %lu us, deferred %lu us; overdraw %lu.%02lux -> %lu.%02lux "
+               "(%lu of %lu culled, %lu trimmed)\n",
+               names[i], (unsigned long)immediateUs, (unsigned long)deferredUs,
+               (unsigned long)(st.pixelsRecorded / area), (unsigned long)(st.pixelsRecorded * 100 / area % 100),
+               (unsigned long)(st.pixelsDrawn / area), (unsigned long)(st.pixelsDrawn * 100 / area % 100),
+               (unsigned long)st.culled, (unsigned long)st.entries, (unsigned long)st.trimmed);
+    }
+}
+
+/**
+ * @brief Configurations GFX_configure() would choose for common panel sizes
+ *
+ * Plans each panel from 135x240 to 240x320 against the whole display arena
+ * and against half of it, with no priorities and with GFX_PRIO_TEXT, and
+ * prints the choice. Nothing is applied, so the running setup is unchanged.
+ */
+void benchmarkConfigPlans()
+{
+    const uint16_t panels[][2] = {{135, 240}, {170, 320}, {172, 320}, {240, 240}, {240, 320}};
+    const size_t budgets[] = {GFX_ARENA_SIZE, GFX_ARENA_SIZE / 2};
+    const uint8_t prios[] = {0, GFX_PRIO_TEXT};
+
+    for (int p = 0; p < 5; p++)
+        for (int b = 0; b < 2; b++)
+            for (int q = 0; q < 2; q++)
+            {
+                GFXconfig cfg;
+                GFX_planConfig(panels[p][0], panels[p][1], budgets[b], prios[q], &cfg);
+                printf("%ux%u in %u KB%s: %s, fonts %u, glyphs %u, total %u bytes\n",
+                       panels[p][0], panels[p][1], (unsigned)(budgets[b] / 1024), prios[q] ? " (text)" : "",
+                       cfg.framebuffer ? "framebuffer" : "direct", (unsigned)cfg.fontCacheBytes,
+                       (unsigned)cfg.outlineCacheBytes, (unsigned)cfg.totalBytes);
+            }
+}
+
+/**
+ * @brief Dial with an anti-aliased needle and an outline-font readout
+ *
+ * Region coordinates are 0..151 x 0..151 and are shifted down by
+ * view->shift, so the same code draws at full and at half resolution.
+ */
+static void drawDial(const GFXregionView *view, void *ctx)
+{
+    int angle = *(int *)ctx;
+    int16_t s = view->shift;
+    int16_t cx = view->x + (76 >> s), cy = view->y + (76 >> s);
+    float a = angle * 3.14159f / 180.0f;
+
+    GFX_fillRect(view->x, view->y, view->w, view->h, ST77XX_BLACK);
+    GFX_fillCircle(cx, cy, 70 >> s, ST77XX_BLUE);
+    for (int r = 0; r < 3; r++)
+        GFX_drawLineAA(cx + r - 1, cy, cx + (int16_t)(cosf(a) * (64 >> s)), cy + (int16_t)(sinf(a) * (64 >> s)),
+                       ST77XX_YELLOW, ST77XX_BLUE);
+    char text[8];
+    snprintf(text, sizeof(text), "%d", angle);
+    GFX_drawOutlineText(cx - (20 >> s), cy + (40 >> s), &OutlineSans, text, 24 >> s, ST77XX_WHITE, ST77XX_BLUE, 4);
+}
+
+/**
+ * @brief Frame time and quality levels while a dial sweeps
+ *
+ * Turns the dial for 120 frames against a 10 ms budget, then stops it, and
+ * prints the frames and time spent at each quality level.
+ */
+void benchmarkQuality()
+{
+    static const char *const names[GFX_QUALITY_LEVELS] = {"full", "fast", "half", "skip"};
+    int angle = 0;
+
+    GFX_clearDynamicRegions();
+    GFX_addDynamicRegion(10, 60, 152, 152, drawDial, &angle);
+    GFX_setFrameBudget(10000);
+    GFX_resetQualityStats();
+    GFX_fillScreen(ST77XX_BLACK);
+    for (int f = 0; f <= 120; f++)
+    {
+        GFX_frameBegin();
+        angle = (f * 3) % 360;
+        GFX_drawDynamicRegions();
+        GFX_flush();
+        GFX_frameEnd(f < 120); // The last frame stops and repaints at full quality
+    }
+
+    GFXqualityStats st;
+    GFX_getQualityStats(&st);
+    for (int i = 0; i < GFX_QUALITY_LEVELS; i++)
+        printf("Quality %s: %lu frames, %lu us\n", names[i], (unsigned long)st.frames[i], (unsigned long)st.us[i]);
+    printf("Quality: %lu down, %lu up, %lu skipped, %lu repaints\n", (unsigned long)st.stepsDown,
+           (unsigned long)st.stepsUp, (unsigned long)st.skipped, (unsigned long)st.repaints);
+    GFX_clearDynamicRegions();
+}
+
+/**
+ * @brief SPI bytes per transition type against full-frame animation
+ *
+ * Plays every transition between two simple screens and prints the bytes
+ * sent per step next to what flushing every step in full would send.
+ */
+void benchmarkTransitions()
+{
+    static const char *const names[GFX_TRANSITION_TYPES] = {"slide up", "slide down", "wipe down",
+                                                             "wipe up",  "wipe right", "wipe left",
+                                                             "reveal",   "fade in",    "fade out"};
+    if (gfxFramebuffer == NULL)
+    {
+        printf("Transitions: no framebuffer, skipped\n");
+        return;
+    }
+
+    GFX_resetTransitionStats();
+    for (uint8_t t = 0; t < GFX_TRANSITION_TYPES; t++)
+    {
+        GFX_fillScreen(t & 1 ? ST77XX_BLUE : ST77XX_BLACK);
+        GFX_fillRect(10, 10, 60, 60, ST77XX_YELLOW);
+        GFX_setCursor(10, 100);
+        GFX_printf("%s", names[t]);
+
+        absolute_time_t t0 = get_absolute_time();
+        GFX_transition(t, 16, 0);
+        uint32_t us = (uint32_t)absolute_time_diff_us(t0, get_absolute_time());
+
+        GFXtransitionStats st;
+        GFX_getTransitionStats(t, &st);
+        printf("Transition %-10s: %lu bytes/frame vs %lu naive, %lu us\n", names[t],
+               (unsigned long)(st.bytes / st.frames), (unsigned long)(st.naiveBytes / st.frames), (unsigned long)us);
+    }
+}
+
+/**
+ * @brief Glyphs per second for 1-bpp and anti-aliased bitmap text
+ *
+ * Draws the same line with the 1-bpp and the 4-bpp version of one font:
+ * 1-bpp, anti-aliased opaque (ramp lookup) and anti-aliased transparent
+ * (blend into the framebuffer).
+ */
+void benchmarkAAFont()
+{
+    static const char *const names[3] = {"1bpp", "AA opaque", "AA transparent"};
+    const GFXfont *fonts[3] = {&Sans24, &Sans24AA, &Sans24AA};
+    const char *text = "Flow 12.5 l/min";
+    const int passes = 20;
+    int glyphs = strlen(text) * passes;
+
+    GFX_fillScreen(ST77XX_BLUE);
+    GFX_resetAAFontStats();
+    for (int i = 0; i < 3; i++)
+    {
+        GFX_setFont(fonts[i]);
+        GFX_setTextColor(ST77XX_WHITE);
+        GFX_setTextBack(i == 2 ? ST77XX_WHITE : ST77XX_BLUE);
+        absolute_time_t t0 = get_absolute_time();
+        for (int p = 0; p < passes; p++)
+        {
+            GFX_setCursor(4, 40 + (p % 10) * 26);
+            GFX_printf("%s", text);
+        }
+        int64_t us = absolute_time_diff_us(t0, get_absolute_time());
+        printf("Text %-14s: %lu glyphs/s\n", names[i], (unsigned long)(glyphs * 1000000LL / (us ? us : 1)));
+    }
+    GFX_flush();
+
+    GFXaaFontStats st;
+    GFX_getAAFontStats(&st);
+    printf("AA ramps: %lu hits, %lu built\n", (unsigned long)st.rampHits, (unsigned long)st.rampMisses);
+    GFX_setFont(NULL);
+    GFX_setTextBack(ST77XX_BLACK);
+}
+
+/**
+ * @brief Counter updates per second: segment field against redrawn text
+ *
+ * Counts up on a four-digit seven-segment field and on the same string
+ * printed at text size 6 into a cleared box and flushed with auto damage.
+ * Prints updates per second and SPI bytes per update for both.
+ */
+void benchmarkSegments()
+{
+    const int updates = 200;
+    char text[8];
+    if (gfxFramebuffer == NULL)
+    {
+        printf("Segments: no framebuffer, skipped\n");
+        return;
+    }
+
+    GFXsegField field;
+    if (!GFX_segmentInit(&field, 8, 40, 4, 48, GFX_SEG_7, ST77XX_RED, 0x2000, ST77XX_BLACK))
+    {
+        printf("Segments: no arena room, skipped\n");
+        return;
+    }
+    GFX_fillScreen(ST77XX_BLACK);
+    GFX_flush();
+
+    GFX_resetSegmentStats();
+    absolute_time_t t0 = get_absolute_time();
+    for (int i = 0; i < updates; i++)
+    {
+        snprintf(text, sizeof(text), "%3d.%d", (i / 10) % 1000, i % 10);
+        GFX_segmentPrint(&field, text);
+        GFX_segmentFlush(&field);
+    }
+    int64_t us = absolute_time_diff_us(t0, get_absolute_time());
+    GFXsegStats seg;
+    GFX_getSegmentStats(&seg);
+    printf("Segments: %lu updates/s, %lu bytes/update, %lu segments/update, %u arena bytes\n",
+           (unsigned long)(updates * 1000000LL / (us ? us : 1)), (unsigned long)(seg.bytes / updates),
+           (unsigned long)(seg.segments / updates), (unsigned)GFX_segmentMemory(&field));
+
+    GFX_setTextSize(6);
+    GFX_setTextColor(ST77XX_RED);
+    GFX_setTextBack(ST77XX_BLACK);
+    GFX_resetFlushStats();
+    t0 = get_absolute_time();
+    for (int i = 0; i < updates; i++)
+    {
+        snprintf(text, sizeof(text), "%3d.%d", (i / 10) % 1000, i % 10);
+        GFX_fillRect(8, 120, 160, 48, ST77XX_BLACK);
+        GFX_setCursor(8, 120);
+        GFX_printf("%s", text);
+        GFX_flush();
+    }
+    us = absolute_time_diff_us(t0, get_absolute_time());
+    GFXflushStats fl;
+    GFX_getFlushStats(&fl);
+    printf("Text size 6: %lu updates/s, %lu bytes/update\n", (unsigned long)(updates * 1000000LL / (us ? us : 1)),
+           (unsigned long)(fl.rowsSent * lcd_width * 2 / updates));
+    GFX_setTextSize(1);
+    GFX_setTextColor(ST77XX_WHITE);
+}
+
+#define ICON_COUNT 12 ///< Icons in the asset cache benchmark
+#define ICON_SIZE 32  ///< Icon edge in pixels
+
+static const uint16_t iconPalette[4] = {ST77XX_BLACK, ST77XX_WHITE, ST77XX_CYAN, ST77XX_RED};
+static uint8_t iconRle[ICON_COUNT][sizeof(iconPalette) + 2 * ICON_SIZE * ICON_SIZE];
+static GFXasset iconAssets[ICON_COUNT];
+
+// Run-length encode a ring icon per ID, standing in for icons kept compressed in flash
+static void buildIcons()
+{
+    for (int i = 0; i < ICON_COUNT; i++)
+    {
+        uint8_t *out = iconRle[i];
+        memcpy(out, iconPalette, sizeof(iconPalette));
+        out += sizeof(iconPalette);
+        int r = 8 + i % 8, run = 0, last = -1;
+        for (int p = 0; p <= ICON_SIZE * ICON_SIZE; p++)
+        {
+            int v = -1;
+            if (p < ICON_SIZE * ICON_SIZE)
+            {
+                int dx = p % ICON_SIZE - ICON_SIZE / 2, dy = p / ICON_SIZE - ICON_SIZE / 2;
+                int d2 = dx * dx + dy * dy;
+                v = d2 > r * r ? 0 : d2 > (r - 3) * (r - 3) ? 1 : 2 + ((dx ^ dy ^ i) & 1);
+            }
+            if (v == last && run < 255)
+            {
+                run++;
+                continue;
+            }
+            if (run)
+            {
+                *out++ = run;
+                *out++ = last;
+            }
+            last = v;
+            run = 1;
+        }
+        iconAssets[i] = {iconRle[i], (uint32_t)(out - iconRle[i]), ICON_SIZE, ICON_SIZE, GFX_ASSET_PAL8, 4,
+                         GFX_assetDecodeRle};
+    }
+}
+
+// Draw one screen of four icons; returns microseconds
+static uint32_t drawIconScreen(int screen)
+{
+    absolute_time_t t0 = get_absolute_time();
+    for (int k = 0; k < 4; k++)
+        GFX_drawAsset((screen * 3 + k) % ICON_COUNT, 8 + k * 40, 40);
+    return (uint32_t)absolute_time_diff_us(t0, get_absolute_time());
+}
+
+/**
+ * @brief Icon draw cost with and without the decoded asset cache
+ *
+ * Screens of four run-length encoded 32x32 paletted icons, drawn decoding
+ * on every draw, from a warm cache, and paging through more icons than the
+ * cache holds with and without core 1 decoding the next screen ahead.
+ */
+void benchmarkAssets()
+{
+    const int screens = 24;
+    uint32_t us;
+
+    buildIcons();
+    GFX_setAssetCacheBudget(8 * (sizeof(iconPalette) + ICON_SIZE * ICON_SIZE));
+    GFX_assetSetTable(iconAssets, ICON_COUNT);
+    if (GFX_assetGet(0) == NULL)
+    {
+        printf("Assets: no arena room, skipped\n");
+        return;
+    }
+    GFX_fillScreen(ST77XX_BLACK);
+
+    us = 0;
+    for (int s = 0; s < screens; s++)
+    {
+        GFX_releaseAssetCache(); // Decode on every draw
+        us += drawIconScreen(0);
+    }
+    printf("Assets decoded per draw: %lu us/screen\n", (unsigned long)(us / screens));
+
+    us = 0;
+    for (int s = 0; s < screens; s++)
+        us += drawIconScreen(0);
+    printf("Assets cached:           %lu us/screen\n", (unsigned long)(us / screens));
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+            multicore_launch_core1(GFX_assetPrefetchLoop);
+        GFX_releaseAssetCache();
+        GFX_resetAssetStats();
+        us = 0;
+        for (int s = 0; s < screens; s++)
+        {
+            us += drawIconScreen(s);
+            GFX_flush();
+            if (pass == 1)
+            {
+                uint16_t next[4];
+                for (int k = 0; k < 4; k++)
+                    next[k] = ((s + 1) * 3 + k) % ICON_COUNT;
+                GFX_assetPrefetch(next, 4);
+            }
+            sleep_ms(5); // The rest of the frame
+        }
+        GFXassetStats st;
+        GFX_getAssetStats(&st);
+        printf("Assets paging%s: %lu us/screen, %lu hits, %lu misses, %lu prefetched, %lu evicted, %u bytes\n",
+               pass ? " + core 1" : "", (unsigned long)(us / screens), (unsigned long)st.hits,
+               (unsigned long)st.misses, (unsigned long)st.prefetches, (unsigned long)st.evictions,
+               (unsigned)GFX_assetCacheUsed());
+    }
+
+    // Stop the prefetcher once it is idle and give the pool back
+    GFX_setAssetCacheBudget(GFX_ASSET_RAM_BUDGET);
+    GFX_releaseAssetCache();
+    multicore_reset_core1();
+}
+
+// Fake spectrum: a peak wandering across 128 bins over a noise floor
+static void fakeSpectrum(uint8_t *mags, int n)
+{
+    int peak = (n * 3) % 128;
+    for (int i = 0; i < 128; i++)
+    {
+        int d = i > peak ? i - peak : peak - i;
+        int v = 255 - d * 12 + (int)(rand() & 31);
+        mags[i] = v < 0 ? rand() & 31 : v > 255 ? 255 : v;
+    }
+}
+
+/**
+ * @brief Waterfall rows per second: per-pixel drawing against the widget
+ *
+ * Adds rows of a fake 128-bin spectrum three ways: GFX_drawPixel() per
+ * cell after GFX_scrollUp() and a full flush, the widget over the full
+ * screen width (panel scroll band) and the widget in a narrower region.
+ */
+void benchmarkWaterfall()
+{
+    static const char *const names[3] = {"drawPixel + scroll", "widget full width", "widget 120 px"};
+    static const uint16_t stops[5] = {ST77XX_BLACK, ST77XX_BLUE, ST77XX_RED, ST77XX_YELLOW, ST77XX_WHITE};
+    static uint16_t heat[256];
+    const int rows = 60;
+    uint8_t mags[128];
+
+    GFX_waterfallGradient(heat, stops, 5);
+    for (int mode = 0; mode < 3; mode++)
+    {
+        GFXwaterfall wf;
+        GFX_fillScreen(ST77XX_BLACK);
+        GFX_flush();
+        if (mode && !GFX_waterfallInit(&wf, mode == 1 ? 0 : 26, 40, mode == 1 ? lcd_width : 120, 240, heat,
+                                       GFX_WATERFALL_DOWN))
+        {
+            printf("Waterfall %s: no room, skipped\n", names[mode]);
+            continue;
+        }
+        GFX_resetWaterfallStats();
+        GFX_resetFlushStats();
+
+        int64_t us = 0;
+        for (int n = 0; n < rows; n++)
+        {
+            fakeSpectrum(mags, n);
+            absolute_time_t t0 = get_absolute_time();
+            if (mode == 0)
+            {
+                GFX_scrollUp(1);
+                for (int x = 0; x < lcd_width; x++)
+                    GFX_drawPixel(x, lcd_height - 1, heat[mags[x * 128 / lcd_width]]);
+                GFX_flush();
+            }
+            else
+                GFX_waterfallPush(&wf, mags, 128);
+            us += absolute_time_diff_us(t0, get_absolute_time());
+        }
+
+        GFXwaterfallStats st;
+        GFX_getWaterfallStats(&st);
+        GFXflushStats fl;
+        GFX_getFlushStats(&fl);
+        uint32_t bytes = mode ? st.bytes / rows : fl.rowsSent * lcd_width * 2 / rows;
+        printf("Waterfall %-18s: %lu rows/s, %lu us/row, %lu bytes/row\n", names[mode],
+               (unsigned long)(rows * 1000000LL / (us ? us : 1)), (unsigned long)(us / rows), (unsigned long)bytes);
+    }
+    LCD_scrollRows(0); // Give the panel its normal row order back
+    GFX_fillScreen(ST77XX_BLACK);
+    GFX_invalidatePanel();
+    GFX_flush();
+}
+
+/**
+ * @brief Clipping cost: span-clipped fills against a stencil test per pixel
+ *
+ * Builds the rounded-corner stencil for the panel and fills the screen
+ * through it with GFX_fillRect() (a few compares per row) and with
+ * GFX_drawPixel() on every pixel (one stencil test each), then draws a
+ * full-bleed screen whose bars run into the corners.
+ */
+void benchmarkStencil()
+{
+    const int frames = 10;
+    size_t mark = GFX_arenaMark();
+    GFXstencil corners;
+    if (!GFX_stencilRoundedRect(&corners, lcd_width, lcd_height, PANEL_CORNER_RADIUS))
+    {
+        printf("Stencil: no arena room, skipped\n");
+        return;
+    }
+    GFX_setStencil(&corners);
+
+    int64_t spanUs = 0, pixelUs = 0;
+    for (int n = 0; n < frames; n++)
+    {
+        uint16_t color = n & 1 ? ST77XX_BLUE : ST77XX_RED;
+        absolute_time_t t0 = get_absolute_time();
+        GFX_fillRect(0, 0, lcd_width, lcd_height, color);
+        absolute_time_t t1 = get_absolute_time();
+        for (int y = 0; y < lcd_height; y++)
+            for (int x = 0; x < lcd_width; x++)
+                GFX_drawPixel(x, y, color);
+        spanUs += absolute_time_diff_us(t0, t1);
+        pixelUs += absolute_time_diff_us(t1, get_absolute_time());
+    }
+    printf("Stencil fill: %lu us with spans, %lu us per pixel, %u spans in %u bytes\n",
+           (unsigned long)(spanUs / frames), (unsigned long)(pixelUs / frames), (unsigned)corners.count,
+           (unsigned)GFX_stencilMemory(&corners));
+
+    // Full bleed: header and footer bars reach the glass edge
+    GFX_fillScreen(ST77XX_BLACK);
+    GFX_fillRect(0, 0, lcd_width, 48, ST77XX_BLUE);
+    GFX_fillRect(0, lcd_height - 48, lcd_width, 48, ST77XX_BLUE);
+    GFX_flush();
+
+    GFX_setStencil(NULL);
+    GFX_arenaRelease(mark);
+    GFX_fillScreen(ST77XX_BLACK);
+    GFX_flush();
+}
+
 int main()
 {
     stdio_init_all();
@@ -483,10 +1536,43 @@ int main()
     LCD_setRotation(0); // ← Try 0 instead of 2
     printf("Display rotation set to 0 degrees\n");
 
-    printf("Creating framebuffer...\n");
-    // Allocate framebuffer memory for graphics operations
-    GFX_createFramebuf();
-    printf("Framebuffer created successfully\n");
+    // Panel readback, if the board has a read path (see lib/hardware.h)
+    LCD_setReadMode(OLED_READ_MODE, OLED_MISO_PIN);
+
+    printf("Configuring rendering...\n");
+    // Framebuffer if it fits the display arena, glyph caches with the rest;
+    // without room for a framebuffer drawing goes straight to the panel
+    if (!GFX_configure(GFX_ARENA_SIZE, 0))
+        printf("Some display buffers could not be allocated\n");
+    GFX_memoryReport();
+
+    // Only send rows that changed since the previous flush
+    GFX_setAutoDamage(true);
+
+#if RUN_BENCHMARKS
+    printf("\n=== Rendering Benchmarks ===\n");
+    benchmarkTextXip();
+    benchmarkAffine();
+    benchmarkTilemap();
+    benchmarkTextbox();
+    benchmarkOutlineFont();
+    benchmarkLines();
+    benchmarkCurves();
+    benchmarkReadback();
+    benchmarkPioFlush();
+    benchmarkFlushQueue();
+    benchmarkStream();
+    benchmarkOverdraw();
+    benchmarkConfigPlans();
+    benchmarkQuality();
+    benchmarkTransitions();
+    benchmarkAAFont();
+    benchmarkSegments();
+    benchmarkAssets();
+    benchmarkWaterfall();
+    benchmarkStencil();
+    printf("================================\n\n");
+#endif
 
     printf("\n╔═══════════════════════════════════════════════════╗\n");
     printf("║  ST7789P3 Safe Zone Tests - 172x320 Rounded Display  ║\n");
@@ -546,7 +1632,7 @@ int main()
             GFX_setCursor(20, 50);
             GFX_printf("20px safe");
 
-            GFX_flush();
+            timedFlush();
             break;
         }
 
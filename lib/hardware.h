@@ -25,4 +25,11 @@ OLED_SCK on GPIO 10
 #define OLED_SCK_PIN 10
 #define OLED_SPI_PORT spi1
 
+// Panel readback (RAMRD). This PCB has no read path, so the driver stays
+// write-only. Use LCD_READ_3WIRE if SDA reaches the panel as a plain
+// bidirectional line, or LCD_READ_4WIRE with OLED_MISO_PIN set if the panel's
+// SDO is wired to an SPI1 RX pin.
+#define OLED_READ_MODE LCD_READ_NONE
+#define OLED_MISO_PIN -1
+
 // BL pin is connected to 3.3V directly on the PCB
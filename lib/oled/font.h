@@ -2,7 +2,18 @@
 #ifndef FONT_H
 #define FONT_H
 
-static const unsigned char font[] = {
+#include "pico/stdlib.h"
+
+// The classic font is read a byte at a time for every character, so by default
+// it is placed in SRAM (copied at boot) instead of being fetched through the
+// XIP cache. Define GFX_CLASSIC_FONT_IN_FLASH to save the 1.3 KB of SRAM.
+#ifdef GFX_CLASSIC_FONT_IN_FLASH
+#define GFX_FONT_PLACEMENT
+#else
+#define GFX_FONT_PLACEMENT __not_in_flash("gfx_font")
+#endif
+
+static const unsigned char GFX_FONT_PLACEMENT font[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x5B, 0x4F, 0x5B, 0x3E, 0x3E, 0x6B,
     0x4F, 0x6B, 0x3E, 0x1C, 0x3E, 0x7C, 0x3E, 0x1C, 0x18, 0x3C, 0x7E, 0x3C,
     0x18, 0x1C, 0x57, 0x7D, 0x57, 0x1C, 0x1C, 0x5E, 0x7F, 0x5E, 0x1C, 0x00,
@@ -0,0 +1,152 @@
+// SRAM font cache - keeps glyph data out of XIP flash on the text path
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Fonts are copied into the display arena (charged to GFX_MEM_GLYPHS, capped
+// at GFX_FONT_RAM_BUDGET unless GFX_setFontCacheBudget() changes it). Slots
+// map the original (flash) font pointer to its SRAM copy so callers keep
+// using the const font symbols they already have. Each slot remembers the
+// arena generation of its copy. A copy released with the arena (mode switch)
+// drops its slot and is re-copied on demand; copies below the release mark,
+// e.g. under a re-created framebuffer, are kept.
+
+#include <string.h>
+#include "fontcache.h"
+#include "gfxarena.h"
+
+extern GFXfont *gfxFont; // Font GFX_drawChar() renders with (gfx.cpp)
+
+typedef struct
+{
+    const GFXfont *src;  ///< Font as given by the caller
+    GFXfont ram;         ///< Copy whose bitmap/glyph pointers point into the pool
+    size_t bytes;        ///< Arena bytes held by the copy
+    uint32_t generation; ///< Arena generation the copy was allocated in
+} FontSlot;
+
+static size_t fontPoolUsed = 0;
+static size_t fontBudget = GFX_FONT_RAM_BUDGET;
+static FontSlot fontSlots[GFX_FONT_RAM_SLOTS];
+static uint8_t fontSlotCount = 0;
+static bool fontAutoCache = false;
+
+// Bitmap data is not stored with a length, so derive it from the glyph table
+static size_t fontBitmapSize(const GFXfont *f)
+{
+    size_t end = 0;
+    uint8_t bpp = f->bpp > 1 ? f->bpp : 1;
+    for (uint16_t i = 0; i <= f->last - f->first; i++)
+    {
+        const GFXglyph *g = &f->glyph[i];
+        size_t e = g->bitmapOffset + ((size_t)g->width * g->height * bpp + 7) / 8;
+        if (e > end)
+            end = e;
+    }
+    return end;
+}
+
+// Forget cached fonts whose arena memory has been released. Slots are
+// compacted, so gfxFont follows its slot or falls back to the flash font.
+static void fontCheckArena()
+{
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < fontSlotCount; i++)
+    {
+        FontSlot *s = &fontSlots[i];
+        if (!GFX_arenaHolds(s->ram.glyph, s->generation))
+        {
+            if (gfxFont == &s->ram)
+                gfxFont = (GFXfont *)s->src;
+            fontPoolUsed -= s->bytes;
+            continue;
+        }
+        if (kept != i)
+        {
+            fontSlots[kept] = *s;
+            if (gfxFont == &s->ram)
+                gfxFont = &fontSlots[kept].ram;
+        }
+        kept++;
+    }
+    fontSlotCount = kept;
+}
+
+bool GFX_cacheFontInRam(const GFXfont *f)
+{
+    if (f == NULL)
+        return false;
+    fontCheckArena();
+    for (uint8_t i = 0; i < fontSlotCount; i++)
+        if (fontSlots[i].src == f)
+            return true;
+    if (fontSlotCount == GFX_FONT_RAM_SLOTS)
+        return false;
+
+    size_t glyphBytes = (size_t)(f->last - f->first + 1) * sizeof(GFXglyph);
+    size_t bitmapBytes = fontBitmapSize(f);
+    if (fontPoolUsed + glyphBytes + bitmapBytes > fontBudget)
+        return false;
+
+    // Arena allocations are 4-byte aligned, and glyphBytes is even, which is
+    // all GFXglyph's 16-bit members need
+    uint8_t *mem = (uint8_t *)GFX_arenaAlloc(glyphBytes + bitmapBytes, GFX_MEM_GLYPHS);
+    if (mem == NULL)
+        return false;
+
+    memcpy(mem, f->glyph, glyphBytes);
+    memcpy(mem + glyphBytes, f->bitmap, bitmapBytes);
+    fontPoolUsed += glyphBytes + bitmapBytes;
+
+    FontSlot *s = &fontSlots[fontSlotCount++];
+    s->src = f;
+    s->ram = *f;
+    s->ram.glyph = (GFXglyph *)mem;
+    s->ram.bitmap = mem + glyphBytes;
+    s->bytes = glyphBytes + bitmapBytes;
+    s->generation = GFX_arenaGeneration();
+    return true;
+}
+
+void GFX_setFontAutoCache(bool enable)
+{
+    fontAutoCache = enable;
+}
+
+void GFX_releaseFontCache()
+{
+    // The arena memory itself is returned by whoever releases the arena.
+    // Text keeps rendering from the flash font if its copy is dropped.
+    for (uint8_t i = 0; i < fontSlotCount; i++)
+        if (gfxFont == &fontSlots[i].ram)
+            gfxFont = (GFXfont *)fontSlots[i].src;
+    fontSlotCount = 0;
+    fontPoolUsed = 0;
+}
+
+const GFXfont *GFX_fontRamLookup(const GFXfont *f)
+{
+    if (f == NULL)
+        return NULL;
+    fontCheckArena();
+    for (uint8_t i = 0; i < fontSlotCount; i++)
+        if (fontSlots[i].src == f)
+            return &fontSlots[i].ram;
+    if (fontAutoCache && GFX_cacheFontInRam(f))
+        return &fontSlots[fontSlotCount - 1].ram;
+    return f;
+}
+
+size_t GFX_fontCacheUsed()
+{
+    return fontPoolUsed;
+}
+
+void GFX_setFontCacheBudget(size_t bytes)
+{
+    // Fonts already copied stay; the new limit applies to the next one
+    fontBudget = bytes;
+}
+
+size_t GFX_fontCacheBudget()
+{
+    return fontBudget;
+}
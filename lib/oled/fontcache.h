@@ -0,0 +1,74 @@
+/**
+ * @file fontcache.h
+ * @brief SRAM copies of GFXfont data to keep text rendering out of XIP flash
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Glyph bitmaps and glyph tables are read with scattered byte accesses, which
+ * miss the 16 KB XIP cache once the application code is large. Fonts can be
+ * copied into the display arena up to a fixed budget, either explicitly or
+ * automatically when they are selected with GFX_setFont(). The copy is used
+ * transparently.
+ */
+
+#ifndef FONTCACHE_H
+#define FONTCACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gfxfont.h"
+
+/** @brief Default maximum display arena bytes used by cached fonts */
+#ifndef GFX_FONT_RAM_BUDGET
+#define GFX_FONT_RAM_BUDGET 8192
+#endif
+
+/** @brief Maximum number of fonts held in SRAM at once */
+#ifndef GFX_FONT_RAM_SLOTS
+#define GFX_FONT_RAM_SLOTS 4
+#endif
+
+/**
+ * @brief Copy a font's bitmap and glyph table into SRAM
+ * @param f Font to cache (normally a const font in flash)
+ * @return true if the font is now cached, false if it does not fit the budget
+ */
+bool GFX_cacheFontInRam(const GFXfont *f);
+
+/**
+ * @brief Copy fonts into SRAM automatically when GFX_setFont() selects them
+ * @param enable true to cache on demand (subject to the budget)
+ */
+void GFX_setFontAutoCache(bool enable);
+
+/**
+ * @brief Drop all cached fonts and reset the budget
+ * @note The arena memory is only reclaimed when the arena is released past it;
+ *       the cache also drops a copy by itself when that happens
+ */
+void GFX_releaseFontCache();
+
+/**
+ * @brief Find the SRAM copy of a font
+ * @param f Font as passed to GFX_setFont()
+ * @return SRAM copy if cached (caching it first in auto mode), otherwise f
+ */
+const GFXfont *GFX_fontRamLookup(const GFXfont *f);
+
+/**
+ * @brief Bytes of the SRAM font budget currently in use
+ */
+size_t GFX_fontCacheUsed();
+
+/**
+ * @brief Change the SRAM font budget at run time (GFX_configure() does this)
+ * @param bytes New limit; fonts already cached are kept even if over it
+ */
+void GFX_setFontCacheBudget(size_t bytes);
+
+/**
+ * @brief Current SRAM font budget
+ */
+size_t GFX_fontCacheBudget();
+
+#endif
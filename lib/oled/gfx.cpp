@@ -4,13 +4,24 @@
 
 #include <cstring> // Include cstring for strlen and vsprintf
 #include "font.h"
+#include "gfx.h"
 #include "gfxfont.h"
+#include "gfxaafont.h"
 #include "pico/stdlib.h"
 #include "hardware/dma.h"
 #include "st7789.h"
+#include "pixcache.h"
+#include "readcache.h"
+#include "lcdqueue.h"
+#include "lcdstream.h"
+#include "gfxdefer.h"
+#include "fontcache.h"
+#include "gfxarena.h"
+#include "gfxstencil.h"
 
 // Forward function declarations
 void GFX_fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void initGfxDmaChan();
 
 #ifndef swap
 #define swap(a, b)     \
@@ -30,6 +41,35 @@ static bool gfx_dma_init = false;
 uint16_t *gfxFramebuffer = NULL;
 static bool gfxFbUpdated = false;
 
+// Lazy clear: GFX_fillScreen()/GFX_clearScreen() only record the colour and
+// mark every row untouched. A row is filled with the clear colour the first
+// time something draws into it; GFX_flush() streams untouched rows as constant
+// colour without reading the framebuffer.
+#define GFX_MAX_ROWS 320
+static uint8_t gfxRowTouched[(GFX_MAX_ROWS + 7) / 8];
+static uint16_t gfxLazyColour = 0x0000;
+
+// Ring-buffer scrolling: logical row 0 lives in physical row gfxRowOrigin, so
+// GFX_scrollUp() only moves the origin and clears the exposed rows. The
+// coverage bitmap is indexed by physical row, everything else by logical row.
+static int16_t gfxRowOrigin = 0;
+
+// Automatic damage detection: GFX_flush() hashes every row and only sends the
+// rows whose hash differs from what was last sent
+static bool gfxAutoDamage = false;
+static bool gfxFlushQueued = false; // GFX_flush() hands rows to the background queue
+static bool gfxHashValid = false;
+static uint32_t gfxRowHash[GFX_MAX_ROWS];
+static GFXflushStats gfxFlushStats = {0, 0, 0, 0};
+
+static size_t gfxFbMark = 0; // Arena mark taken before the framebuffer
+
+// Flush-time brightness: pixels are scaled per channel through small LUTs on
+// their way to the panel, leaving the framebuffer untouched
+static uint8_t gfxBrightness = GFX_BRIGHTNESS_FULL;
+static uint8_t gfxLut5[32], gfxLut6[64];
+static uint16_t gfxDimRow[GFX_MAX_ROWS]; // Rows are at most 320 pixels in any rotation
+
 extern uint16_t _width;  ///< Display width as modified by current rotation
 extern uint16_t _height; ///< Display height as modified by current rotation
 
@@ -43,6 +83,7 @@ uint16_t clearColour = GFX_BLACK;
 uint8_t wrap = 1;
 
 GFXfont *gfxFont = NULL;
+static const GFXfont *gfxFontSrc = NULL; // Font as passed in, before SRAM lookup
 
 uint GFX_getWidth()
 {
@@ -59,27 +100,181 @@ void GFX_setClearColor(uint16_t color)
     clearColour = color;
 }
 
-void GFX_clearScreen()
+static inline int16_t gfxPhysRow(int16_t y)
 {
-    GFX_fillRect(0, 0, _width, _height, clearColour);
+    int16_t p = y + gfxRowOrigin;
+    return p >= _height ? p - _height : p;
+}
+
+static inline bool gfxIsRowTouched(int16_t y)
+{
+    int16_t p = gfxPhysRow(y);
+    return gfxRowTouched[p >> 3] & (1 << (p & 7));
+}
+
+uint16_t *__time_critical_func(GFX_getRow)(int16_t y)
+{
+    if (gfxDeferActive)
+        GFX_deferResolve(); // Recorded entries go under whatever the caller draws
+    int16_t p = gfxPhysRow(y);
+    uint16_t *row = gfxFramebuffer + p * _width;
+    if (!(gfxRowTouched[p >> 3] & (1 << (p & 7))))
+    {
+        // First touch since the last clear: materialise the clear colour
+        for (uint16_t i = 0; i < _width; i++)
+            row[i] = gfxLazyColour;
+        gfxRowTouched[p >> 3] |= 1 << (p & 7);
+    }
+    gfxFbUpdated = true;
+    return row;
+}
+
+// In-place reversal of n pixels, used to rotate the ring back to linear order
+static void gfxReverse(uint16_t *a, size_t n)
+{
+    for (size_t i = 0, j = n - 1; i < j; i++, j--)
+    {
+        uint16_t t = a[i];
+        a[i] = a[j];
+        a[j] = t;
+    }
+}
+
+void GFX_resolveClear()
+{
+    if (gfxDeferActive)
+        GFX_deferResolve();
+    if (gfxFramebuffer == NULL)
+        return;
+    for (int16_t y = 0; y < _height; y++)
+        GFX_getRow(y);
+
+    if (gfxRowOrigin)
+    {
+        // Rotate the ring left by gfxRowOrigin rows (three reversals, no
+        // extra buffer). Every row is touched now, so the bitmap stays valid.
+        size_t split = (size_t)gfxRowOrigin * _width;
+        size_t total = (size_t)_height * _width;
+        gfxReverse(gfxFramebuffer, split);
+        gfxReverse(gfxFramebuffer + split, total - split);
+        gfxReverse(gfxFramebuffer, total);
+        gfxRowOrigin = 0;
+    }
 }
 
 void GFX_fillScreen(uint16_t color)
 {
-    GFX_fillRect(0, 0, _width, _height, color);
+    if (gfxDeferActive)
+    {
+        GFX_deferFill(0, 0, _width, _height, color);
+        return;
+    }
+    if (gfxFramebuffer != NULL)
+    {
+        gfxLazyColour = color;
+        memset(gfxRowTouched, 0, sizeof(gfxRowTouched));
+        gfxFbUpdated = true;
+    }
+    else
+    {
+        LCD_cacheFlush();
+        LCD_FillWindow(0, 0, _width, _height, color);
+    }
+}
+
+void GFX_clearScreen()
+{
+    GFX_fillScreen(clearColour);
 }
 
-void GFX_drawPixel(int16_t x, int16_t y, uint16_t color)
+void __time_critical_func(GFX_drawPixel)(int16_t x, int16_t y, uint16_t color)
 {
+    if (gfxDeferActive)
+        GFX_deferResolve();
     if (gfxFramebuffer != NULL)
     {
-        if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+        if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height) || !GFX_stencilTest(x, y))
+            return;
+        GFX_getRow(y)[x] = color; //(color >> 8) | (color << 8);
+        gfxFbUpdated = true;
+    }
+    else
+    {
+        if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height) || !GFX_stencilTest(x, y))
             return;
-        gfxFramebuffer[x + y * _width] = color; //(color >> 8) | (color << 8);
+        // Direct mode: merge runs into window writes instead of LCD_WritePixel()
+        LCD_cachePixel(x, y, color);
+    }
+}
+
+void GFX_blendPixel(int16_t x, int16_t y, uint16_t color, uint8_t alpha, uint16_t bg)
+{
+    if (alpha == 0 || (x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+        return;
+    if (gfxDeferActive)
+        GFX_deferResolve(); // bg is read below
+    if (alpha < 32)
+    {
+        if (gfxFramebuffer)
+            bg = GFX_getRow(y)[x];
+        else if (LCD_canRead())
+            bg = LCD_readPixelCached(x, y);
+        color = GFX_blend565(color, bg, alpha);
+    }
+    GFX_drawPixel(x, y, color);
+}
+
+// Fill pixels x0 to x1 of row y, clipped to the screen only
+static void gfxFillSpan(int16_t x0, int16_t x1, int16_t y, uint16_t color)
+{
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 >= _width)
+        x1 = _width - 1;
+    if (x0 > x1)
+        return;
+
+    if (gfxFramebuffer != NULL)
+    {
+        uint16_t *row = GFX_getRow(y);
+        for (int16_t x = x0; x <= x1; x++)
+            row[x] = color;
         gfxFbUpdated = true;
     }
+    else if (x1 - x0 >= 8)
+    {
+        // Long spans go out as one window fill, after any queued pixels
+        LCD_cacheFlush();
+        LCD_FillWindow(x0, y, x1 - x0 + 1, 1, color);
+    }
     else
-        LCD_WritePixel(x, y, color);
+    {
+        for (int16_t x = x0; x <= x1; x++)
+            LCD_cachePixel(x, y, color);
+    }
+}
+
+void GFX_drawSpan(int16_t x0, int16_t x1, int16_t y, uint16_t color)
+{
+    if (gfxDeferActive)
+        GFX_deferResolve();
+    if (y < 0 || y >= _height)
+        return;
+    if (gfxStencil == NULL)
+    {
+        gfxFillSpan(x0, x1, y, color);
+        return;
+    }
+    // Intersect with the row's visible spans
+    uint16_t count;
+    const GFXspan *sp = GFX_stencilRow(y, &count);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        int16_t lo = sp[i].x0 > x0 ? sp[i].x0 : x0;
+        int16_t hi = sp[i].x1 < x1 ? sp[i].x1 : x1;
+        if (lo <= hi)
+            gfxFillSpan(lo, hi, y, color);
+    }
 }
 
 void GFX_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
@@ -135,16 +330,44 @@ void GFX_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color
 
 void GFX_drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
+    if (gfxDeferActive && h > 0)
+    {
+        GFX_deferFill(x, y, 1, h, color);
+        return;
+    }
     GFX_drawLine(x, y, x, y + h - 1, color);
 }
 
 void GFX_drawFastHLine(int16_t x, int16_t y, int16_t l, uint16_t color)
 {
+    if (gfxDeferActive && l > 0)
+    {
+        GFX_deferFill(x, y, l, 1, color);
+        return;
+    }
+    if (gfxStencil != NULL && l > 0)
+    {
+        GFX_drawSpan(x, x + l - 1, y, color);
+        return;
+    }
     GFX_drawLine(x, y, x + l - 1, y, color);
 }
 
 void GFX_fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
+    // Empty sizes still draw through GFX_drawLine(); keep that immediate
+    if (gfxDeferActive && w > 0 && h > 0)
+    {
+        GFX_deferFill(x, y, w, h, color);
+        return;
+    }
+    if (gfxStencil != NULL && w > 0 && h > 0)
+    {
+        // Clip each row against its spans rather than testing every pixel
+        for (int16_t j = y; j < y + h; j++)
+            GFX_drawSpan(x, x + w - 1, j, color);
+        return;
+    }
     for (int16_t i = x; i < x + w; i++)
     {
         GFX_drawFastVLine(i, y, h, color);
@@ -159,8 +382,8 @@ void GFX_drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
     GFX_drawFastVLine(x + w - 1, y, h, color);
 }
 
-void GFX_drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
-                  uint16_t bg, uint8_t size_x, uint8_t size_y)
+void __time_critical_func(GFX_drawChar)(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                                        uint16_t bg, uint8_t size_x, uint8_t size_y)
 {
     if (!gfxFont)
     {
@@ -169,6 +392,12 @@ void GFX_drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
             ((x + 6 * size_x - 1) < 0) || // Clip left
             ((y + 8 * size_y - 1) < 0))   // Clip top
             return;
+        if (gfxDeferActive)
+        {
+            // With a background the whole 6x8 cell is painted
+            GFX_deferChar(x, y, c, color, bg, size_x, size_y, x, y, 6 * size_x, 8 * size_y, bg != color);
+            return;
+        }
 
         if (c >= 176)
             c++; // Handle 'classic' charset behavior
@@ -223,6 +452,20 @@ void GFX_drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
             xo16 = xo;
             yo16 = yo;
         }
+        bool aa = gfxFont->bpp > 1;
+        if (gfxDeferActive)
+        {
+            // Set bits only, so never opaque; anti-aliased glyphs with a
+            // background paint their whole box
+            GFX_deferChar(x, y, c + (uint8_t)gfxFont->first, color, bg, size_x, size_y, x + xo * size_x,
+                          y + yo * size_y, w * size_x, h * size_y, aa && bg != color);
+            return;
+        }
+        if (aa)
+        {
+            GFX_drawCharAA(x, y, gfxFont, glyph, color, bg, size_x, size_y);
+            return;
+        }
 
         // GFX_Select();
         for (yy = 0; yy < h; yy++)
@@ -338,7 +581,14 @@ void GFX_setFont(const GFXfont *f)
         // Move cursor pos up 6 pixels so it's at top-left of char.
         cursor_y -= 6;
     }
-    gfxFont = (GFXfont *)f;
+    // Render from the SRAM copy if the font is (or can be) cached
+    gfxFontSrc = f;
+    gfxFont = (GFXfont *)GFX_fontRamLookup(f);
+}
+
+const GFXfont *GFX_getFont()
+{
+    return gfxFontSrc;
 }
 
 void fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
@@ -451,31 +701,307 @@ void GFX_printf(const char *format, ...)
     va_end(args);
 }
 
-void GFX_createFramebuf()
+bool GFX_createFramebuf()
 {
-    // fixed casting issue
-    void *some_void_pointer = malloc(_width * _height * sizeof(uint16_t));
+    LCD_cacheFlush(); // Don't leave direct-mode pixels behind
+    if (gfxFramebuffer != NULL)
+        GFX_destroyFramebuf(); // e.g. re-created after a rotation change
+
+    // Static display arena instead of malloc(): no heap fragmentation across
+    // mode switches, and failure is reported instead of dereferenced
+    gfxFbMark = GFX_arenaMark();
+    void *some_void_pointer = GFX_arenaAlloc((size_t)_width * _height * sizeof(uint16_t), GFX_MEM_FRAMEBUFFER);
+    if (some_void_pointer == NULL)
+        return false;
 
     gfxFramebuffer = static_cast<uint16_t *>(some_void_pointer);
+    GFX_arenaSetFloor(GFX_arenaMark()); // Releases elsewhere stop above it
+
+    // Fresh buffer starts as a pending clear to black instead of stale RAM
+    gfxLazyColour = GFX_BLACK;
+    memset(gfxRowTouched, 0, sizeof(gfxRowTouched));
+    gfxRowOrigin = 0;
+    gfxHashValid = false;
+    return true;
 }
 void GFX_destroyFramebuf()
 {
-    free(gfxFramebuffer);
+    if (gfxFramebuffer == NULL)
+        return;
+    LCD_queueWait(); // The queue may still be reading rows
+    GFX_arenaSetFloor(0);
+    GFX_arenaRelease(gfxFbMark); // O(1); also frees anything allocated after it
     gfxFramebuffer = NULL;
+    GFX_stencilCheckArena(); // A stencil built after the framebuffer went with it
+
+    // The SRAM font copy may have gone with it
+    gfxFont = (GFXfont *)GFX_fontRamLookup(gfxFontSrc);
+}
+
+// Drawing target saved while a canvas is active
+typedef struct
+{
+    uint16_t *framebuffer;
+    uint16_t width, height;
+    uint8_t rowTouched[sizeof(gfxRowTouched)];
+    uint16_t lazyColour;
+    int16_t rowOrigin;
+    bool fbUpdated;
+    bool deferActive;
+    const GFXstencil *stencil;
+} GFXtarget;
+
+static GFXtarget gfxSaved;
+static bool gfxInCanvas = false;
+
+bool GFX_beginCanvas(uint16_t *pixels, uint16_t w, uint16_t h)
+{
+    if (gfxInCanvas || pixels == NULL || w == 0 || h == 0 || h > GFX_MAX_ROWS)
+        return false;
+    if (gfxDeferActive)
+        GFX_deferResolve(); // Recorded entries belong to the screen
+
+    gfxSaved.framebuffer = gfxFramebuffer;
+    gfxSaved.width = _width;
+    gfxSaved.height = _height;
+    memcpy(gfxSaved.rowTouched, gfxRowTouched, sizeof(gfxRowTouched));
+    gfxSaved.lazyColour = gfxLazyColour;
+    gfxSaved.rowOrigin = gfxRowOrigin;
+    gfxSaved.fbUpdated = gfxFbUpdated;
+    gfxSaved.deferActive = gfxDeferActive;
+    gfxSaved.stencil = gfxStencil;
+
+    // The canvas is a plain linear image whose rows all hold real pixels
+    gfxFramebuffer = pixels;
+    _width = w;
+    _height = h;
+    memset(gfxRowTouched, 0xFF, sizeof(gfxRowTouched));
+    gfxRowOrigin = 0;
+    gfxDeferActive = false;
+    gfxStencil = NULL; // The stencil is in screen coordinates
+    gfxInCanvas = true;
+    return true;
+}
+
+void GFX_endCanvas()
+{
+    if (!gfxInCanvas)
+        return;
+    // A fillScreen() on the canvas is still pending in its untouched rows
+    for (int16_t y = 0; y < _height; y++)
+        if (!gfxIsRowTouched(y))
+            for (uint16_t x = 0; x < _width; x++)
+                gfxFramebuffer[y * _width + x] = gfxLazyColour;
+
+    gfxFramebuffer = gfxSaved.framebuffer;
+    _width = gfxSaved.width;
+    _height = gfxSaved.height;
+    memcpy(gfxRowTouched, gfxSaved.rowTouched, sizeof(gfxRowTouched));
+    gfxLazyColour = gfxSaved.lazyColour;
+    gfxRowOrigin = gfxSaved.rowOrigin;
+    gfxFbUpdated = gfxSaved.fbUpdated;
+    gfxDeferActive = gfxSaved.deferActive;
+    gfxStencil = gfxSaved.stencil;
+    gfxInCanvas = false;
+}
+
+// One pixel through the brightness LUTs
+static inline uint16_t gfxDim(uint16_t c)
+{
+    return (gfxLut5[c >> 11] << 11) | (gfxLut6[(c >> 5) & 63] << 5) | gfxLut5[c & 31];
+}
+
+// Dimmed rows go out through one streamed window, converted a row at a time
+static void gfxSendDimmed(int16_t y0, int16_t y1, bool touched)
+{
+    if (!touched)
+    {
+        LCD_FillWindow(0, y0, _width, y1 - y0, gfxDim(gfxLazyColour));
+        return;
+    }
+    LCD_beginWrite(0, y0, _width, y1 - y0);
+    for (int16_t y = y0; y < y1; y++)
+    {
+        const uint16_t *src = gfxFramebuffer + gfxPhysRow(y) * _width;
+        for (uint16_t x = 0; x < _width; x++)
+            gfxDimRow[x] = gfxDim(src[x]);
+        LCD_pushPixels(gfxDimRow, _width);
+    }
+    LCD_endWrite();
+}
+
+// Send rows [y0, y1): drawn rows from the framebuffer, untouched rows as a
+// constant-colour fill
+static void gfxSendRows(int16_t y0, int16_t y1)
+{
+    int16_t y = y0;
+    while (y < y1)
+    {
+        bool touched = gfxIsRowTouched(y);
+        int16_t yn = y + 1;
+        // Drawn runs also stop at the ring wrap point, where the physical
+        // rows stop being contiguous
+        while (yn < y1 && gfxIsRowTouched(yn) == touched && !(touched && gfxPhysRow(yn) == 0))
+            yn++;
+        if (gfxBrightness != GFX_BRIGHTNESS_FULL)
+            gfxSendDimmed(y, yn, touched);
+        else if (gfxFlushQueued)
+        {
+            if (touched)
+                LCD_queueBitmap(0, y, _width, yn - y, gfxFramebuffer + gfxPhysRow(y) * _width, _width);
+            else
+                LCD_queueFill(0, y, _width, yn - y, gfxLazyColour);
+        }
+        else if (touched)
+            LCD_WriteBitmap(0, y, _width, yn - y, gfxFramebuffer + gfxPhysRow(y) * _width);
+        else
+            LCD_FillWindow(0, y, _width, yn - y, gfxLazyColour);
+        y = yn;
+    }
+    gfxFlushStats.rowsSent += y1 - y0;
+}
+
+// Hash one row of pixels; with fill set, a row of _width copies of *row
+static uint32_t __time_critical_func(gfxHashRow)(const uint16_t *row, bool fill)
+{
+#if PICO_NO_HARDWARE
+    // Host builds: FNV-1a over the pixels. Hashes are only ever compared with
+    // hashes from the same build, so it need not match the DMA CRC.
+    uint32_t h = 2166136261u;
+    for (uint16_t i = 0; i < _width; i++)
+    {
+        h ^= fill ? row[0] : row[i];
+        h *= 16777619u;
+    }
+    return h;
+#else
+    // Let the DMA sniffer compute a CRC32 while the channel reads the row
+    // into a dummy word; the CPU only waits for ~_width bus cycles
+    static uint32_t sink;
+    initGfxDmaChan();
+
+    dma_channel_config c = dma_channel_get_default_config(memcpy_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, !fill);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_sniff_enable(&c, true);
+
+    dma_sniffer_enable(memcpy_dma_chan, DMA_SNIFF_CTRL_CALC_VALUE_CRC32, true);
+    dma_sniffer_set_data_accumulator(0xFFFFFFFF);
+    dma_channel_configure(memcpy_dma_chan, &c, &sink, row, _width, true);
+    dma_channel_wait_for_finish_blocking(memcpy_dma_chan);
+    return dma_sniffer_get_data_accumulator();
+#endif
+}
+
+static void gfxFlushChanged()
+{
+    absolute_time_t start = get_absolute_time();
+
+    // Untouched rows all hold the clear colour and share one hash, taken from
+    // the colour itself so they are neither materialised nor read
+    uint32_t clearHash = gfxHashRow(&gfxLazyColour, true);
+
+    // Mark changed rows in place; gfxRowHash[] is updated as we go
+    static uint8_t changed[(GFX_MAX_ROWS + 7) / 8];
+    for (int16_t y = 0; y < _height; y++)
+    {
+        uint32_t h = gfxIsRowTouched(y) ? gfxHashRow(gfxFramebuffer + gfxPhysRow(y) * _width, false) : clearHash;
+        if (!gfxHashValid || h != gfxRowHash[y])
+            changed[y >> 3] |= 1 << (y & 7);
+        else
+            changed[y >> 3] &= ~(1 << (y & 7));
+        gfxRowHash[y] = h;
+    }
+    gfxHashValid = true;
+    gfxFlushStats.rowsHashed += _height;
+    gfxFlushStats.hashUs += absolute_time_diff_us(start, get_absolute_time());
+
+    // Coalesce changed rows into runs
+    int16_t y = 0;
+    while (y < _height)
+    {
+        if (!(changed[y >> 3] & (1 << (y & 7))))
+        {
+            y++;
+            continue;
+        }
+        int16_t yn = y + 1;
+        while (yn < _height && (changed[yn >> 3] & (1 << (yn & 7))))
+            yn++;
+        gfxSendRows(y, yn);
+        y = yn;
+    }
 }
 
 void GFX_flush()
 {
+    if (gfxDeferActive)
+        GFX_deferResolve(); // Frame end: cull and draw the display list
     if (gfxFramebuffer != NULL)
     {
-        LCD_WriteBitmap(0, 0, _width, _height, gfxFramebuffer);
+        if (gfxAutoDamage)
+            gfxFlushChanged();
+        else
+            gfxSendRows(0, _height);
+        gfxFlushStats.flushes++;
         gfxFbUpdated = false;
     }
+    else
+        LCD_cacheFlush(); // Frame end in direct mode
+}
+
+void GFX_setAutoDamage(bool enable)
+{
+    gfxAutoDamage = enable;
+    gfxHashValid = false; // First flush always sends everything
+}
+
+void GFX_invalidatePanel()
+{
+    gfxHashValid = false;
+}
+
+void GFX_setFlushBrightness(uint8_t level)
+{
+    if (level > GFX_BRIGHTNESS_FULL)
+        level = GFX_BRIGHTNESS_FULL;
+    if (level == gfxBrightness)
+        return;
+    gfxBrightness = level;
+    for (uint8_t i = 0; i < 32; i++)
+        gfxLut5[i] = (i * level + 16) >> 5;
+    for (uint8_t i = 0; i < 64; i++)
+        gfxLut6[i] = (i * level + 16) >> 5;
+    GFX_invalidatePanel(); // The panel no longer shows what the hashes describe
+}
+
+void GFX_setFlushQueue(bool enable)
+{
+    if (!enable)
+        LCD_queueWait();
+    gfxFlushQueued = enable;
+}
+
+void GFX_flushQueueWait()
+{
+    LCD_queueWait();
+}
+
+void GFX_getFlushStats(GFXflushStats *stats)
+{
+    *stats = gfxFlushStats;
+}
+
+void GFX_resetFlushStats()
+{
+    memset(&gfxFlushStats, 0, sizeof(gfxFlushStats));
 }
 
 void GFX_Update()
 {
-    if (gfxFbUpdated)
+    // Auto damage mode also catches writes that bypassed gfxFbUpdated
+    if (gfxFbUpdated || gfxFramebuffer == NULL || gfxAutoDamage)
         GFX_flush();
 }
 
@@ -538,17 +1064,123 @@ void dma_memcpy(void *dest, void *src, size_t num)
 
 void GFX_scrollUp(int n)
 {
+    if (gfxDeferActive)
+        GFX_deferResolve();
     if (gfxFramebuffer)
     {
+        if (n <= 0)
+            return;
         if (n > _height)
             n = _height;
-        uint16_t *src = gfxFramebuffer + (_width * n);
-        size_t linesCopy = _width * (_height - n);
-        size_t linesFill = _width * n;
 
-        dma_memcpy(gfxFramebuffer, src, 2 * linesCopy);
-        dma_memset(gfxFramebuffer + linesCopy, 0, 2 * linesFill);
+        // O(1) scroll: old top rows become the exposed bottom rows
+        gfxRowOrigin = gfxPhysRow(n % _height);
+
+        for (int16_t y = _height - n; y < _height; y++)
+        {
+            int16_t p = gfxPhysRow(y);
+            memset(gfxFramebuffer + p * _width, 0, _width * sizeof(uint16_t));
+            gfxRowTouched[p >> 3] |= 1 << (p & 7);
+        }
+        gfxFbUpdated = true;
+    }
+}
+
+bool GFX_copyRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, int16_t dy)
+{
+    static uint16_t copyRow[320]; // One panel row, read back or clipped by the stencil
+
+    if (gfxDeferActive)
+        GFX_deferResolve();
+    if (!gfxFramebuffer && !LCD_canRead())
+        return false;
+
+    // Clip source and destination together
+    if (x < 0)
+    {
+        w += x;
+        dx -= x;
+        x = 0;
+    }
+    if (dx < 0)
+    {
+        w += dx;
+        x -= dx;
+        dx = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        dy -= y;
+        y = 0;
+    }
+    if (dy < 0)
+    {
+        h += dy;
+        y -= dy;
+        dy = 0;
+    }
+    if (x + w > _width)
+        w = _width - x;
+    if (dx + w > _width)
+        w = _width - dx;
+    if (y + h > _height)
+        h = _height - y;
+    if (dy + h > _height)
+        h = _height - dy;
+    if (w <= 0 || h <= 0)
+        return true;
+
+    // Walk rows away from the overlap; memmove (or reading the whole row
+    // first) handles overlap within a row
+    if (!gfxFramebuffer)
+        LCD_cacheFlush();
+    bool clipped = !GFX_stencilBoxVisible(dx, dy, w, h);
+    for (int16_t i = 0; i < h; i++)
+    {
+        int16_t r = dy > y ? h - 1 - i : i;
+        if (clipped)
+        {
+            // Partly hidden destination: the source row is copied out first,
+            // so its spans can be written back even where they overlap it
+            if (gfxFramebuffer)
+            {
+                memcpy(copyRow, GFX_getRow(y + r) + x, w * sizeof(uint16_t));
+                gfxFbUpdated = true;
+            }
+            else
+                LCD_ReadBitmap(x, y + r, w, 1, copyRow);
+            GFX_stencilCopyRow(dx, dy + r, copyRow, w);
+        }
+        else if (gfxFramebuffer)
+        {
+            memmove(GFX_getRow(dy + r) + dx, GFX_getRow(y + r) + x, w * sizeof(uint16_t));
+            gfxFbUpdated = true;
+        }
+        else
+        {
+            LCD_ReadBitmap(x, y + r, w, 1, copyRow);
+            LCD_WriteBitmap(dx, dy + r, w, 1, copyRow);
+        }
+    }
+    return true;
+}
+
+bool GFX_readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *buf)
+{
+    if (gfxDeferActive)
+        GFX_deferResolve();
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > _width || y + h > _height)
+        return false;
+
+    if (gfxFramebuffer)
+    {
+        for (int16_t r = 0; r < h; r++)
+            memcpy(buf + r * w, GFX_getRow(y + r) + x, w * sizeof(uint16_t));
+        return true;
     }
+    LCD_cacheFlush(); // The panel must hold every queued pixel
+    return LCD_ReadBitmap(x, y, w, h, buf);
 }
 
 void GFX_setTextSize(uint8_t size)
@@ -23,18 +23,74 @@
  */
 #define GFX_RGB565(R, G, B) ((uint16_t)(((R) & 0b11111000) << 8) | (((G) & 0b11111100) << 3) | ((B) >> 3))
 
+/**
+ * @brief Blend two RGB565 colors (SWAR: all three channels in one multiply)
+ * @param fg Foreground color
+ * @param bg Background color
+ * @param alpha Foreground weight, 0 (all bg) to 32 (all fg)
+ * @return Blended RGB565 color
+ */
+static inline uint16_t GFX_blend565(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+    // Spread to 0b00000gggggg00000rrrrr000000bbbbb so each channel has 5 bits
+    // of headroom for the weight
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t r = ((f * alpha + b * (32 - alpha)) >> 5) & 0x07E0F81F;
+    return (uint16_t)(r | (r >> 16));
+}
+
+/** @brief Framebuffer pixels, or NULL in direct mode (use GFX_getRow() to access rows) */
+extern uint16_t *gfxFramebuffer;
+
 // Framebuffer Management
 /**
  * @brief Create and allocate memory for the framebuffer
- * @note Must be called before any drawing operations
+ * @return true on success, false if the display arena has no room for it
+ * @note Allocated from the static display arena (gfxarena.h), sized for the
+ *       current rotation. Without a framebuffer drawing goes straight to the panel.
  */
-void GFX_createFramebuf();
+bool GFX_createFramebuf();
 
 /**
  * @brief Destroy and free framebuffer memory
+ * @note Returns the arena to where it was before GFX_createFramebuf(), so
+ *       anything allocated after the framebuffer is released too
  */
 void GFX_destroyFramebuf();
 
+/**
+ * @brief Get a pointer to framebuffer row y for direct pixel access
+ * @param y Row (0 to height-1, not range checked)
+ * @return Pointer to the first pixel of the row
+ * @note Materialises a pending lazy clear for that row and accounts for the
+ *       scroll ring offset. Use this instead of indexing gfxFramebuffer directly.
+ */
+uint16_t *GFX_getRow(int16_t y);
+
+/**
+ * @brief Materialise any pending lazy clear and scroll offset into the framebuffer
+ * @note Only needed by code that reads or writes gfxFramebuffer directly; it
+ *       leaves gfxFramebuffer as a plain linear image
+ */
+void GFX_resolveClear();
+
+/**
+ * @brief Send all drawing to an off-screen RGB565 image until GFX_endCanvas()
+ * @param pixels Image, w*h pixels row by row; its contents are kept
+ * @param w Image width
+ * @param h Image height (at most 320)
+ * @return false if a canvas is already active or the size is invalid
+ * @note Works with or without a framebuffer. Deferred mode is paused, and
+ *       GFX_flush() and scrolling must not be used on the canvas.
+ */
+bool GFX_beginCanvas(uint16_t *pixels, uint16_t w, uint16_t h);
+
+/**
+ * @brief Go back to drawing on the screen (or framebuffer)
+ */
+void GFX_endCanvas();
+
 // Basic Drawing Functions
 /**
  * @brief Draw a single pixel in the framebuffer
@@ -44,6 +100,27 @@ void GFX_destroyFramebuf();
  */
 void GFX_drawPixel(int16_t x, int16_t y, uint16_t color);
 
+/**
+ * @brief Blend a color into a pixel
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param color 16-bit RGB565 color
+ * @param alpha Coverage, 0 (nothing) to 32 (opaque)
+ * @param bg Color to blend with in direct mode when the panel cannot be
+ *           read back; with a framebuffer, or panel readback (see
+ *           LCD_setReadMode()), the pixel already there is used
+ */
+void GFX_blendPixel(int16_t x, int16_t y, uint16_t color, uint8_t alpha, uint16_t bg);
+
+/**
+ * @brief Fill a horizontal span of pixels, clipped to the screen
+ * @param x0 First X coordinate
+ * @param x1 Last X coordinate (inclusive)
+ * @param y Y coordinate
+ * @param color 16-bit RGB565 color
+ */
+void GFX_drawSpan(int16_t x0, int16_t x1, int16_t y, uint16_t color);
+
 // Text Functions
 /**
  * @brief Draw a single character
@@ -94,6 +171,12 @@ void GFX_setTextSize(uint8_t size);
  */
 void GFX_setFont(const GFXfont *f);
 
+/**
+ * @brief Get the font selected with GFX_setFont()
+ * @return Font as passed to GFX_setFont(), or NULL for the classic font
+ */
+const GFXfont *GFX_getFont();
+
 // Line Drawing Functions
 /**
  * @brief Draw a line between two points
@@ -148,6 +231,8 @@ void GFX_fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 /**
  * @brief Fill entire screen with a color
  * @param color 16-bit RGB565 color
+ * @note With a framebuffer this only records the color; rows are filled on
+ *       first touch and untouched rows are streamed as constant color by GFX_flush()
  */
 void GFX_fillScreen(uint16_t color);
 
@@ -191,21 +276,114 @@ void GFX_printf(const char *format, ...);
 
 /**
  * @brief Flush framebuffer contents to the display
- * @note Call this after drawing operations to update the screen
+ * @note Call this after drawing operations to update the screen. Without a
+ *       framebuffer it sends the pixels still held by the write-combining cache.
  */
 void GFX_flush();
 
 /**
  * @brief Update display (alias for GFX_flush)
+ * @note Only flushes if something was drawn, unless auto damage mode is on
  */
 void GFX_Update();
 
+/** @brief Flush counters (since the last GFX_resetFlushStats()) */
+typedef struct
+{
+    uint32_t flushes;    ///< GFX_flush() calls with a framebuffer
+    uint32_t rowsHashed; ///< Rows hashed in auto damage mode
+    uint32_t rowsSent;   ///< Rows actually sent to the panel
+    uint32_t hashUs;     ///< Time spent hashing, in microseconds
+} GFXflushStats;
+
+/**
+ * @brief Enable automatic change detection in GFX_flush()
+ * @param enable true to hash each row and only send rows that changed
+ * @note Catches code that writes gfxFramebuffer directly. Uses the DMA sniffer
+ *       CRC32 on the RP2040 and a software hash on host builds.
+ */
+void GFX_setAutoDamage(bool enable);
+
+/**
+ * @brief Send GFX_flush() rows through the background flush queue (lcdqueue.h)
+ * @param enable true to return as soon as the rows are queued
+ * @note The rows are read by DMA while the caller carries on, so drawing
+ *       straight after GFX_flush() can put some of the next frame's pixels
+ *       into this one. Call GFX_flushQueueWait() first when that matters.
+ */
+void GFX_setFlushQueue(bool enable);
+
+/**
+ * @brief Wait until every row queued by GFX_flush() has reached the panel
+ */
+void GFX_flushQueueWait();
+
+/**
+ * @brief Make the next GFX_flush() send every row
+ * @note For code that writes the panel behind GFX_flush(), so automatic
+ *       change detection does not compare against what is no longer there
+ */
+void GFX_invalidatePanel();
+
+/** @brief GFX_setFlushBrightness() level that sends pixels unchanged */
+#define GFX_BRIGHTNESS_FULL 32
+
+/**
+ * @brief Scale every pixel GFX_flush() sends, without changing the framebuffer
+ * @param level 0 (black) to GFX_BRIGHTNESS_FULL
+ * @note Each channel goes through a small lookup table built here. Dimmed
+ *       rows are converted a row at a time into a streamed window
+ *       (lcdstream.h), so the flush queue is not used meanwhile.
+ */
+void GFX_setFlushBrightness(uint8_t level);
+
+/**
+ * @brief Read flush counters, e.g. to compare hash time against rows saved
+ * @param stats Destination for the counters
+ */
+void GFX_getFlushStats(GFXflushStats *stats);
+
+/**
+ * @brief Reset flush counters
+ */
+void GFX_resetFlushStats();
+
 /**
  * @brief Scroll screen content up by n lines
  * @param n Number of lines to scroll
+ * @note O(1) in the framebuffer size: only the row origin moves and the n
+ *       exposed rows are cleared to black. GFX_flush() sends the ring as two
+ *       segments around the wrap point.
  */
 void GFX_scrollUp(int n);
 
+/**
+ * @brief Copy a rectangle of the framebuffer to another position
+ * @param x Source X
+ * @param y Source Y
+ * @param w Width
+ * @param h Height
+ * @param dx Destination X
+ * @param dy Destination Y
+ * @return false in direct mode when the panel cannot be read back; the
+ *         caller has to redraw the destination instead
+ * @note Source and destination may overlap. In direct mode the copy reads
+ *       and rewrites the panel one row at a time.
+ */
+bool GFX_copyRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, int16_t dy);
+
+/**
+ * @brief Read back a rectangle of pixels (save-under, read-modify-write)
+ * @param x Left X
+ * @param y Top Y
+ * @param w Width
+ * @param h Height
+ * @param buf Destination for w * h RGB565 pixels, row by row
+ * @return false if the rectangle is not fully on screen, or in direct mode
+ *         when the panel cannot be read back
+ */
+bool GFX_readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *buf);
+
 // Utility Functions
 /**
  * @brief Get framebuffer width
@@ -0,0 +1,159 @@
+// Anti-aliased GFXfont glyphs
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Coverage levels are packed MSB first and rows run on without padding, as
+// in 1-bpp GFXfont bitmaps, so a pixel never straddles a byte. Level v of
+// 2^bpp - 1 maps to the blend weight (v * 32 + top / 2) / top, the same
+// rounding for the ramps and the transparent blend tables.
+//
+// The common case, size 1 into the framebuffer, walks the clipped glyph box
+// row by row on GFX_getRow(). Everything else (scaled text, direct mode)
+// goes pixel by pixel through the generic primitives.
+
+#include <string.h>
+#include "gfxaafont.h"
+#include "gfx.h"
+#include "gfxquality.h"
+#include "gfxstencil.h"
+#include "st7789.h"
+#include "pico/stdlib.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+typedef struct
+{
+    uint16_t fg, bg;
+    uint8_t bpp;
+    uint16_t ramp[16];
+} AAramp;
+
+static const uint8_t aaAlpha2[4] = {0, 11, 21, 32};
+static const uint8_t aaAlpha4[16] = {0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32};
+
+static AAramp aaRamps[GFX_AA_RAMPS];
+static uint8_t aaRampCount = 0;
+static uint8_t aaRampNext = 0; // Slot replaced next once all are in use
+static uint8_t aaRampLast = 0; // Slot found by the previous lookup
+static GFXaaFontStats aaStats = {0, 0, 0};
+
+const uint16_t *GFX_aaRamp(uint16_t fg, uint16_t bg, uint8_t bpp)
+{
+    AAramp *r = &aaRamps[aaRampLast];
+    if (aaRampCount && r->fg == fg && r->bg == bg && r->bpp == bpp)
+    {
+        aaStats.rampHits++;
+        return r->ramp;
+    }
+    for (uint8_t i = 0; i < aaRampCount; i++)
+    {
+        r = &aaRamps[i];
+        if (r->fg == fg && r->bg == bg && r->bpp == bpp)
+        {
+            aaRampLast = i;
+            aaStats.rampHits++;
+            return r->ramp;
+        }
+    }
+
+    uint8_t slot;
+    if (aaRampCount < GFX_AA_RAMPS)
+        slot = aaRampCount++;
+    else
+    {
+        slot = aaRampNext;
+        aaRampNext = (aaRampNext + 1) % GFX_AA_RAMPS;
+    }
+    r = &aaRamps[slot];
+    r->fg = fg;
+    r->bg = bg;
+    r->bpp = bpp;
+    const uint8_t *alpha = bpp == 2 ? aaAlpha2 : aaAlpha4;
+    for (uint8_t v = 0; v < (1 << bpp); v++)
+        r->ramp[v] = GFX_blend565(fg, bg, alpha[v]);
+    aaRampLast = slot;
+    aaStats.rampMisses++;
+    return r->ramp;
+}
+
+void __time_critical_func(GFX_drawCharAA)(int16_t x, int16_t y, const GFXfont *font, const GFXglyph *glyph,
+                                          uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y)
+{
+    uint8_t bpp = font->bpp;
+    uint8_t top = (1 << bpp) - 1;
+    const uint8_t *bits = font->bitmap + glyph->bitmapOffset;
+    const uint8_t *alpha = bpp == 2 ? aaAlpha2 : aaAlpha4;
+    int16_t w = glyph->width, h = glyph->height;
+    bool opaque = bg != color;
+    const uint16_t *ramp = opaque ? GFX_aaRamp(color, bg, bpp) : NULL;
+    // Transparent text drawn aliased, with no blends, at reduced quality and
+    // where nothing can be read back to blend with
+    bool blendable = gfxFramebuffer != NULL || LCD_canRead();
+    uint8_t solid = gfxQualityLevel != GFX_QUALITY_FULL || !blendable ? (top + 1) / 2 : top;
+
+    aaStats.glyphs++;
+    x += glyph->xOffset * size_x;
+    y += glyph->yOffset * size_y;
+
+    if (size_x == 1 && size_y == 1 && gfxFramebuffer != NULL)
+    {
+        int16_t xx0 = x < 0 ? -x : 0, xx1 = x + w > (int16_t)_width ? _width - x : w;
+        int16_t yy0 = y < 0 ? -y : 0, yy1 = y + h > (int16_t)_height ? _height - y : h;
+        for (int16_t yy = yy0; yy < yy1; yy++)
+        {
+            uint16_t *row = GFX_getRow(y + yy) + x;
+            uint16_t count;
+            const GFXspan *sp = GFX_stencilRow(y + yy, &count);
+            for (uint16_t s = 0; s < count; s++)
+            {
+                // Glyph columns inside this visible span
+                int16_t a = sp[s].x0 - x > xx0 ? sp[s].x0 - x : xx0;
+                int16_t b = sp[s].x1 - x + 1 < xx1 ? sp[s].x1 - x + 1 : xx1;
+                uint32_t bit = ((uint32_t)yy * w + a) * bpp;
+                for (int16_t xx = a; xx < b; xx++, bit += bpp)
+                {
+                    uint8_t v = (bits[bit >> 3] >> (8 - bpp - (bit & 7))) & top;
+                    if (opaque)
+                        row[xx] = ramp[v];
+                    else if (v >= solid)
+                        row[xx] = color;
+                    else if (v && solid == top)
+                        row[xx] = GFX_blend565(color, row[xx], alpha[v]);
+                }
+            }
+        }
+        return;
+    }
+
+    uint32_t bit = 0;
+    for (int16_t yy = 0; yy < h; yy++)
+        for (int16_t xx = 0; xx < w; xx++, bit += bpp)
+        {
+            uint8_t v = (bits[bit >> 3] >> (8 - bpp - (bit & 7))) & top;
+            int16_t px = x + xx * size_x, py = y + yy * size_y;
+            if (opaque || v >= solid)
+            {
+                uint16_t c = opaque ? ramp[v] : color;
+                if (size_x == 1 && size_y == 1)
+                    GFX_drawPixel(px, py, c);
+                else
+                    GFX_fillRect(px, py, size_x, size_y, c);
+            }
+            else if (v && solid == top)
+            {
+                for (uint8_t sy = 0; sy < size_y; sy++)
+                    for (uint8_t sx = 0; sx < size_x; sx++)
+                        GFX_blendPixel(px + sx, py + sy, color, alpha[v], color);
+            }
+        }
+}
+
+void GFX_getAAFontStats(GFXaaFontStats *stats)
+{
+    *stats = aaStats;
+}
+
+void GFX_resetAAFontStats()
+{
+    memset(&aaStats, 0, sizeof(aaStats));
+}
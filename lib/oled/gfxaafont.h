@@ -0,0 +1,74 @@
+/**
+ * @file gfxaafont.h
+ * @brief Anti-aliased GFXfont glyphs with 2 or 4 bits of coverage per pixel
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * A GFXfont whose bpp field is 2 or 4 stores a coverage level per pixel
+ * instead of a single bit (tools/ttf2aafont.py writes them). GFX_drawChar()
+ * and the text functions hand such glyphs to GFX_drawCharAA():
+ * - Opaque text (background color different from the text color) looks
+ *   every pixel up in a 4- or 16-entry RGB565 ramp from background to text
+ *   color. Ramps are kept for the last few color pairs, so a screen of text
+ *   in a handful of colors computes each ramp once.
+ * - Transparent text (background equal to the text color) blends partly
+ *   covered pixels into what is under them with GFX_blend565(). That needs
+ *   the framebuffer, or panel readback in direct mode (see GFX_blendPixel()).
+ * Opaque glyphs paint their whole bounding box, so glyphs that overlap their
+ * neighbour's box (negative xOffset) should be drawn transparent.
+ */
+
+#ifndef GFXAAFONT_H
+#define GFXAAFONT_H
+
+#include <stdint.h>
+#include "gfxfont.h"
+
+/** @brief Color ramps kept for reuse (one per text/background pair and bpp) */
+#ifndef GFX_AA_RAMPS
+#define GFX_AA_RAMPS 8
+#endif
+
+/** @brief Anti-aliased text counters (since the last GFX_resetAAFontStats()) */
+typedef struct
+{
+    uint32_t glyphs;     ///< Anti-aliased glyphs drawn
+    uint32_t rampHits;   ///< Opaque glyphs whose ramp was already built
+    uint32_t rampMisses; ///< Ramps built
+} GFXaaFontStats;
+
+/**
+ * @brief RGB565 ramp from background to text color
+ * @param fg Text color (last entry)
+ * @param bg Background color (entry 0)
+ * @param bpp 2 or 4: the ramp has 4 or 16 entries
+ * @return The ramp, valid until GFX_AA_RAMPS other pairs have been asked for
+ */
+const uint16_t *GFX_aaRamp(uint16_t fg, uint16_t bg, uint8_t bpp);
+
+/**
+ * @brief Draw an anti-aliased glyph (called by GFX_drawChar())
+ * @param x Cursor X position
+ * @param y Cursor Y position (baseline)
+ * @param font Font holding the glyph; font->bpp is 2 or 4
+ * @param glyph Glyph to draw
+ * @param color Text color
+ * @param bg Background color; equal to color for transparent text
+ * @param size_x X-axis scaling
+ * @param size_y Y-axis scaling
+ */
+void GFX_drawCharAA(int16_t x, int16_t y, const GFXfont *font, const GFXglyph *glyph, uint16_t color, uint16_t bg,
+                    uint8_t size_x, uint8_t size_y);
+
+/**
+ * @brief Read the anti-aliased text counters
+ * @param stats Destination for the counters
+ */
+void GFX_getAAFontStats(GFXaaFontStats *stats);
+
+/**
+ * @brief Reset the anti-aliased text counters
+ */
+void GFX_resetAAFontStats();
+
+#endif
@@ -0,0 +1,133 @@
+// Display memory arena - bump allocator over a static, linker-placed region
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// The region lives in .uninitialized_data so it is not zeroed at boot; every
+// consumer initialises what it allocates. A short allocation log lets
+// GFX_arenaRelease() hand bytes back to the right consumer, and records the
+// generation each allocation was made in: an address reused after a release
+// comes back with a newer generation, so GFX_arenaHolds() can tell a
+// surviving allocation from a new one in its place. Releases stop at the
+// floor, which keeps the framebuffer from being freed under the drawing code.
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "gfxarena.h"
+
+#ifndef GFX_ARENA_MAX_ALLOCS
+#define GFX_ARENA_MAX_ALLOCS 32
+#endif
+
+typedef struct
+{
+    size_t offset;
+    size_t size;
+    uint32_t generation;
+    uint8_t who;
+} ArenaEntry;
+
+static uint8_t __uninitialized_ram(gfxArena)[GFX_ARENA_SIZE] __attribute__((aligned(4)));
+static size_t arenaUsed = 0;
+static ArenaEntry arenaLog[GFX_ARENA_MAX_ALLOCS];
+static uint8_t arenaLogCount = 0;
+static uint32_t arenaGeneration = 0;
+static size_t arenaFloor = 0; // Releases never go below this offset
+static GFXmemUsage arenaStats = {GFX_ARENA_SIZE, 0, 0, {0}, {0}};
+
+static const char *const consumerNames[GFX_MEM_CONSUMERS] = {
+    "framebuffer", "line buffers", "canvases", "glyph caches", "display lists", "other"};
+
+void *GFX_arenaAlloc(size_t bytes, GFXmemConsumer who)
+{
+    bytes = (bytes + 3) & ~(size_t)3;
+    if (bytes == 0 || bytes > GFX_ARENA_SIZE - arenaUsed || arenaLogCount == GFX_ARENA_MAX_ALLOCS)
+        return NULL;
+
+    ArenaEntry *e = &arenaLog[arenaLogCount++];
+    e->offset = arenaUsed;
+    e->size = bytes;
+    e->generation = arenaGeneration;
+    e->who = who;
+
+    void *p = gfxArena + arenaUsed;
+    arenaUsed += bytes;
+
+    arenaStats.used = arenaUsed;
+    if (arenaUsed > arenaStats.highWater)
+        arenaStats.highWater = arenaUsed;
+    arenaStats.consumer[who] += bytes;
+    if (arenaStats.consumer[who] > arenaStats.consumerHigh[who])
+        arenaStats.consumerHigh[who] = arenaStats.consumer[who];
+    return p;
+}
+
+size_t GFX_arenaMark()
+{
+    return arenaUsed;
+}
+
+void GFX_arenaRelease(size_t mark)
+{
+    if (mark < arenaFloor)
+        mark = arenaFloor;
+    if (mark >= arenaUsed)
+        return;
+    while (arenaLogCount && arenaLog[arenaLogCount - 1].offset >= mark)
+    {
+        ArenaEntry *e = &arenaLog[--arenaLogCount];
+        arenaStats.consumer[e->who] -= e->size;
+    }
+    arenaUsed = mark;
+    arenaStats.used = arenaUsed;
+    arenaGeneration++;
+}
+
+void GFX_arenaReset()
+{
+    if (arenaFloor > 0)
+    {
+        GFX_arenaRelease(arenaFloor);
+        return;
+    }
+    arenaUsed = 0;
+    arenaLogCount = 0;
+    arenaStats.used = 0;
+    for (uint8_t i = 0; i < GFX_MEM_CONSUMERS; i++)
+        arenaStats.consumer[i] = 0;
+    arenaGeneration++;
+}
+
+void GFX_arenaSetFloor(size_t mark)
+{
+    arenaFloor = mark < arenaUsed ? mark : arenaUsed;
+}
+
+uint32_t GFX_arenaGeneration()
+{
+    return arenaGeneration;
+}
+
+bool GFX_arenaHolds(const void *p, uint32_t generation)
+{
+    const uint8_t *b = (const uint8_t *)p;
+    if (b < gfxArena || b >= gfxArena + arenaUsed)
+        return false;
+    size_t offset = b - gfxArena;
+    for (uint8_t i = arenaLogCount; i-- > 0;)
+        if (arenaLog[i].offset <= offset)
+            return arenaLog[i].offset == offset && arenaLog[i].generation == generation;
+    return false;
+}
+
+void GFX_arenaGetUsage(GFXmemUsage *usage)
+{
+    *usage = arenaStats;
+}
+
+void GFX_arenaReport()
+{
+    printf("Display arena: %u/%u bytes used (high water %u)\n",
+           (unsigned)arenaStats.used, (unsigned)arenaStats.size, (unsigned)arenaStats.highWater);
+    for (uint8_t i = 0; i < GFX_MEM_CONSUMERS; i++)
+        printf("  %-14s %6u bytes (high %u)\n", consumerNames[i],
+               (unsigned)arenaStats.consumer[i], (unsigned)arenaStats.consumerHigh[i]);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file gfxarena.h
+ * @brief Static display memory arena for framebuffers and other display buffers
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * All large display allocations (framebuffer, line buffers, canvases, glyph
+ * caches, display lists) come from one statically reserved, linker-placed
+ * region instead of the heap. Allocation is a bump of an offset, release is
+ * back to a mark, so a mode or rotation switch returns memory in O(1) and can
+ * never fragment. Failure is reported by returning NULL.
+ */
+
+#ifndef GFXARENA_H
+#define GFXARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Size of the display arena in bytes
+ * @note Holds a framebuffer for the largest panel LCD_initDisplay() accepts
+ *       (240x320 RGB565, 150 KB) plus 20 KB for caches and display lists
+ */
+#ifndef GFX_ARENA_SIZE
+#define GFX_ARENA_SIZE (240 * 320 * 2 + 20 * 1024)
+#endif
+
+/** @brief Who an arena allocation belongs to, for usage reporting */
+typedef enum
+{
+    GFX_MEM_FRAMEBUFFER,
+    GFX_MEM_LINEBUF,
+    GFX_MEM_CANVAS,
+    GFX_MEM_GLYPHS,
+    GFX_MEM_DISPLAYLIST,
+    GFX_MEM_OTHER,
+    GFX_MEM_CONSUMERS ///< Number of consumer types
+} GFXmemConsumer;
+
+/** @brief Arena usage snapshot */
+typedef struct
+{
+    size_t size;                         ///< Total arena size
+    size_t used;                         ///< Bytes currently allocated
+    size_t highWater;                    ///< Largest 'used' seen since boot
+    size_t consumer[GFX_MEM_CONSUMERS];  ///< Bytes currently held per consumer
+    size_t consumerHigh[GFX_MEM_CONSUMERS]; ///< High-water mark per consumer
+} GFXmemUsage;
+
+/**
+ * @brief Allocate from the display arena
+ * @param bytes Number of bytes (rounded up to 4-byte alignment)
+ * @param who Consumer to charge the allocation to
+ * @return Pointer to the memory, or NULL if the arena is exhausted
+ */
+void *GFX_arenaAlloc(size_t bytes, GFXmemConsumer who);
+
+/**
+ * @brief Current allocation offset, to be passed to GFX_arenaRelease() later
+ */
+size_t GFX_arenaMark();
+
+/**
+ * @brief Free everything allocated since a mark
+ * @param mark Value returned by GFX_arenaMark()
+ * @note Never goes below the floor (GFX_arenaSetFloor()): what lies under it
+ *       stays allocated
+ */
+void GFX_arenaRelease(size_t mark);
+
+/**
+ * @brief Free the whole arena in O(1), e.g. on a display mode switch
+ * @note Frees down to the floor only, like GFX_arenaRelease()
+ */
+void GFX_arenaReset();
+
+/**
+ * @brief Keep everything below an offset allocated through releases and resets
+ * @param mark GFX_arenaMark() to protect up to, or 0 to remove the floor
+ * @note Set by GFX_createFramebuf() above the framebuffer, which the drawing
+ *       code uses directly and cannot check for liveness, and removed again
+ *       by GFX_destroyFramebuf()
+ */
+void GFX_arenaSetFloor(size_t mark);
+
+/**
+ * @brief Counter bumped whenever memory is released
+ * @note Read it right after GFX_arenaAlloc() and keep it with the pointer for
+ *       GFX_arenaHolds()
+ */
+uint32_t GFX_arenaGeneration();
+
+/**
+ * @brief Check that an allocation is still live
+ * @param p Pointer returned by GFX_arenaAlloc()
+ * @param generation GFX_arenaGeneration() read when p was allocated
+ * @return false once p has been released, even if the same address has been
+ *         handed out again since. Allocations below a release mark stay live.
+ */
+bool GFX_arenaHolds(const void *p, uint32_t generation);
+
+/**
+ * @brief Read current arena usage and high-water marks
+ * @param usage Destination for the snapshot
+ */
+void GFX_arenaGetUsage(GFXmemUsage *usage);
+
+/**
+ * @brief Print arena usage per consumer on stdout
+ */
+void GFX_arenaReport();
+
+#endif
@@ -0,0 +1,594 @@
+// Decoded image asset cache
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Decoded assets live in one pool taken from the display arena (charged to
+// GFX_MEM_OTHER). Slots hold the assets. An open-addressed hash with linear
+// probing maps IDs to slots; removal shifts later entries back, so there
+// are no tombstones. The slots are on two lists: most to least recently
+// used, for eviction, and by pool offset, to find first-fit gaps. Finding
+// room evicts from the cold end until a gap opens up. That is O(slots) per
+// miss, which is nothing next to the decode that follows.
+//
+// A critical section guards the cache state so core 1 can prefetch while
+// core 0 draws. Decoders run outside it, on a slot marked busy so nothing
+// evicts it. A core asking for an asset the other one is decoding waits
+// for it. The arena itself is not guarded, so the pool is only taken by the
+// calls core 0 makes; prefetch steps never allocate.
+
+#include <string.h>
+#include "gfxasset.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxdefer.h"
+#include "gfxstencil.h"
+#include "lcdstream.h"
+#include "pixcache.h"
+#include "pico/stdlib.h"
+#include "pico/critical_section.h"
+#include "hardware/sync.h"
+
+#if GFX_ASSET_SLOTS > 128 || (GFX_ASSET_SLOTS & (GFX_ASSET_SLOTS - 1))
+#error "GFX_ASSET_SLOTS must be a power of two no larger than 128"
+#endif
+
+#define ASSET_NONE 0xFF
+#define ASSET_HASH_SIZE (GFX_ASSET_SLOTS * 2)
+
+#define ASSET_FREE 0
+#define ASSET_BUSY 1 // Being decoded
+#define ASSET_READY 2
+
+typedef struct
+{
+    uint16_t id;
+    uint8_t state;
+    uint8_t pins;
+    uint8_t newer, older; // Recency list
+    uint8_t next;         // Pool offset list
+    uint32_t offset, bytes;
+    uint32_t epoch; // Prefetch period of the last use
+    GFXsurface surface;
+} AssetSlot;
+
+static const GFXasset *assetTable = NULL;
+static uint16_t assetCount = 0;
+static critical_section_t assetLock;
+static bool assetLockReady = false;
+
+static uint8_t *assetPool = NULL;
+static size_t assetPoolSize = 0;
+static size_t assetBudget = GFX_ASSET_RAM_BUDGET;
+static size_t assetUsed = 0;
+static uint32_t assetGeneration = 0;
+static size_t assetMark, assetTop; // Arena mark before and after the pool
+
+static AssetSlot assetSlots[GFX_ASSET_SLOTS];
+static uint8_t assetHash[ASSET_HASH_SIZE];
+static uint8_t assetNewest = ASSET_NONE, assetOldest = ASSET_NONE;
+static uint8_t assetFirst = ASSET_NONE; // Lowest pool offset
+static uint32_t assetEpoch = 0;
+
+static uint16_t assetQueue[GFX_ASSET_PREFETCH_QUEUE];
+static uint8_t assetQueueHead = 0, assetQueueCount = 0;
+
+static GFXassetStats assetStats = {0, 0, 0, 0, 0, 0};
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+static inline uint8_t assetHashOf(uint16_t id)
+{
+    return (uint8_t)(((uint32_t)id * 2654435769u) >> 16) & (ASSET_HASH_SIZE - 1);
+}
+
+static uint8_t assetFind(uint16_t id)
+{
+    for (uint8_t h = assetHashOf(id);; h = (h + 1) & (ASSET_HASH_SIZE - 1))
+    {
+        uint8_t s = assetHash[h];
+        if (s == ASSET_NONE || assetSlots[s].id == id)
+            return s;
+    }
+}
+
+static void assetHashInsert(uint8_t s)
+{
+    uint8_t h = assetHashOf(assetSlots[s].id);
+    while (assetHash[h] != ASSET_NONE)
+        h = (h + 1) & (ASSET_HASH_SIZE - 1);
+    assetHash[h] = s;
+}
+
+static void assetHashRemove(uint16_t id)
+{
+    uint8_t h = assetHashOf(id);
+    while (assetSlots[assetHash[h]].id != id)
+        h = (h + 1) & (ASSET_HASH_SIZE - 1);
+
+    // Shift back later entries of the probe run that may move into the hole
+    for (uint8_t j = (h + 1) & (ASSET_HASH_SIZE - 1);; j = (j + 1) & (ASSET_HASH_SIZE - 1))
+    {
+        uint8_t s = assetHash[j];
+        if (s == ASSET_NONE)
+            break;
+        uint8_t home = assetHashOf(assetSlots[s].id);
+        // The entry stays if its home lies cyclically in (h, j]
+        if (((j - home) & (ASSET_HASH_SIZE - 1)) < ((j - h) & (ASSET_HASH_SIZE - 1)))
+            continue;
+        assetHash[h] = s;
+        h = j;
+    }
+    assetHash[h] = ASSET_NONE;
+}
+
+static void assetUnlinkRecent(uint8_t s)
+{
+    AssetSlot *a = &assetSlots[s];
+    if (a->newer != ASSET_NONE)
+        assetSlots[a->newer].older = a->older;
+    else
+        assetNewest = a->older;
+    if (a->older != ASSET_NONE)
+        assetSlots[a->older].newer = a->newer;
+    else
+        assetOldest = a->newer;
+}
+
+static void assetMakeNewest(uint8_t s)
+{
+    AssetSlot *a = &assetSlots[s];
+    a->newer = ASSET_NONE;
+    a->older = assetNewest;
+    if (assetNewest != ASSET_NONE)
+        assetSlots[assetNewest].newer = s;
+    else
+        assetOldest = s;
+    assetNewest = s;
+}
+
+static void assetRemove(uint8_t s)
+{
+    AssetSlot *a = &assetSlots[s];
+    assetHashRemove(a->id);
+    assetUnlinkRecent(s);
+    if (assetFirst == s)
+        assetFirst = a->next;
+    else
+    {
+        uint8_t p = assetFirst;
+        while (assetSlots[p].next != s)
+            p = assetSlots[p].next;
+        assetSlots[p].next = a->next;
+    }
+    assetUsed -= a->bytes;
+    a->state = ASSET_FREE;
+}
+
+// Empty the cache. Called with assetLock held; decoders still running on
+// the other core are waited for first, since they write into the pool and
+// mark their slot ready when they return.
+static void assetClear()
+{
+    assetQueueCount = 0; // So the other core starts no new decode meanwhile
+    for (uint8_t s = 0; s < GFX_ASSET_SLOTS; s++)
+        while (assetSlots[s].state == ASSET_BUSY)
+        {
+            critical_section_exit(&assetLock);
+            tight_loop_contents();
+            critical_section_enter_blocking(&assetLock);
+        }
+    memset(assetSlots, 0, sizeof(assetSlots));
+    memset(assetHash, ASSET_NONE, sizeof(assetHash));
+    assetNewest = assetOldest = assetFirst = ASSET_NONE;
+    assetUsed = 0;
+    assetQueueCount = 0;
+}
+
+// Forget the pool once its arena memory has been released
+static void assetCheckArena()
+{
+    if (assetPool != NULL && !GFX_arenaHolds(assetPool, assetGeneration))
+    {
+        assetClear();
+        assetPool = NULL;
+        assetPoolSize = 0;
+    }
+}
+
+// Take the pool if there is none. Core 0 only, with assetLock held.
+static void assetPoolReady()
+{
+    assetCheckArena();
+    if (assetPool != NULL)
+        return;
+    assetMark = GFX_arenaMark();
+    assetPool = (uint8_t *)GFX_arenaAlloc(assetBudget, GFX_MEM_OTHER);
+    assetPoolSize = assetPool != NULL ? assetBudget : 0;
+    assetGeneration = GFX_arenaGeneration();
+    assetTop = GFX_arenaMark();
+}
+
+// Evict the least recently used asset that may go. Prefetching leaves
+// alone assets used in the current and the previous prefetch period.
+static bool assetEvictOne(bool prefetch)
+{
+    for (uint8_t s = assetOldest; s != ASSET_NONE; s = assetSlots[s].newer)
+    {
+        const AssetSlot *a = &assetSlots[s];
+        if (a->state != ASSET_READY || a->pins || (prefetch && a->epoch + 1 >= assetEpoch))
+            continue;
+        assetRemove(s);
+        assetStats.evictions++;
+        return true;
+    }
+    return false;
+}
+
+// First-fit gap in the pool. Sets *prev to the slot the gap follows.
+static bool assetPlace(uint32_t bytes, uint32_t *offset, uint8_t *prev)
+{
+    uint32_t end = 0;
+    *prev = ASSET_NONE;
+    for (uint8_t s = assetFirst; s != ASSET_NONE; s = assetSlots[s].next)
+    {
+        if (assetSlots[s].offset - end >= bytes)
+            break;
+        end = assetSlots[s].offset + assetSlots[s].bytes;
+        *prev = s;
+    }
+    *offset = end;
+    return assetPoolSize - end >= bytes;
+}
+
+static uint8_t assetFreeSlot()
+{
+    for (uint8_t s = 0; s < GFX_ASSET_SLOTS; s++)
+        if (assetSlots[s].state == ASSET_FREE)
+            return s;
+    return ASSET_NONE;
+}
+
+// Find or decode an asset. Called and returns with assetLock held, but
+// releases it while waiting for or running a decoder.
+static uint8_t assetLoad(uint16_t id, bool prefetch)
+{
+    if (id >= assetCount)
+        return ASSET_NONE;
+    assetCheckArena();
+
+    uint8_t s = assetFind(id);
+    while (s != ASSET_NONE && assetSlots[s].state == ASSET_BUSY)
+    {
+        critical_section_exit(&assetLock);
+        tight_loop_contents();
+        critical_section_enter_blocking(&assetLock);
+        s = assetFind(id);
+    }
+    if (s != ASSET_NONE)
+    {
+        assetUnlinkRecent(s);
+        assetMakeNewest(s);
+        assetSlots[s].epoch = assetEpoch;
+        if (!prefetch)
+            assetStats.hits++;
+        return s;
+    }
+
+    const GFXasset *a = &assetTable[id];
+    uint32_t bytes = (GFX_assetBytes(a) + 3) & ~3u;
+
+    uint32_t offset;
+    uint8_t prev;
+    while ((s = assetFreeSlot()) == ASSET_NONE || !assetPlace(bytes, &offset, &prev))
+    {
+        if (bytes > assetPoolSize || !assetEvictOne(prefetch))
+        {
+            assetStats.failures++;
+            return ASSET_NONE;
+        }
+    }
+
+    AssetSlot *slot = &assetSlots[s];
+    slot->id = id;
+    slot->state = ASSET_BUSY;
+    slot->pins = 0;
+    slot->offset = offset;
+    slot->bytes = bytes;
+    slot->epoch = assetEpoch;
+    if (prev == ASSET_NONE)
+    {
+        slot->next = assetFirst;
+        assetFirst = s;
+    }
+    else
+    {
+        slot->next = assetSlots[prev].next;
+        assetSlots[prev].next = s;
+    }
+    assetHashInsert(s);
+    assetMakeNewest(s);
+    assetUsed += bytes;
+
+    uint8_t *mem = assetPool + offset;
+    GFXsurface *sf = &slot->surface;
+    sf->width = a->width;
+    sf->height = a->height;
+    if (a->format == GFX_ASSET_PAL8)
+    {
+        sf->pixels = NULL;
+        sf->palette = (const uint16_t *)mem;
+        sf->indices = mem + a->colors * sizeof(uint16_t);
+    }
+    else
+    {
+        sf->pixels = (const uint16_t *)mem;
+        sf->palette = NULL;
+        sf->indices = NULL;
+    }
+
+    critical_section_exit(&assetLock);
+    bool ok = a->decode(a, mem);
+    critical_section_enter_blocking(&assetLock);
+
+    if (!ok)
+    {
+        assetRemove(s);
+        assetStats.failures++;
+        return ASSET_NONE;
+    }
+    slot->state = ASSET_READY;
+    assetStats.bytesDecoded += GFX_assetBytes(a);
+    if (prefetch)
+        assetStats.prefetches++;
+    else
+        assetStats.misses++;
+    return s;
+}
+
+void GFX_assetSetTable(const GFXasset *table, uint16_t count)
+{
+    if (!assetLockReady)
+    {
+        critical_section_init(&assetLock);
+        assetLockReady = true;
+    }
+    critical_section_enter_blocking(&assetLock);
+    assetTable = table;
+    assetCount = count;
+    assetClear();
+    assetPoolReady();
+    critical_section_exit(&assetLock);
+}
+
+const GFXsurface *GFX_assetGet(uint16_t id)
+{
+    if (!assetLockReady)
+        return NULL;
+    critical_section_enter_blocking(&assetLock);
+    assetPoolReady();
+    uint8_t s = assetLoad(id, false);
+    critical_section_exit(&assetLock);
+    return s != ASSET_NONE ? &assetSlots[s].surface : NULL;
+}
+
+bool GFX_drawAsset(uint16_t id, int16_t x, int16_t y)
+{
+    const GFXsurface *sf = GFX_assetGet(id);
+    if (sf == NULL)
+        return false;
+
+    // Visible part of the image
+    int16_t x0 = x < 0 ? 0 : x, x1 = x + sf->width > (int16_t)_width ? _width : x + sf->width;
+    int16_t y0 = y < 0 ? 0 : y, y1 = y + sf->height > (int16_t)_height ? _height : y + sf->height;
+    if (x0 >= x1 || y0 >= y1)
+        return true;
+    uint16_t w = x1 - x0;
+    static uint16_t rowBuf[320];
+
+    if (!GFX_stencilBoxVisible(x0, y0, w, y1 - y0))
+    {
+        // Partly hidden: each row's visible spans only
+        for (int16_t yy = y0; yy < y1; yy++)
+        {
+            size_t off = (size_t)(yy - y) * sf->width + (x0 - x);
+            if (!sf->pixels)
+                for (uint16_t i = 0; i < w; i++)
+                    rowBuf[i] = sf->palette[sf->indices[off + i]];
+            GFX_stencilCopyRow(x0, yy, sf->pixels ? sf->pixels + off : rowBuf, w);
+        }
+        return true;
+    }
+
+    if (gfxFramebuffer != NULL)
+    {
+        for (int16_t yy = y0; yy < y1; yy++)
+        {
+            uint16_t *dst = GFX_getRow(yy) + x0;
+            size_t off = (size_t)(yy - y) * sf->width + (x0 - x);
+            if (sf->pixels)
+                memcpy(dst, sf->pixels + off, w * sizeof(uint16_t));
+            else
+                for (uint16_t i = 0; i < w; i++)
+                    dst[i] = sf->palette[sf->indices[off + i]];
+        }
+        return true;
+    }
+
+    // Direct mode: one window, paletted rows expanded a row at a time
+    if (gfxDeferActive)
+        GFX_deferResolve();
+    LCD_cacheFlush();
+    LCD_beginWrite(x0, y0, w, y1 - y0);
+    for (int16_t yy = y0; yy < y1; yy++)
+    {
+        size_t off = (size_t)(yy - y) * sf->width + (x0 - x);
+        if (sf->pixels)
+            LCD_pushPixels(sf->pixels + off, w);
+        else
+        {
+            for (uint16_t i = 0; i < w; i++)
+                rowBuf[i] = sf->palette[sf->indices[off + i]];
+            LCD_pushPixels(rowBuf, w);
+        }
+    }
+    LCD_endWrite();
+    return true;
+}
+
+bool GFX_assetPin(uint16_t id)
+{
+    if (!assetLockReady)
+        return false;
+    critical_section_enter_blocking(&assetLock);
+    assetPoolReady();
+    uint8_t s = assetLoad(id, false);
+    if (s != ASSET_NONE && assetSlots[s].pins < 255)
+        assetSlots[s].pins++;
+    critical_section_exit(&assetLock);
+    return s != ASSET_NONE;
+}
+
+void GFX_assetUnpin(uint16_t id)
+{
+    if (!assetLockReady)
+        return;
+    critical_section_enter_blocking(&assetLock);
+    uint8_t s = assetFind(id);
+    if (s != ASSET_NONE && assetSlots[s].pins)
+        assetSlots[s].pins--;
+    critical_section_exit(&assetLock);
+}
+
+void GFX_assetPrefetch(const uint16_t *ids, uint8_t count)
+{
+    if (!assetLockReady)
+        return;
+    critical_section_enter_blocking(&assetLock);
+    assetPoolReady(); // Here, so the prefetching core never allocates
+    assetEpoch++;
+    assetQueueHead = 0;
+    assetQueueCount = count < GFX_ASSET_PREFETCH_QUEUE ? count : GFX_ASSET_PREFETCH_QUEUE;
+    memcpy(assetQueue, ids, assetQueueCount * sizeof(uint16_t));
+    critical_section_exit(&assetLock);
+    __sev(); // Wake GFX_assetPrefetchLoop()
+}
+
+bool GFX_assetPrefetchStep()
+{
+    if (!assetLockReady)
+        return false;
+    critical_section_enter_blocking(&assetLock);
+    bool queued = assetQueueCount != 0;
+    if (queued)
+    {
+        uint16_t id = assetQueue[assetQueueHead++];
+        assetQueueCount--;
+        assetLoad(id, true);
+    }
+    critical_section_exit(&assetLock);
+    return queued;
+}
+
+void GFX_assetPrefetchLoop()
+{
+    while (true)
+    {
+        if (!GFX_assetPrefetchStep())
+            __wfe();
+    }
+}
+
+size_t GFX_assetBytes(const GFXasset *asset)
+{
+    size_t pixels = (size_t)asset->width * asset->height;
+    if (asset->format == GFX_ASSET_PAL8)
+        return asset->colors * sizeof(uint16_t) + pixels;
+    return pixels * sizeof(uint16_t);
+}
+
+bool GFX_assetDecodeRaw(const GFXasset *asset, void *dst)
+{
+    size_t bytes = GFX_assetBytes(asset);
+    if (asset->size < bytes)
+        return false;
+    memcpy(dst, asset->data, bytes);
+    return true;
+}
+
+bool GFX_assetDecodeRle(const GFXasset *asset, void *dst)
+{
+    size_t left = (size_t)asset->width * asset->height;
+
+    if (asset->format != GFX_ASSET_PAL8)
+    {
+        const uint16_t *in = (const uint16_t *)asset->data;
+        const uint16_t *end = in + asset->size / sizeof(uint16_t);
+        uint16_t *out = (uint16_t *)dst;
+        while (left)
+        {
+            if (end - in < 2 || in[0] == 0 || in[0] > left)
+                return false;
+            for (uint16_t i = 0; i < in[0]; i++)
+                *out++ = in[1];
+            left -= in[0];
+            in += 2;
+        }
+        return true;
+    }
+
+    size_t paletteBytes = asset->colors * sizeof(uint16_t);
+    if (asset->size < paletteBytes)
+        return false;
+    memcpy(dst, asset->data, paletteBytes);
+    const uint8_t *in = (const uint8_t *)asset->data + paletteBytes;
+    const uint8_t *end = (const uint8_t *)asset->data + asset->size;
+    uint8_t *out = (uint8_t *)dst + paletteBytes;
+    while (left)
+    {
+        if (end - in < 2 || in[0] == 0 || in[0] > left || in[1] >= asset->colors)
+            return false;
+        memset(out, in[1], in[0]);
+        out += in[0];
+        left -= in[0];
+        in += 2;
+    }
+    return true;
+}
+
+void GFX_releaseAssetCache()
+{
+    if (!assetLockReady)
+        return;
+    critical_section_enter_blocking(&assetLock);
+    assetClear();
+    // Keep the pool for reuse unless the budget has changed since it was
+    // taken. Then it goes back to the arena if nothing was allocated above it.
+    assetCheckArena();
+    if (assetPool != NULL && assetPoolSize != assetBudget && GFX_arenaMark() == assetTop)
+    {
+        GFX_arenaRelease(assetMark);
+        assetPool = NULL;
+        assetPoolSize = 0;
+    }
+    critical_section_exit(&assetLock);
+}
+
+void GFX_setAssetCacheBudget(size_t bytes)
+{
+    assetBudget = bytes;
+}
+
+size_t GFX_assetCacheUsed()
+{
+    return assetUsed;
+}
+
+void GFX_getAssetStats(GFXassetStats *stats)
+{
+    *stats = assetStats;
+}
+
+void GFX_resetAssetStats()
+{
+    memset(&assetStats, 0, sizeof(assetStats));
+}
@@ -0,0 +1,203 @@
+/**
+ * @file gfxasset.h
+ * @brief SRAM cache of decoded image assets with LRU eviction
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Icons and images kept compressed in flash have to be decoded before they
+ * can be drawn. Decoding on every draw costs far more than drawing on the
+ * M0+, and the same icons turn up on screen after screen. The application
+ * registers a table of assets. An asset's ID is its index in that table.
+ * GFX_assetGet() decodes an asset the first time it is asked for and keeps
+ * the RGB565 or paletted result in a pool in the display arena. Later calls
+ * find it through a small open-addressed hash. When the pool budget or the
+ * slots run out, the least recently used asset goes first. Pinned assets
+ * and assets still being decoded are never evicted.
+ *
+ * GFX_assetPrefetch() queues the assets of the next screen and
+ * GFX_assetPrefetchStep() decodes them one at a time. Either call the step
+ * from the main loop when idle, or run GFX_assetPrefetchLoop() on core 1.
+ * Prefetching never evicts assets drawn since the previous
+ * GFX_assetPrefetch() call, so it cannot pull the current screen's images
+ * out from under core 0.
+ */
+
+#ifndef GFXASSET_H
+#define GFXASSET_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define GFX_ASSET_RGB565 0 ///< Decodes to width*height RGB565 pixels
+#define GFX_ASSET_PAL8 1   ///< Decodes to a palette followed by width*height 8-bit indices
+
+/** @brief Default display arena bytes reserved for decoded assets */
+#ifndef GFX_ASSET_RAM_BUDGET
+#define GFX_ASSET_RAM_BUDGET 16384
+#endif
+
+/** @brief Most assets held at once (a power of two; the hash has twice as many entries) */
+#ifndef GFX_ASSET_SLOTS
+#define GFX_ASSET_SLOTS 32
+#endif
+
+/** @brief Asset IDs that can wait in the prefetch queue */
+#ifndef GFX_ASSET_PREFETCH_QUEUE
+#define GFX_ASSET_PREFETCH_QUEUE 16
+#endif
+
+/** @brief An image in flash and how to decode it */
+typedef struct GFXasset
+{
+    const void *data; ///< Encoded data
+    uint32_t size;    ///< Encoded bytes
+    uint16_t width;   ///< Width in pixels
+    uint16_t height;  ///< Height in pixels
+    uint8_t format;   ///< GFX_ASSET_RGB565 or GFX_ASSET_PAL8
+    uint16_t colors;  ///< Palette entries (GFX_ASSET_PAL8)
+    /**
+     * Decoder: writes the decoded image to dst (GFX_assetBytes() long) and
+     * returns false if the data is corrupt. GFX_assetDecodeRaw and
+     * GFX_assetDecodeRle are provided.
+     */
+    bool (*decode)(const struct GFXasset *asset, void *dst);
+} GFXasset;
+
+/** @brief A decoded asset, either RGB565 or paletted */
+typedef struct
+{
+    const uint16_t *pixels;  ///< RGB565 pixels, or NULL
+    const uint8_t *indices;  ///< Paletted pixels, or NULL
+    const uint16_t *palette; ///< RGB565 palette for paletted pixels
+    uint16_t width;          ///< Width in pixels
+    uint16_t height;         ///< Height in pixels
+} GFXsurface;
+
+/** @brief Asset cache counters (since the last GFX_resetAssetStats()) */
+typedef struct
+{
+    uint32_t hits;         ///< GFX_assetGet() calls that found the asset decoded
+    uint32_t misses;       ///< GFX_assetGet() calls that had to decode it
+    uint32_t prefetches;   ///< Assets decoded by GFX_assetPrefetchStep()
+    uint32_t evictions;    ///< Assets dropped to make room
+    uint32_t failures;     ///< Assets that did not fit or failed to decode
+    uint32_t bytesDecoded; ///< Bytes written by decoders
+} GFXassetStats;
+
+/**
+ * @brief Register the application's assets and empty the cache
+ * @param table Assets, indexed by asset ID
+ * @param count Number of assets
+ * @note Call once from core 0 before anything else here, and before
+ *       starting GFX_assetPrefetchLoop(). The pool is taken from the arena
+ *       here, and again by the other core 0 calls (GFX_assetGet(),
+ *       GFX_assetPin(), GFX_assetPrefetch()) once the arena has released it;
+ *       GFX_assetPrefetchStep() never allocates.
+ */
+void GFX_assetSetTable(const GFXasset *table, uint16_t count);
+
+/**
+ * @brief Decoded asset, decoding it first if it is not cached
+ * @param id Asset ID
+ * @return The surface, or NULL if the ID is unknown, the asset does not fit
+ *         or it fails to decode. Unless the asset is pinned, the surface is
+ *         valid until the next GFX_assetGet() or GFX_drawAsset().
+ */
+const GFXsurface *GFX_assetGet(uint16_t id);
+
+/**
+ * @brief Draw a decoded asset with its top-left corner at (x, y)
+ * @param id Asset ID
+ * @param x Screen X
+ * @param y Screen Y
+ * @return false if the asset could not be decoded
+ */
+bool GFX_drawAsset(uint16_t id, int16_t x, int16_t y);
+
+/**
+ * @brief Decode an asset if needed and keep it cached until GFX_assetUnpin()
+ * @return false if the asset could not be decoded
+ * @note Pins nest; each GFX_assetPin() needs its own GFX_assetUnpin()
+ */
+bool GFX_assetPin(uint16_t id);
+
+/**
+ * @brief Let a pinned asset be evicted again
+ */
+void GFX_assetUnpin(uint16_t id);
+
+/**
+ * @brief Queue assets for GFX_assetPrefetchStep() to decode ahead of use
+ * @param ids Asset IDs, typically the ones the next screen draws
+ * @param count Number of IDs; those that do not fit the queue are dropped
+ * @note Replaces what is still queued. Prefetching does not evict assets
+ *       used since the previous call, which the current screen is drawing.
+ */
+void GFX_assetPrefetch(const uint16_t *ids, uint8_t count);
+
+/**
+ * @brief Decode the next queued asset
+ * @return false if the queue was empty
+ */
+bool GFX_assetPrefetchStep();
+
+/**
+ * @brief Decode queued assets forever, sleeping while the queue is empty
+ * @note Entry point for multicore_launch_core1() (link pico_multicore)
+ */
+void GFX_assetPrefetchLoop();
+
+/**
+ * @brief Bytes needed by an asset once decoded
+ */
+size_t GFX_assetBytes(const GFXasset *asset);
+
+/**
+ * @brief Decoder for data already in decoded layout (palette first for GFX_ASSET_PAL8)
+ */
+bool GFX_assetDecodeRaw(const GFXasset *asset, void *dst);
+
+/**
+ * @brief Run-length decoder
+ *
+ * GFX_ASSET_RGB565 data is (count, color) pairs of 16-bit words.
+ * GFX_ASSET_PAL8 data is the palette as 16-bit words, then (count, index)
+ * byte pairs. Counts are 1 or more, and runs may cross row ends.
+ */
+bool GFX_assetDecodeRle(const GFXasset *asset, void *dst);
+
+/**
+ * @brief Drop all cached assets (pinned ones too) and clear the prefetch queue
+ * @note Waits for a decode running on the other core to finish first. The
+ *       pool is kept for reuse unless the budget has changed; the cache also
+ *       empties itself when the arena is released past it, but call this
+ *       first if the other core may be prefetching, as GFX_configure() does.
+ */
+void GFX_releaseAssetCache();
+
+/**
+ * @brief Change the pool size
+ * @param bytes New pool size in bytes
+ * @note Takes effect when the pool is next taken: at the next
+ *       GFX_releaseAssetCache() if the pool is still the newest arena
+ *       allocation, otherwise once the arena is released past it
+ */
+void GFX_setAssetCacheBudget(size_t bytes);
+
+/**
+ * @brief Bytes of the pool held by decoded assets
+ */
+size_t GFX_assetCacheUsed();
+
+/**
+ * @brief Read the asset cache counters
+ * @param stats Destination for the counters
+ */
+void GFX_getAssetStats(GFXassetStats *stats);
+
+/**
+ * @brief Reset the asset cache counters
+ */
+void GFX_resetAssetStats();
+
+#endif
@@ -0,0 +1,184 @@
+// Fixed-point affine blitter
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Everything is integer: the M0+ has no FPU and no hardware divide for
+// 64-bit values, so divisions only happen once per destination row when the
+// visible span is computed, never per pixel.
+
+#include "pico/stdlib.h"
+#include "gfx.h"
+#include "gfxblit.h"
+#include "gfxstencil.h"
+
+// sin(0..90 degrees) in Q15
+static const int16_t sinTableQ15[91] = {
+    0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126,
+    5690, 6252, 6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+    16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+    21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+    25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+    28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+    30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+    32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+    32767};
+
+static int32_t sinQ15(int16_t deg)
+{
+    deg %= 360;
+    if (deg < 0)
+        deg += 360;
+    if (deg <= 90)
+        return sinTableQ15[deg];
+    if (deg <= 180)
+        return sinTableQ15[180 - deg];
+    if (deg <= 270)
+        return -sinTableQ15[deg - 180];
+    return -sinTableQ15[360 - deg];
+}
+
+bool GFX_affineRotateScale(GFXaffine *m, int16_t angleDeg, int32_t scale,
+                           int16_t srcX, int16_t srcY, int16_t dstX, int16_t dstY)
+{
+    if (scale <= 0)
+    {
+        // No inverse: map every pixel left of the source so nothing is drawn
+        *m = {0, 0, -0x10000, 0, 0, 0};
+        return false;
+    }
+
+    // Inverse of "rotate clockwise by angle, then scale": rotate back by the
+    // transposed matrix and divide by the scale
+    int64_t inv = ((int64_t)1 << 32) / scale; // 1/scale in 16.16
+    int32_t cs = (int32_t)((sinQ15(angleDeg + 90) * inv) >> 15);
+    int32_t sn = (int32_t)((sinQ15(angleDeg) * inv) >> 15);
+
+    m->a = cs;
+    m->b = sn;
+    m->c = -sn;
+    m->d = cs;
+
+    // Sample at destination pixel centres: u(x + 0.5, y + 0.5) relative to the pivot
+    m->tx = ((int32_t)srcX << 16) - (int32_t)((int64_t)cs * dstX + (int64_t)sn * dstY) + (cs + sn) / 2;
+    m->ty = ((int32_t)srcY << 16) - (int32_t)((int64_t)-sn * dstX + (int64_t)cs * dstY) + (cs - sn) / 2;
+    return true;
+}
+
+static int32_t floorDiv(int64_t n, int32_t d)
+{
+    return (int32_t)(n >= 0 ? n / d : -((-n + d - 1) / d));
+}
+
+// Narrow [*lo, *hi] to the steps i for which min <= f0 + s*i <= max
+static void spanLimit(int32_t f0, int32_t s, int32_t min, int32_t max, int32_t *lo, int32_t *hi)
+{
+    int32_t a, b;
+    if (s == 0)
+    {
+        if (f0 < min || f0 > max)
+            *hi = -1;
+        return;
+    }
+    if (s > 0)
+    {
+        a = -floorDiv((int64_t)f0 - min, s); // ceil((min - f0) / s)
+        b = floorDiv((int64_t)max - f0, s);
+    }
+    else
+    {
+        a = -floorDiv((int64_t)max - f0, -s); // ceil((f0 - max) / -s)
+        b = floorDiv((int64_t)f0 - min, -s);
+    }
+    if (a > *lo)
+        *lo = a;
+    if (b < *hi)
+        *hi = b;
+}
+
+void __time_critical_func(GFX_blitAffine)(const GFXimage *src, const GFXaffine *m,
+                                          int16_t x, int16_t y, int16_t w, int16_t h,
+                                          uint8_t flags, uint16_t key)
+{
+    int16_t sw = GFX_getWidth(), sh = GFX_getHeight();
+    bool bilinear = flags & GFX_BLIT_BILINEAR;
+    bool keyed = flags & GFX_BLIT_COLORKEY;
+
+    // Clip the destination rectangle to the screen once
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > sw)
+        w = sw - x;
+    if (y + h > sh)
+        h = sh - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    // Bilinear reads the pixel to the right and below, and samples relative to
+    // source pixel centres
+    int32_t uMax = ((int32_t)src->width << 16) - 1;
+    int32_t vMax = ((int32_t)src->height << 16) - 1;
+    int32_t bias = 0;
+    if (bilinear)
+    {
+        uMax -= 0x10000;
+        vMax -= 0x10000;
+        bias = 0x8000;
+    }
+
+    for (int16_t yy = y; yy < y + h; yy++)
+    {
+        int32_t u = (int32_t)((int64_t)m->a * x + (int64_t)m->b * yy + m->tx) - bias;
+        int32_t v = (int32_t)((int64_t)m->c * x + (int64_t)m->d * yy + m->ty) - bias;
+
+        // Visible part of this row, solved from the linear u(i), v(i)
+        int32_t i0 = 0, i1 = w - 1;
+        spanLimit(u, m->a, 0, uMax, &i0, &i1);
+        spanLimit(v, m->c, 0, vMax, &i0, &i1);
+        if (i0 > i1)
+            continue;
+
+        uint16_t *out = gfxFramebuffer ? GFX_getRow(yy) + x : NULL;
+        uint16_t count;
+        const GFXspan *sp = GFX_stencilRow(yy, &count);
+        int32_t u0 = u, v0 = v;
+
+        for (uint16_t s = 0; s < count; s++)
+        {
+            // Part of the row inside this visible span
+            int32_t lo = sp[s].x0 - x > i0 ? sp[s].x0 - x : i0;
+            int32_t hi = sp[s].x1 - x < i1 ? sp[s].x1 - x : i1;
+            u = u0 + m->a * lo;
+            v = v0 + m->c * lo;
+            for (int32_t i = lo; i <= hi; i++, u += m->a, v += m->c)
+            {
+                const uint16_t *p = src->pixels + (v >> 16) * src->stride + (u >> 16);
+                uint16_t col;
+
+                if (keyed && *p == key)
+                    continue;
+                if (bilinear)
+                {
+                    uint8_t fx = (u >> 11) & 31, fy = (v >> 11) & 31;
+                    uint16_t top = GFX_blend565(p[1], p[0], fx);
+                    uint16_t bottom = GFX_blend565(p[src->stride + 1], p[src->stride], fx);
+                    col = GFX_blend565(bottom, top, fy);
+                }
+                else
+                    col = *p;
+
+                if (out)
+                    out[i] = col;
+                else
+                    GFX_drawPixel(x + i, yy, col);
+            }
+        }
+    }
+}
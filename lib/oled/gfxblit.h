@@ -0,0 +1,74 @@
+/**
+ * @file gfxblit.h
+ * @brief Fixed-point affine blitter for rotated and scaled RGB565 sprites
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * GFX_blitAffine() walks the destination rectangle and maps every pixel back
+ * into the source image with a 16.16 fixed-point inverse matrix, stepping
+ * incrementally along each span. The part of each row that lands inside the
+ * source is found analytically, so the inner loop has no bounds tests.
+ */
+
+#ifndef GFXBLIT_H
+#define GFXBLIT_H
+
+#include <stdint.h>
+
+/** @brief RGB565 source image */
+typedef struct
+{
+    const uint16_t *pixels; ///< First pixel of the image
+    uint16_t width;         ///< Width in pixels
+    uint16_t height;        ///< Height in pixels
+    uint16_t stride;        ///< Distance between rows, in pixels
+} GFXimage;
+
+/**
+ * @brief Inverse mapping from destination to source, all values 16.16
+ *
+ * For destination pixel (x, y): u = a*x + b*y + tx, v = c*x + d*y + ty,
+ * where (u, v) is the source position sampled for that pixel.
+ */
+typedef struct
+{
+    int32_t a, b, tx;
+    int32_t c, d, ty;
+} GFXaffine;
+
+#define GFX_BLIT_NEAREST 0x00  ///< Nearest-neighbour sampling
+#define GFX_BLIT_BILINEAR 0x01 ///< 2x2 bilinear sampling
+#define GFX_BLIT_COLORKEY 0x02 ///< Skip source pixels equal to the key color
+
+/**
+ * @brief Build a rotate-and-scale mapping around two pivot points
+ * @param m Matrix to fill
+ * @param angleDeg Clockwise rotation in degrees (any value, wraps)
+ * @param scale Scale factor in 16.16 (0x10000 = 1.0, 0x20000 = 2x larger)
+ * @param srcX Pivot X in the source image
+ * @param srcY Pivot Y in the source image
+ * @param dstX Where the source pivot lands on screen, X
+ * @param dstY Where the source pivot lands on screen, Y
+ * @return false if scale is not positive; m then maps nothing, so a blit
+ *         with it draws no pixels
+ */
+bool GFX_affineRotateScale(GFXaffine *m, int16_t angleDeg, int32_t scale,
+                           int16_t srcX, int16_t srcY, int16_t dstX, int16_t dstY);
+
+/**
+ * @brief Draw a transformed image into a destination rectangle
+ * @param src Source image
+ * @param m Destination-to-source mapping
+ * @param x Destination rectangle X
+ * @param y Destination rectangle Y
+ * @param w Destination rectangle width
+ * @param h Destination rectangle height
+ * @param flags GFX_BLIT_* flags
+ * @param key Transparent color when GFX_BLIT_COLORKEY is set
+ * @note Destination pixels that map outside the source are left untouched
+ */
+void GFX_blitAffine(const GFXimage *src, const GFXaffine *m,
+                    int16_t x, int16_t y, int16_t w, int16_t h,
+                    uint8_t flags, uint16_t key);
+
+#endif
@@ -0,0 +1,166 @@
+// Rendering configuration under a RAM budget
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Planning is a greedy walk over the components, cheapest decision first:
+// - the framebuffer is taken whole or not at all, since it is worth more
+//   than every cache together (no per-pixel commands, DMA flushes);
+// - the glyph caches take what they can get, down to a useful minimum;
+// - the display list is fixed size and only wanted for layered screens.
+// GFX_PRIO_TEXT moves the glyph caches ahead of the framebuffer, and
+// GFX_PRIO_LAYERED the display list ahead of the glyph caches.
+
+#include <stdio.h>
+#include <string.h>
+#include "gfxconfig.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxasset.h"
+#include "gfxdefer.h"
+#include "gfxoutline.h"
+#include "gfxstencil.h"
+#include "fontcache.h"
+#include "pixcache.h"
+#include "readcache.h"
+#include "lcdstream.h"
+#include "pico/stdlib.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+static GFXconfig cfgCurrent = {0, 0, false, false, false, 0, 0, 0, 0, 0};
+
+// Arena allocations are rounded up to words
+static size_t cfgAlign(size_t bytes)
+{
+    return (bytes + 3) & ~(size_t)3;
+}
+
+static void cfgGlyphs(GFXconfig *cfg, size_t *left)
+{
+    size_t font = *left < GFX_FONT_RAM_BUDGET ? *left : GFX_FONT_RAM_BUDGET;
+    if (font >= GFX_CONFIG_MIN_GLYPH_CACHE)
+    {
+        cfg->fontCacheBytes = font;
+        *left -= font;
+    }
+
+    size_t outline = *left < GFX_OUTLINE_CACHE_BYTES ? *left : GFX_OUTLINE_CACHE_BYTES;
+    outline &= 0xFFFC; // Fits the pool's 16-bit offsets, whole words
+    if (outline >= GFX_CONFIG_MIN_GLYPH_CACHE)
+    {
+        cfg->outlineCacheBytes = (uint16_t)outline;
+        *left -= outline;
+    }
+}
+
+static void cfgDisplayList(GFXconfig *cfg, size_t *left)
+{
+    size_t bytes = cfgAlign(GFX_deferBytes());
+    if (bytes > *left)
+        return;
+    cfg->deferred = true;
+    cfg->displayListBytes = bytes;
+    *left -= bytes;
+}
+
+void GFX_planConfig(uint16_t width, uint16_t height, size_t ramBudget, uint8_t priorities, GFXconfig *cfg)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->width = width;
+    cfg->height = height;
+
+    size_t left = ramBudget;
+    bool glyphsFirst = (priorities & GFX_PRIO_TEXT) && !(priorities & GFX_PRIO_FRAMERATE);
+    if (glyphsFirst)
+        cfgGlyphs(cfg, &left);
+
+    size_t fb = cfgAlign((size_t)width * height * sizeof(uint16_t));
+    if (fb <= left)
+    {
+        cfg->framebuffer = true;
+        cfg->framebufferBytes = fb;
+        cfg->flushQueue = (priorities & GFX_PRIO_FRAMERATE) != 0;
+        left -= fb;
+    }
+
+    if (priorities & GFX_PRIO_LAYERED)
+        cfgDisplayList(cfg, &left);
+    if (!glyphsFirst)
+        cfgGlyphs(cfg, &left);
+
+    cfg->totalBytes = ramBudget - left;
+}
+
+bool GFX_configure(size_t ramBudget, uint8_t priorities)
+{
+    if (ramBudget > GFX_ARENA_SIZE)
+        ramBudget = GFX_ARENA_SIZE;
+    GFX_planConfig(_width, _height, ramBudget, priorities, &cfgCurrent);
+
+    // Tear down the old setup before the arena goes
+    GFX_setDeferred(false);
+    GFX_setFlushQueue(false); // Waits for queued rows
+    GFX_releaseAssetCache();  // Waits for a decode on core 1, which writes into the arena
+    GFX_destroyFramebuf();
+    GFX_arenaReset();
+    GFX_stencilCheckArena();
+    GFX_releaseFontCache();
+
+    // Caches are sized now and fill up on first use
+    GFX_setFontCacheBudget(cfgCurrent.fontCacheBytes);
+    GFX_setFontAutoCache(cfgCurrent.fontCacheBytes > 0);
+    GFX_setOutlineCacheBytes(cfgCurrent.outlineCacheBytes);
+
+    bool ok = true;
+    if (cfgCurrent.framebuffer && !GFX_createFramebuf())
+    {
+        ok = false;
+        cfgCurrent.framebuffer = false;
+        cfgCurrent.flushQueue = false;
+        cfgCurrent.totalBytes -= cfgCurrent.framebufferBytes;
+        cfgCurrent.framebufferBytes = 0;
+    }
+    GFX_setFlushQueue(cfgCurrent.flushQueue);
+    if (cfgCurrent.deferred && !GFX_setDeferred(true))
+    {
+        ok = false;
+        cfgCurrent.deferred = false;
+        cfgCurrent.totalBytes -= cfgCurrent.displayListBytes;
+        cfgCurrent.displayListBytes = 0;
+    }
+    return ok;
+}
+
+void GFX_getConfig(GFXconfig *cfg)
+{
+    *cfg = cfgCurrent;
+}
+
+void GFX_memoryReport()
+{
+    GFXmemUsage usage;
+    GFXoutlineCacheStats outline;
+    GFX_arenaGetUsage(&usage);
+    GFX_getOutlineCacheStats(&outline);
+
+    printf("Display configuration for %ux%u: %s, flush queue %s, deferred %s\n",
+           cfgCurrent.width, cfgCurrent.height, cfgCurrent.framebuffer ? "framebuffer" : "direct mode",
+           cfgCurrent.flushQueue ? "on" : "off", cfgCurrent.deferred ? "on" : "off");
+    printf("  %-14s %6u bytes (planned %u)\n", "framebuffer",
+           (unsigned)usage.consumer[GFX_MEM_FRAMEBUFFER], (unsigned)cfgCurrent.framebufferBytes);
+    printf("  %-14s %6u bytes (budget %u)\n", "font copies",
+           (unsigned)GFX_fontCacheUsed(), (unsigned)GFX_fontCacheBudget());
+    printf("  %-14s %6u bytes (pool %u)\n", "outline glyphs",
+           (unsigned)outline.bytes, (unsigned)GFX_outlineCacheBytes());
+    printf("  %-14s %6u bytes (planned %u)\n", "display list",
+           (unsigned)usage.consumer[GFX_MEM_DISPLAYLIST], (unsigned)cfgCurrent.displayListBytes);
+    printf("  %-14s %6u bytes\n", "total planned", (unsigned)cfgCurrent.totalBytes);
+
+    printf("Static pixel buffers:\n");
+    printf("  %-14s %6u bytes\n", "pixel cache", (unsigned)(PIXCACHE_SIZE * sizeof(uint16_t)));
+    printf("  %-14s %6u bytes\n", "read cache",
+           (unsigned)(READCACHE_TILES * READCACHE_TILE_W * READCACHE_TILE_H * sizeof(uint16_t)));
+    printf("  %-14s %6u bytes\n", "stream buffers", (unsigned)(2 * LCD_STREAM_PIXELS * sizeof(uint16_t)));
+
+    GFX_arenaReport();
+}
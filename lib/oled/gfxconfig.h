@@ -0,0 +1,90 @@
+/**
+ * @file gfxconfig.h
+ * @brief Pick the rendering configuration that fits a RAM budget
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Whether a full framebuffer fits depends on the panel size, the rotation
+ * and whatever else the firmware keeps in the display arena. A 135x240
+ * framebuffer takes 63 KB, a 240x320 one 150 KB, which leaves only 20 KB of
+ * the default arena for everything else. GFX_configure() works this out once, at start-up: given
+ * the arena bytes the display may use, it chooses
+ * - framebuffer or direct mode (pixels go to the panel through the
+ *   write-combining cache),
+ * - the background flush queue, with a framebuffer,
+ * - the SRAM font budget and the outline glyph cache size,
+ * - deferred mode and its display list,
+ * in the order the priorities ask for, and applies the choice.
+ *
+ * GFX_planConfig() makes the same choice without touching anything, for a
+ * panel of any size, so layouts can be checked ahead of time or on a host.
+ */
+
+#ifndef GFXCONFIG_H
+#define GFXCONFIG_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** @brief Priorities for GFX_configure(), combined with | */
+#define GFX_PRIO_FRAMERATE 0x01 ///< Frames redraw most of the screen: framebuffer and flush queue first
+#define GFX_PRIO_TEXT 0x02      ///< Text-heavy screens: glyph caches before the framebuffer
+#define GFX_PRIO_LAYERED 0x04   ///< Overlapping panels: deferred mode before the glyph caches
+
+/** @brief Smallest glyph cache worth having; less than this is left unused */
+#ifndef GFX_CONFIG_MIN_GLYPH_CACHE
+#define GFX_CONFIG_MIN_GLYPH_CACHE 1024
+#endif
+
+/** @brief A rendering configuration and what it costs */
+typedef struct
+{
+    uint16_t width;             ///< Panel width the choice was made for
+    uint16_t height;            ///< Panel height the choice was made for
+    bool framebuffer;           ///< Full RGB565 framebuffer, otherwise direct mode
+    bool flushQueue;            ///< GFX_flush() through the background queue
+    bool deferred;              ///< Deferred frame mode with its display list
+    size_t framebufferBytes;    ///< Arena bytes for the framebuffer
+    size_t fontCacheBytes;      ///< SRAM font budget (0: fonts stay in flash)
+    uint16_t outlineCacheBytes; ///< Outline glyph cache pool (0: no cache)
+    size_t displayListBytes;    ///< Arena bytes for the display list
+    size_t totalBytes;          ///< Sum of the above, at most the budget
+} GFXconfig;
+
+/**
+ * @brief Choose a configuration without applying it
+ * @param width Panel width in pixels, as rotated
+ * @param height Panel height in pixels, as rotated
+ * @param ramBudget Display arena bytes the configuration may use
+ * @param priorities GFX_PRIO_ flags, or 0 for the fastest general setup
+ * @param cfg Destination for the choice
+ */
+void GFX_planConfig(uint16_t width, uint16_t height, size_t ramBudget, uint8_t priorities, GFXconfig *cfg);
+
+/**
+ * @brief Choose and apply the fastest configuration that fits a RAM budget
+ * @param ramBudget Display arena bytes for buffers and caches; clamped to GFX_ARENA_SIZE.
+ *                  What is left of the arena stays free for text boxes, tile maps and paths.
+ * @param priorities GFX_PRIO_ flags, or 0 for the fastest general setup
+ * @return false if a chosen buffer could not be allocated; that part is
+ *         left off (direct mode for the framebuffer) and GFX_getConfig() says so
+ * @note Resets the display arena, so call it at start-up or on a mode
+ *       switch, and again after a rotation that changes the panel shape.
+ *       With GFX_PRIO_FRAMERATE the flush queue is on: see GFX_setFlushQueue().
+ */
+bool GFX_configure(size_t ramBudget, uint8_t priorities);
+
+/**
+ * @brief Configuration chosen by the last GFX_configure()
+ * @param cfg Destination for the configuration
+ */
+void GFX_getConfig(GFXconfig *cfg);
+
+/**
+ * @brief Print what each display component uses on stdout
+ * @note Budgets from GFX_configure() next to what is actually in use,
+ *       the static pixel buffers outside the arena, then GFX_arenaReport()
+ */
+void GFX_memoryReport();
+
+#endif
@@ -0,0 +1,365 @@
+// Deferred frame mode with occlusion culling
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Entries are kept in recording order. GFX_deferResolve() makes two passes:
+// - Backwards: each entry's box is clipped against the covered region, a
+//   list of disjoint rectangles. If nothing is left the entry is culled.
+//   A fill keeps the rectangles that are left, up to a few per fill. An
+//   opaque entry then adds its box to the region.
+// - Forwards: the surviving entries are drawn with recording switched off.
+//
+// The region is allowed to under-cover when it runs out of room, and a fill
+// that breaks into too many pieces is simply drawn whole. Both only give
+// up some savings; the output is the same.
+
+#include "gfxdefer.h"
+#include "gfx.h"
+#include "gfxfont.h"
+#include "fontcache.h"
+#include "gfxarena.h"
+#include "pico/stdlib.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+extern GFXfont *gfxFont;
+
+#define DL_FILL 0
+#define DL_CHAR 1
+#define DL_CALL 2
+
+#define DL_OPAQUE 0x01
+#define DL_CULLED 0x02
+#define DL_TRIMMED 0x04
+
+#define MAX_VISIBLE 8 // Pieces a box may break into before it counts as fully visible
+
+typedef struct
+{
+    int16_t x0, y0, x1, y1; // x1, y1 exclusive
+} DLrect;
+
+typedef struct
+{
+    DLrect box; // Clipped to the screen
+    uint8_t type, flags;
+    uint16_t color;
+    union
+    {
+        struct
+        {
+            uint16_t first, count; // Trimmed pieces in dlPieces
+        } fill;
+        struct
+        {
+            int16_t x, y;
+            const GFXfont *font; // As passed to GFX_setFont(), not its SRAM copy
+            uint16_t bg;
+            unsigned char c;
+            uint8_t sx, sy;
+        } ch;
+        struct
+        {
+            GFXdeferFn fn;
+            void *ctx;
+        } call;
+    };
+} DLentry;
+
+bool gfxDeferActive = false;
+
+static DLentry *dlEntries = NULL;
+static uint16_t dlCount = 0;
+static uint32_t dlGeneration;
+static DLrect dlRegion[GFX_DEFER_REGION_RECTS];
+static uint16_t dlRegionCount;
+static DLrect dlPieces[GFX_DEFER_PIECES];
+static uint16_t dlPieceCount;
+static GFXdeferStats dlStats = {0, 0, 0, 0, 0, 0};
+
+bool GFX_setDeferred(bool enable)
+{
+    if (!enable)
+    {
+        if (gfxDeferActive)
+            GFX_deferResolve();
+        gfxDeferActive = false;
+        return true;
+    }
+    if (gfxDeferActive && GFX_arenaHolds(dlEntries, dlGeneration))
+        return true; // Already recording; keep what is in the list
+    if (!GFX_arenaHolds(dlEntries, dlGeneration))
+    {
+        dlEntries = (DLentry *)GFX_arenaAlloc(GFX_DEFER_ENTRIES * sizeof(DLentry), GFX_MEM_DISPLAYLIST);
+        dlGeneration = GFX_arenaGeneration();
+        if (dlEntries == NULL)
+            return false;
+    }
+    dlCount = 0;
+    gfxDeferActive = true;
+    return true;
+}
+
+// Clip a box to the screen; false if nothing is left
+static bool dlClip(DLrect *r, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    r->x0 = x < 0 ? 0 : x;
+    r->y0 = y < 0 ? 0 : y;
+    r->x1 = x + w > (int16_t)_width ? _width : x + w;
+    r->y1 = y + h > (int16_t)_height ? _height : y + h;
+    return r->x0 < r->x1 && r->y0 < r->y1;
+}
+
+// The list lives in the arena. Once that is released past it (framebuffer
+// destroyed, GFX_configure(), an earlier mark) the entries are gone, and
+// deferred mode ends: callers draw straight away instead.
+static bool dlLost()
+{
+    if (GFX_arenaHolds(dlEntries, dlGeneration))
+        return false;
+    dlEntries = NULL;
+    dlCount = 0;
+    gfxDeferActive = false;
+    return true;
+}
+
+static DLentry *dlAdd(const DLrect *box, uint8_t type, bool opaque)
+{
+    if (dlLost())
+        return NULL;
+    if (dlCount == GFX_DEFER_ENTRIES)
+        GFX_deferResolve(); // Full: draw this batch and start another
+    DLentry *e = &dlEntries[dlCount++];
+    e->box = *box;
+    e->type = type;
+    e->flags = opaque ? DL_OPAQUE : 0;
+    dlStats.entries++;
+    dlStats.pixelsRecorded += (uint32_t)(box->x1 - box->x0) * (box->y1 - box->y0);
+    return e;
+}
+
+void GFX_deferFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    DLrect box;
+    if (!dlClip(&box, x, y, w, h))
+        return;
+    DLentry *e = dlAdd(&box, DL_FILL, true);
+    if (e == NULL)
+    {
+        if (box.x0 == 0 && box.y0 == 0 && box.x1 == _width && box.y1 == _height)
+            GFX_fillScreen(color);
+        else
+            GFX_fillRect(x, y, w, h, color);
+        return;
+    }
+    e->color = color;
+}
+
+void GFX_deferChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x,
+                   uint8_t size_y, int16_t bx, int16_t by, int16_t bw, int16_t bh, bool opaque)
+{
+    DLrect box;
+    if (!dlClip(&box, bx, by, bw, bh))
+        return;
+    DLentry *e = dlAdd(&box, DL_CHAR, opaque);
+    if (e == NULL)
+    {
+        GFX_drawChar(x, y, c, color, bg, size_x, size_y);
+        return;
+    }
+    e->color = color;
+    e->ch.x = x;
+    e->ch.y = y;
+    e->ch.font = GFX_getFont(); // The SRAM copy may move or go before the replay
+    e->ch.bg = bg;
+    e->ch.c = c;
+    e->ch.sx = size_x;
+    e->ch.sy = size_y;
+}
+
+void GFX_deferCall(int16_t x, int16_t y, int16_t w, int16_t h, bool opaque, GFXdeferFn fn, void *ctx)
+{
+    if (!gfxDeferActive)
+    {
+        fn(ctx);
+        return;
+    }
+    DLrect box;
+    if (!dlClip(&box, x, y, w, h))
+        return;
+    DLentry *e = dlAdd(&box, DL_CALL, opaque);
+    if (e == NULL)
+    {
+        fn(ctx);
+        return;
+    }
+    e->call.fn = fn;
+    e->call.ctx = ctx;
+}
+
+// out = in minus r; returns the new count, or -1 if it would exceed max
+static int dlSubtract(const DLrect *in, int n, const DLrect *r, DLrect *out, int max)
+{
+    int m = 0;
+    for (int i = 0; i < n; i++)
+    {
+        const DLrect *a = &in[i];
+        if (r->x0 >= a->x1 || r->x1 <= a->x0 || r->y0 >= a->y1 || r->y1 <= a->y0)
+        {
+            if (m == max)
+                return -1;
+            out[m++] = *a;
+            continue;
+        }
+        // Up to four pieces: above, below, then left and right of the overlap
+        int16_t oy0 = r->y0 > a->y0 ? r->y0 : a->y0;
+        int16_t oy1 = r->y1 < a->y1 ? r->y1 : a->y1;
+        DLrect p[4];
+        int k = 0;
+        if (a->y0 < oy0)
+            p[k++] = {a->x0, a->y0, a->x1, oy0};
+        if (oy1 < a->y1)
+            p[k++] = {a->x0, oy1, a->x1, a->y1};
+        if (a->x0 < r->x0)
+            p[k++] = {a->x0, oy0, r->x0, oy1};
+        if (r->x1 < a->x1)
+            p[k++] = {r->x1, oy0, a->x1, oy1};
+        if (m + k > max)
+            return -1;
+        for (int j = 0; j < k; j++)
+            out[m++] = p[j];
+    }
+    return m;
+}
+
+// What the region leaves visible of a box: the count of pieces in vis, or
+// -1 if it breaks into more than MAX_VISIBLE
+static int dlVisible(const DLrect *box, DLrect *vis)
+{
+    DLrect tmp[MAX_VISIBLE];
+    DLrect *cur = vis, *next = tmp;
+    cur[0] = *box;
+    int n = 1;
+    for (uint16_t i = 0; i < dlRegionCount && n > 0; i++)
+    {
+        n = dlSubtract(cur, n, &dlRegion[i], next, MAX_VISIBLE);
+        if (n < 0)
+            return -1;
+        DLrect *t = cur;
+        cur = next;
+        next = t;
+    }
+    if (cur != vis)
+        for (int i = 0; i < n; i++)
+            vis[i] = cur[i];
+    return n;
+}
+
+static void dlFill(const DLrect *r, uint16_t color)
+{
+    GFX_fillRect(r->x0, r->y0, r->x1 - r->x0, r->y1 - r->y0, color);
+}
+
+void GFX_deferResolve()
+{
+    if (!gfxDeferActive || dlCount == 0 || dlLost())
+        return;
+    gfxDeferActive = false; // Draw for real from here on
+
+    dlRegionCount = 0;
+    dlPieceCount = 0;
+    for (int i = dlCount - 1; i >= 0; i--)
+    {
+        DLentry *e = &dlEntries[i];
+        DLrect vis[MAX_VISIBLE];
+        int n = dlVisible(&e->box, vis);
+        if (n == 0)
+        {
+            e->flags |= DL_CULLED;
+            dlStats.culled++;
+            continue;
+        }
+
+        bool fullScreen = e->box.x0 == 0 && e->box.y0 == 0 && e->box.x1 == _width && e->box.y1 == _height;
+        if (e->type == DL_FILL && n > 0 && !(n == 1 && vis[0].x0 == e->box.x0 && vis[0].y0 == e->box.y0 &&
+                                             vis[0].x1 == e->box.x1 && vis[0].y1 == e->box.y1))
+        {
+            // A whole-screen fill is a lazy clear with a framebuffer, cheaper than any piece of it
+            if (!(fullScreen && gfxFramebuffer != NULL) && dlPieceCount + n <= GFX_DEFER_PIECES)
+            {
+                e->flags |= DL_TRIMMED;
+                e->fill.first = dlPieceCount;
+                e->fill.count = n;
+                for (int k = 0; k < n; k++)
+                    dlPieces[dlPieceCount++] = vis[k];
+                dlStats.trimmed++;
+            }
+        }
+
+        if (e->flags & DL_OPAQUE)
+        {
+            // Add what the region does not have yet, keeping it disjoint
+            if (n > 0 && dlRegionCount + n <= GFX_DEFER_REGION_RECTS)
+                for (int k = 0; k < n; k++)
+                    dlRegion[dlRegionCount++] = vis[k];
+        }
+    }
+
+    for (uint16_t i = 0; i < dlCount; i++)
+    {
+        DLentry *e = &dlEntries[i];
+        if (e->flags & DL_CULLED)
+            continue;
+        switch (e->type)
+        {
+        case DL_FILL:
+            if (e->flags & DL_TRIMMED)
+            {
+                for (uint16_t k = 0; k < e->fill.count; k++)
+                {
+                    const DLrect *r = &dlPieces[e->fill.first + k];
+                    dlFill(r, e->color);
+                    dlStats.pixelsDrawn += (uint32_t)(r->x1 - r->x0) * (r->y1 - r->y0);
+                }
+                continue;
+            }
+            if (e->box.x0 == 0 && e->box.y0 == 0 && e->box.x1 == _width && e->box.y1 == _height)
+                GFX_fillScreen(e->color);
+            else
+                dlFill(&e->box, e->color);
+            break;
+        case DL_CHAR:
+            gfxFont = (GFXfont *)GFX_fontRamLookup(e->ch.font);
+            GFX_drawChar(e->ch.x, e->ch.y, e->ch.c, e->color, e->ch.bg, e->ch.sx, e->ch.sy);
+            break;
+        case DL_CALL:
+            e->call.fn(e->call.ctx);
+            break;
+        }
+        dlStats.pixelsDrawn += (uint32_t)(e->box.x1 - e->box.x0) * (e->box.y1 - e->box.y0);
+    }
+    gfxFont = (GFXfont *)GFX_fontRamLookup(GFX_getFont());
+
+    dlStats.frames++;
+    dlCount = 0;
+    gfxDeferActive = true;
+}
+
+size_t GFX_deferBytes()
+{
+    return GFX_DEFER_ENTRIES * sizeof(DLentry);
+}
+
+void GFX_getDeferStats(GFXdeferStats *stats)
+{
+    *stats = dlStats;
+}
+
+void GFX_resetDeferStats()
+{
+    dlStats.frames = 0;
+    dlStats.entries = 0;
+    dlStats.culled = 0;
+    dlStats.trimmed = 0;
+    dlStats.pixelsRecorded = 0;
+    dlStats.pixelsDrawn = 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file gfxdefer.h
+ * @brief Deferred frame mode: record primitives, cull overdraw, then rasterise
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * A typical screen clears everything, fills panels and then draws text over
+ * them, so many pixels are written two or three times before the flush. In
+ * deferred mode, fills (GFX_fillScreen, GFX_fillRect and fast H/V lines, and
+ * therefore GFX_drawRect), characters and GFX_deferCall() boxes are only recorded
+ * into a display list. When the frame ends, the list is walked backwards
+ * while building a region (a list of disjoint rectangles) of what later
+ * opaque entries cover:
+ * - an entry whose box is completely inside it is culled;
+ * - a fill that is partly covered is cut down to its visible rectangles.
+ * The list is then drawn in the original order.
+ *
+ * The list is resolved by GFX_flush(). It is also resolved before anything
+ * that is not recorded draws or reads pixels (GFX_drawPixel, spans, rows,
+ * copies), so results are always the same as immediate drawing.
+ */
+
+#ifndef GFXDEFER_H
+#define GFXDEFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** @brief Display list entries (about 24 bytes each, from the display arena) */
+#ifndef GFX_DEFER_ENTRIES
+#define GFX_DEFER_ENTRIES 256
+#endif
+
+/** @brief Rectangles the covered region can hold; beyond that it stops growing */
+#ifndef GFX_DEFER_REGION_RECTS
+#define GFX_DEFER_REGION_RECTS 48
+#endif
+
+/** @brief Rectangles available for trimmed fills per frame */
+#ifndef GFX_DEFER_PIECES
+#define GFX_DEFER_PIECES 96
+#endif
+
+/** @brief Deferred drawing callback for GFX_deferCall() */
+typedef void (*GFXdeferFn)(void *ctx);
+
+/** @brief Deferred mode counters (since the last GFX_resetDeferStats()) */
+typedef struct
+{
+    uint32_t frames;         ///< Display lists resolved
+    uint32_t entries;        ///< Primitives recorded
+    uint32_t culled;         ///< Entries skipped as completely covered
+    uint32_t trimmed;        ///< Fills cut down to their visible part
+    uint32_t pixelsRecorded; ///< Area of every recorded entry
+    uint32_t pixelsDrawn;    ///< Area actually rasterised
+} GFXdeferStats;
+
+/** @brief Set while primitives are being recorded (checked by gfx.cpp) */
+extern bool gfxDeferActive;
+
+/**
+ * @brief Turn deferred frame mode on or off
+ * @param enable true to record from now on, false to draw what is recorded and stop
+ * @return false if the display list does not fit in the arena
+ * @note Turning it on while it is already on keeps what is recorded.
+ *       Once the arena is released past the list (GFX_destroyFramebuf(),
+ *       GFX_configure(), an earlier GFX_arenaMark()) deferred mode ends and
+ *       what was recorded is dropped; drawing goes straight through until it
+ *       is turned on again.
+ */
+bool GFX_setDeferred(bool enable);
+
+/**
+ * @brief Record a drawing call to be made at frame end
+ * @param x X coordinate of the box the call draws in
+ * @param y Y coordinate of the box
+ * @param w Width of the box
+ * @param h Height of the box
+ * @param opaque true if the call sets every pixel of the box, so it can hide earlier entries
+ * @param fn Called with ctx when the list is resolved, unless culled
+ * @param ctx Passed to fn; must stay valid until then
+ * @note Outside deferred mode fn is called straight away.
+ */
+void GFX_deferCall(int16_t x, int16_t y, int16_t w, int16_t h, bool opaque, GFXdeferFn fn, void *ctx);
+
+/**
+ * @brief Cull and draw everything recorded so far; recording carries on
+ */
+void GFX_deferResolve();
+
+/**
+ * @brief Record a fill (used by gfx.cpp while gfxDeferActive)
+ */
+void GFX_deferFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+/**
+ * @brief Record a character (used by gfx.cpp while gfxDeferActive)
+ * @param bx X coordinate of the box the glyph covers
+ * @param by Y coordinate of the box
+ * @param bw Width of the box
+ * @param bh Height of the box
+ * @param opaque true if the glyph paints its whole box (classic font with a background)
+ */
+void GFX_deferChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x,
+                   uint8_t size_y, int16_t bx, int16_t by, int16_t bw, int16_t bh, bool opaque);
+
+/**
+ * @brief Display arena bytes GFX_setDeferred(true) allocates for the list
+ */
+size_t GFX_deferBytes();
+
+/**
+ * @brief Read the deferred mode counters
+ * @param stats Destination for the counters
+ */
+void GFX_getDeferStats(GFXdeferStats *stats);
+
+/**
+ * @brief Reset the deferred mode counters
+ */
+void GFX_resetDeferStats();
+
+#endif
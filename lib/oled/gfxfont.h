@@ -22,6 +22,7 @@ typedef struct
     uint16_t first;   ///< ASCII extents (first char)
     uint16_t last;    ///< ASCII extents (last char)
     uint8_t yAdvance; ///< Newline distance (y axis)
+    uint8_t bpp;      ///< Bits per bitmap pixel: 0 or 1 for classic fonts, 2 or 4 for anti-aliased coverage
 } GFXfont;
 
 #endif // _GFXFONT_H_
\ No newline at end of file
@@ -0,0 +1,254 @@
+// Thick, anti-aliased and poly lines
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "gfx.h"
+#include "gfxline.h"
+#include "gfxquality.h"
+
+// Polygon corners are kept in 1/16 pixel with the integer grid on pixel
+// centres, which keeps every product below 32 bits on a 320-pixel screen
+#define SUB GFX_SUBPIXEL
+
+static uint32_t isqrt(uint32_t v)
+{
+    uint32_t r = 0, bit = 1u << 30;
+    while (bit > v)
+        bit >>= 2;
+    while (bit)
+    {
+        if (v >= r + bit)
+        {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else
+            r >>= 1;
+        bit >>= 2;
+    }
+    return r;
+}
+
+static int32_t ceilSub(int32_t v)
+{
+    return -((-v) >> 4);
+}
+
+// Fill a convex polygon, one span per row, covering the pixels whose centres
+// lie inside
+static void fillConvex(const int32_t *xs, const int32_t *ys, uint8_t n, uint16_t color)
+{
+    int32_t ymin = ys[0], ymax = ys[0];
+    for (uint8_t i = 1; i < n; i++)
+    {
+        if (ys[i] < ymin)
+            ymin = ys[i];
+        if (ys[i] > ymax)
+            ymax = ys[i];
+    }
+
+    int16_t r0 = ceilSub(ymin), r1 = ymax >> 4;
+    if (r0 < 0)
+        r0 = 0;
+    if (r1 >= (int16_t)GFX_getHeight())
+        r1 = GFX_getHeight() - 1;
+
+    for (int16_t row = r0; row <= r1; row++)
+    {
+        int32_t yc = row * SUB;
+        int32_t xl = INT32_MAX, xr = INT32_MIN;
+        for (uint8_t i = 0; i < n; i++)
+        {
+            uint8_t j = i + 1 < n ? i + 1 : 0;
+            int32_t ya = ys[i], yb = ys[j];
+            if (ya == yb ? yc != ya : (yc < (ya < yb ? ya : yb) || yc > (ya < yb ? yb : ya)))
+                continue;
+            int32_t x1 = xs[i], x2 = xs[j];
+            if (ya != yb)
+                x1 = x2 = xs[i] + (yc - ya) * (xs[j] - xs[i]) / (yb - ya);
+            if (x1 > x2)
+            {
+                int32_t t = x1;
+                x1 = x2;
+                x2 = t;
+            }
+            if (x1 < xl)
+                xl = x1;
+            if (x2 > xr)
+                xr = x2;
+        }
+        if (xl <= xr)
+            GFX_drawSpan(ceilSub(xl), xr >> 4, row, color);
+    }
+}
+
+// One thick segment as a quadrilateral, end points in 1/16 pixel; extStart/
+// extEnd push the ends out by half the width (square caps)
+static void thickSegment(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t width,
+                         bool extStart, bool extEnd, uint16_t color)
+{
+    int32_t dx = x1 - x0, dy = y1 - y0;
+    int32_t len = isqrt(dx * dx + dy * dy);
+
+    if (len == 0)
+    {
+        GFX_fillRect(((x0 + SUB / 2) >> 4) - width / 2, ((y0 + SUB / 2) >> 4) - width / 2, width, width, color);
+        return;
+    }
+
+    // Half-width along the normal and along the line, in 1/16 pixel
+    int32_t nx = -dy * width * (SUB / 2) / len, ny = dx * width * (SUB / 2) / len;
+    int32_t ex = dx * width * (SUB / 2) / len, ey = dy * width * (SUB / 2) / len;
+    int32_t ax = x0 - (extStart ? ex : 0), ay = y0 - (extStart ? ey : 0);
+    int32_t bx = x1 + (extEnd ? ex : 0), by = y1 + (extEnd ? ey : 0);
+
+    int32_t xs[4] = {ax + nx, bx + nx, bx - nx, ax - nx};
+    int32_t ys[4] = {ay + ny, by + ny, by - ny, ay - ny};
+    fillConvex(xs, ys, 4, color);
+}
+
+// Thick poly line over points scaled by unit (1 for 1/16 pixel, SUB for whole pixels)
+static void thickPolyline(const GFXpoint *pts, uint16_t n, int32_t unit, uint8_t width, uint8_t cap,
+                          uint16_t color)
+{
+    bool square = cap == GFX_CAP_SQUARE;
+    if (n == 1)
+        thickSegment(pts[0].x * unit, pts[0].y * unit, pts[0].x * unit, pts[0].y * unit, width, false, false,
+                     color);
+    for (uint16_t i = 0; i + 1 < n; i++)
+        thickSegment(pts[i].x * unit, pts[i].y * unit, pts[i + 1].x * unit, pts[i + 1].y * unit, width,
+                     square && i == 0, square && i + 2 == n, color);
+
+    // Round joins fill the wedge between segments
+    for (uint16_t i = 0; i < n; i++)
+    {
+        if ((i == 0 || i + 1 == n) && cap != GFX_CAP_ROUND)
+            continue;
+        GFX_fillCircle((pts[i].x * unit + SUB / 2) >> 4, (pts[i].y * unit + SUB / 2) >> 4, width / 2, color);
+    }
+}
+
+void GFX_drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint8_t cap,
+                       uint16_t color)
+{
+    if (width <= 1)
+    {
+        GFX_drawLine(x0, y0, x1, y1, color);
+        return;
+    }
+    thickSegment(x0 * SUB, y0 * SUB, x1 * SUB, y1 * SUB, width, cap == GFX_CAP_SQUARE, cap == GFX_CAP_SQUARE,
+                 color);
+    if (cap == GFX_CAP_ROUND)
+    {
+        GFX_fillCircle(x0, y0, width / 2, color);
+        GFX_fillCircle(x1, y1, width / 2, color);
+    }
+}
+
+// Wu's line walked from (x0, y0) towards (x1, y1). The end point itself is
+// only drawn when withEnd is set, so chained segments share it exactly once.
+static void wuLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool withEnd, uint16_t color, uint16_t bg)
+{
+    int16_t dx = x1 - x0, dy = y1 - y0;
+    bool steep = abs(dy) > abs(dx);
+    int16_t steps = steep ? abs(dy) : abs(dx);
+    int16_t step = (steep ? dy : dx) < 0 ? -1 : 1;
+
+    // Minor axis position in 16.16, advanced by the gradient each step. The
+    // remainder of the division is carried like Bresenham's error term, so
+    // the walk lands exactly on the end point.
+    int32_t span = (int32_t)(steep ? dx : dy) * 65536;
+    int32_t grad = steps ? span / steps : 0, rem = steps ? span % steps : 0, err = 0;
+    int32_t minor = (int32_t)(steep ? x0 : y0) * 65536;
+    int16_t major = steep ? y0 : x0;
+
+    for (int16_t i = 0; i < steps + withEnd; i++, major += step)
+    {
+        if (i > 0)
+        {
+            minor += grad;
+            err += rem;
+            if (err >= steps)
+            {
+                minor++;
+                err -= steps;
+            }
+            else if (err <= -steps)
+            {
+                minor--;
+                err += steps;
+            }
+        }
+        int16_t m = minor >> 16;
+        uint8_t f = (minor >> 11) & 31; // Coverage of the second pixel, 0..31
+        if (gfxQualityLevel != GFX_QUALITY_FULL)
+        {
+            // Reduced quality: only the nearer pixel, no blending
+            if (f >= 16)
+                m++;
+            if (steep)
+                GFX_drawPixel(m, major, color);
+            else
+                GFX_drawPixel(major, m, color);
+            continue;
+        }
+        if (steep)
+        {
+            GFX_blendPixel(m, major, color, 32 - f, bg);
+            GFX_blendPixel(m + 1, major, color, f, bg);
+        }
+        else
+        {
+            GFX_blendPixel(major, m, color, 32 - f, bg);
+            GFX_blendPixel(major, m + 1, color, f, bg);
+        }
+    }
+}
+
+void GFX_drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg)
+{
+    wuLine(x0, y0, x1, y1, true, color, bg);
+}
+
+void GFX_drawPolyline(const GFXpoint *pts, uint16_t n, uint8_t width, uint8_t cap, uint16_t color)
+{
+    if (n == 0)
+        return;
+    if (n == 1 || width <= 1)
+    {
+        for (uint16_t i = 0; i + 1 < n; i++)
+            GFX_drawLine(pts[i].x, pts[i].y, pts[i + 1].x, pts[i + 1].y, color);
+        if (n == 1)
+            GFX_drawThickLine(pts[0].x, pts[0].y, pts[0].x, pts[0].y, width, cap, color);
+        return;
+    }
+
+    thickPolyline(pts, n, SUB, width, cap, color);
+}
+
+void GFX_drawPolylineFixed(const GFXpoint *pts, uint16_t n, uint8_t width, uint8_t cap, uint16_t color)
+{
+    if (n == 0)
+        return;
+    if (width <= 1)
+    {
+        for (uint16_t i = 0; i + 1 < n; i++)
+            GFX_drawLine((pts[i].x + SUB / 2) >> 4, (pts[i].y + SUB / 2) >> 4,
+                         (pts[i + 1].x + SUB / 2) >> 4, (pts[i + 1].y + SUB / 2) >> 4, color);
+        if (n == 1)
+            GFX_drawPixel((pts[0].x + SUB / 2) >> 4, (pts[0].y + SUB / 2) >> 4, color);
+        return;
+    }
+    thickPolyline(pts, n, 1, width, cap, color);
+}
+
+void GFX_drawPolylineAA(const GFXpoint *pts, uint16_t n, bool closed, uint16_t color, uint16_t bg)
+{
+    if (n == 1)
+        GFX_blendPixel(pts[0].x, pts[0].y, color, 32, bg);
+    for (uint16_t i = 0; i + 1 < n; i++)
+        wuLine(pts[i].x, pts[i].y, pts[i + 1].x, pts[i + 1].y, !closed && i + 2 == n, color, bg);
+    if (closed && n > 1)
+        wuLine(pts[n - 1].x, pts[n - 1].y, pts[0].x, pts[0].y, false, color, bg);
+}
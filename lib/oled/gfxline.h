@@ -0,0 +1,85 @@
+/**
+ * @file gfxline.h
+ * @brief Thick, anti-aliased and poly lines
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Thick lines are filled as one quadrilateral, one horizontal span per row,
+ * instead of several offset Bresenham passes. Anti-aliased lines use Wu's
+ * algorithm with 5-bit integer coverage fed to GFX_blend565(). Poly lines
+ * draw every shared vertex exactly once, so anti-aliased joints are not
+ * blended twice.
+ */
+
+#ifndef GFXLINE_H
+#define GFXLINE_H
+
+#include <stdint.h>
+
+/** @brief A point in screen coordinates */
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+} GFXpoint;
+
+/** @brief Units per pixel of the fixed-point (sub-pixel) calls */
+#define GFX_SUBPIXEL 16
+
+#define GFX_CAP_BUTT 0   ///< Line ends exactly at the end points
+#define GFX_CAP_SQUARE 1 ///< Line extends by half its width past the end points
+#define GFX_CAP_ROUND 2  ///< Half-disc around each end point
+
+/**
+ * @brief Draw a line of any width
+ * @param x0 Start X
+ * @param y0 Start Y
+ * @param x1 End X
+ * @param y1 End Y
+ * @param width Line width in pixels (1 falls back to GFX_drawLine())
+ * @param cap GFX_CAP_BUTT, GFX_CAP_SQUARE or GFX_CAP_ROUND
+ * @param color 16-bit RGB565 color
+ */
+void GFX_drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint8_t cap,
+                       uint16_t color);
+
+/**
+ * @brief Draw a 1-pixel anti-aliased line (Wu's algorithm)
+ * @param x0 Start X
+ * @param y0 Start Y
+ * @param x1 End X
+ * @param y1 End Y
+ * @param color 16-bit RGB565 color
+ * @param bg Background to blend with in direct mode (see GFX_blendPixel())
+ */
+void GFX_drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg);
+
+/**
+ * @brief Draw connected thick line segments with round joins
+ * @param pts Points
+ * @param n Number of points
+ * @param width Line width in pixels
+ * @param cap Cap used at the two open ends
+ * @param color 16-bit RGB565 color
+ */
+void GFX_drawPolyline(const GFXpoint *pts, uint16_t n, uint8_t width, uint8_t cap, uint16_t color);
+
+/**
+ * @brief GFX_drawPolyline() with points in 1/GFX_SUBPIXEL pixel units
+ *
+ * Used for flattened curves, whose points rarely fall on whole pixels. A
+ * width of 1 rounds the points and draws plain lines.
+ */
+void GFX_drawPolylineFixed(const GFXpoint *pts, uint16_t n, uint8_t width, uint8_t cap, uint16_t color);
+
+/**
+ * @brief Draw connected anti-aliased segments, each shared vertex blended once
+ * @param pts Points
+ * @param n Number of points
+ * @param closed Also join the last point back to the first
+ * @param color 16-bit RGB565 color
+ * @param bg Background to blend with in direct mode (see GFX_blendPixel())
+ */
+void GFX_drawPolylineAA(const GFXpoint *pts, uint16_t n, bool closed, uint16_t color, uint16_t bg);
+
+#endif
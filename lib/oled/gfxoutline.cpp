@@ -0,0 +1,600 @@
+// Outline font rasteriser and glyph cache
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Glyph coordinates are converted to 1/64 pixel fixed point and flattened into
+// line edges. Each pixel row is sampled on 4 sub-scanlines; the crossings of a
+// sub-scanline are sorted and the spans with non-zero winding are added to a
+// per-pixel coverage row with 1/16 pixel precision at both ends, so a fully
+// covered pixel collects 4 * 16 = 64.
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "gfx.h"
+#include "gfxoutline.h"
+#include "gfxarena.h"
+#include "gfxquality.h"
+
+#define FIX_SHIFT 6 // 1/64 pixel
+#define FIX_ONE (1 << FIX_SHIFT)
+#define SUBSAMPLES 4
+#define FULL_COVERAGE (SUBSAMPLES * 16)
+
+#define GFX_OUTLINE_MAX_EDGES 384
+#define GFX_OUTLINE_MAX_W 160
+#define GFX_OUTLINE_MAX_CROSSINGS 48
+
+typedef struct
+{
+    int16_t x0, y0, x1, y1; // y0 < y1, glyph-local 1/64 pixel
+    int8_t dir;             // +1 downwards in the original contour, -1 upwards
+} Edge;
+
+// Glyph prepared for rasterising: edges plus the pixel bounding box
+typedef struct
+{
+    uint16_t edges;
+    int16_t xMin, yMin; // Pixel offsets of the bitmap from pen/baseline
+    uint8_t width, height;
+    uint8_t advance;
+} Prepared;
+
+static Edge edgeBuf[GFX_OUTLINE_MAX_EDGES];
+
+static uint8_t coverageTo4(uint8_t cov)
+{
+    return (cov * 15 + FULL_COVERAGE / 2) / FULL_COVERAGE;
+}
+
+static void addEdge(Prepared *g, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    if (y0 == y1 || g->edges == GFX_OUTLINE_MAX_EDGES)
+        return; // Horizontal edges never cross a sub-scanline
+    Edge *e = &edgeBuf[g->edges++];
+    if (y0 < y1)
+    {
+        e->x0 = x0, e->y0 = y0, e->x1 = x1, e->y1 = y1, e->dir = 1;
+    }
+    else
+    {
+        e->x0 = x1, e->y0 = y1, e->x1 = x0, e->y1 = y0, e->dir = -1;
+    }
+}
+
+static uint32_t isqrt(uint32_t v)
+{
+    uint32_t r = 0, bit = 1u << 30;
+    while (bit > v)
+        bit >>= 2;
+    while (bit)
+    {
+        if (v >= r + bit)
+        {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else
+            r >>= 1;
+        bit >>= 2;
+    }
+    return r;
+}
+
+// Flatten a quadratic into enough lines to stay within ~1/4 pixel
+static void addQuad(Prepared *g, int32_t x0, int32_t y0, int32_t cx, int32_t cy, int32_t x1, int32_t y1)
+{
+    int32_t dx = x0 - 2 * cx + x1, dy = y0 - 2 * cy + y1;
+    uint32_t dev = (dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy);
+    int32_t n = 1 + isqrt(dev / (FIX_ONE / 4) / 4);
+    if (n > 16)
+        n = 16;
+
+    int32_t px = x0, py = y0, nn = n * n;
+    for (int32_t i = 1; i <= n; i++)
+    {
+        int32_t a = (n - i) * (n - i), b = 2 * i * (n - i), c = i * i;
+        int32_t qx = (a * x0 + b * cx + c * x1) / nn;
+        int32_t qy = (a * y0 + b * cy + c * y1) / nn;
+        addEdge(g, px, py, qx, qy);
+        px = qx;
+        py = qy;
+    }
+}
+
+// Scale the glyph's points, find its bounding box and flatten its contours
+static bool prepare(const GFXoutlineFont *font, uint8_t c, uint8_t px, Prepared *g)
+{
+    if (c < font->first || c > font->last || px == 0 || px > GFX_OUTLINE_MAX_PX)
+        return false;
+
+    const GFXoutlineGlyph *gl = &font->glyphs[c - font->first];
+    const GFXoutlinePoint *pt = font->points + gl->pointOffset;
+    int32_t em = font->unitsPerEm;
+
+    g->edges = 0;
+    g->advance = (gl->advance * px + em / 2) / em;
+    g->width = g->height = 0;
+    g->xMin = g->yMin = 0;
+    if (gl->pointCount == 0)
+        return true;
+
+    // Points in 1/64 pixel, y down (static: too big for the default stack)
+    static int16_t xs[256], ys[256];
+    int32_t minX = INT32_MAX, minY = INT32_MAX, maxX = INT32_MIN, maxY = INT32_MIN;
+    for (uint8_t i = 0; i < gl->pointCount; i++)
+    {
+        xs[i] = pt[i].x * px * FIX_ONE / em;
+        ys[i] = -pt[i].y * px * FIX_ONE / em;
+        if (xs[i] < minX)
+            minX = xs[i];
+        if (xs[i] > maxX)
+            maxX = xs[i];
+        if (ys[i] < minY)
+            minY = ys[i];
+        if (ys[i] > maxY)
+            maxY = ys[i];
+    }
+
+    // Control points bound the curves, so this box holds the whole glyph
+    g->xMin = minX >> FIX_SHIFT;
+    g->yMin = minY >> FIX_SHIFT;
+    int32_t w = ((maxX + FIX_ONE - 1) >> FIX_SHIFT) - g->xMin;
+    int32_t h = ((maxY + FIX_ONE - 1) >> FIX_SHIFT) - g->yMin;
+    if (w <= 0 || h <= 0 || w > GFX_OUTLINE_MAX_W || h > 255)
+        return false;
+    g->width = w;
+    g->height = h;
+
+    int32_t ox = g->xMin * FIX_ONE, oy = g->yMin * FIX_ONE;
+    for (uint8_t i = 0; i < gl->pointCount; i++)
+    {
+        xs[i] -= ox;
+        ys[i] -= oy;
+    }
+
+    // Walk each contour: a contour starts on-curve, two off-curve points in a
+    // row imply an on-curve point halfway between them
+    uint8_t first = 0;
+    for (uint8_t i = 0; i < gl->pointCount; i++)
+    {
+        if (!(pt[i].flags & GFX_OUTLINE_CONTOUR_END))
+            continue;
+        uint8_t last = i;
+        int32_t px0 = xs[first], py0 = ys[first];
+        for (uint16_t k = first + 1; k <= last + 1;)
+        {
+            uint8_t p = k <= last ? k : first;
+            if (k > last || (pt[p].flags & GFX_OUTLINE_ON_CURVE))
+            {
+                addEdge(g, px0, py0, xs[p], ys[p]);
+                px0 = xs[p];
+                py0 = ys[p];
+                k++;
+                continue;
+            }
+            uint8_t n = k + 1 <= last ? k + 1 : first;
+            if (pt[n].flags & GFX_OUTLINE_ON_CURVE)
+            {
+                addQuad(g, px0, py0, xs[p], ys[p], xs[n], ys[n]);
+                px0 = xs[n];
+                py0 = ys[n];
+                k += 2;
+            }
+            else
+            {
+                int32_t mx = (xs[p] + xs[n]) / 2, my = (ys[p] + ys[n]) / 2;
+                addQuad(g, px0, py0, xs[p], ys[p], mx, my);
+                px0 = mx;
+                py0 = my;
+                k++;
+            }
+        }
+        first = i + 1;
+    }
+    return true;
+}
+
+// Coverage (0..FULL_COVERAGE) of one pixel row
+static void coverRow(const Prepared *g, int16_t row, uint8_t *cov)
+{
+    int16_t xs[GFX_OUTLINE_MAX_CROSSINGS];
+    int8_t dirs[GFX_OUTLINE_MAX_CROSSINGS];
+    int32_t limit = g->width * 16;
+
+    memset(cov, 0, g->width);
+    for (uint8_t s = 0; s < SUBSAMPLES; s++)
+    {
+        int32_t sy = row * FIX_ONE + s * (FIX_ONE / SUBSAMPLES) + FIX_ONE / SUBSAMPLES / 2;
+        uint8_t n = 0;
+
+        for (uint16_t i = 0; i < g->edges && n < GFX_OUTLINE_MAX_CROSSINGS; i++)
+        {
+            const Edge *e = &edgeBuf[i];
+            if (sy < e->y0 || sy >= e->y1)
+                continue;
+            int16_t x = e->x0 + (sy - e->y0) * (e->x1 - e->x0) / (e->y1 - e->y0);
+
+            // Insertion sort: rows rarely have more than a handful of crossings
+            uint8_t j = n++;
+            while (j > 0 && xs[j - 1] > x)
+            {
+                xs[j] = xs[j - 1];
+                dirs[j] = dirs[j - 1];
+                j--;
+            }
+            xs[j] = x;
+            dirs[j] = e->dir;
+        }
+
+        // Non-zero winding spans, ends in 1/16 pixel
+        int8_t wind = 0;
+        for (uint8_t i = 0; i < n; i++)
+        {
+            if (wind != 0)
+            {
+                int32_t a = xs[i - 1] >> 2, b = xs[i] >> 2;
+                if (a < 0)
+                    a = 0;
+                if (b > limit)
+                    b = limit;
+                if (a < b)
+                {
+                    int32_t pa = a >> 4, pb = b >> 4;
+                    if (pa == pb)
+                        cov[pa] += b - a;
+                    else
+                    {
+                        cov[pa] += 16 - (a & 15);
+                        for (int32_t p = pa + 1; p < pb; p++)
+                            cov[p] += 16;
+                        if (b & 15)
+                            cov[pb] += b & 15;
+                    }
+                }
+            }
+            wind += dirs[i];
+        }
+    }
+}
+
+static size_t bitmapBytes(const Prepared *g, uint8_t bpp)
+{
+    return ((size_t)g->width * g->height * bpp + 7) / 8;
+}
+
+// Rasterise a prepared glyph into a packed bitmap
+static void render(const Prepared *g, uint8_t bpp, uint8_t *out)
+{
+    uint8_t cov[GFX_OUTLINE_MAX_W];
+    uint32_t bit = 0;
+
+    memset(out, 0, bitmapBytes(g, bpp));
+    for (int16_t row = 0; row < g->height; row++)
+    {
+        coverRow(g, row, cov);
+        for (uint8_t x = 0; x < g->width; x++, bit += bpp)
+        {
+            if (bpp == 1)
+            {
+                if (cov[x] >= FULL_COVERAGE / 2)
+                    out[bit >> 3] |= 0x80 >> (bit & 7);
+            }
+            else
+            {
+                uint8_t v = coverageTo4(cov[x]);
+                out[bit >> 3] |= (bit & 4) ? v : v << 4;
+            }
+        }
+    }
+}
+
+static void fillInfo(const Prepared *g, uint8_t bpp, const uint8_t *bitmap, GFXoutlineBitmap *info)
+{
+    info->bitmap = bitmap;
+    info->width = g->width;
+    info->height = g->height;
+    info->xOffset = g->xMin;
+    info->yOffset = g->yMin;
+    info->advance = g->advance;
+    info->bpp = bpp;
+}
+
+size_t GFX_outlineRasterize(const GFXoutlineFont *font, uint8_t c, uint8_t px, uint8_t bpp,
+                            uint8_t *out, size_t outSize, GFXoutlineBitmap *info)
+{
+    Prepared g;
+
+    if (!prepare(font, c, px, &g))
+        return 0;
+    fillInfo(&g, bpp, out, info);
+    size_t bytes = bitmapBytes(&g, bpp);
+    if (out == NULL)
+        return bytes;
+    if (bytes == 0 || bytes > outSize)
+        return 0;
+    render(&g, bpp, out);
+    return bytes;
+}
+
+// ----------------------------------------------------------------------------
+// Glyph cache: entries are kept in pool order, so evicting compacts the pool
+// with one pass of memmove. Lookups go through a small open-addressed index.
+
+typedef struct
+{
+    const GFXoutlineFont *font;
+    uint8_t c, px, bpp;
+    uint16_t offset, bytes;
+    uint32_t lastUse;
+    GFXoutlineBitmap bmp;
+} CacheEntry;
+
+#define INDEX_SIZE 256 // Power of two, over twice GFX_OUTLINE_CACHE_ENTRIES
+#define INDEX_EMPTY 0xFF
+
+static uint8_t *cachePool = NULL;
+static uint32_t cacheGeneration = 0;
+static size_t cacheMark, cacheTop; // Arena mark before and after the pool
+static uint16_t cacheUsed = 0;
+static uint16_t cacheBytes = GFX_OUTLINE_CACHE_BYTES; // Requested size
+static uint16_t cachePoolBytes = 0;                   // Size of cachePool
+static CacheEntry cacheEntries[GFX_OUTLINE_CACHE_ENTRIES];
+static uint8_t cacheIndex[INDEX_SIZE];
+static uint16_t cacheCount = 0;
+static uint32_t cacheTick = 0;
+static GFXoutlineCacheStats cacheStats = {0, 0, 0, 0, 0};
+
+static uint32_t cacheHash(const GFXoutlineFont *font, uint8_t c, uint8_t px, uint8_t bpp)
+{
+    uint32_t h = (uint32_t)(uintptr_t)font ^ (c * 0x9E3779B1u) ^ (px << 8) ^ (bpp << 16);
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    return (h ^ (h >> 12)) & (INDEX_SIZE - 1);
+}
+
+static void cacheRebuildIndex()
+{
+    memset(cacheIndex, INDEX_EMPTY, sizeof(cacheIndex));
+    for (uint16_t i = 0; i < cacheCount; i++)
+    {
+        CacheEntry *e = &cacheEntries[i];
+        uint32_t h = cacheHash(e->font, e->c, e->px, e->bpp);
+        while (cacheIndex[h] != INDEX_EMPTY)
+            h = (h + 1) & (INDEX_SIZE - 1);
+        cacheIndex[h] = i;
+    }
+}
+
+// Pool lives in the display arena; start again only if the arena released
+// it, so a pool below a release mark is kept rather than allocated twice
+static bool cacheReady()
+{
+    if (cacheBytes == 0)
+        return false; // Cache turned off: everything is drawn uncached
+    if (cachePool && GFX_arenaHolds(cachePool, cacheGeneration))
+        return true;
+    cacheMark = GFX_arenaMark();
+    cachePool = (uint8_t *)GFX_arenaAlloc(cacheBytes, GFX_MEM_GLYPHS);
+    cacheGeneration = GFX_arenaGeneration();
+    cacheTop = GFX_arenaMark();
+    cachePoolBytes = cachePool ? cacheBytes : 0;
+    cacheCount = 0;
+    cacheUsed = 0;
+    cacheRebuildIndex();
+    return cachePool != NULL;
+}
+
+// Evict least recently used glyphs until bytes fit, then compact the pool
+static void cacheMakeRoom(uint16_t bytes)
+{
+    uint16_t live = cacheUsed;
+    bool evicted = false;
+
+    while (cacheCount && (cachePoolBytes - live < bytes || cacheCount == GFX_OUTLINE_CACHE_ENTRIES))
+    {
+        uint16_t lru = 0;
+        for (uint16_t i = 1; i < cacheCount; i++)
+            if (cacheEntries[i].lastUse < cacheEntries[lru].lastUse)
+                lru = i;
+        live -= cacheEntries[lru].bytes;
+        memmove(&cacheEntries[lru], &cacheEntries[lru + 1], (cacheCount - lru - 1) * sizeof(CacheEntry));
+        cacheCount--;
+        cacheStats.evictions++;
+        evicted = true;
+    }
+    if (!evicted)
+        return;
+
+    uint16_t at = 0;
+    for (uint16_t i = 0; i < cacheCount; i++)
+    {
+        CacheEntry *e = &cacheEntries[i];
+        if (e->offset != at)
+            memmove(cachePool + at, cachePool + e->offset, e->bytes);
+        e->offset = at;
+        e->bmp.bitmap = cachePool + at;
+        at += e->bytes;
+    }
+    cacheUsed = at;
+    cacheRebuildIndex();
+}
+
+const GFXoutlineBitmap *GFX_outlineGlyph(const GFXoutlineFont *font, uint8_t c, uint8_t px, uint8_t bpp)
+{
+    if (!cacheReady())
+        return NULL;
+
+    uint32_t h = cacheHash(font, c, px, bpp);
+    while (cacheIndex[h] != INDEX_EMPTY)
+    {
+        CacheEntry *e = &cacheEntries[cacheIndex[h]];
+        if (e->font == font && e->c == c && e->px == px && e->bpp == bpp)
+        {
+            e->lastUse = ++cacheTick;
+            cacheStats.hits++;
+            return &e->bmp;
+        }
+        h = (h + 1) & (INDEX_SIZE - 1);
+    }
+
+    Prepared g;
+    if (!prepare(font, c, px, &g))
+        return NULL;
+    cacheStats.misses++;
+    uint16_t bytes = (bitmapBytes(&g, bpp) + 3) & ~3; // Word aligned entries
+    if (bytes > cachePoolBytes)
+        return NULL;
+    cacheMakeRoom(bytes);
+
+    CacheEntry *e = &cacheEntries[cacheCount];
+    e->font = font;
+    e->c = c;
+    e->px = px;
+    e->bpp = bpp;
+    e->offset = cacheUsed;
+    e->bytes = bytes;
+    e->lastUse = ++cacheTick;
+    if (bytes)
+        render(&g, bpp, cachePool + cacheUsed);
+    fillInfo(&g, bpp, cachePool + cacheUsed, &e->bmp);
+    cacheUsed += e->bytes;
+
+    h = cacheHash(font, c, px, bpp);
+    while (cacheIndex[h] != INDEX_EMPTY)
+        h = (h + 1) & (INDEX_SIZE - 1);
+    cacheIndex[h] = cacheCount++;
+    return &e->bmp;
+}
+
+// Draw one pixel of coverage v (0..15)
+static void coverPixel(int16_t x, int16_t y, uint8_t v, uint16_t color, uint16_t bg)
+{
+    GFX_blendPixel(x, y, color, (v * 32 + 7) / 15, bg);
+}
+
+static void blitGlyph(int16_t x, int16_t y, const GFXoutlineBitmap *b, uint16_t color, uint16_t bg)
+{
+    uint32_t bit = 0;
+
+    x += b->xOffset;
+    y += b->yOffset;
+    for (uint8_t yy = 0; yy < b->height; yy++)
+    {
+        for (uint8_t xx = 0; xx < b->width; xx++, bit += b->bpp)
+        {
+            uint8_t v = b->bitmap[bit >> 3];
+            if (b->bpp == 1)
+                v = (v & (0x80 >> (bit & 7))) ? 15 : 0;
+            else
+                v = (bit & 4) ? v & 0x0F : v >> 4;
+            coverPixel(x + xx, y + yy, v, color, bg);
+        }
+    }
+}
+
+// Rasterise straight to the screen, for glyphs the cache cannot hold
+static void drawUncached(int16_t x, int16_t y, const Prepared *g, uint8_t bpp, uint16_t color, uint16_t bg)
+{
+    uint8_t cov[GFX_OUTLINE_MAX_W];
+
+    for (int16_t row = 0; row < g->height; row++)
+    {
+        coverRow(g, row, cov);
+        for (uint8_t xx = 0; xx < g->width; xx++)
+        {
+            uint8_t v = bpp == 1 ? (cov[xx] >= FULL_COVERAGE / 2 ? 15 : 0) : coverageTo4(cov[xx]);
+            coverPixel(x + g->xMin + xx, y + g->yMin + row, v, color, bg);
+        }
+    }
+}
+
+int16_t GFX_drawOutlineChar(int16_t x, int16_t y, const GFXoutlineFont *font, uint8_t c,
+                            uint8_t px, uint16_t color, uint16_t bg, uint8_t bpp)
+{
+    if (gfxQualityLevel != GFX_QUALITY_FULL)
+        bpp = 1; // Reduced quality: no anti-aliasing
+    const GFXoutlineBitmap *b = GFX_outlineGlyph(font, c, px, bpp);
+    if (b)
+    {
+        blitGlyph(x, y, b, color, bg);
+        return b->advance;
+    }
+
+    Prepared g;
+    if (!prepare(font, c, px, &g))
+        return 0;
+    drawUncached(x, y, &g, bpp, color, bg);
+    return g.advance;
+}
+
+int16_t GFX_drawOutlineText(int16_t x, int16_t y, const GFXoutlineFont *font, const char *str,
+                            uint8_t px, uint16_t color, uint16_t bg, uint8_t bpp)
+{
+    while (*str)
+        x += GFX_drawOutlineChar(x, y, font, *str++, px, color, bg, bpp);
+    return x;
+}
+
+int16_t GFX_outlineTextWidth(const GFXoutlineFont *font, const char *str, uint8_t px)
+{
+    int16_t w = 0;
+    for (; *str; str++)
+    {
+        uint8_t c = *str;
+        if (c >= font->first && c <= font->last)
+            w += (font->glyphs[c - font->first].advance * px + font->unitsPerEm / 2) / font->unitsPerEm;
+    }
+    return w;
+}
+
+size_t GFX_outlineFontBytes(const GFXoutlineFont *font)
+{
+    const GFXoutlineGlyph *last = &font->glyphs[font->last - font->first];
+    size_t points = last->pointOffset + last->pointCount;
+    return points * sizeof(GFXoutlinePoint) +
+           (font->last - font->first + 1) * sizeof(GFXoutlineGlyph) + sizeof(GFXoutlineFont);
+}
+
+void GFX_outlineCacheClear()
+{
+    cacheCount = 0;
+    cacheUsed = 0;
+    cacheRebuildIndex();
+}
+
+void GFX_setOutlineCacheBytes(uint16_t bytes)
+{
+    GFX_outlineCacheClear();
+    cacheBytes = bytes;
+    if (cachePool == NULL || !GFX_arenaHolds(cachePool, cacheGeneration))
+    {
+        cachePool = NULL;
+        return;
+    }
+    // The newest allocation is given back and the new size allocated on next
+    // use. Under something else, the pool keeps its size until the arena is
+    // released past it.
+    if (GFX_arenaMark() == cacheTop)
+    {
+        GFX_arenaRelease(cacheMark);
+        cachePool = NULL;
+    }
+}
+
+uint16_t GFX_outlineCacheBytes()
+{
+    return cacheBytes;
+}
+
+void GFX_getOutlineCacheStats(GFXoutlineCacheStats *stats)
+{
+    cacheStats.entries = cacheCount;
+    cacheStats.bytes = cacheUsed;
+    *stats = cacheStats;
+}
+
+void GFX_resetOutlineCacheStats()
+{
+    cacheStats.hits = 0;
+    cacheStats.misses = 0;
+    cacheStats.evictions = 0;
+}
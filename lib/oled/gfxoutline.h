@@ -0,0 +1,168 @@
+/**
+ * @file gfxoutline.h
+ * @brief Scalable outline fonts with a rasterised glyph cache
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Outline fonts store each glyph as closed contours of quadratic Bezier
+ * segments (TrueType style on/off-curve points) with 8-bit coordinates on a
+ * small em. A scanline rasteriser with 4 sub-scanlines and 1/16 pixel span
+ * ends turns a glyph into 1-bpp or 4-bpp coverage at any pixel size up to
+ * GFX_OUTLINE_MAX_PX. Rasterised glyphs are kept in an LRU cache in the
+ * display arena, keyed by font, character, size and depth, so repeated text
+ * costs a cache lookup plus a bitmap blit. Fonts are made with
+ * tools/ttf2outline.py.
+ */
+
+#ifndef GFXOUTLINE_H
+#define GFXOUTLINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define GFX_OUTLINE_ON_CURVE 0x01    ///< Point lies on the outline
+#define GFX_OUTLINE_CONTOUR_END 0x02 ///< Last point of a contour
+
+/** @brief Largest pixel size (em height) that can be rasterised */
+#define GFX_OUTLINE_MAX_PX 96
+
+/** @brief Default display arena bytes reserved for rasterised glyphs */
+#ifndef GFX_OUTLINE_CACHE_BYTES
+#define GFX_OUTLINE_CACHE_BYTES 6144
+#endif
+
+/** @brief Maximum number of glyphs held in the cache */
+#ifndef GFX_OUTLINE_CACHE_ENTRIES
+#define GFX_OUTLINE_CACHE_ENTRIES 96
+#endif
+
+/** @brief Outline point in font units, y up from the baseline */
+typedef struct
+{
+    int8_t x;
+    int8_t y;
+    uint8_t flags; ///< GFX_OUTLINE_ON_CURVE / GFX_OUTLINE_CONTOUR_END
+} GFXoutlinePoint;
+
+/** @brief Per-glyph outline data */
+typedef struct
+{
+    uint16_t pointOffset; ///< First point in GFXoutlineFont::points
+    uint8_t pointCount;   ///< Number of points, all contours
+    uint8_t advance;      ///< Advance width in font units
+} GFXoutlineGlyph;
+
+/** @brief Outline font */
+typedef struct
+{
+    const GFXoutlinePoint *points; ///< All contour points
+    const GFXoutlineGlyph *glyphs; ///< Glyph table, first..last
+    uint16_t first;                ///< First character
+    uint16_t last;                 ///< Last character
+    uint8_t unitsPerEm;            ///< Font units per em
+    int8_t ascent;                 ///< Ascender in font units
+    int8_t descent;                ///< Descender in font units (negative)
+} GFXoutlineFont;
+
+/** @brief A rasterised glyph, laid out like GFXfont bitmaps (continuous rows) */
+typedef struct
+{
+    const uint8_t *bitmap; ///< 1 bit or 4 bits per pixel, MSB first
+    uint8_t width;         ///< Bitmap width in pixels
+    uint8_t height;        ///< Bitmap height in pixels
+    int8_t xOffset;        ///< From the pen position to the left column
+    int8_t yOffset;        ///< From the baseline to the top row
+    uint8_t advance;       ///< Pen advance in pixels
+    uint8_t bpp;           ///< 1 or 4
+} GFXoutlineBitmap;
+
+/** @brief Glyph cache counters */
+typedef struct
+{
+    uint32_t hits;      ///< Glyphs served from the cache
+    uint32_t misses;    ///< Glyphs rasterised
+    uint32_t evictions; ///< Glyphs dropped to make room
+    uint16_t entries;   ///< Glyphs currently cached
+    uint16_t bytes;     ///< Cache bytes in use
+} GFXoutlineCacheStats;
+
+/**
+ * @brief Rasterise one glyph into a caller buffer (no caching)
+ * @param font Outline font
+ * @param c Character
+ * @param px Pixel size (em height), 1..GFX_OUTLINE_MAX_PX
+ * @param bpp 1 or 4
+ * @param out Output buffer, or NULL to only fill in the glyph metrics
+ * @param outSize Size of the output buffer
+ * @param info Filled with the metrics (info->bitmap is set to out) unless
+ *             the character is missing from the font
+ * @return Bitmap bytes written, or needed when out is NULL; 0 if the glyph
+ *         is missing, empty or larger than outSize
+ */
+size_t GFX_outlineRasterize(const GFXoutlineFont *font, uint8_t c, uint8_t px, uint8_t bpp,
+                            uint8_t *out, size_t outSize, GFXoutlineBitmap *info);
+
+/**
+ * @brief Get a rasterised glyph from the cache, rasterising it on a miss
+ * @return Cached glyph, or NULL if it cannot be cached (no arena room, or
+ *         larger than the whole cache)
+ */
+const GFXoutlineBitmap *GFX_outlineGlyph(const GFXoutlineFont *font, uint8_t c, uint8_t px, uint8_t bpp);
+
+/**
+ * @brief Draw one character with its pen at (x, baseline y)
+ * @param color Text color
+ * @param bg Color 4-bpp edges blend towards in direct mode; with a
+ *           framebuffer, edges blend with the pixels already there
+ * @return Pen advance in pixels
+ */
+int16_t GFX_drawOutlineChar(int16_t x, int16_t y, const GFXoutlineFont *font, uint8_t c,
+                            uint8_t px, uint16_t color, uint16_t bg, uint8_t bpp);
+
+/**
+ * @brief Draw a string with its pen starting at (x, baseline y)
+ * @return Pen X after the last character
+ */
+int16_t GFX_drawOutlineText(int16_t x, int16_t y, const GFXoutlineFont *font, const char *str,
+                            uint8_t px, uint16_t color, uint16_t bg, uint8_t bpp);
+
+/**
+ * @brief Width of a string in pixels
+ */
+int16_t GFX_outlineTextWidth(const GFXoutlineFont *font, const char *str, uint8_t px);
+
+/**
+ * @brief Flash bytes used by an outline font (points, glyph table, header)
+ */
+size_t GFX_outlineFontBytes(const GFXoutlineFont *font);
+
+/**
+ * @brief Drop every cached glyph
+ */
+void GFX_outlineCacheClear();
+
+/**
+ * @brief Resize the glyph cache pool (GFX_configure() does this)
+ * @param bytes Pool size, allocated from the arena on first use; 0 draws every glyph uncached
+ * @note Empties the cache. A pool that is still the newest arena allocation is
+ *       given back at once; one with allocations above it keeps its old size
+ *       until the arena is released past it, so call this at start-up.
+ */
+void GFX_setOutlineCacheBytes(uint16_t bytes);
+
+/**
+ * @brief Current glyph cache pool size
+ */
+uint16_t GFX_outlineCacheBytes();
+
+/**
+ * @brief Read the glyph cache counters
+ */
+void GFX_getOutlineCacheStats(GFXoutlineCacheStats *stats);
+
+/**
+ * @brief Reset the hit, miss and eviction counters
+ */
+void GFX_resetOutlineCacheStats();
+
+#endif
@@ -0,0 +1,357 @@
+// Bezier curves and paths
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxpath.h"
+
+#define SUB GFX_SUBPIXEL
+#define CLOSED 0x8000
+
+// Scratch for the direct Bezier calls: the start point plus every step
+static GFXpoint curvePts[GFX_PATH_MAX_STEPS + 1];
+
+// Fill crossings for one scanline
+static int32_t crossX[GFX_PATH_MAX_CROSSINGS];
+static int8_t crossDir[GFX_PATH_MAX_CROSSINGS];
+
+static uint32_t isqrt(uint32_t v)
+{
+    uint32_t r = 0, bit = 1u << 30;
+    while (bit > v)
+        bit >>= 2;
+    while (bit)
+    {
+        if (v >= r + bit)
+        {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else
+            r >>= 1;
+        bit >>= 2;
+    }
+    return r;
+}
+
+static int32_t ceilSub(int32_t v)
+{
+    return -((-v) >> 4);
+}
+
+// Rounded division by a positive divisor
+static int32_t divRound(int64_t v, int32_t d)
+{
+    return (int32_t)(v >= 0 ? (v + d / 2) / d : -((-v + d / 2) / d));
+}
+
+// Steps from Wang's formula: n^2 = k * |second difference| / (8 * tolerance),
+// with k = 2 for quadratics and 6 for cubics. The length is overestimated as
+// max + min / 2, which is cheap and cannot overflow.
+static uint8_t curveSteps(int32_t ddx, int32_t ddy, uint8_t k)
+{
+    uint32_t ax = abs(ddx), ay = abs(ddy);
+    uint32_t m = ax > ay ? ax + ay / 2 : ay + ax / 2;
+    uint32_t den = 8 * GFX_PATH_TOLERANCE;
+    uint32_t n2 = (k * m + den - 1) / den;
+    uint32_t n = isqrt(n2);
+    if (n * n < n2)
+        n++;
+    if (n < 1)
+        n = 1;
+    return n > GFX_PATH_MAX_STEPS ? GFX_PATH_MAX_STEPS : n;
+}
+
+// Flatten a quadratic from p0 (excluded) to p2 (included), all in 1/16 pixel.
+// Points are evaluated directly in Bernstein form so no error accumulates.
+static uint8_t flattenQuad(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, GFXpoint *out)
+{
+    uint8_t n = curveSteps(x0 - 2 * x1 + x2, y0 - 2 * y1 + y2, 2);
+    int32_t nn = n * n;
+    for (uint8_t i = 1; i <= n; i++)
+    {
+        int32_t a = n - i, b = i;
+        out[i - 1].x = divRound(a * a * x0 + 2 * a * b * x1 + b * b * x2, nn);
+        out[i - 1].y = divRound(a * a * y0 + 2 * a * b * y1 + b * b * y2, nn);
+    }
+    return n;
+}
+
+// Flatten a cubic the same way; n^3 weights need 64-bit sums
+static uint8_t flattenCubic(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                            int32_t x3, int32_t y3, GFXpoint *out)
+{
+    uint8_t n1 = curveSteps(x0 - 2 * x1 + x2, y0 - 2 * y1 + y2, 6);
+    uint8_t n2 = curveSteps(x1 - 2 * x2 + x3, y1 - 2 * y2 + y3, 6);
+    uint8_t n = n1 > n2 ? n1 : n2;
+    int32_t nnn = n * n * n;
+    for (uint8_t i = 1; i <= n; i++)
+    {
+        int32_t a = n - i, b = i;
+        int32_t w0 = a * a * a, w1 = 3 * a * a * b, w2 = 3 * a * b * b, w3 = b * b * b;
+        out[i - 1].x = divRound((int64_t)w0 * x0 + (int64_t)w1 * x1 + (int64_t)w2 * x2 + (int64_t)w3 * x3, nnn);
+        out[i - 1].y = divRound((int64_t)w0 * y0 + (int64_t)w1 * y1 + (int64_t)w2 * y2 + (int64_t)w3 * y3, nnn);
+    }
+    return n;
+}
+
+static uint16_t contourStart(const GFXpath *path, uint8_t c)
+{
+    return c ? path->ends[c - 1] & ~CLOSED : 0;
+}
+
+static void addPoint(GFXpath *path, int32_t x, int32_t y)
+{
+    if (path->count > contourStart(path, path->contours))
+    {
+        const GFXpoint *last = &path->pts[path->count - 1];
+        if (last->x == x && last->y == y)
+            return;
+    }
+    if (path->count == path->cap)
+    {
+        path->overflow = true;
+        return;
+    }
+    if (path->count > contourStart(path, path->contours))
+        path->segments++;
+    path->pts[path->count].x = x;
+    path->pts[path->count].y = y;
+    path->count++;
+}
+
+// Finish the open contour; one that never got a second point is dropped
+static void endContour(GFXpath *path, bool closed)
+{
+    if (!path->open)
+        return;
+    path->open = false;
+    uint16_t start = contourStart(path, path->contours);
+    if (path->count - start < 2)
+    {
+        path->count = start;
+        return;
+    }
+    path->ends[path->contours++] = path->count | (closed ? CLOSED : 0);
+}
+
+bool GFX_pathInit(GFXpath *path, uint16_t maxPoints, uint8_t maxContours)
+{
+    // Points and contour ends in one allocation, so a failure leaves nothing behind
+    size_t pointBytes = maxPoints * sizeof(GFXpoint);
+    path->pts = (GFXpoint *)GFX_arenaAlloc(pointBytes + maxContours * sizeof(uint16_t), GFX_MEM_OTHER);
+    path->cap = 0;
+    path->contourCap = 0;
+    GFX_pathReset(path);
+    if (!path->pts)
+        return false;
+    path->ends = (uint16_t *)((uint8_t *)path->pts + pointBytes);
+    path->generation = GFX_arenaGeneration();
+    path->cap = maxPoints;
+    path->contourCap = maxContours;
+    return true;
+}
+
+bool GFX_pathValid(const GFXpath *path)
+{
+    return path->pts != NULL && GFX_arenaHolds(path->pts, path->generation);
+}
+
+// Building a path whose memory has gone only records the loss
+static bool pathWritable(GFXpath *path)
+{
+    if (GFX_pathValid(path))
+        return true;
+    path->overflow = true;
+    return false;
+}
+
+void GFX_pathReset(GFXpath *path)
+{
+    path->count = 0;
+    path->contours = 0;
+    path->segments = 0;
+    path->open = false;
+    path->overflow = false;
+}
+
+void GFX_pathMoveTo(GFXpath *path, int16_t x, int16_t y)
+{
+    if (!pathWritable(path))
+        return;
+    endContour(path, false);
+    if (path->contours == path->contourCap)
+    {
+        path->overflow = true;
+        return;
+    }
+    path->open = true;
+    addPoint(path, x * SUB, y * SUB);
+}
+
+void GFX_pathLineTo(GFXpath *path, int16_t x, int16_t y)
+{
+    if (!pathWritable(path))
+        return;
+    if (!path->open)
+    {
+        GFX_pathMoveTo(path, x, y);
+        return;
+    }
+    addPoint(path, x * SUB, y * SUB);
+}
+
+void GFX_pathQuadTo(GFXpath *path, int16_t cx, int16_t cy, int16_t x, int16_t y)
+{
+    if (!pathWritable(path))
+        return;
+    if (!path->open || path->count == 0)
+    {
+        GFX_pathMoveTo(path, x, y);
+        return;
+    }
+    const GFXpoint *p = &path->pts[path->count - 1];
+    uint8_t n = flattenQuad(p->x, p->y, cx * SUB, cy * SUB, x * SUB, y * SUB, curvePts);
+    for (uint8_t i = 0; i < n; i++)
+        addPoint(path, curvePts[i].x, curvePts[i].y);
+}
+
+void GFX_pathCubicTo(GFXpath *path, int16_t c1x, int16_t c1y, int16_t c2x, int16_t c2y, int16_t x, int16_t y)
+{
+    if (!pathWritable(path))
+        return;
+    if (!path->open || path->count == 0)
+    {
+        GFX_pathMoveTo(path, x, y);
+        return;
+    }
+    const GFXpoint *p = &path->pts[path->count - 1];
+    uint8_t n = flattenCubic(p->x, p->y, c1x * SUB, c1y * SUB, c2x * SUB, c2y * SUB, x * SUB, y * SUB, curvePts);
+    for (uint8_t i = 0; i < n; i++)
+        addPoint(path, curvePts[i].x, curvePts[i].y);
+}
+
+void GFX_pathClose(GFXpath *path)
+{
+    if (!pathWritable(path))
+        return;
+    if (!path->open || path->count == contourStart(path, path->contours))
+    {
+        endContour(path, false);
+        return;
+    }
+    const GFXpoint *first = &path->pts[contourStart(path, path->contours)];
+    addPoint(path, first->x, first->y);
+    endContour(path, true);
+}
+
+void GFX_strokePath(const GFXpath *path, uint8_t width, uint8_t cap, uint16_t color)
+{
+    if (!GFX_pathValid(path))
+        return;
+    // An open contour still being built is stroked as it stands
+    uint8_t contours = path->contours + (path->open ? 1 : 0);
+    for (uint8_t c = 0; c < contours; c++)
+    {
+        uint16_t start = contourStart(path, c);
+        uint16_t end = c < path->contours ? path->ends[c] & ~CLOSED : path->count;
+        bool closed = c < path->contours && (path->ends[c] & CLOSED);
+        // A closed contour has no ends, only a join where it meets itself
+        GFX_drawPolylineFixed(&path->pts[start], end - start, width, closed ? GFX_CAP_ROUND : cap, color);
+    }
+}
+
+void GFX_fillPath(const GFXpath *path, uint16_t color)
+{
+    if (path->count == 0 || !GFX_pathValid(path))
+        return;
+
+    int32_t ymin = path->pts[0].y, ymax = ymin;
+    for (uint16_t i = 1; i < path->count; i++)
+    {
+        if (path->pts[i].y < ymin)
+            ymin = path->pts[i].y;
+        if (path->pts[i].y > ymax)
+            ymax = path->pts[i].y;
+    }
+    int16_t r0 = ceilSub(ymin), r1 = ymax >> 4;
+    if (r0 < 0)
+        r0 = 0;
+    if (r1 >= (int16_t)GFX_getHeight())
+        r1 = GFX_getHeight() - 1;
+
+    // Crossings far off screen are pulled in so span ends fit in int16
+    int32_t xLimit = (GFX_getWidth() + 1) * SUB;
+    uint8_t contours = path->contours + (path->open ? 1 : 0);
+    for (int16_t row = r0; row <= r1; row++)
+    {
+        // Sample each row at the pixel centres; edges are half-open in y so a
+        // vertex shared by two edges is counted once
+        int32_t yc = row * SUB;
+        uint8_t n = 0;
+        for (uint8_t c = 0; c < contours; c++)
+        {
+            uint16_t start = contourStart(path, c);
+            uint16_t end = c < path->contours ? path->ends[c] & ~CLOSED : path->count;
+            for (uint16_t i = start; i < end; i++)
+            {
+                const GFXpoint *a = &path->pts[i];
+                const GFXpoint *b = &path->pts[i + 1 < end ? i + 1 : start];
+                if (a->y == b->y || yc < (a->y < b->y ? a->y : b->y) || yc >= (a->y < b->y ? b->y : a->y))
+                    continue;
+                if (n == GFX_PATH_MAX_CROSSINGS)
+                    break;
+                int32_t x = a->x + (int32_t)((int64_t)(yc - a->y) * (b->x - a->x) / (b->y - a->y));
+                if (x < -SUB)
+                    x = -SUB;
+                if (x > xLimit)
+                    x = xLimit;
+                int8_t dir = b->y > a->y ? 1 : -1;
+
+                // Insertion sort by x as crossings arrive
+                uint8_t k = n++;
+                while (k > 0 && crossX[k - 1] > x)
+                {
+                    crossX[k] = crossX[k - 1];
+                    crossDir[k] = crossDir[k - 1];
+                    k--;
+                }
+                crossX[k] = x;
+                crossDir[k] = dir;
+            }
+        }
+
+        int16_t winding = 0;
+        int32_t spanStart = 0;
+        for (uint8_t k = 0; k < n; k++)
+        {
+            if (winding == 0)
+                spanStart = crossX[k];
+            winding += crossDir[k];
+            // Pixels whose centres lie in [spanStart, crossX)
+            if (winding == 0)
+                GFX_drawSpan(ceilSub(spanStart), ceilSub(crossX[k]) - 1, row, color);
+        }
+    }
+}
+
+void GFX_drawQuadBezier(int16_t x0, int16_t y0, int16_t cx, int16_t cy, int16_t x1, int16_t y1,
+                        uint8_t width, uint8_t cap, uint16_t color)
+{
+    curvePts[0].x = x0 * SUB;
+    curvePts[0].y = y0 * SUB;
+    uint8_t n = flattenQuad(x0 * SUB, y0 * SUB, cx * SUB, cy * SUB, x1 * SUB, y1 * SUB, &curvePts[1]);
+    GFX_drawPolylineFixed(curvePts, n + 1, width, cap, color);
+}
+
+void GFX_drawCubicBezier(int16_t x0, int16_t y0, int16_t c1x, int16_t c1y, int16_t c2x, int16_t c2y,
+                         int16_t x1, int16_t y1, uint8_t width, uint8_t cap, uint16_t color)
+{
+    curvePts[0].x = x0 * SUB;
+    curvePts[0].y = y0 * SUB;
+    uint8_t n = flattenCubic(x0 * SUB, y0 * SUB, c1x * SUB, c1y * SUB, c2x * SUB, c2y * SUB,
+                             x1 * SUB, y1 * SUB, &curvePts[1]);
+    GFX_drawPolylineFixed(curvePts, n + 1, width, cap, color);
+}
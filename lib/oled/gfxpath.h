@@ -0,0 +1,131 @@
+/**
+ * @file gfxpath.h
+ * @brief Quadratic and cubic Bezier curves and paths in fixed point
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Curves are flattened to line segments in 1/GFX_SUBPIXEL pixel integers.
+ * The segment count per curve comes from Wang's formula: the curve's second
+ * differences bound how far a straight segment can stray, so a small or
+ * nearly straight curve gets a few segments and a large sweeping one gets
+ * more, always within GFX_PATH_TOLERANCE. A path is then stroked through the
+ * poly line code of gfxline.h or filled with a non-zero scanline fill.
+ * Coordinates must stay within +/-2047 pixels so the fixed-point points fit
+ * in a GFXpoint.
+ */
+
+#ifndef GFXPATH_H
+#define GFXPATH_H
+
+#include <stdint.h>
+#include "gfxline.h"
+
+/** @brief Largest distance between a curve and its segments, 1/GFX_SUBPIXEL pixel */
+#ifndef GFX_PATH_TOLERANCE
+#define GFX_PATH_TOLERANCE 4
+#endif
+
+/** @brief Most segments a single curve is split into */
+#define GFX_PATH_MAX_STEPS 64
+
+/** @brief Most edge crossings on one scanline when filling */
+#define GFX_PATH_MAX_CROSSINGS 64
+
+/** @brief Path state; fields below the marker are internal */
+typedef struct
+{
+    uint16_t segments; ///< Line segments produced by the last build
+    bool overflow;     ///< Points or contours were dropped for lack of room
+
+    // Internal
+    GFXpoint *pts;       // Flattened points in 1/GFX_SUBPIXEL pixel
+    uint16_t *ends;      // One past the last point of each contour, top bit set when closed
+    uint16_t count, cap;
+    uint8_t contours, contourCap;
+    bool open;           // A contour is being built
+    uint32_t generation; // Arena generation of pts and ends
+} GFXpath;
+
+/**
+ * @brief Set up a path, allocating its point and contour tables from the display arena
+ * @param path Path to initialise
+ * @param maxPoints Flattened points held (a curve adds up to GFX_PATH_MAX_STEPS)
+ * @param maxContours Contours (sub-paths) held
+ * @return false if the arena has no room
+ * @note Once the arena is released past the path (GFX_configure(), an earlier
+ *       GFX_arenaMark()) building only sets overflow and drawing does
+ *       nothing until it is initialised again
+ */
+bool GFX_pathInit(GFXpath *path, uint16_t maxPoints, uint8_t maxContours);
+
+/**
+ * @brief Check that a path's arena memory is still its own
+ * @return false if initialisation failed or the arena was released past the path
+ */
+bool GFX_pathValid(const GFXpath *path);
+
+/**
+ * @brief Empty the path, keeping its storage
+ */
+void GFX_pathReset(GFXpath *path);
+
+/**
+ * @brief Start a new contour at (x, y)
+ */
+void GFX_pathMoveTo(GFXpath *path, int16_t x, int16_t y);
+
+/**
+ * @brief Straight line to (x, y); starts a contour there if none is open
+ */
+void GFX_pathLineTo(GFXpath *path, int16_t x, int16_t y);
+
+/**
+ * @brief Quadratic Bezier to (x, y) with control point (cx, cy)
+ */
+void GFX_pathQuadTo(GFXpath *path, int16_t cx, int16_t cy, int16_t x, int16_t y);
+
+/**
+ * @brief Cubic Bezier to (x, y) with control points (c1x, c1y) and (c2x, c2y)
+ */
+void GFX_pathCubicTo(GFXpath *path, int16_t c1x, int16_t c1y, int16_t c2x, int16_t c2y, int16_t x, int16_t y);
+
+/**
+ * @brief Close the current contour back to its first point
+ */
+void GFX_pathClose(GFXpath *path);
+
+/**
+ * @brief Stroke every contour
+ * @param path Path
+ * @param width Line width in pixels
+ * @param cap GFX_CAP_* used at the ends of open contours
+ * @param color 16-bit RGB565 color
+ */
+void GFX_strokePath(const GFXpath *path, uint8_t width, uint8_t cap, uint16_t color);
+
+/**
+ * @brief Fill the path with the non-zero winding rule, open contours closed implicitly
+ * @param path Path
+ * @param color 16-bit RGB565 color
+ */
+void GFX_fillPath(const GFXpath *path, uint16_t color);
+
+/**
+ * @brief Draw a quadratic Bezier curve without building a path
+ * @param width Line width in pixels
+ * @param cap GFX_CAP_* used at both ends
+ * @param color 16-bit RGB565 color
+ */
+void GFX_drawQuadBezier(int16_t x0, int16_t y0, int16_t cx, int16_t cy, int16_t x1, int16_t y1,
+                        uint8_t width, uint8_t cap, uint16_t color);
+
+/**
+ * @brief Draw a cubic Bezier curve without building a path
+ * @param width Line width in pixels
+ * @param cap GFX_CAP_* used at both ends
+ * @param color 16-bit RGB565 color
+ */
+void GFX_drawCubicBezier(int16_t x0, int16_t y0, int16_t c1x, int16_t c1y, int16_t c2x, int16_t c2y,
+                         int16_t x1, int16_t y1, uint8_t width, uint8_t cap, uint16_t color);
+
+#endif
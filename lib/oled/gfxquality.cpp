@@ -0,0 +1,285 @@
+// Adaptive rendering quality
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// The frame time average is an exponential moving average with weight 1/8,
+// so a step in cost shows after a handful of frames. Going down a level
+// only needs the average over budget for GFX_QUALITY_HOLD_FRAMES; going
+// back up also needs a retry interval since the last step down, which
+// keeps a load sitting right at the budget from bouncing between two levels
+// every few frames. A step up that has to be undone doubles the interval,
+// up to 16 times GFX_QUALITY_RETRY_FRAMES, until motion stops. The average
+// restarts at every level change so it only ever holds frames of one level.
+//
+// Half resolution draws the region into a canvas a quarter of its size and
+// writes each canvas pixel as a 2x2 block, into the framebuffer rows or as
+// one window write per pair of rows in direct mode.
+
+#include <string.h>
+#include "gfxquality.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxdefer.h"
+#include "gfxstencil.h"
+#include "st7789.h"
+#include "pixcache.h"
+#include "pico/stdlib.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+typedef struct
+{
+    int16_t x, y;
+    uint16_t w, h;
+    GFXregionFn fn;
+    void *ctx;
+} QRegion;
+
+uint8_t gfxQualityLevel = GFX_QUALITY_FULL;
+
+static QRegion qRegions[GFX_QUALITY_REGIONS];
+static uint8_t qRegionCount = 0;
+static uint8_t qLevel = GFX_QUALITY_FULL;
+static uint32_t qBudgetUs = 0;
+static uint32_t qAverageUs = 0;
+static uint16_t qSinceChange = 0; // Frames at the current level
+static uint16_t qSinceDown = 0;   // Frames since the last step down
+static uint16_t qRetry = GFX_QUALITY_RETRY_FRAMES;
+static bool qLastWasUp = false;   // The last change was a step up
+static uint32_t qFrame = 0;
+static absolute_time_t qStart;
+
+static uint16_t *qCanvas = NULL;
+static size_t qCanvasPixels = 0;
+static uint32_t qCanvasGeneration;
+static size_t qCanvasMark, qCanvasTop; // Arena mark before and after the canvas
+static uint16_t qRows[2 * 320]; // A doubled row pair in direct mode
+
+static GFXqualityStats qStats;
+
+void GFX_setFrameBudget(uint32_t targetUs)
+{
+    qBudgetUs = targetUs;
+}
+
+int8_t GFX_addDynamicRegion(int16_t x, int16_t y, int16_t w, int16_t h, GFXregionFn fn, void *ctx)
+{
+    if (qRegionCount == GFX_QUALITY_REGIONS)
+        return -1;
+    int16_t x1 = x + w > (int16_t)_width ? _width : x + w;
+    int16_t y1 = y + h > (int16_t)_height ? _height : y + h;
+    if (x < 0)
+        x = 0;
+    if (y < 0)
+        y = 0;
+    if (x >= x1 || y >= y1)
+        return -1;
+
+    QRegion *r = &qRegions[qRegionCount];
+    r->x = x;
+    r->y = y;
+    r->w = x1 - x;
+    r->h = y1 - y;
+    r->fn = fn;
+    r->ctx = ctx;
+    return qRegionCount++;
+}
+
+void GFX_clearDynamicRegions()
+{
+    qRegionCount = 0;
+}
+
+void GFX_frameBegin()
+{
+    qStart = get_absolute_time();
+}
+
+// Canvas big enough for the largest region at half size, kept in the arena.
+// A canvas that is too small is replaced only while it is the newest
+// allocation; under anything else the region is drawn at full size.
+static bool qCanvasReady()
+{
+    size_t need = 0;
+    for (uint8_t i = 0; i < qRegionCount; i++)
+    {
+        size_t n = (size_t)((qRegions[i].w + 1) / 2) * ((qRegions[i].h + 1) / 2);
+        if (n > need)
+            need = n;
+    }
+    if (qCanvas && GFX_arenaHolds(qCanvas, qCanvasGeneration))
+    {
+        if (qCanvasPixels >= need)
+            return true;
+        if (GFX_arenaMark() != qCanvasTop)
+            return false;
+        GFX_arenaRelease(qCanvasMark);
+    }
+    qCanvasMark = GFX_arenaMark();
+    qCanvas = (uint16_t *)GFX_arenaAlloc(need * sizeof(uint16_t), GFX_MEM_CANVAS);
+    qCanvasGeneration = GFX_arenaGeneration();
+    qCanvasTop = GFX_arenaMark();
+    qCanvasPixels = qCanvas ? need : 0;
+    return qCanvas != NULL;
+}
+
+// Write the half-size canvas over the region, each pixel as a 2x2 block
+static void qExpand(const QRegion *r, uint16_t cw)
+{
+    if (!GFX_stencilBoxVisible(r->x, r->y, r->w, r->h))
+    {
+        // Partly hidden: each row's visible spans only
+        for (uint16_t y = 0; y < r->h; y++)
+        {
+            const uint16_t *src = qCanvas + (y >> 1) * cw;
+            for (uint16_t x = 0; x < r->w; x++)
+                qRows[x] = src[x >> 1];
+            GFX_stencilCopyRow(r->x, r->y + y, qRows, r->w);
+        }
+        return;
+    }
+
+    if (gfxFramebuffer != NULL)
+    {
+        for (uint16_t y = 0; y < r->h; y++)
+        {
+            const uint16_t *src = qCanvas + (y >> 1) * cw;
+            uint16_t *dst = GFX_getRow(r->y + y) + r->x;
+            for (uint16_t x = 0; x < r->w; x++)
+                dst[x] = src[x >> 1];
+        }
+        return;
+    }
+
+    if (gfxDeferActive)
+        GFX_deferResolve(); // Recorded entries go first
+    LCD_cacheFlush();        // Keep ordering with pixels already queued
+    for (uint16_t y = 0; y < r->h; y += 2)
+    {
+        const uint16_t *src = qCanvas + (y >> 1) * cw;
+        for (uint16_t x = 0; x < r->w; x++)
+            qRows[x] = src[x >> 1];
+        uint16_t rows = r->h - y < 2 ? 1 : 2;
+        if (rows == 2)
+            memcpy(qRows + r->w, qRows, r->w * sizeof(uint16_t));
+        LCD_WriteBitmap(r->x, r->y + y, r->w, rows, qRows);
+    }
+}
+
+static void qDrawRegion(const QRegion *r, uint8_t level)
+{
+    GFXregionView v;
+    v.level = level;
+    if (level >= GFX_QUALITY_HALF && qCanvasReady())
+    {
+        v.x = 0;
+        v.y = 0;
+        v.w = (r->w + 1) / 2;
+        v.h = (r->h + 1) / 2;
+        v.shift = 1;
+        gfxQualityLevel = level;
+        GFX_beginCanvas(qCanvas, v.w, v.h);
+        r->fn(&v, r->ctx);
+        GFX_endCanvas();
+        gfxQualityLevel = GFX_QUALITY_FULL;
+        qExpand(r, v.w);
+        return;
+    }
+
+    if (level > GFX_QUALITY_FAST)
+        level = GFX_QUALITY_FAST; // No canvas: cheapest full-size drawing
+    v.x = r->x;
+    v.y = r->y;
+    v.w = r->w;
+    v.h = r->h;
+    v.shift = 0;
+    v.level = level;
+    gfxQualityLevel = level;
+    r->fn(&v, r->ctx);
+    gfxQualityLevel = GFX_QUALITY_FULL;
+}
+
+void GFX_drawDynamicRegions()
+{
+    if (qLevel == GFX_QUALITY_SKIP && (qFrame & 1))
+    {
+        qStats.skipped++;
+        return;
+    }
+    for (uint8_t i = 0; i < qRegionCount; i++)
+        qDrawRegion(&qRegions[i], qLevel);
+}
+
+void GFX_frameEnd(bool moving)
+{
+    uint32_t t = (uint32_t)absolute_time_diff_us(qStart, get_absolute_time());
+    qStats.frames[qLevel]++;
+    qStats.us[qLevel] += t;
+    qFrame++;
+
+    if (!moving)
+    {
+        if (qLevel != GFX_QUALITY_FULL)
+        {
+            // Final repaint so the still picture is at full quality
+            absolute_time_t t0 = get_absolute_time();
+            qLevel = GFX_QUALITY_FULL;
+            for (uint8_t i = 0; i < qRegionCount; i++)
+                qDrawRegion(&qRegions[i], GFX_QUALITY_FULL);
+            GFX_flush();
+            qStats.us[GFX_QUALITY_FULL] += absolute_time_diff_us(t0, get_absolute_time());
+            qStats.repaints++;
+        }
+        qAverageUs = 0;
+        qSinceChange = 0;
+        qRetry = GFX_QUALITY_RETRY_FRAMES;
+        qSinceDown = qRetry;
+        qLastWasUp = false;
+        return;
+    }
+
+    qAverageUs = qAverageUs ? qAverageUs - qAverageUs / 8 + t / 8 : t;
+    if (qSinceChange < 0xFFFF)
+        qSinceChange++;
+    if (qSinceDown < 0xFFFF)
+        qSinceDown++;
+    if (qBudgetUs == 0 || qSinceChange < GFX_QUALITY_HOLD_FRAMES)
+        return;
+
+    if (qAverageUs > qBudgetUs && qLevel < GFX_QUALITY_SKIP)
+    {
+        if (qLastWasUp && qRetry < 16 * GFX_QUALITY_RETRY_FRAMES)
+            qRetry *= 2; // That step up did not hold
+        qLevel++;
+        qStats.stepsDown++;
+        qSinceDown = 0;
+        qLastWasUp = false;
+    }
+    else if (qLevel > GFX_QUALITY_FULL && qSinceDown >= qRetry &&
+             (uint64_t)qAverageUs * 100 < (uint64_t)qBudgetUs * GFX_QUALITY_RESTORE_PCT)
+    {
+        qLevel--;
+        qStats.stepsUp++;
+        qLastWasUp = true;
+    }
+    else
+        return;
+    qSinceChange = 0;
+    qAverageUs = 0;
+}
+
+uint8_t GFX_getQualityLevel()
+{
+    return qLevel;
+}
+
+void GFX_getQualityStats(GFXqualityStats *stats)
+{
+    qStats.averageUs = qAverageUs;
+    *stats = qStats;
+}
+
+void GFX_resetQualityStats()
+{
+    memset(&qStats, 0, sizeof(qStats));
+}
@@ -0,0 +1,145 @@
+/**
+ * @file gfxquality.h
+ * @brief Adaptive rendering quality driven by measured frame time
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Parts of the screen that animate (needles, plots, scrolling lists) are
+ * registered as dynamic regions with a callback that draws them. Each
+ * frame is timed between GFX_frameBegin() and GFX_frameEnd(), and when the
+ * moving average goes over the frame budget the regions are drawn one
+ * level cheaper:
+ * - GFX_QUALITY_FAST: anti-aliased lines and outline glyphs drawn aliased;
+ * - GFX_QUALITY_HALF: also rendered at half resolution into a canvas and
+ *   pixel doubled onto the screen;
+ * - GFX_QUALITY_SKIP: also redrawn only every other frame.
+ * A level is held for a few frames before the next step down, and the
+ * average has to fall well under the budget, for longer, before a step
+ * back up, so the level does not flicker. When motion stops the regions
+ * are repainted once at full quality.
+ */
+
+#ifndef GFXQUALITY_H
+#define GFXQUALITY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define GFX_QUALITY_FULL 0   ///< Everything drawn as designed
+#define GFX_QUALITY_FAST 1   ///< No anti-aliasing in dynamic regions
+#define GFX_QUALITY_HALF 2   ///< Dynamic regions at half resolution, pixels doubled
+#define GFX_QUALITY_SKIP 3   ///< As HALF, redrawn every other frame
+#define GFX_QUALITY_LEVELS 4 ///< Number of quality levels
+
+/** @brief Maximum number of dynamic regions */
+#ifndef GFX_QUALITY_REGIONS
+#define GFX_QUALITY_REGIONS 8
+#endif
+
+/** @brief Frames a level is kept before stepping down again */
+#ifndef GFX_QUALITY_HOLD_FRAMES
+#define GFX_QUALITY_HOLD_FRAMES 4
+#endif
+
+/** @brief Frames after a step down before a step back up is tried */
+#ifndef GFX_QUALITY_RETRY_FRAMES
+#define GFX_QUALITY_RETRY_FRAMES 60
+#endif
+
+/** @brief Step back up only when the average is below this percentage of the budget */
+#ifndef GFX_QUALITY_RESTORE_PCT
+#define GFX_QUALITY_RESTORE_PCT 70
+#endif
+
+/** @brief Where and how a dynamic region callback draws */
+typedef struct
+{
+    int16_t x;     ///< Screen (or canvas) position of region pixel (0, 0)
+    int16_t y;     ///< Screen (or canvas) position of region pixel (0, 0)
+    uint16_t w;    ///< Width to paint, in drawing pixels
+    uint16_t h;    ///< Height to paint, in drawing pixels
+    uint8_t shift; ///< 1 at half resolution: region coordinates are divided by 2
+    uint8_t level; ///< Quality level being drawn
+} GFXregionView;
+
+/**
+ * @brief Draws a dynamic region
+ * @param view Where to draw; every pixel of the w*h box must be painted
+ * @param ctx Caller's context pointer
+ */
+typedef void (*GFXregionFn)(const GFXregionView *view, void *ctx);
+
+/** @brief Quality controller counters (since the last GFX_resetQualityStats()) */
+typedef struct
+{
+    uint32_t frames[GFX_QUALITY_LEVELS]; ///< Frames timed at each level
+    uint64_t us[GFX_QUALITY_LEVELS];     ///< Time spent in frames at each level
+    uint32_t stepsDown;                  ///< Level reductions
+    uint32_t stepsUp;                    ///< Level restorations while moving
+    uint32_t skipped;                    ///< Region redraws skipped at GFX_QUALITY_SKIP
+    uint32_t repaints;                   ///< Full-quality repaints when motion stopped
+    uint32_t averageUs;                  ///< Current moving average frame time
+} GFXqualityStats;
+
+/** @brief Level dynamic regions are being drawn at (checked by the AA code) */
+extern uint8_t gfxQualityLevel;
+
+/**
+ * @brief Set the frame time to stay under
+ * @param targetUs Budget in microseconds, e.g. 33333 for 30 fps; 0 disables adaptation
+ */
+void GFX_setFrameBudget(uint32_t targetUs);
+
+/**
+ * @brief Register an area of the screen that changes while animating
+ * @param x X coordinate of the region
+ * @param y Y coordinate of the region
+ * @param w Width (clipped to the screen)
+ * @param h Height (clipped to the screen)
+ * @param fn Draws the region; called by GFX_drawDynamicRegions()
+ * @param ctx Passed to fn
+ * @return Region index, or -1 if the table is full or the region is off screen
+ */
+int8_t GFX_addDynamicRegion(int16_t x, int16_t y, int16_t w, int16_t h, GFXregionFn fn, void *ctx);
+
+/**
+ * @brief Remove every dynamic region
+ */
+void GFX_clearDynamicRegions();
+
+/**
+ * @brief Start timing a frame
+ */
+void GFX_frameBegin();
+
+/**
+ * @brief Draw every dynamic region at the current quality level
+ * @note Half resolution takes a canvas from the display arena (GFX_MEM_CANVAS)
+ *       for the largest region; without room the region is drawn at GFX_QUALITY_FAST.
+ */
+void GFX_drawDynamicRegions();
+
+/**
+ * @brief Finish timing a frame (after GFX_flush()) and adjust the level
+ * @param moving false once the animation has stopped: quality goes back to
+ *               full and the regions are repainted and flushed straight away
+ */
+void GFX_frameEnd(bool moving);
+
+/**
+ * @brief Current quality level, GFX_QUALITY_FULL to GFX_QUALITY_SKIP
+ */
+uint8_t GFX_getQualityLevel();
+
+/**
+ * @brief Read the quality controller counters
+ * @param stats Destination for the counters
+ */
+void GFX_getQualityStats(GFXqualityStats *stats);
+
+/**
+ * @brief Reset the quality controller counters
+ */
+void GFX_resetQualityStats();
+
+#endif
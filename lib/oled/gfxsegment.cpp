@@ -0,0 +1,407 @@
+// Segment displays
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Segment outlines are convex polygons in half-pixel units: hexagons with
+// pointed ends for the bars, parallelograms for the diagonals, a square for
+// the decimal point. Stroke width s is about a tenth of the height and
+// neighbouring segments are kept a small gap apart, so no two segments share
+// a pixel and one can be refilled without touching the others. At init each
+// polygon is scan-converted once, sampling at pixel centres, into one
+// (first, last) pixel pair per row; drawing a segment is then one
+// GFX_drawSpan() per row, for every digit of the field.
+
+#include <string.h>
+#include "gfxsegment.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "st7789.h"
+#include "pixcache.h"
+#include "lcdqueue.h"
+#include "pico/stdlib.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+#define SEG_DP7 7   // Decimal point shape and bit in seven-segment fields
+#define SEG_DP14 14 // Decimal point shape and bit in fourteen-segment fields
+#define SEG_WINDOW_BYTES 11 // CASET, RASET and RAMWR with their data
+
+// Fourteen-segment patterns from ' ' to 'Z'; lower case is folded to upper
+static const uint16_t seg14Font[] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // ' ' to '''
+    0x0000, 0x0000, 0x3FC0, 0x12C0, 0x0000, 0x00C0, 0x0000, 0x0C00, // '(' to '/'
+    0x0C3F, 0x0006, 0x00DB, 0x008F, 0x00E6, 0x00ED, 0x00FD, 0x0007, // '0' to '7'
+    0x00FF, 0x00EF, 0x0000, 0x0000, 0x0000, 0x00C8, 0x0000, 0x0000, // '8' to '?'
+    0x0000, 0x00F7, 0x128F, 0x0039, 0x120F, 0x00F9, 0x0071, 0x00BD, // '@' to 'G'
+    0x00F6, 0x1209, 0x001E, 0x2470, 0x0038, 0x0536, 0x2136, 0x003F, // 'H' to 'O'
+    0x00F3, 0x203F, 0x20F3, 0x00ED, 0x1201, 0x003E, 0x0C30, 0x2836, // 'P' to 'W'
+    0x2D00, 0x1500, 0x0C09,                                         // 'X' to 'Z'
+};
+
+// Seven-segment patterns for '0' to '9'
+static const uint8_t seg7Digits[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+
+// Letters seven segments can show, in whichever case reads better
+static const char seg7Letters[] = "AaBbCcDdEeFfHhLlNnOoPpRrTtUu-_";
+static const uint8_t seg7LetterMasks[] = {0x77, 0x77, 0x7C, 0x7C, 0x39, 0x58, 0x5E, 0x5E, 0x79, 0x79,
+                                          0x71, 0x71, 0x76, 0x74, 0x38, 0x38, 0x54, 0x54, 0x3F, 0x5C,
+                                          0x73, 0x73, 0x50, 0x50, 0x78, 0x78, 0x3E, 0x1C, 0x40, 0x08};
+
+static GFXsegStats segStats = {0, 0, 0, 0};
+
+static uint16_t segChar(uint8_t style, char c)
+{
+    if (style == GFX_SEG_14)
+    {
+        if (c >= 'a' && c <= 'z')
+            c -= 'a' - 'A';
+        if (c == '_')
+            return 0x0008;
+        return (c >= ' ' && c <= 'Z') ? seg14Font[c - ' '] : 0;
+    }
+    if (c >= '0' && c <= '9')
+        return seg7Digits[c - '0'];
+    const char *p = c ? strchr(seg7Letters, c) : NULL;
+    return p ? seg7LetterMasks[p - seg7Letters] : 0;
+}
+
+typedef struct
+{
+    int16_t x[6], y[6];
+    uint8_t n;
+} SegPoly;
+
+static void segHexH(SegPoly *p, int16_t xl, int16_t xr, int16_t cy, int16_t s)
+{
+    const int16_t xs[6] = {xl, (int16_t)(xl + s), (int16_t)(xr - s), xr, (int16_t)(xr - s), (int16_t)(xl + s)};
+    const int16_t ys[6] = {cy, (int16_t)(cy - s), (int16_t)(cy - s), cy, (int16_t)(cy + s), (int16_t)(cy + s)};
+    memcpy(p->x, xs, sizeof(xs));
+    memcpy(p->y, ys, sizeof(ys));
+    p->n = 6;
+}
+
+static void segHexV(SegPoly *p, int16_t cx, int16_t yt, int16_t yb, int16_t s)
+{
+    const int16_t xs[6] = {cx, (int16_t)(cx + s), (int16_t)(cx + s), cx, (int16_t)(cx - s), (int16_t)(cx - s)};
+    const int16_t ys[6] = {yt, (int16_t)(yt + s), (int16_t)(yb - s), yb, (int16_t)(yb - s), (int16_t)(yt + s)};
+    memcpy(p->x, xs, sizeof(xs));
+    memcpy(p->y, ys, sizeof(ys));
+    p->n = 6;
+}
+
+// Top edge from xa to xa + dw at y0, bottom edge from xb - dw to xb at y1
+static void segQuad(SegPoly *p, int16_t xa, int16_t y0, int16_t xb, int16_t y1, int16_t dw)
+{
+    const int16_t xs[4] = {xa, (int16_t)(xa + dw), xb, (int16_t)(xb - dw)};
+    const int16_t ys[4] = {y0, y0, y1, y1};
+    memcpy(p->x, xs, sizeof(xs));
+    memcpy(p->y, ys, sizeof(ys));
+    p->n = 4;
+}
+
+// Outlines of every segment in half pixels; returns the number of shapes
+static uint8_t segOutlines(uint8_t style, uint8_t height, SegPoly *p, uint8_t *width, uint8_t *pitch)
+{
+    int16_t s = style == GFX_SEG_14 ? height / 10 : height / 8; // Stroke width in pixels
+    if (s < 2)
+        s = 2;
+    int16_t w = style == GFX_SEG_14 ? height * 2 / 3 : height * 11 / 20;
+    int16_t g = s / 2 > 2 ? s / 2 : 2; // Gap between segments
+    int16_t W = 2 * w, H = 2 * height, mx = w, my = height; // Box and centre in half pixels
+    *width = w;
+    *pitch = w + 2 * s;
+
+    segHexH(&p[0], s + g, W - s - g, s, s);      // A
+    segHexV(&p[1], W - s, s + g, my - g, s);     // B
+    segHexV(&p[2], W - s, my + g, H - s - g, s); // C
+    segHexH(&p[3], s + g, W - s - g, H - s, s);  // D
+    segHexV(&p[4], s, my + g, H - s - g, s);     // E
+    segHexV(&p[5], s, s + g, my - g, s);         // F
+    if (style == GFX_SEG_7)
+    {
+        segHexH(&p[6], s + g, W - s - g, my, s);                    // G
+        segQuad(&p[SEG_DP7], W + s, H - 2 * s, W + 3 * s, H, 2 * s); // Decimal point
+        return SEG_DP7 + 1;
+    }
+
+    segHexH(&p[6], s + g, mx - g, my, s);     // G1
+    segHexH(&p[7], mx + g, W - s - g, my, s); // G2
+    // Diagonals run corner to corner of the boxes left between the bars
+    int16_t lx0 = 2 * s + g, lx1 = mx - s - g, rx0 = mx + s + g, rx1 = W - 2 * s - g;
+    int16_t uy0 = 2 * s + g, uy1 = my - s - g, dy0 = my + s + g, dy1 = H - 2 * s - g;
+    int16_t dw = s + s / 2;
+    if (dw > lx1 - lx0)
+        dw = lx1 - lx0;
+    segQuad(&p[8], lx0, uy0, lx1, uy1, dw);                       // H
+    segHexV(&p[9], mx, 2 * s + g, my - s - g, s);                 // J
+    segQuad(&p[10], rx1 - dw, uy0, rx0 + dw, uy1, dw);            // K
+    segQuad(&p[11], lx1 - dw, dy0, lx0 + dw, dy1, dw);            // L
+    segHexV(&p[12], mx, my + s + g, H - 2 * s - g, s);            // M
+    segQuad(&p[13], rx0, dy0, rx1, dy1, dw);                      // N
+    segQuad(&p[SEG_DP14], W + s, H - 2 * s, W + 3 * s, H, 2 * s); // Decimal point
+    return SEG_DP14 + 1;
+}
+
+// Pixels whose centre (2 * x + 1 half pixels) lies in [a, b], in 1/16 half pixels
+static void segCover(int32_t a, int32_t b, int16_t *x0, int16_t *x1)
+{
+    *x0 = (int16_t)((a - 16 + 31 + 32 * 16) / 32 - 16);
+    *x1 = (int16_t)((b - 16 + 32 * 16) / 32 - 16);
+}
+
+// Scan-convert a convex outline: row range, then one pixel pair per row
+static void segRasterise(const SegPoly *p, GFXsegShape *shape, uint8_t *spans, bool fill)
+{
+    int16_t ymin = p->y[0], ymax = p->y[0];
+    for (uint8_t i = 1; i < p->n; i++)
+    {
+        if (p->y[i] < ymin)
+            ymin = p->y[i];
+        if (p->y[i] > ymax)
+            ymax = p->y[i];
+    }
+    int16_t y0 = ymin / 2, y1 = (ymax - 1) / 2;
+    shape->y0 = y0;
+    shape->rows = y1 - y0 + 1;
+    if (!fill)
+        return;
+
+    int16_t bx0 = 255, bx1 = 0;
+    for (int16_t y = y0; y <= y1; y++)
+    {
+        int32_t Y = 2 * y + 1, lo = INT32_MAX, hi = INT32_MIN;
+        for (uint8_t i = 0; i < p->n; i++)
+        {
+            int32_t xa = p->x[i], ya = p->y[i];
+            int32_t xb = p->x[(i + 1) % p->n], yb = p->y[(i + 1) % p->n];
+            if (ya == yb || Y < (ya < yb ? ya : yb) || Y > (ya < yb ? yb : ya))
+                continue;
+            int32_t x = xa * 16 + (Y - ya) * (xb - xa) * 16 / (yb - ya);
+            if (x < lo)
+                lo = x;
+            if (x > hi)
+                hi = x;
+        }
+        int16_t x0 = 1, x1 = 0; // Empty row at a pointed tip
+        if (lo <= hi)
+            segCover(lo, hi, &x0, &x1);
+        uint8_t *sp = spans + 2 * (shape->span + (y - y0));
+        sp[0] = x0 > x1 ? 1 : x0;
+        sp[1] = x0 > x1 ? 0 : x1;
+        if (x0 <= x1 && x0 < bx0)
+            bx0 = x0;
+        if (x0 <= x1 && x1 > bx1)
+            bx1 = x1;
+    }
+    shape->x0 = bx0 <= bx1 ? bx0 : 0;
+    shape->x1 = bx0 <= bx1 ? bx1 : 0;
+}
+
+bool GFX_segmentInit(GFXsegField *f, int16_t x, int16_t y, uint8_t digits, uint8_t height, uint8_t style,
+                     uint16_t on, uint16_t off, uint16_t bg)
+{
+    memset(f, 0, sizeof(*f));
+    if (digits == 0 || digits > GFX_SEG_MAX_DIGITS || height < 12 || style > GFX_SEG_14)
+        return false;
+
+    SegPoly polys[SEG_DP14 + 1];
+    uint8_t count = segOutlines(style, height, polys, &f->width, &f->pitch);
+    GFXsegShape shapes[SEG_DP14 + 1];
+    uint16_t rows = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        segRasterise(&polys[i], &shapes[i], NULL, false);
+        shapes[i].span = rows;
+        rows += shapes[i].rows;
+    }
+
+    size_t shapeBytes = (count * sizeof(GFXsegShape) + 3) & ~(size_t)3;
+    uint8_t *mem = (uint8_t *)GFX_arenaAlloc(shapeBytes + 2 * rows, GFX_MEM_OTHER);
+    if (mem == NULL)
+        return false;
+    f->shapes = (GFXsegShape *)mem;
+    f->spans = mem + shapeBytes;
+    f->spanBytes = shapeBytes + 2 * rows;
+    f->generation = GFX_arenaGeneration();
+    for (uint8_t i = 0; i < count; i++)
+    {
+        segRasterise(&polys[i], &shapes[i], f->spans, true);
+        f->shapes[i] = shapes[i];
+    }
+
+    f->x = x;
+    f->y = y;
+    f->digits = digits;
+    f->style = style;
+    f->height = height;
+    f->on = on;
+    f->off = off;
+    f->bg = bg;
+    return true;
+}
+
+static void segDamage(GFXsegField *f, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int16_t x1 = x + w > (int16_t)_width ? _width : x + w, y1 = y + h > (int16_t)_height ? _height : y + h;
+    if (x < 0)
+        x = 0;
+    if (y < 0)
+        y = 0;
+    if (x >= x1 || y >= y1)
+        return;
+    if (f->damageCount == GFX_SEG_DAMAGE_RECTS)
+    {
+        // Out of boxes: everything, this one included, becomes one bounding box
+        for (uint8_t i = 0; i < f->damageCount; i++)
+        {
+            const GFXsegRect *q = &f->damage[i];
+            x = q->x < x ? q->x : x;
+            y = q->y < y ? q->y : y;
+            x1 = q->x + q->w > x1 ? q->x + q->w : x1;
+            y1 = q->y + q->h > y1 ? q->y + q->h : y1;
+        }
+        GFXsegRect *r = &f->damage[0];
+        r->x = x;
+        r->y = y;
+        r->w = x1 - x;
+        r->h = y1 - y;
+        f->damageCount = 1;
+        return;
+    }
+    GFXsegRect *r = &f->damage[f->damageCount++];
+    r->x = x;
+    r->y = y;
+    r->w = x1 - x;
+    r->h = y1 - y;
+}
+
+static void segFill(const GFXsegField *f, uint8_t digit, uint8_t shape, uint16_t color)
+{
+    const GFXsegShape *sh = &f->shapes[shape];
+    int16_t dx = f->x + digit * f->pitch, dy = f->y + sh->y0;
+    const uint8_t *sp = f->spans + 2 * sh->span;
+    for (uint8_t r = 0; r < sh->rows; r++, sp += 2)
+        if (sp[0] <= sp[1])
+            GFX_drawSpan(dx + sp[0], dx + sp[1], dy + r, color);
+}
+
+bool GFX_segmentValid(const GFXsegField *f)
+{
+    return f->shapes != NULL && GFX_arenaHolds(f->shapes, f->generation);
+}
+
+uint8_t GFX_segmentPrint(GFXsegField *f, const char *text)
+{
+    if (!GFX_segmentValid(f))
+        return 0;
+    uint16_t dp = f->style == GFX_SEG_14 ? 1 << SEG_DP14 : 1 << SEG_DP7;
+    uint8_t shapes = f->style == GFX_SEG_14 ? SEG_DP14 + 1 : SEG_DP7 + 1;
+
+    uint16_t want[GFX_SEG_MAX_DIGITS];
+    memset(want, 0, sizeof(want));
+    uint8_t n = 0;
+    for (; *text; text++)
+    {
+        if (*text == '.' && n > 0 && !(want[n - 1] & dp))
+            want[n - 1] |= dp;
+        else if (n < f->digits)
+            want[n++] = *text == '.' ? dp : segChar(f->style, *text);
+        else
+            break;
+    }
+
+    uint8_t filled = 0;
+    segStats.updates++;
+    if (!f->drawn)
+    {
+        GFX_fillRect(f->x, f->y, f->digits * f->pitch, f->height, f->bg);
+        segDamage(f, f->x, f->y, f->digits * f->pitch, f->height);
+        for (uint8_t d = 0; d < f->digits; d++)
+            for (uint8_t k = 0; k < shapes; k++)
+                if ((want[d] >> k) & 1 || f->off != f->bg)
+                {
+                    segFill(f, d, k, (want[d] >> k) & 1 ? f->on : f->off);
+                    filled++;
+                }
+        memcpy(f->shown, want, sizeof(want));
+        f->drawn = true;
+        segStats.segments += filled;
+        return filled;
+    }
+
+    for (uint8_t d = 0; d < f->digits; d++)
+    {
+        uint16_t changed = f->shown[d] ^ want[d];
+        for (uint8_t k = 0; changed; k++, changed >>= 1)
+        {
+            if (!(changed & 1))
+                continue;
+            const GFXsegShape *sh = &f->shapes[k];
+            segFill(f, d, k, (want[d] >> k) & 1 ? f->on : f->off);
+            segDamage(f, f->x + d * f->pitch + sh->x0, f->y + sh->y0, sh->x1 - sh->x0 + 1, sh->rows);
+            filled++;
+        }
+        f->shown[d] = want[d];
+    }
+    segStats.segments += filled;
+    return filled;
+}
+
+void GFX_segmentInvalidate(GFXsegField *f)
+{
+    f->drawn = false;
+}
+
+uint8_t GFX_segmentDamage(const GFXsegField *f, const GFXsegRect **rects)
+{
+    *rects = f->damage;
+    return f->damageCount;
+}
+
+uint32_t GFX_segmentFlush(GFXsegField *f)
+{
+    uint32_t bytes = 0;
+    if (gfxFramebuffer == NULL)
+    {
+        LCD_cacheFlush(); // Segments went out through the pixel cache
+        f->damageCount = 0;
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < f->damageCount; i++)
+    {
+        const GFXsegRect *r = &f->damage[i];
+        // One window per run of rows that are contiguous in the scroll ring
+        int16_t y = r->y, end = r->y + r->h;
+        while (y < end)
+        {
+            const uint16_t *src = GFX_getRow(y);
+            int16_t n = 1;
+            while (y + n < end && GFX_getRow(y + n) == src + n * _width)
+                n++;
+            LCD_queueBitmap(r->x, y, r->w, n, src + r->x, _width);
+            bytes += (uint32_t)r->w * n * sizeof(uint16_t) + SEG_WINDOW_BYTES;
+            y += n;
+        }
+    }
+    LCD_queueWait(); // The framebuffer may be drawn into straight after
+    segStats.rects += f->damageCount;
+    segStats.bytes += bytes;
+    f->damageCount = 0;
+    return bytes;
+}
+
+size_t GFX_segmentMemory(const GFXsegField *f)
+{
+    return f->spanBytes;
+}
+
+void GFX_getSegmentStats(GFXsegStats *stats)
+{
+    *stats = segStats;
+}
+
+void GFX_resetSegmentStats()
+{
+    memset(&segStats, 0, sizeof(segStats));
+}
@@ -0,0 +1,166 @@
+/**
+ * @file gfxsegment.h
+ * @brief Seven- and fourteen-segment numeric fields that redraw only changed segments
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Large readouts drawn as text need either a big bitmap font in flash or
+ * GFX_setTextSize() scaling, where every lit bit of the 5x7 font becomes a
+ * GFX_fillRect() and the whole string is redrawn on every change. A segment
+ * field instead builds its segment shapes once, at any height, as row spans
+ * in the display arena. It remembers which segments every position shows,
+ * and an update fills only the segments that turn on (lit color) or off
+ * (unlit color). The boxes of those segments are the field's damage;
+ * GFX_segmentFlush() sends just those from the framebuffer.
+ *
+ * Segment bits follow the usual 14-segment layout: A (top), B, C (right),
+ * D (bottom), E, F (left), G1 and G2 (middle halves), H, K, L, N
+ * (diagonals) and J, M (centre verticals), then the decimal point. Seven
+ * segment fields draw G1 or G2 as one middle segment and ignore the rest.
+ */
+
+#ifndef GFXSEGMENT_H
+#define GFXSEGMENT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define GFX_SEG_7 0  ///< Seven segments and a decimal point per digit
+#define GFX_SEG_14 1 ///< Fourteen segments and a decimal point per digit
+
+/** @brief Character positions per field */
+#ifndef GFX_SEG_MAX_DIGITS
+#define GFX_SEG_MAX_DIGITS 10
+#endif
+
+/** @brief Damage boxes kept per field; more are merged into one bounding box */
+#ifndef GFX_SEG_DAMAGE_RECTS
+#define GFX_SEG_DAMAGE_RECTS 24
+#endif
+
+/** @brief A screen rectangle */
+typedef struct
+{
+    int16_t x, y;
+    uint16_t w, h;
+} GFXsegRect;
+
+/** @brief Rows of one segment, shared by every digit of a field */
+typedef struct
+{
+    uint8_t y0;    ///< First row, relative to the digit
+    uint8_t rows;  ///< Number of rows
+    uint8_t x0;    ///< Leftmost pixel, relative to the digit
+    uint8_t x1;    ///< Rightmost pixel, relative to the digit
+    uint16_t span; ///< First row's (first, last) pixel pair in the span table
+} GFXsegShape;
+
+/** @brief Segment field state; fields below the marker are internal */
+typedef struct
+{
+    int16_t x, y;   ///< Top-left corner of the first digit
+    uint8_t digits; ///< Character positions
+    uint8_t style;  ///< GFX_SEG_7 or GFX_SEG_14
+    uint8_t height; ///< Digit height in pixels
+    uint8_t width;  ///< Digit width in pixels, without the decimal point
+    uint8_t pitch;  ///< Distance from one position to the next
+    uint16_t on;    ///< Lit segment color
+    uint16_t off;   ///< Unlit segment color (the background color hides them)
+    uint16_t bg;    ///< Color between segments
+
+    // Internal
+    GFXsegShape *shapes;
+    uint8_t *spans;
+    uint16_t spanBytes;
+    uint32_t generation; // Arena generation of shapes and spans
+    uint16_t shown[GFX_SEG_MAX_DIGITS]; // Segment bits on screen per position
+    bool drawn;
+    GFXsegRect damage[GFX_SEG_DAMAGE_RECTS];
+    uint8_t damageCount;
+} GFXsegField;
+
+/** @brief Segment field counters (since the last GFX_resetSegmentStats()) */
+typedef struct
+{
+    uint32_t updates;  ///< GFX_segmentPrint() calls
+    uint32_t segments; ///< Segments filled
+    uint32_t rects;    ///< Damage boxes sent by GFX_segmentFlush()
+    uint32_t bytes;    ///< SPI bytes sent by GFX_segmentFlush(), windows included
+} GFXsegStats;
+
+/**
+ * @brief Set up a segment field, building its segment shapes in the display arena
+ * @param f Field to initialise
+ * @param x Screen X of the first digit
+ * @param y Screen Y of the top of the digits
+ * @param digits Character positions (up to GFX_SEG_MAX_DIGITS)
+ * @param height Digit height in pixels (at least 12); the width follows from it
+ * @param style GFX_SEG_7 or GFX_SEG_14
+ * @param on Lit segment color
+ * @param off Unlit segment color; pass bg to hide unlit segments
+ * @param bg Background color
+ * @return false if the arena has no room or the arguments are out of range
+ * @note Nothing is drawn until the first GFX_segmentPrint()
+ * @note Once the arena is released past the shapes (GFX_configure(), an
+ *       earlier GFX_arenaMark()) printing draws nothing until the field is
+ *       initialised again
+ */
+bool GFX_segmentInit(GFXsegField *f, int16_t x, int16_t y, uint8_t digits, uint8_t height, uint8_t style,
+                     uint16_t on, uint16_t off, uint16_t bg);
+
+/**
+ * @brief Check that a segment field's arena memory is still its own
+ * @return false if initialisation failed or the arena was released past the shapes
+ */
+bool GFX_segmentValid(const GFXsegField *f);
+
+/**
+ * @brief Show a string, filling only the segments that change
+ * @param f Field to update
+ * @param text Characters left to right; a '.' lights the decimal point of the
+ *             character before it. Positions past the end are blank.
+ *             Format numbers with snprintf() to right-align them.
+ * @return Number of segments filled
+ * @note The first call after init or GFX_segmentInvalidate() draws the whole field
+ */
+uint8_t GFX_segmentPrint(GFXsegField *f, const char *text);
+
+/**
+ * @brief Redraw the whole field on the next GFX_segmentPrint()
+ * @note For when something else has drawn over the field
+ */
+void GFX_segmentInvalidate(GFXsegField *f);
+
+/**
+ * @brief Boxes changed by GFX_segmentPrint() since the last GFX_segmentFlush()
+ * @param f Field
+ * @param rects Set to the boxes
+ * @return Number of boxes
+ */
+uint8_t GFX_segmentDamage(const GFXsegField *f, const GFXsegRect **rects);
+
+/**
+ * @brief Send the changed boxes from the framebuffer to the panel and forget them
+ * @param f Field
+ * @return SPI bytes sent, windows included; 0 in direct mode, where
+ *         segments already went to the panel as they were filled
+ */
+uint32_t GFX_segmentFlush(GFXsegField *f);
+
+/**
+ * @brief Arena bytes used by a field's segment shapes
+ */
+size_t GFX_segmentMemory(const GFXsegField *f);
+
+/**
+ * @brief Read the segment field counters
+ * @param stats Destination for the counters
+ */
+void GFX_getSegmentStats(GFXsegStats *stats);
+
+/**
+ * @brief Reset the segment field counters
+ */
+void GFX_resetSegmentStats();
+
+#endif
@@ -0,0 +1,204 @@
+// Stencil masks
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Spans are kept in one array in row order, with a table of where each row
+// starts, so a row's spans are found in O(1) and visited in order. Typical
+// masks have one span per row (a rounded panel) or a few (a cut-out), so
+// intersecting a fill with them is a handful of compares.
+//
+// Rounded corners are tested in doubled coordinates to stay in integers: a
+// pixel (x, y) near the top-left corner is visible if its centre is inside
+// the arc, (2x + 1 - 2r)^2 + (2y + 1 - 2r)^2 <= 4r^2.
+
+#include <string.h>
+#include "gfxstencil.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxdefer.h"
+#include "st7789.h"
+#include "pixcache.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+const GFXstencil *gfxStencil = NULL;
+
+static bool stencilAlloc(GFXstencil *s, uint16_t w, uint16_t h, uint16_t count)
+{
+    s->width = w;
+    s->height = h;
+    s->count = count;
+
+    // Row table and spans in one allocation; spans only need 2-byte alignment
+    s->first = (uint16_t *)GFX_arenaAlloc((h + 1) * sizeof(uint16_t) + count * sizeof(GFXspan), GFX_MEM_OTHER);
+    if (s->first == NULL)
+    {
+        s->spans = NULL;
+        return false;
+    }
+    s->spans = (GFXspan *)(s->first + h + 1);
+    s->generation = GFX_arenaGeneration();
+    return true;
+}
+
+bool GFX_stencilValid(const GFXstencil *s)
+{
+    return s->first != NULL && GFX_arenaHolds(s->first, s->generation);
+}
+
+bool GFX_stencilFromBitmap(GFXstencil *s, const uint8_t *bitmap, uint16_t w, uint16_t h)
+{
+    uint16_t stride = (w + 7) / 8;
+    GFXspan *out = NULL;
+    uint16_t count = 0;
+
+    // First pass counts the spans, second stores them
+    for (int pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+        {
+            if (!stencilAlloc(s, w, h, count))
+                return false;
+            out = s->spans;
+            count = 0;
+        }
+        for (uint16_t y = 0; y < h; y++)
+        {
+            const uint8_t *row = bitmap + y * stride;
+            if (pass == 1)
+                s->first[y] = count; // Also for an empty mask, which has no spans to write
+            int16_t start = -1;
+            for (uint16_t x = 0; x <= w; x++)
+            {
+                bool on = x < w && (row[x >> 3] & (0x80 >> (x & 7)));
+                if (on && start < 0)
+                    start = x;
+                else if (!on && start >= 0)
+                {
+                    if (pass == 1)
+                        out[count] = {start, (int16_t)(x - 1)};
+                    count++;
+                    start = -1;
+                }
+            }
+        }
+    }
+    s->first[h] = count;
+    return true;
+}
+
+bool GFX_stencilRoundedRect(GFXstencil *s, uint16_t w, uint16_t h, uint16_t radius)
+{
+    if (!stencilAlloc(s, w, h, h))
+        return false;
+    int32_t r = radius;
+    if (r > w / 2)
+        r = w / 2;
+    if (r > h / 2)
+        r = h / 2;
+
+    for (uint16_t y = 0; y < h; y++)
+    {
+        // Distance of the row centre from the arc centres, doubled
+        uint16_t edge = y < h - 1 - y ? y : h - 1 - y;
+        int32_t inset = 0;
+        if (edge < r)
+        {
+            int32_t d = 2 * r - 2 * edge - 1;
+            while ((2 * inset + 1 - 2 * r) * (2 * inset + 1 - 2 * r) + d * d > 4 * r * r)
+                inset++;
+        }
+        s->first[y] = y;
+        s->spans[y] = {(int16_t)inset, (int16_t)(w - 1 - inset)};
+    }
+    s->first[h] = h;
+    return true;
+}
+
+bool GFX_setStencil(const GFXstencil *s)
+{
+    if (gfxDeferActive)
+        GFX_deferResolve(); // Recorded entries were drawn under the old stencil
+    if (s != NULL && !GFX_stencilValid(s))
+    {
+        gfxStencil = NULL; // Its spans are gone; draw everywhere rather than read them
+        return false;
+    }
+    gfxStencil = s;
+    return true;
+}
+
+void GFX_stencilCheckArena()
+{
+    if (gfxStencil != NULL && !GFX_stencilValid(gfxStencil))
+        gfxStencil = NULL;
+}
+
+const GFXspan *GFX_stencilRow(int16_t y, uint16_t *count)
+{
+    static GFXspan whole;
+    const GFXstencil *s = gfxStencil;
+    if (s == NULL)
+    {
+        whole = {0, (int16_t)(_width - 1)};
+        *count = 1;
+        return &whole;
+    }
+    if (y < 0 || y >= (int16_t)s->height)
+    {
+        *count = 0;
+        return s->spans;
+    }
+    *count = s->first[y + 1] - s->first[y];
+    return s->spans + s->first[y];
+}
+
+bool GFX_stencilBoxVisible(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (gfxStencil == NULL)
+        return true;
+    for (int16_t yy = y; yy < y + h; yy++)
+    {
+        uint16_t n;
+        const GFXspan *sp = GFX_stencilRow(yy, &n);
+        uint16_t i = 0;
+        while (i < n && !(sp[i].x0 <= x && sp[i].x1 >= x + w - 1))
+            i++;
+        if (i == n)
+            return false;
+    }
+    return true;
+}
+
+void GFX_stencilCopyRow(int16_t x, int16_t y, const uint16_t *pixels, int16_t n)
+{
+    if (y < 0 || y >= (int16_t)_height)
+        return;
+    uint16_t count;
+    const GFXspan *sp = GFX_stencilRow(y, &count);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        int16_t lo = sp[i].x0 > x ? sp[i].x0 : x;
+        int16_t hi = sp[i].x1 < x + n - 1 ? sp[i].x1 : x + n - 1;
+        if (lo < 0)
+            lo = 0;
+        if (hi >= (int16_t)_width)
+            hi = _width - 1;
+        if (lo > hi)
+            continue;
+        if (gfxFramebuffer != NULL)
+            memcpy(GFX_getRow(y) + lo, pixels + (lo - x), (hi - lo + 1) * sizeof(uint16_t));
+        else
+        {
+            if (gfxDeferActive)
+                GFX_deferResolve();
+            LCD_cacheFlush(); // Keep ordering with pixels already queued
+            LCD_WriteBitmap(lo, y, hi - lo + 1, 1, (uint16_t *)pixels + (lo - x));
+        }
+    }
+}
+
+size_t GFX_stencilMemory(const GFXstencil *s)
+{
+    return (s->height + 1) * sizeof(uint16_t) + s->count * sizeof(GFXspan);
+}
@@ -0,0 +1,140 @@
+/**
+ * @file gfxstencil.h
+ * @brief Stencil masks that clip drawing to an arbitrary shape, a row of spans at a time
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * The 1.47" panel's glass has rounded corners. The usual answer is a safe
+ * margin that leaves a band unused along every edge, although only the
+ * corners are cut. A stencil describes the visible pixels exactly: each row
+ * is a short list of visible spans, built from a 1-bpp mask or generated
+ * for a rounded rectangle. While a stencil is set, pixels, spans, filled
+ * rectangles (and through them lines, circles and text) are clipped
+ * against the row's spans. So are glyphs, blits, tiles, assets and
+ * quality-scaled regions that write rows directly. A filled rectangle
+ * costs a few compares per row, not one test per pixel.
+ *
+ * GFX_fillScreen() still clears the whole screen. Widgets that send their
+ * own region to the panel (the waterfall's direct-mode ring, transitions)
+ * are not clipped and should be placed inside the visible area. Canvases
+ * are drawn without the stencil.
+ */
+
+#ifndef GFXSTENCIL_H
+#define GFXSTENCIL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** @brief Visible pixels x0 to x1 (inclusive) of a row */
+typedef struct
+{
+    int16_t x0, x1;
+} GFXspan;
+
+/** @brief A stencil: visible spans per row, left to right */
+typedef struct
+{
+    uint16_t width;      ///< Width the stencil was built for
+    uint16_t height;     ///< Rows; rows below are hidden
+    uint16_t *first;     ///< height+1 indices: row y has spans first[y] to first[y+1]-1
+    GFXspan *spans;      ///< All spans, row by row, in the same allocation as first
+    uint16_t count;      ///< Number of spans
+    uint32_t generation; ///< Arena generation of first and spans
+} GFXstencil;
+
+/** @brief Stencil clipping drawing, or NULL (checked by gfx.cpp) */
+extern const GFXstencil *gfxStencil;
+
+/**
+ * @brief Build a stencil from a 1-bpp mask, allocating it from the display arena
+ * @param s Stencil to fill
+ * @param bitmap Mask, rows padded to whole bytes, MSB first as for GFX_drawBitmap(); 1 is visible
+ * @param w Mask width
+ * @param h Mask height
+ * @return false if the arena has no room
+ * @note An all-clear mask is valid and hides every row
+ */
+bool GFX_stencilFromBitmap(GFXstencil *s, const uint8_t *bitmap, uint16_t w, uint16_t h);
+
+/**
+ * @brief Build a stencil for a rectangle with rounded corners, allocating it from the display arena
+ * @param s Stencil to fill
+ * @param w Width, normally GFX_getWidth()
+ * @param h Height, normally GFX_getHeight()
+ * @param radius Corner radius; pixels whose centres fall outside the corner arcs are hidden
+ * @return false if the arena has no room
+ * @note Build it again after a rotation that swaps width and height
+ */
+bool GFX_stencilRoundedRect(GFXstencil *s, uint16_t w, uint16_t h, uint16_t radius);
+
+/**
+ * @brief Check that a stencil's spans are still held by the arena
+ * @return false if it was never built, or the arena was released past it
+ */
+bool GFX_stencilValid(const GFXstencil *s);
+
+/**
+ * @brief Clip all drawing to a stencil
+ * @param s Stencil, or NULL to draw everywhere again
+ * @return false if the stencil is no longer valid; drawing is then unclipped
+ * @note Once the arena is released past the stencil (GFX_configure(),
+ *       GFX_destroyFramebuf() for one built after the framebuffer, an earlier
+ *       GFX_arenaMark()) it is dropped, and must be built and set again
+ */
+bool GFX_setStencil(const GFXstencil *s);
+
+/**
+ * @brief Drop the current stencil if the arena no longer holds it
+ * @note Called after the arena is released; other code need not call it
+ */
+void GFX_stencilCheckArena();
+
+/**
+ * @brief Visible spans of a row, for code that writes rows itself
+ * @param y Row
+ * @param count Set to the number of spans (0 for a hidden row)
+ * @return The spans; without a stencil, one span across the whole row
+ */
+const GFXspan *GFX_stencilRow(int16_t y, uint16_t *count);
+
+/**
+ * @brief Test one pixel against the stencil
+ * @return true if (x, y) is visible, or no stencil is set
+ */
+static inline bool GFX_stencilTest(int16_t x, int16_t y)
+{
+    const GFXstencil *s = gfxStencil;
+    if (s == NULL)
+        return true;
+    if (y < 0 || y >= (int16_t)s->height)
+        return false;
+    for (uint16_t i = s->first[y]; i < s->first[y + 1]; i++)
+        if (x >= s->spans[i].x0 && x <= s->spans[i].x1)
+            return true;
+    return false;
+}
+
+/**
+ * @brief Check whether a whole box is visible
+ * @return true if every pixel of the box is visible, or no stencil is set
+ */
+bool GFX_stencilBoxVisible(int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief Write the visible part of a row of pixels to the framebuffer (or the panel)
+ * @param x Screen X of the first pixel
+ * @param y Screen row
+ * @param pixels RGB565 pixels
+ * @param n Number of pixels
+ * @note Clipped to the screen and the stencil. For row writers whose box
+ *       GFX_stencilBoxVisible() says is partly hidden.
+ */
+void GFX_stencilCopyRow(int16_t x, int16_t y, const uint16_t *pixels, int16_t n);
+
+/**
+ * @brief Arena bytes used by a stencil
+ */
+size_t GFX_stencilMemory(const GFXstencil *s);
+
+#endif
@@ -0,0 +1,501 @@
+// Multi-line text box with incremental reflow
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "gfx.h"
+#include "gfxtextbox.h"
+#include "gfxarena.h"
+
+/** Most line slots a box can show; bounds the per-update slot table */
+#define GFX_TEXTBOX_MAX_SLOTS 64
+
+#define SLOT_REDRAW -1 // Draw the line from the text
+#define SLOT_BLANK -2  // Clear a slot that showed a line
+#define SLOT_KEEP -3   // Slot is already blank
+
+// How the lines of a new layout relate to the lines on screen. New line L
+// was line L + dropped if L < keepHead, and line L + tailShift + dropped if
+// L >= keepTail (keepTail < 0: no reused tail). Other lines are new.
+typedef struct
+{
+    int16_t keepHead;
+    int16_t keepTail;
+    int16_t tailShift;
+    int16_t dropped;
+} Reflow;
+
+static uint16_t charWidth(const GFXtextbox *tb, uint8_t c)
+{
+    if (!tb->font)
+        return 6 * tb->size;
+    if (c < tb->font->first || c > tb->font->last)
+        return 0;
+    return tb->font->glyph[c - tb->font->first].xAdvance * tb->size;
+}
+
+// Lay out one line starting at pos, breaking after the last space that fits
+// (or inside a word longer than the box). Returns where the next line starts.
+static uint16_t layoutLine(const GFXtextbox *tb, uint16_t pos, uint16_t *width, bool *newline)
+{
+    uint16_t x = 0, ink = 0, brk = 0, brkWidth = 0;
+    bool haveBrk = false;
+
+    *newline = false;
+    for (uint16_t i = pos; i < tb->len; i++)
+    {
+        uint8_t c = tb->text[i];
+        if (c == '\n')
+        {
+            *width = ink;
+            *newline = true;
+            return i + 1;
+        }
+        uint16_t cw = charWidth(tb, c);
+        if (c == ' ')
+        {
+            brk = i;
+            brkWidth = ink;
+            haveBrk = true;
+        }
+        else
+        {
+            if (x + cw > tb->w && i > pos)
+            {
+                *width = haveBrk ? brkWidth : ink;
+                return haveBrk ? brk + 1 : i;
+            }
+            ink = x + cw;
+        }
+        x += cw;
+    }
+    *width = ink;
+    return tb->len;
+}
+
+// Line of the previous layout holding text position pos
+static uint16_t prevLineOf(const GFXtextbox *tb, uint16_t lines, uint16_t pos)
+{
+    uint16_t lo = 0, hi = lines - 1;
+    while (lo < hi)
+    {
+        uint16_t mid = (lo + hi + 1) / 2;
+        if (tb->prevStart[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Lay out lines from line n (starting at text position pos). Stops as soon as
+// a new line starts where an old line that begins at or after oldEditEnd
+// started, shifted by delta: the old layout is valid from there and is copied.
+// Returns false if the line table filled up before the end of the text.
+static bool layoutFrom(GFXtextbox *tb, uint16_t n, uint16_t pos, uint16_t oldLines,
+                       uint16_t editPos, int32_t oldEditEnd, int32_t delta, Reflow *rf)
+{
+    uint16_t j = n;
+
+    for (;;)
+    {
+        uint16_t w;
+        bool nl;
+
+        if (n >= tb->lineCap)
+        {
+            tb->lines = n;
+            return false;
+        }
+        uint16_t next = layoutLine(tb, pos, &w, &nl);
+        tb->start[n] = pos;
+        tb->width[n] = w;
+
+        // Line entirely in front of the edit and broken the same way as before
+        if (rf->keepHead == n && n + 1 < oldLines && tb->prevStart[n] == pos &&
+            tb->prevStart[n + 1] == next && next <= editPos)
+            rf->keepHead = n + 1;
+        n++;
+
+        if (next >= tb->len)
+        {
+            if (nl) // Text ends with a newline: an empty line follows
+            {
+                if (n >= tb->lineCap)
+                {
+                    tb->lines = n;
+                    return false;
+                }
+                tb->start[n] = tb->len;
+                tb->width[n] = 0;
+                n++;
+            }
+            tb->lines = n;
+            return true;
+        }
+        pos = next;
+
+        // Back in step with the old layout?
+        while (j < oldLines && (int32_t)tb->prevStart[j] + delta < pos)
+            j++;
+        if (j < oldLines && (int32_t)tb->prevStart[j] >= oldEditEnd &&
+            (int32_t)tb->prevStart[j] + delta == pos)
+        {
+            uint16_t count = oldLines - j;
+            bool fits = n + count <= tb->lineCap;
+            if (!fits)
+                count = tb->lineCap - n;
+            for (uint16_t k = 0; k < count; k++)
+            {
+                tb->start[n + k] = tb->prevStart[j + k] + delta;
+                tb->width[n + k] = tb->prevWidth[j + k];
+            }
+            rf->keepTail = n;
+            rf->tailShift = j - n;
+            tb->lines = n + count;
+            return fits;
+        }
+    }
+}
+
+// Remove the first k lines (all text if k covers every line)
+static void dropFront(GFXtextbox *tb, uint16_t k, Reflow *rf)
+{
+    uint16_t cut = k < tb->lines ? tb->start[k] : tb->len;
+
+    memmove(tb->text, tb->text + cut, tb->len - cut);
+    tb->len -= cut;
+    if (k >= tb->lines)
+    {
+        tb->lines = 1;
+        tb->start[0] = 0;
+        tb->width[0] = 0;
+    }
+    else
+    {
+        tb->lines -= k;
+        memmove(tb->start, tb->start + k, tb->lines * sizeof(uint16_t));
+        memmove(tb->width, tb->width + k, tb->lines * sizeof(uint16_t));
+        for (uint16_t i = 0; i < tb->lines; i++)
+            tb->start[i] -= cut;
+    }
+    rf->dropped += k;
+    rf->keepHead = rf->keepHead > k ? rf->keepHead - k : 0;
+    tb->top = tb->top > k ? tb->top - k : 0;
+}
+
+static uint16_t slotCount(const GFXtextbox *tb)
+{
+    uint16_t slots = tb->h / tb->lineH;
+    return slots > GFX_TEXTBOX_MAX_SLOTS ? GFX_TEXTBOX_MAX_SLOTS : slots;
+}
+
+// Clear one line slot and draw a line into it (line < 0: leave it blank)
+static void drawSlot(const GFXtextbox *tb, uint16_t slot, int32_t line)
+{
+    int16_t sy = tb->y + slot * tb->lineH;
+
+    GFX_fillRect(tb->x, sy, tb->w, tb->lineH, tb->bg);
+    if (line < 0 || line >= tb->lines)
+        return;
+
+    uint16_t end = line + 1 < tb->lines ? tb->start[line + 1] : tb->len;
+    int16_t cx = tb->x;
+    int16_t cy = tb->font ? sy + tb->ascent : sy;
+
+    if (tb->align == GFX_ALIGN_CENTER)
+        cx += (tb->w - tb->width[line]) / 2;
+    else if (tb->align == GFX_ALIGN_RIGHT)
+        cx += tb->w - tb->width[line];
+
+    for (uint16_t i = tb->start[line]; i < end && cx < tb->x + tb->w; i++)
+    {
+        uint8_t c = tb->text[i];
+        if (c == '\n')
+            break;
+        uint16_t cw = charWidth(tb, c);
+        if (cw && c != ' ')
+            GFX_drawChar(cx, cy, c, tb->color, tb->color, tb->size, tb->size);
+        cx += cw;
+    }
+}
+
+static void moveSlot(const GFXtextbox *tb, int16_t *src, uint16_t slot)
+{
+    if (!GFX_copyRect(tb->x, tb->y + src[slot] * tb->lineH, tb->w, tb->lineH,
+                      tb->x, tb->y + slot * tb->lineH))
+        src[slot] = SLOT_REDRAW; // Direct mode: no readback, draw it instead
+}
+
+// Bring the screen in line with the layout: reused lines that moved are
+// copied, new lines are drawn, slots past the end are cleared
+static void updateScreen(GFXtextbox *tb, const Reflow *rf)
+{
+    uint16_t slots = slotCount(tb);
+    const GFXfont *saved = GFX_getFont();
+
+    GFX_setFont(tb->font);
+    if (!tb->shown)
+    {
+        for (uint16_t k = 0; k < slots; k++)
+            drawSlot(tb, k, tb->top + k);
+        if (slots * tb->lineH < tb->h)
+            GFX_fillRect(tb->x, tb->y + slots * tb->lineH, tb->w, tb->h - slots * tb->lineH, tb->bg);
+    }
+    else
+    {
+        int16_t src[GFX_TEXTBOX_MAX_SLOTS];
+
+        for (uint16_t k = 0; k < slots; k++)
+        {
+            int32_t line = tb->top + k;
+            if (line >= tb->lines)
+            {
+                src[k] = k < tb->shownLines ? SLOT_BLANK : SLOT_KEEP;
+                continue;
+            }
+            int32_t old = -1;
+            if (line < rf->keepHead)
+                old = line + rf->dropped;
+            else if (rf->keepTail >= 0 && line >= rf->keepTail)
+                old = line + rf->tailShift + rf->dropped;
+            int32_t os = old - tb->shownTop;
+            src[k] = (old >= 0 && os >= 0 && os < tb->shownLines) ? os : SLOT_REDRAW;
+        }
+
+        // Downward moves bottom-up, then upward moves top-down: the mapping
+        // keeps line order, so no slot is overwritten before it is copied
+        for (uint16_t k = slots; k-- > 0;)
+            if (src[k] >= 0 && src[k] < k)
+                moveSlot(tb, src, k);
+        for (uint16_t k = 0; k < slots; k++)
+            if (src[k] > k)
+                moveSlot(tb, src, k);
+
+        for (uint16_t k = 0; k < slots; k++)
+        {
+            if (src[k] == SLOT_REDRAW)
+                drawSlot(tb, k, tb->top + k);
+            else if (src[k] == SLOT_BLANK)
+                drawSlot(tb, k, -1);
+        }
+    }
+    GFX_setFont(saved);
+
+    tb->shownTop = tb->top;
+    tb->shownLines = tb->lines - tb->top < slots ? tb->lines - tb->top : slots;
+    tb->shown = true;
+}
+
+// Replace del characters at pos with ins characters from str, re-lay out the
+// affected lines and update the screen. In log mode the text is made to fit
+// by dropping whole lines from the front.
+static bool replaceText(GFXtextbox *tb, uint16_t pos, uint16_t del, const char *str,
+                        uint16_t ins, bool log)
+{
+    Reflow rf = {0, -1, 0, 0};
+
+    if (!GFX_textboxValid(tb))
+        return false;
+    if (pos > tb->len)
+        pos = tb->len;
+    if (del > tb->len - pos)
+        del = tb->len - pos;
+
+    if (tb->len - del + ins > tb->cap)
+    {
+        if (!log)
+            return false;
+        if (ins > tb->cap)
+        {
+            str += ins - tb->cap;
+            ins = tb->cap;
+        }
+        uint16_t need = tb->len + ins - tb->cap;
+        uint16_t k = 1;
+        while (k < tb->lines && tb->start[k] < need)
+            k++;
+        dropFront(tb, k, &rf);
+        pos = tb->len;
+    }
+
+    memmove(tb->text + pos + ins, tb->text + pos + del, tb->len - pos - del);
+    memcpy(tb->text + pos, str, ins);
+    tb->len = tb->len - del + ins;
+
+    // The current layout becomes the previous one
+    uint16_t oldLines = tb->lines;
+    uint16_t *t = tb->start;
+    tb->start = tb->prevStart;
+    tb->prevStart = t;
+    t = tb->width;
+    tb->width = tb->prevWidth;
+    tb->prevWidth = t;
+
+    // A shorter first word can move back onto the line before the edit
+    uint16_t from = prevLineOf(tb, oldLines, pos);
+    if (from > 0)
+        from--;
+    memcpy(tb->start, tb->prevStart, from * sizeof(uint16_t));
+    memcpy(tb->width, tb->prevWidth, from * sizeof(uint16_t));
+    rf.keepHead = from;
+
+    bool complete = layoutFrom(tb, from, tb->prevStart[from], oldLines, pos,
+                               (int32_t)pos + del, (int32_t)ins - del, &rf);
+    while (!complete && log)
+    {
+        // Line table full: drop a quarter of it and carry on
+        dropFront(tb, tb->lines / 4 ? tb->lines / 4 : 1, &rf);
+        uint16_t last = tb->lines - 1;
+        complete = layoutFrom(tb, last, tb->start[last], 0, 0, 0, 0, &rf);
+    }
+
+    uint16_t slots = slotCount(tb);
+    if (tb->autoScroll)
+        tb->top = tb->lines > slots ? tb->lines - slots : 0;
+    else if (tb->top >= tb->lines)
+        tb->top = tb->lines - 1;
+    updateScreen(tb, &rf);
+    return true;
+}
+
+bool GFX_textboxInit(GFXtextbox *tb, int16_t x, int16_t y, int16_t w, int16_t h,
+                     const GFXfont *font, uint8_t size, uint16_t textCap, uint16_t lineCap)
+{
+    if (lineCap == 0)
+        lineCap = 1;
+    if (size == 0)
+        size = 1;
+
+    tb->x = x;
+    tb->y = y;
+    tb->w = w;
+    tb->h = h;
+    tb->font = font;
+    tb->size = size;
+    tb->align = GFX_ALIGN_LEFT;
+    tb->color = 0xFFFF;
+    tb->bg = 0x0000;
+    tb->autoScroll = false;
+
+    // Line tables and text in one allocation, so a failure leaves nothing behind
+    size_t tableBytes = 4 * lineCap * sizeof(uint16_t);
+    uint16_t *tables = (uint16_t *)GFX_arenaAlloc(tableBytes + (textCap ? textCap : 1), GFX_MEM_OTHER);
+    tb->text = NULL;
+    tb->shown = false;
+    if (tables == NULL)
+        return false;
+    tb->generation = GFX_arenaGeneration();
+    tb->text = (char *)tables + tableBytes;
+    tb->start = tables;
+    tb->width = tables + lineCap;
+    tb->prevStart = tables + 2 * lineCap;
+    tb->prevWidth = tables + 3 * lineCap;
+    tb->cap = textCap;
+    tb->lineCap = lineCap;
+
+    tb->ascent = 0;
+    if (font)
+    {
+        tb->lineH = font->yAdvance * size;
+        for (uint16_t c = 0; c <= font->last - font->first; c++)
+            if (-font->glyph[c].yOffset * size > tb->ascent)
+                tb->ascent = -font->glyph[c].yOffset * size;
+    }
+    else
+        tb->lineH = 8 * size;
+
+    tb->len = 0;
+    tb->lines = 1;
+    tb->start[0] = 0;
+    tb->width[0] = 0;
+    tb->top = 0;
+    tb->shownTop = 0;
+    tb->shownLines = 0;
+    tb->shown = false;
+    return true;
+}
+
+bool GFX_textboxValid(const GFXtextbox *tb)
+{
+    // Edits swap the current and previous tables; the lower one starts the allocation
+    const uint16_t *base = tb->start < tb->prevStart ? tb->start : tb->prevStart;
+    return tb->text != NULL && GFX_arenaHolds(base, tb->generation);
+}
+
+void GFX_textboxSetColor(GFXtextbox *tb, uint16_t color, uint16_t bg)
+{
+    tb->color = color;
+    tb->bg = bg;
+    if (tb->shown)
+        GFX_textboxDraw(tb);
+}
+
+void GFX_textboxSetAlign(GFXtextbox *tb, uint8_t align)
+{
+    tb->align = align;
+    if (tb->shown)
+        GFX_textboxDraw(tb);
+}
+
+void GFX_textboxSetAutoScroll(GFXtextbox *tb, bool enable)
+{
+    tb->autoScroll = enable;
+}
+
+bool GFX_textboxSetText(GFXtextbox *tb, const char *str)
+{
+    uint16_t n = strlen(str);
+    uint16_t pre = 0, suf = 0;
+    if (!GFX_textboxValid(tb))
+        return false;
+
+    // Only the part between the common prefix and suffix is edited
+    while (pre < n && pre < tb->len && tb->text[pre] == str[pre])
+        pre++;
+    while (suf < n - pre && suf < tb->len - pre && tb->text[tb->len - 1 - suf] == str[n - 1 - suf])
+        suf++;
+    if (pre == n && n == tb->len && tb->shown)
+        return true;
+    return replaceText(tb, pre, tb->len - pre - suf, str + pre, n - pre - suf, false);
+}
+
+void GFX_textboxAppend(GFXtextbox *tb, const char *str)
+{
+    replaceText(tb, tb->len, 0, str, strlen(str), true);
+}
+
+bool GFX_textboxInsert(GFXtextbox *tb, uint16_t pos, const char *str)
+{
+    return replaceText(tb, pos, 0, str, strlen(str), false);
+}
+
+void GFX_textboxDelete(GFXtextbox *tb, uint16_t pos, uint16_t n)
+{
+    replaceText(tb, pos, n, "", 0, false);
+}
+
+void GFX_textboxScrollTo(GFXtextbox *tb, uint16_t line)
+{
+    Reflow rf = {(int16_t)tb->lines, -1, 0, 0}; // Layout unchanged: every line reused
+
+    if (!GFX_textboxValid(tb))
+        return;
+    tb->top = line < tb->lines ? line : tb->lines - 1;
+    updateScreen(tb, &rf);
+}
+
+void GFX_textboxDraw(GFXtextbox *tb)
+{
+    Reflow rf = {0, -1, 0, 0};
+
+    if (!GFX_textboxValid(tb))
+        return;
+    tb->shown = false;
+    updateScreen(tb, &rf);
+}
+
+uint16_t GFX_textboxLines(const GFXtextbox *tb)
+{
+    return tb->lines;
+}
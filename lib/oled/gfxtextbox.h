@@ -0,0 +1,130 @@
+/**
+ * @file gfxtextbox.h
+ * @brief Multi-line text box with word wrap, alignment and incremental reflow
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * A text box owns its text and caches where every line starts and how wide
+ * it is. An edit only re-lays out lines from the one before the edit up to the
+ * point where the new line breaks fall back in step with the old ones; the
+ * lines after that are reused. On screen, lines that only moved are shifted
+ * with GFX_copyRect() and only the re-laid-out lines are redrawn.
+ */
+
+#ifndef GFXTEXTBOX_H
+#define GFXTEXTBOX_H
+
+#include <stdint.h>
+#include "gfxfont.h"
+
+#define GFX_ALIGN_LEFT 0   ///< Lines start at the left edge
+#define GFX_ALIGN_CENTER 1 ///< Lines are centred
+#define GFX_ALIGN_RIGHT 2  ///< Lines end at the right edge
+
+/** @brief Text box state; fields below the marker are internal */
+typedef struct
+{
+    int16_t x, y, w, h;  ///< Box on screen
+    const GFXfont *font; ///< Font, NULL for the classic 6x8 font
+    uint8_t size;        ///< Text magnification
+    uint8_t align;       ///< GFX_ALIGN_*
+    uint16_t color;      ///< Text color
+    uint16_t bg;         ///< Box background color
+    bool autoScroll;     ///< Keep the last line visible (log style)
+
+    // Internal
+    char *text;
+    uint16_t len, cap;
+    uint16_t *start, *width;         // Current layout: first char and pixel width per line
+    uint16_t *prevStart, *prevWidth; // Previous layout, kept for resynchronising
+    uint16_t lines, lineCap;
+    uint16_t top;        // First line shown
+    uint16_t lineH;      // Line pitch in pixels
+    int16_t ascent;      // Baseline offset for GFXfont fonts
+    uint16_t shownTop;   // top when the screen was last updated
+    uint16_t shownLines; // Lines on screen after the last update
+    bool shown;          // Screen holds a previous update
+    uint32_t generation; // Arena generation of text and line tables
+} GFXtextbox;
+
+/**
+ * @brief Set up a text box, allocating its text and line tables from the display arena
+ * @param tb Text box to initialise
+ * @param x Box X
+ * @param y Box Y
+ * @param w Box width
+ * @param h Box height
+ * @param font Font (NULL for the classic font)
+ * @param size Text magnification
+ * @param textCap Maximum number of characters held
+ * @param lineCap Maximum number of wrapped lines held
+ * @return false if the arena has no room
+ * @note Nothing is drawn until the first edit or GFX_textboxDraw(). Once the
+ *       arena is released past the box (GFX_configure(), an earlier
+ *       GFX_arenaMark()) edits fail and draws do nothing until it is
+ *       initialised again.
+ */
+bool GFX_textboxInit(GFXtextbox *tb, int16_t x, int16_t y, int16_t w, int16_t h,
+                     const GFXfont *font, uint8_t size, uint16_t textCap, uint16_t lineCap);
+
+/**
+ * @brief Check that a text box's arena memory is still its own
+ * @return false if initialisation failed or the arena was released past the box
+ */
+bool GFX_textboxValid(const GFXtextbox *tb);
+
+/**
+ * @brief Set text and background colors (takes effect on the next full draw)
+ */
+void GFX_textboxSetColor(GFXtextbox *tb, uint16_t color, uint16_t bg);
+
+/**
+ * @brief Set line alignment and redraw the box
+ * @param align GFX_ALIGN_LEFT, GFX_ALIGN_CENTER or GFX_ALIGN_RIGHT
+ */
+void GFX_textboxSetAlign(GFXtextbox *tb, uint8_t align);
+
+/**
+ * @brief Keep the last line in view as text is added
+ */
+void GFX_textboxSetAutoScroll(GFXtextbox *tb, bool enable);
+
+/**
+ * @brief Replace the whole text
+ * @note Only the part that differs from the current text is re-laid out
+ * @return false if the text does not fit the text capacity
+ */
+bool GFX_textboxSetText(GFXtextbox *tb, const char *str);
+
+/**
+ * @brief Append text, dropping whole lines from the front when full
+ */
+void GFX_textboxAppend(GFXtextbox *tb, const char *str);
+
+/**
+ * @brief Insert text at a character position
+ * @return false if the text does not fit the text capacity
+ */
+bool GFX_textboxInsert(GFXtextbox *tb, uint16_t pos, const char *str);
+
+/**
+ * @brief Delete n characters starting at a character position
+ */
+void GFX_textboxDelete(GFXtextbox *tb, uint16_t pos, uint16_t n);
+
+/**
+ * @brief Show the text starting at the given wrapped line
+ */
+void GFX_textboxScrollTo(GFXtextbox *tb, uint16_t line);
+
+/**
+ * @brief Redraw the whole box
+ */
+void GFX_textboxDraw(GFXtextbox *tb);
+
+/**
+ * @brief Number of wrapped lines in the current layout
+ */
+uint16_t GFX_textboxLines(const GFXtextbox *tb);
+
+#endif
@@ -0,0 +1,171 @@
+// Tile-map background renderer
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "gfx.h"
+#include "gfxtile.h"
+#include "gfxarena.h"
+#include "gfxdefer.h"
+#include "gfxstencil.h"
+#include "pixcache.h"
+#include "st7789.h"
+
+/** Largest supported tile edge; sizes the direct-mode tile buffer */
+#define GFX_TILE_MAX 16
+
+bool GFX_tilemapInit(GFXtilemap *tm, const GFXtileset *tiles, uint8_t cols, uint8_t rows,
+                     int16_t x, int16_t y)
+{
+    size_t cells = (size_t)cols * rows;
+
+    tm->tiles = tiles;
+    tm->cols = cols;
+    tm->rows = rows;
+    tm->x = x;
+    tm->y = y;
+    tm->map = NULL;
+    if (tiles->tileSize > GFX_TILE_MAX || cells == 0)
+        return false;
+
+    // Map and dirty bits in one allocation, so a failure leaves nothing behind
+    tm->map = (uint8_t *)GFX_arenaAlloc(cells + (cells + 7) / 8, GFX_MEM_OTHER);
+    if (tm->map == NULL)
+        return false;
+    tm->dirty = tm->map + cells;
+    tm->generation = GFX_arenaGeneration();
+
+    memset(tm->map, 0, cells);
+    GFX_tilemapInvalidate(tm);
+    return true;
+}
+
+bool GFX_tilemapValid(const GFXtilemap *tm)
+{
+    return tm->map != NULL && GFX_arenaHolds(tm->map, tm->generation);
+}
+
+void GFX_tilemapSet(GFXtilemap *tm, uint8_t col, uint8_t row, uint8_t tile)
+{
+    if (col >= tm->cols || row >= tm->rows || !GFX_tilemapValid(tm))
+        return;
+    uint16_t i = row * tm->cols + col;
+    if (tm->map[i] != tile)
+    {
+        tm->map[i] = tile;
+        tm->dirty[i >> 3] |= 1 << (i & 7);
+    }
+}
+
+uint8_t GFX_tilemapGet(const GFXtilemap *tm, uint8_t col, uint8_t row)
+{
+    if (col >= tm->cols || row >= tm->rows || !GFX_tilemapValid(tm))
+        return 0;
+    return tm->map[row * tm->cols + col];
+}
+
+void GFX_tilemapInvalidate(GFXtilemap *tm)
+{
+    if (!GFX_tilemapValid(tm))
+        return;
+    memset(tm->dirty, 0xFF, ((size_t)tm->cols * tm->rows + 7) / 8);
+}
+
+size_t GFX_tilemapMemory(const GFXtilemap *tm)
+{
+    size_t cells = (size_t)tm->cols * tm->rows;
+    return cells + (cells + 7) / 8;
+}
+
+static void tileDraw(const GFXtilemap *tm, uint8_t col, uint8_t row)
+{
+    const GFXtileset *ts = tm->tiles;
+    uint8_t n = ts->tileSize;
+    uint8_t tile = tm->map[row * tm->cols + col];
+    int16_t tx = tm->x + col * n, ty = tm->y + row * n;
+    int16_t sw = GFX_getWidth(), sh = GFX_getHeight();
+
+    if (tile >= ts->count)
+        return;
+
+    // Visible part of the tile
+    int16_t x0 = tx < 0 ? 0 : tx, x1 = tx + n > sw ? sw : tx + n;
+    int16_t y0 = ty < 0 ? 0 : ty, y1 = ty + n > sh ? sh : ty + n;
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    size_t base = (size_t)tile * n * n;
+    uint16_t w = x1 - x0;
+
+    if (!GFX_stencilBoxVisible(x0, y0, w, y1 - y0))
+    {
+        // Partly hidden: each row's visible spans only
+        uint16_t line[GFX_TILE_MAX];
+        for (int16_t y = y0; y < y1; y++)
+        {
+            size_t off = base + (y - ty) * n + (x0 - tx);
+            if (!ts->pixels)
+                for (uint16_t i = 0; i < w; i++)
+                    line[i] = ts->palette[ts->indices[off + i]];
+            GFX_stencilCopyRow(x0, y, ts->pixels ? ts->pixels + off : line, w);
+        }
+        return;
+    }
+
+    if (gfxFramebuffer != NULL)
+    {
+        for (int16_t y = y0; y < y1; y++)
+        {
+            uint16_t *dst = GFX_getRow(y) + x0;
+            size_t off = base + (y - ty) * n + (x0 - tx);
+            if (ts->pixels)
+                memcpy(dst, ts->pixels + off, w * sizeof(uint16_t));
+            else
+                for (uint16_t i = 0; i < w; i++)
+                    dst[i] = ts->palette[ts->indices[off + i]];
+        }
+        return;
+    }
+
+    // Direct mode: one window per tile. Whole RGB565 tiles go out straight
+    // from flash; clipped or paletted tiles are expanded into a small buffer.
+    static uint16_t tileBuf[GFX_TILE_MAX * GFX_TILE_MAX];
+    if (gfxDeferActive)
+        GFX_deferResolve(); // Recorded entries go first too
+    LCD_cacheFlush(); // Keep ordering with pixels already queued
+    if (ts->pixels && w == n && y1 - y0 == n)
+    {
+        LCD_WriteBitmap(tx, ty, n, n, (uint16_t *)(ts->pixels + base));
+        return;
+    }
+    uint16_t *out = tileBuf;
+    for (int16_t y = y0; y < y1; y++)
+    {
+        size_t off = base + (y - ty) * n + (x0 - tx);
+        for (uint16_t i = 0; i < w; i++)
+            *out++ = ts->pixels ? ts->pixels[off + i] : ts->palette[ts->indices[off + i]];
+    }
+    LCD_WriteBitmap(x0, y0, w, y1 - y0, tileBuf);
+}
+
+uint16_t GFX_tilemapRender(GFXtilemap *tm)
+{
+    uint16_t drawn = 0;
+    uint16_t cells = tm->cols * tm->rows;
+    if (!GFX_tilemapValid(tm))
+        return 0;
+
+    for (uint16_t i = 0; i < cells; i++)
+    {
+        if (!(tm->dirty[i >> 3] & (1 << (i & 7))))
+        {
+            if (tm->dirty[i >> 3] == 0)
+                i |= 7; // Skip clean bytes eight cells at a time
+            continue;
+        }
+        tileDraw(tm, i % tm->cols, i / tm->cols);
+        tm->dirty[i >> 3] &= ~(1 << (i & 7));
+        drawn++;
+    }
+    return drawn;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file gfxtile.h
+ * @brief Tile-map background renderer with per-tile dirty tracking
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Grid UIs (launchers, keypads, status matrices) are described as a map of
+ * tile indices into a tile set kept in flash. Changing a map entry only marks
+ * that tile dirty; GFX_tilemapRender() redraws just the dirty tiles, copying
+ * RGB565 tile rows with memcpy (or expanding paletted rows). Without a
+ * framebuffer the tiles are streamed straight to the panel.
+ */
+
+#ifndef GFXTILE_H
+#define GFXTILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** @brief A set of square tiles, either RGB565 or 8-bit paletted */
+typedef struct
+{
+    const uint16_t *pixels;  ///< RGB565 tiles, tileSize*tileSize each, or NULL
+    const uint8_t *indices;  ///< Paletted tiles, tileSize*tileSize each, or NULL
+    const uint16_t *palette; ///< RGB565 palette for paletted tiles
+    uint8_t tileSize;        ///< Tile edge in pixels (8 or 16)
+    uint16_t count;          ///< Number of tiles in the set
+} GFXtileset;
+
+/** @brief A grid of tile indices placed on screen */
+typedef struct
+{
+    const GFXtileset *tiles; ///< Tile set the indices refer to
+    uint8_t *map;            ///< cols*rows tile indices, row-major
+    uint8_t *dirty;          ///< One bit per map cell
+    uint8_t cols;            ///< Map width in tiles
+    uint8_t rows;            ///< Map height in tiles
+    int16_t x;               ///< Screen X of the top-left tile
+    int16_t y;               ///< Screen Y of the top-left tile
+    uint32_t generation;     ///< Arena generation of map and dirty
+} GFXtilemap;
+
+/**
+ * @brief Set up a tile map, allocating its map and dirty bits from the display arena
+ * @param tm Tile map to initialise
+ * @param tiles Tile set
+ * @param cols Map width in tiles
+ * @param rows Map height in tiles
+ * @param x Screen X of the top-left tile
+ * @param y Screen Y of the top-left tile
+ * @return false if the arena has no room or the tiles are larger than 16 px
+ *         (the map is unusable)
+ * @note All cells start as tile 0 and dirty. Once the arena is released past
+ *       the map (GFX_configure(), an earlier GFX_arenaMark()) the map is
+ *       unusable: the calls below do nothing until it is initialised again.
+ */
+bool GFX_tilemapInit(GFXtilemap *tm, const GFXtileset *tiles, uint8_t cols, uint8_t rows,
+                     int16_t x, int16_t y);
+
+/**
+ * @brief Check that a tile map's arena memory is still its own
+ * @return false if initialisation failed or the arena was released past the map
+ */
+bool GFX_tilemapValid(const GFXtilemap *tm);
+
+/**
+ * @brief Change one map cell; marks it dirty only if the index changed
+ */
+void GFX_tilemapSet(GFXtilemap *tm, uint8_t col, uint8_t row, uint8_t tile);
+
+/**
+ * @brief Read one map cell
+ * @return Tile index, or 0 outside the map or if the map is unusable
+ */
+uint8_t GFX_tilemapGet(const GFXtilemap *tm, uint8_t col, uint8_t row);
+
+/**
+ * @brief Mark every cell dirty, e.g. after something else drew over the map
+ */
+void GFX_tilemapInvalidate(GFXtilemap *tm);
+
+/**
+ * @brief Draw all dirty tiles and clear their dirty bits
+ * @return Number of tiles drawn
+ */
+uint16_t GFX_tilemapRender(GFXtilemap *tm);
+
+/**
+ * @brief RAM used by a tile map (map plus dirty bits), in bytes
+ */
+size_t GFX_tilemapMemory(const GFXtilemap *tm);
+
+#endif
@@ -0,0 +1,150 @@
+// Screen transitions
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Every transition works from a linear framebuffer holding the new screen,
+// and step i of n covers the new screen up to i/n of the way:
+// - Slides: the scroll start address moves first, then the rows that wrap
+//   round into view are written at their own position in panel RAM, which
+//   is where the new screen has them. After the last step the offset is
+//   back at 0 and panel RAM is the new screen, unscrolled.
+// - Wipes and the reveal: only the strips between the previous step's edge
+//   and this step's are queued, as strided rectangles of the framebuffer.
+// - Fades: one brightness-scaled GFX_flush() per step. They save drawing
+//   the frame again at every level, not bus traffic.
+// Bytes are counted as pixels plus the window and scroll commands; the
+// naive figure is one full-screen window per step.
+
+#include <string.h>
+#include "gfxtransition.h"
+#include "gfx.h"
+#include "st7789.h"
+#include "pixcache.h"
+#include "lcdqueue.h"
+#include "pico/stdlib.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+static GFXtransitionStats tStats[GFX_TRANSITION_TYPES];
+static GFXtransitionStats *tCur;
+
+// Queue a rectangle of the framebuffer for the panel
+static void tSend(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    if (x0 >= x1 || y0 >= y1)
+        return;
+    LCD_queueBitmap(x0, y0, x1 - x0, y1 - y0, gfxFramebuffer + y0 * _width + x0, _width);
+    tCur->bytes += (uint32_t)(x1 - x0) * (y1 - y0) * sizeof(uint16_t) + GFX_TRANSITION_WINDOW_BYTES;
+}
+
+static void tScroll(uint16_t offset)
+{
+    LCD_scrollRows(offset);
+    tCur->bytes += GFX_TRANSITION_SCROLL_BYTES;
+}
+
+// One step of a slide, wipe or reveal; k is this step's edge, kp the previous one's
+static void tStep(uint8_t type, uint8_t i, uint8_t frames)
+{
+    int16_t W = _width, H = _height;
+    int16_t k = (int32_t)H * (i + 1) / frames, kp = (int32_t)H * i / frames;
+    int16_t c = (int32_t)W * (i + 1) / frames, cp = (int32_t)W * i / frames;
+
+    switch (type)
+    {
+    case GFX_TRANSITION_SLIDE_UP:
+        tScroll(k % H);
+        tSend(0, kp, W, k);
+        break;
+    case GFX_TRANSITION_SLIDE_DOWN:
+        tScroll((H - k) % H);
+        tSend(0, H - k, W, H - kp);
+        break;
+    case GFX_TRANSITION_WIPE_DOWN:
+        tSend(0, kp, W, k);
+        break;
+    case GFX_TRANSITION_WIPE_UP:
+        tSend(0, H - k, W, H - kp);
+        break;
+    case GFX_TRANSITION_WIPE_RIGHT:
+        tSend(cp, 0, c, H);
+        break;
+    case GFX_TRANSITION_WIPE_LEFT:
+        tSend(W - c, 0, W - cp, H);
+        break;
+    case GFX_TRANSITION_REVEAL:
+    {
+        // Box grows from the centre; send the ring between it and the last one
+        int16_t x0 = (int32_t)W * (frames - i - 1) / (2 * frames), y0 = (int32_t)H * (frames - i - 1) / (2 * frames);
+        int16_t x1 = W - x0, y1 = H - y0;
+        if (i == 0)
+        {
+            tSend(x0, y0, x1, y1);
+            break;
+        }
+        int16_t px0 = (int32_t)W * (frames - i) / (2 * frames), py0 = (int32_t)H * (frames - i) / (2 * frames);
+        int16_t px1 = W - px0, py1 = H - py0;
+        tSend(x0, y0, x1, py0);
+        tSend(x0, py1, x1, y1);
+        tSend(x0, py0, px0, py1);
+        tSend(px1, py0, x1, py1);
+        break;
+    }
+    }
+    LCD_queueWait(); // The step is on the glass before the frame time starts counting down
+}
+
+bool GFX_transition(uint8_t type, uint8_t frames, uint16_t frameMs)
+{
+    if (gfxFramebuffer == NULL || type >= GFX_TRANSITION_TYPES)
+        return false;
+    if (frames == 0)
+        frames = 1;
+
+    GFX_resolveClear(); // Linear image, deferred drawing done
+    GFX_flushQueueWait();
+    LCD_cacheFlush();
+    tCur = &tStats[type];
+    tCur->runs++;
+
+    bool slide = type == GFX_TRANSITION_SLIDE_UP || type == GFX_TRANSITION_SLIDE_DOWN;
+    if (slide && !LCD_scrollRows(0))
+        type = type == GFX_TRANSITION_SLIDE_UP ? GFX_TRANSITION_WIPE_UP : GFX_TRANSITION_WIPE_DOWN;
+
+    uint32_t frameBytes = (uint32_t)_width * _height * sizeof(uint16_t) + GFX_TRANSITION_WINDOW_BYTES;
+    for (uint8_t i = 0; i < frames; i++)
+    {
+        absolute_time_t t0 = get_absolute_time();
+        if (type == GFX_TRANSITION_FADE_IN || type == GFX_TRANSITION_FADE_OUT)
+        {
+            uint8_t up = (uint32_t)GFX_BRIGHTNESS_FULL * (i + 1) / frames;
+            GFX_setFlushBrightness(type == GFX_TRANSITION_FADE_IN ? up : GFX_BRIGHTNESS_FULL - up);
+            GFX_flush();
+            GFX_flushQueueWait();
+            tCur->bytes += frameBytes;
+        }
+        else
+            tStep(type, i, frames);
+        tCur->frames++;
+        tCur->naiveBytes += frameBytes;
+
+        int64_t left = (int64_t)frameMs * 1000 - absolute_time_diff_us(t0, get_absolute_time());
+        if (left > 0 && i + 1 < frames)
+            sleep_us(left);
+    }
+
+    GFX_setFlushBrightness(GFX_BRIGHTNESS_FULL);
+    GFX_invalidatePanel(); // Written behind GFX_flush()
+    return true;
+}
+
+void GFX_getTransitionStats(uint8_t type, GFXtransitionStats *stats)
+{
+    if (type < GFX_TRANSITION_TYPES)
+        *stats = tStats[type];
+}
+
+void GFX_resetTransitionStats()
+{
+    memset(tStats, 0, sizeof(tStats));
+}
@@ -0,0 +1,75 @@
+/**
+ * @file gfxtransition.h
+ * @brief Screen transitions that send only what changes on each frame
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * A transition animates from the picture on the panel to the one already
+ * drawn in the framebuffer. Redrawing and flushing a whole mixed frame for
+ * every step costs a full screen of SPI bytes per frame; instead:
+ * - slides move the panel picture with the ST7789 vertical scroll start
+ *   address (LCD_scrollRows()) and write only the rows coming in;
+ * - wipes and reveals send the strips of the new frame that became visible
+ *   since the previous step;
+ * - fades flush through the brightness lookup table of
+ *   GFX_setFlushBrightness(), so nothing is redrawn between steps.
+ */
+
+#ifndef GFXTRANSITION_H
+#define GFXTRANSITION_H
+
+#include <stdint.h>
+
+#define GFX_TRANSITION_SLIDE_UP 0   ///< New screen pushes the old one up from the bottom
+#define GFX_TRANSITION_SLIDE_DOWN 1 ///< New screen pushes the old one down from the top
+#define GFX_TRANSITION_WIPE_DOWN 2  ///< New screen uncovered from the top edge down
+#define GFX_TRANSITION_WIPE_UP 3    ///< New screen uncovered from the bottom edge up
+#define GFX_TRANSITION_WIPE_RIGHT 4 ///< New screen uncovered from the left edge
+#define GFX_TRANSITION_WIPE_LEFT 5  ///< New screen uncovered from the right edge
+#define GFX_TRANSITION_REVEAL 6     ///< New screen grows from a box in the centre
+#define GFX_TRANSITION_FADE_IN 7    ///< New screen brought up from black
+#define GFX_TRANSITION_FADE_OUT 8   ///< Panel picture taken down to black
+#define GFX_TRANSITION_TYPES 9      ///< Number of transition types
+
+/** @brief Bytes counted for each RAMWR window set (CASET, RASET and RAMWR with their data) */
+#define GFX_TRANSITION_WINDOW_BYTES 11
+
+/** @brief Bytes counted for each scroll update (VSCRDEF and VSCSAD with their data) */
+#define GFX_TRANSITION_SCROLL_BYTES 10
+
+/** @brief Transition counters for one type (since the last GFX_resetTransitionStats()) */
+typedef struct
+{
+    uint32_t runs;       ///< Transitions played
+    uint32_t frames;     ///< Animation steps
+    uint32_t bytes;      ///< SPI bytes sent: commands and pixels
+    uint32_t naiveBytes; ///< Bytes a full-frame flush per step would have sent
+} GFXtransitionStats;
+
+/**
+ * @brief Animate from the panel picture to the framebuffer
+ * @param type GFX_TRANSITION_ type
+ * @param frames Number of animation steps (at least 1)
+ * @param frameMs Time per step; steps that take longer run late
+ * @return false without a framebuffer or with an unknown type
+ * @note Draw the new screen, but do not flush it, before calling. The one
+ *       exception is GFX_TRANSITION_FADE_OUT, which takes down what the
+ *       framebuffer holds (normally the screen being left) and leaves the
+ *       panel black. Slides need rotation 0 or 2, where panel rows are
+ *       screen rows; in rotations 1 and 3 they play as the matching wipe.
+ */
+bool GFX_transition(uint8_t type, uint8_t frames, uint16_t frameMs);
+
+/**
+ * @brief Read the counters of one transition type
+ * @param type GFX_TRANSITION_ type
+ * @param stats Destination for the counters
+ */
+void GFX_getTransitionStats(uint8_t type, GFXtransitionStats *stats);
+
+/**
+ * @brief Reset the counters of every transition type
+ */
+void GFX_resetTransitionStats();
+
+#endif
@@ -0,0 +1,222 @@
+// Waterfall widget
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Region rows are numbered from its top edge. On the panel path the
+// framebuffer row (y + r) holds band row r as the panel stores it, and
+// head is the band's scroll offset: a row going in at the top takes the
+// row just above the offset and moves the offset onto it; one going in
+// at the bottom takes the row at the offset and moves the offset past it.
+// The software ring in direct mode uses head the same way for the first
+// row shown, so both paths share the stepping. Rows written into the
+// framebuffer or straight to the panel go through the stencil.
+
+#include <string.h>
+#include "gfxwaterfall.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxdefer.h"
+#include "gfxstencil.h"
+#include "st7789.h"
+#include "pixcache.h"
+#include "lcdqueue.h"
+#include "lcdstream.h"
+#include "pico/stdlib.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+#define WF_WINDOW_BYTES 11 // CASET, RASET and RAMWR with their data
+#define WF_SCROLL_BYTES 10 // VSCRDEF and VSCSAD with their data
+
+static uint16_t wfLine[320]; // New row in direct mode; rows are at most 320 pixels
+static GFXwaterfallStats wfStats = {0, 0, 0};
+
+// Send region rows [r0, r1) from the framebuffer, one window per run of
+// rows that are contiguous in the scroll ring
+static uint32_t wfSendRows(const GFXwaterfall *wf, uint16_t r0, uint16_t r1)
+{
+    uint32_t bytes = 0;
+    int16_t y = wf->y + r0, end = wf->y + r1;
+    while (y < end)
+    {
+        const uint16_t *src = GFX_getRow(y);
+        int16_t n = 1;
+        while (y + n < end && GFX_getRow(y + n) == src + n * _width)
+            n++;
+        LCD_queueBitmap(wf->x, y, wf->w, n, src + wf->x, _width);
+        bytes += (uint32_t)wf->w * n * sizeof(uint16_t) + WF_WINDOW_BYTES;
+        y += n;
+    }
+    LCD_queueWait(); // The framebuffer may be drawn into straight after
+    return bytes;
+}
+
+// Direct-mode producer: region pixels from the index ring, through the color map
+static void wfProduce(uint16_t *buf, uint32_t first, uint16_t n, void *ctx)
+{
+    const GFXwaterfall *wf = (const GFXwaterfall *)ctx;
+    uint16_t row = first / wf->w, col = first % wf->w;
+    const uint8_t *src = wf->ring + ((wf->head + row) % wf->h) * wf->w;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        buf[i] = wf->colormap[src[col]];
+        if (++col == wf->w)
+        {
+            col = 0;
+            row++;
+            src = wf->ring + ((wf->head + row) % wf->h) * wf->w;
+        }
+    }
+}
+
+bool GFX_waterfallInit(GFXwaterfall *wf, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *colormap,
+                       uint8_t direction)
+{
+    wf->x = x;
+    wf->y = y;
+    wf->w = w;
+    wf->h = h;
+    wf->colormap = colormap;
+    wf->direction = direction;
+    wf->head = 0;
+    wf->hardware = false;
+    wf->ring = NULL;
+    if (x < 0 || y < 0 || w == 0 || h == 0 || x + w > _width || y + h > _height)
+        return false;
+
+    wf->hardware = x == 0 && w == _width && LCD_scrollRegion(y, h, 0);
+    if (gfxFramebuffer != NULL)
+    {
+        GFX_fillRect(x, y, w, h, colormap[0]);
+        wfSendRows(wf, 0, h);
+        return true;
+    }
+
+    if (!wf->hardware)
+    {
+        wf->ring = (uint8_t *)GFX_arenaAlloc((size_t)w * h, GFX_MEM_OTHER);
+        if (wf->ring == NULL)
+            return false;
+        wf->generation = GFX_arenaGeneration();
+        memset(wf->ring, 0, (size_t)w * h);
+    }
+    if (gfxDeferActive)
+        GFX_deferResolve();
+    LCD_cacheFlush();
+    LCD_FillWindow(x, y, w, h, colormap[0]);
+    return true;
+}
+
+bool GFX_waterfallValid(const GFXwaterfall *wf)
+{
+    if (wf->x < 0 || wf->y < 0 || wf->w == 0 || wf->h == 0 || wf->x + wf->w > _width || wf->y + wf->h > _height)
+        return false;
+    if (wf->ring != NULL)
+        return GFX_arenaHolds(wf->ring, wf->generation);
+    return wf->hardware || gfxFramebuffer != NULL;
+}
+
+uint32_t GFX_waterfallPush(GFXwaterfall *wf, const uint8_t *magnitudes, uint16_t count)
+{
+    uint32_t bytes;
+    uint16_t r; // Region row that takes the new row
+
+    if (count == 0 || !GFX_waterfallValid(wf))
+        return 0;
+    if (wf->hardware || wf->ring != NULL)
+    {
+        if (wf->direction == GFX_WATERFALL_DOWN)
+            r = wf->head = (wf->head + wf->h - 1) % wf->h;
+        else
+        {
+            r = wf->head;
+            wf->head = (wf->head + 1) % wf->h;
+        }
+    }
+    else
+    {
+        // Framebuffer without panel scrolling: shift the region's rows
+        if (wf->direction == GFX_WATERFALL_DOWN)
+        {
+            for (int16_t k = wf->h - 1; k > 0; k--)
+                GFX_stencilCopyRow(wf->x, wf->y + k, GFX_getRow(wf->y + k - 1) + wf->x, wf->w);
+            r = 0;
+        }
+        else
+        {
+            for (int16_t k = 0; k < wf->h - 1; k++)
+                GFX_stencilCopyRow(wf->x, wf->y + k, GFX_getRow(wf->y + k + 1) + wf->x, wf->w);
+            r = wf->h - 1;
+        }
+    }
+
+    // Resample to the region width (16.16 step) and map in the same pass
+    uint32_t step = ((uint32_t)count << 16) / wf->w, pos = step >> 1;
+    if (wf->ring != NULL)
+    {
+        uint8_t *dst = wf->ring + (size_t)r * wf->w;
+        for (uint16_t i = 0; i < wf->w; i++, pos += step)
+            dst[i] = magnitudes[pos >> 16];
+    }
+    else
+    {
+        // Into the framebuffer, or to the panel in direct mode
+        for (uint16_t i = 0; i < wf->w; i++, pos += step)
+            wfLine[i] = wf->colormap[magnitudes[pos >> 16]];
+        GFX_stencilCopyRow(wf->x, wf->y + r, wfLine, wf->w);
+    }
+
+    if (wf->hardware)
+    {
+        if (gfxFramebuffer != NULL)
+            LCD_queueBitmap(wf->x, wf->y + r, wf->w, 1, GFX_getRow(wf->y + r) + wf->x, _width);
+        LCD_scrollRegion(wf->y, wf->h, wf->head); // Waits for the row to go out
+        bytes = (uint32_t)wf->w * sizeof(uint16_t) + WF_WINDOW_BYTES + WF_SCROLL_BYTES;
+        wfStats.scrolled++;
+    }
+    else if (wf->ring != NULL)
+    {
+        if (gfxDeferActive)
+            GFX_deferResolve();
+        LCD_cacheFlush();
+        LCD_streamWindow(wf->x, wf->y, wf->w, wf->h, wfProduce, wf);
+        bytes = (uint32_t)wf->w * wf->h * sizeof(uint16_t) + WF_WINDOW_BYTES;
+    }
+    else
+        bytes = wfSendRows(wf, 0, wf->h);
+
+    wfStats.rows++;
+    wfStats.bytes += bytes;
+    return bytes;
+}
+
+void GFX_waterfallGradient(uint16_t *map, const uint16_t *stops, uint8_t count)
+{
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        uint16_t pos = i * (count - 1);
+        uint8_t seg = pos / 255;
+        if (seg >= count - 1)
+        {
+            map[i] = stops[count - 1];
+            continue;
+        }
+        uint8_t alpha = ((pos % 255) * 32 + 127) / 255;
+        map[i] = GFX_blend565(stops[seg + 1], stops[seg], alpha);
+    }
+}
+
+size_t GFX_waterfallMemory(const GFXwaterfall *wf)
+{
+    return wf->ring != NULL ? (size_t)wf->w * wf->h : 0;
+}
+
+void GFX_getWaterfallStats(GFXwaterfallStats *stats)
+{
+    *stats = wfStats;
+}
+
+void GFX_resetWaterfallStats()
+{
+    memset(&wfStats, 0, sizeof(wfStats));
+}
@@ -0,0 +1,120 @@
+/**
+ * @file gfxwaterfall.h
+ * @brief Waterfall (spectrogram) widget that scrolls by one row per update
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * A waterfall shows one row of magnitudes per update, with older rows
+ * moving away from the edge where new ones come in. Drawing each cell with
+ * GFX_drawPixel() and moving the picture with GFX_scrollUp() repaints and
+ * resends the whole screen for every row. GFX_waterfallPush() instead maps
+ * the magnitudes through a 256-entry RGB565 color map in one pass, straight
+ * into the new row, and moves the region:
+ * - a region the full width of the screen (rotations 0 and 2) moves with the
+ *   panel's vertical scroll band (LCD_scrollRegion()). Only the new row and
+ *   the scroll command are sent. The framebuffer keeps the region in the
+ *   panel's memory order, so GFX_flush() stays in step with the panel.
+ * - a narrower region cannot be scrolled by the panel, so the whole region
+ *   is sent. With a framebuffer its rows are shifted in place (the region
+ *   only, not the whole screen). Without one the widget keeps its cells as
+ *   8-bit indices in a ring in the display arena, moves the ring's start,
+ *   and streams the region through the color map (lcdstream.h).
+ */
+
+#ifndef GFXWATERFALL_H
+#define GFXWATERFALL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define GFX_WATERFALL_DOWN 0 ///< New rows come in at the top and move down
+#define GFX_WATERFALL_UP 1   ///< New rows come in at the bottom and move up
+
+/** @brief Waterfall state; fields below the marker are internal */
+typedef struct
+{
+    int16_t x, y;              ///< Top-left corner of the region
+    uint16_t w, h;             ///< Region size in pixels
+    const uint16_t *colormap;  ///< 256 RGB565 colors, index 0 for the lowest magnitude
+    uint8_t direction;         ///< GFX_WATERFALL_DOWN or GFX_WATERFALL_UP
+
+    // Internal
+    bool hardware;       // Moved by the panel's scroll band
+    uint16_t head;       // Ring row shown first (software ring) or scroll offset (hardware)
+    uint8_t *ring;       // w*h color indices without a framebuffer, software path
+    uint32_t generation; // Arena generation of ring
+} GFXwaterfall;
+
+/** @brief Waterfall counters (since the last GFX_resetWaterfallStats()) */
+typedef struct
+{
+    uint32_t rows;     ///< Rows pushed
+    uint32_t scrolled; ///< Rows moved by the panel's scroll band
+    uint32_t bytes;    ///< SPI bytes sent, windows and scroll commands included
+} GFXwaterfallStats;
+
+/**
+ * @brief Set up a waterfall and clear its region to colormap[0]
+ * @param wf Waterfall to initialise
+ * @param x Region X (0 together with the full screen width allows panel scrolling)
+ * @param y Region Y
+ * @param w Region width
+ * @param h Region height
+ * @param colormap 256 RGB565 colors, kept by pointer
+ * @param direction GFX_WATERFALL_DOWN or GFX_WATERFALL_UP
+ * @return false if the region is off the screen, or if a narrow region
+ *         without a framebuffer has no room for its ring in the arena
+ * @note The panel has a single scroll band. LCD_scrollRows() and the slide
+ *       transitions replace it; call this again afterwards.
+ * @note Once the arena is released past the ring (GFX_configure(), an
+ *       earlier GFX_arenaMark()), or a framebuffer region loses its
+ *       framebuffer, pushing does nothing until it is initialised again
+ */
+bool GFX_waterfallInit(GFXwaterfall *wf, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *colormap,
+                       uint8_t direction);
+
+/**
+ * @brief Check that a waterfall can still be drawn as it was set up
+ * @return false if initialisation failed, the region no longer fits the
+ *         screen, the arena was released past the ring, or a region shifted
+ *         in the framebuffer has lost it
+ */
+bool GFX_waterfallValid(const GFXwaterfall *wf);
+
+/**
+ * @brief Add one row and send it to the panel
+ * @param wf Waterfall
+ * @param magnitudes Color map indices, stretched or squeezed to the region
+ *                   width by nearest sampling
+ * @param count Number of magnitudes
+ * @return SPI bytes sent, windows and scroll commands included
+ * @note Rows written to the framebuffer, and new rows sent in direct mode, are
+ *       clipped by the stencil; the direct-mode ring is streamed unclipped
+ */
+uint32_t GFX_waterfallPush(GFXwaterfall *wf, const uint8_t *magnitudes, uint16_t count);
+
+/**
+ * @brief Fill a color map with a gradient through evenly spaced colors
+ * @param map 256 entries to fill
+ * @param stops Colors from magnitude 0 to magnitude 255
+ * @param count Number of stops (at least 2)
+ */
+void GFX_waterfallGradient(uint16_t *map, const uint16_t *stops, uint8_t count);
+
+/**
+ * @brief Arena bytes used by a waterfall (the index ring, if it has one)
+ */
+size_t GFX_waterfallMemory(const GFXwaterfall *wf);
+
+/**
+ * @brief Read the waterfall counters
+ * @param stats Destination for the counters
+ */
+void GFX_getWaterfallStats(GFXwaterfallStats *stats);
+
+/**
+ * @brief Reset the waterfall counters
+ */
+void GFX_resetWaterfallStats();
+
+#endif
@@ -0,0 +1,201 @@
+// Background flush queue
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// The queue is a ring of entries. While it runs, the head entry owns the
+// bus. Starting an entry selects the panel and sends the window with the
+// usual blocking command writes, which take a few microseconds. It then
+// starts a 16-bit DMA transfer into the SPI data register. The channel's
+// completion IRQ starts the next row of a strided entry, or waits for the
+// SPI to finish shifting, raises CS and starts the next entry. Only the
+// first entry is started from the caller; after that everything happens in
+// the IRQ.
+
+#include "lcdqueue.h"
+#include "st7789.h"
+#include "pixcache.h"
+#include "readcache.h"
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+extern spi_inst_t *st7789_spi;
+void ST7789_Select();
+void ST7789_DeSelect();
+void ST7789_RegData();
+void LCD_setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+typedef struct
+{
+    uint16_t x, y, w, h;
+    const uint16_t *pixels; // NULL for a fill
+    uint16_t stride;
+    uint16_t colour; // Fill colour; the DMA reads it from here
+} QueueEntry;
+
+static QueueEntry queue[LCD_QUEUE_DEPTH];
+static volatile uint8_t qHead = 0, qCount = 0;
+static volatile bool qRunning = false;
+static uint16_t qRow; // Rows of the head entry already handed to the DMA
+static int qDma = -1;
+static dma_channel_config qCfgBitmap, qCfgFill;
+static LCDqueueStats qStats = {0, 0, 0, 0};
+
+static void qTransfer(const dma_channel_config *cfg, const uint16_t *src, uint32_t count)
+{
+    dma_channel_configure(qDma, cfg, &spi_get_hw(st7789_spi)->dr, src, count, true);
+    qStats.transfers++;
+}
+
+// Window and RAMWR for the head entry, then its first transfer
+static void __time_critical_func(qStartEntry)()
+{
+    QueueEntry *e = &queue[qHead];
+    while (spi_is_busy(st7789_spi))
+        tight_loop_contents();
+
+    ST7789_Select();
+    LCD_setAddrWindow(e->x, e->y, e->w, e->h);
+    ST7789_RegData();
+    spi_set_format(st7789_spi, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+
+    if (e->pixels == NULL)
+    {
+        qTransfer(&qCfgFill, &e->colour, (uint32_t)e->w * e->h);
+        qRow = e->h;
+    }
+    else if (e->stride == e->w)
+    {
+        qTransfer(&qCfgBitmap, e->pixels, (uint32_t)e->w * e->h);
+        qRow = e->h;
+    }
+    else
+    {
+        qTransfer(&qCfgBitmap, e->pixels, e->w);
+        qRow = 1;
+    }
+}
+
+static void __time_critical_func(qIrq)()
+{
+    if (qDma < 0 || !dma_channel_get_irq0_status(qDma))
+        return;
+    dma_channel_acknowledge_irq0(qDma);
+
+    QueueEntry *e = &queue[qHead];
+    if (qRow < e->h)
+    {
+        // Same window, so the panel just carries on with the next row
+        qTransfer(&qCfgBitmap, e->pixels + (uint32_t)qRow * e->stride, e->w);
+        qRow++;
+        return;
+    }
+
+    // The channel finishes when the last pixel enters the SPI FIFO; CS has
+    // to stay low until it has been shifted out
+    while (spi_is_busy(st7789_spi))
+        tight_loop_contents();
+    ST7789_DeSelect();
+
+    qHead = (qHead + 1) % LCD_QUEUE_DEPTH;
+    qCount--;
+    if (qCount)
+        qStartEntry();
+    else
+        qRunning = false;
+}
+
+static void qInit()
+{
+    if (qDma >= 0)
+        return;
+    qDma = dma_claim_unused_channel(true);
+
+    qCfgBitmap = dma_channel_get_default_config(qDma);
+    channel_config_set_transfer_data_size(&qCfgBitmap, DMA_SIZE_16);
+    channel_config_set_read_increment(&qCfgBitmap, true);
+    channel_config_set_write_increment(&qCfgBitmap, false);
+    channel_config_set_dreq(&qCfgBitmap, spi_get_dreq(st7789_spi, true));
+    qCfgFill = qCfgBitmap;
+    channel_config_set_read_increment(&qCfgFill, false);
+
+    dma_channel_set_irq0_enabled(qDma, true);
+    irq_add_shared_handler(DMA_IRQ_0, qIrq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+static void qPush(const QueueEntry *entry)
+{
+    qInit();
+    LCD_cacheFlush(); // Pixels queued before this entry go out first
+
+    if (qCount == LCD_QUEUE_DEPTH)
+    {
+        qStats.stalls++;
+        while (qCount == LCD_QUEUE_DEPTH)
+            tight_loop_contents();
+    }
+
+    // The IRQ pops entries, so the ring indices only change with it masked
+    uint32_t irqState = save_and_disable_interrupts();
+    queue[(qHead + qCount) % LCD_QUEUE_DEPTH] = *entry;
+    qCount++;
+    if (qCount > qStats.maxDepth)
+        qStats.maxDepth = qCount;
+    qStats.entries++;
+    if (!qRunning)
+    {
+        qRunning = true;
+        qStartEntry();
+    }
+    restore_interrupts(irqState);
+}
+
+void LCD_queueBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels, uint16_t stride)
+{
+    if (w == 0 || h == 0)
+        return;
+    QueueEntry e = {x, y, w, h, pixels, stride, 0};
+    qPush(&e);
+
+    // Cached tiles see the pixels as they are now, like LCD_WriteBitmap()
+    if (stride == w)
+        LCD_readCacheUpdate(x, y, w, h, pixels);
+    else
+        for (uint16_t row = 0; row < h; row++)
+            LCD_readCacheUpdate(x, y + row, w, 1, pixels + (uint32_t)row * stride);
+}
+
+void LCD_queueFill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t col)
+{
+    if (w == 0 || h == 0)
+        return;
+    QueueEntry e = {x, y, w, h, NULL, w, col};
+    qPush(&e);
+    LCD_readCacheFill(x, y, w, h, col);
+}
+
+bool LCD_queueBusy()
+{
+    return qRunning;
+}
+
+void LCD_queueWait()
+{
+    while (qRunning)
+        tight_loop_contents();
+}
+
+void LCD_getQueueStats(LCDqueueStats *stats)
+{
+    *stats = qStats;
+}
+
+void LCD_resetQueueStats()
+{
+    qStats.entries = 0;
+    qStats.transfers = 0;
+    qStats.stalls = 0;
+    qStats.maxDepth = 0;
+}
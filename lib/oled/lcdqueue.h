@@ -0,0 +1,84 @@
+/**
+ * @file lcdqueue.h
+ * @brief Background flush queue: rectangles drained by the DMA completion IRQ
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * LCD_WriteBitmap() blocks until its rectangle has gone out, so flushing
+ * several dirty regions keeps the main loop waiting for the bus. Here the
+ * caller only queues rectangles (source buffer, stride, window). The DMA
+ * completion IRQ sends the next window's CASET/RASET/RAMWR, switches the SPI
+ * back to 16-bit and starts the next transfer, one per source row when the
+ * rows are not contiguous. A whole frame's damage drains in the background.
+ *
+ * Ordering: entries reach the panel in the order they were queued, so a
+ * later rectangle overlapping an earlier one wins. Every blocking LCD_ call
+ * (writes, reads, rotation) first waits for the queue to drain, so mixing
+ * the two keeps program order too.
+ */
+
+#ifndef LCDQUEUE_H
+#define LCDQUEUE_H
+
+#include <stdint.h>
+
+/** @brief Entries the queue can hold; queuing into a full queue waits for a slot */
+#ifndef LCD_QUEUE_DEPTH
+#define LCD_QUEUE_DEPTH 16
+#endif
+
+/** @brief Flush queue statistics (since the last LCD_resetQueueStats()) */
+typedef struct
+{
+    uint32_t entries;   ///< Rectangles and fills queued
+    uint32_t transfers; ///< DMA transfers started (one per row for strided sources)
+    uint32_t stalls;    ///< Times the caller had to wait for a free slot
+    uint8_t maxDepth;   ///< Most entries waiting at once
+} LCDqueueStats;
+
+/**
+ * @brief Queue a rectangle of pixels for the panel
+ * @param x X coordinate of the window
+ * @param y Y coordinate of the window
+ * @param w Width in pixels
+ * @param h Height in pixels
+ * @param pixels First pixel of the top row
+ * @param stride Pixels from one source row to the next (w for a packed bitmap)
+ * @note Returns straight away unless the queue is full. The pixels are read
+ *       by DMA as the entry is sent, so anything drawn into them before
+ *       LCD_queueWait() may or may not make it out.
+ */
+void LCD_queueBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels, uint16_t stride);
+
+/**
+ * @brief Queue a window filled with one color
+ * @param x X coordinate of the window
+ * @param y Y coordinate of the window
+ * @param w Width in pixels
+ * @param h Height in pixels
+ * @param col 16-bit RGB565 color value
+ */
+void LCD_queueFill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t col);
+
+/**
+ * @brief Whether queued entries are still being sent
+ */
+bool LCD_queueBusy();
+
+/**
+ * @brief Wait until every queued entry has reached the panel and CS is high
+ */
+void LCD_queueWait();
+
+/**
+ * @brief Read the flush queue statistics
+ * @param stats Destination for the counters
+ */
+void LCD_getQueueStats(LCDqueueStats *stats);
+
+/**
+ * @brief Reset the flush queue statistics
+ */
+void LCD_resetQueueStats();
+
+#endif
@@ -0,0 +1,115 @@
+// Streaming window writes
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Two line buffers take turns. Pixels go into the current one, and a full
+// buffer is handed to DMA. Before that, the previous transfer (from the
+// other buffer) has to finish, which then frees that buffer to be filled
+// next. The CPU only ever waits for the transfer before last, so filling
+// one buffer overlaps sending the other. With no DMA channel free, each
+// buffer is written out with blocking SPI instead.
+
+#include "lcdstream.h"
+#include "st7789.h"
+#include "pixcache.h"
+#include "readcache.h"
+#include "lcdqueue.h"
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+
+extern spi_inst_t *st7789_spi;
+void ST7789_Select();
+void ST7789_DeSelect();
+void ST7789_RegData();
+void LCD_setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+static uint16_t streamBuf[2][LCD_STREAM_PIXELS];
+static uint8_t sbIndex = 0; // Buffer being filled
+static uint16_t sbFill = 0;  // Pixels in it
+static int sDma = -1; // -1 if no channel could be claimed
+static dma_channel_config sCfg;
+
+// Hand the current buffer to DMA and switch to the other one
+static void __time_critical_func(sSend)()
+{
+    if (sDma < 0)
+        spi_write16_blocking(st7789_spi, streamBuf[sbIndex], sbFill);
+    else
+    {
+        dma_channel_wait_for_finish_blocking(sDma); // Frees the other buffer
+        dma_channel_configure(sDma, &sCfg, &spi_get_hw(st7789_spi)->dr, streamBuf[sbIndex], sbFill, true);
+    }
+    sbIndex ^= 1;
+    sbFill = 0;
+}
+
+void LCD_beginWrite(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (sDma < 0)
+    {
+        sDma = dma_claim_unused_channel(false); // Tried again next time if none is free
+        if (sDma >= 0)
+        {
+            sCfg = dma_channel_get_default_config(sDma);
+            channel_config_set_transfer_data_size(&sCfg, DMA_SIZE_16);
+            channel_config_set_read_increment(&sCfg, true);
+            channel_config_set_write_increment(&sCfg, false);
+            channel_config_set_dreq(&sCfg, spi_get_dreq(st7789_spi, true));
+        }
+    }
+
+    LCD_cacheFlush(); // Earlier pixels first
+    LCD_queueWait();
+    sbIndex = 0;
+    sbFill = 0;
+
+    ST7789_Select();
+    LCD_setAddrWindow(x, y, w, h);
+    ST7789_RegData();
+    spi_set_format(st7789_spi, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+}
+
+void __time_critical_func(LCD_pushPixels)(const uint16_t *buf, uint32_t n)
+{
+    while (n)
+    {
+        uint32_t chunk = LCD_STREAM_PIXELS - sbFill;
+        if (chunk > n)
+            chunk = n;
+        memcpy(&streamBuf[sbIndex][sbFill], buf, chunk * sizeof(uint16_t));
+        sbFill += chunk;
+        buf += chunk;
+        n -= chunk;
+        if (sbFill == LCD_STREAM_PIXELS)
+            sSend();
+    }
+}
+
+void LCD_endWrite()
+{
+    if (sbFill)
+        sSend();
+    if (sDma >= 0)
+        dma_channel_wait_for_finish_blocking(sDma);
+    // The channel finishes when the last pixel enters the SPI FIFO
+    while (spi_is_busy(st7789_spi))
+        tight_loop_contents();
+    ST7789_DeSelect();
+
+    LCD_readCacheInvalidate(); // Streamed pixels are not tracked
+}
+
+void LCD_streamWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, LCDproducer producer, void *ctx)
+{
+    LCD_beginWrite(x, y, w, h);
+    uint32_t total = (uint32_t)w * h;
+    for (uint32_t first = 0; first < total; first += LCD_STREAM_PIXELS)
+    {
+        uint16_t n = total - first < LCD_STREAM_PIXELS ? total - first : LCD_STREAM_PIXELS;
+        producer(streamBuf[sbIndex], first, n, ctx); // While the other buffer is sent
+        sbFill = n;
+        sSend();
+    }
+    LCD_endWrite();
+}
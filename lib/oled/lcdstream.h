@@ -0,0 +1,72 @@
+/**
+ * @file lcdstream.h
+ * @brief Streaming window writes for generated pixels
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * LCD_WriteBitmap() needs the whole w*h bitmap in RAM, and LCD_WritePixel()
+ * costs a full window transaction per pixel. A stream opens one window and
+ * takes its pixels in pieces of any size. They are copied into two small
+ * line buffers: while DMA sends one, the other is filled. Gradients, plots,
+ * patterns and decoded images can then go out at full SPI rate with a few
+ * hundred bytes of RAM. If no DMA channel is free, the buffers are sent
+ * with blocking SPI writes instead.
+ *
+ * Between LCD_beginWrite() and LCD_endWrite() the stream owns the bus, so
+ * no other LCD_ or GFX_ calls that reach the panel may be made.
+ */
+
+#ifndef LCDSTREAM_H
+#define LCDSTREAM_H
+
+#include <stdint.h>
+
+/** @brief Pixels per line buffer; two are used (4 * LCD_STREAM_PIXELS bytes) */
+#ifndef LCD_STREAM_PIXELS
+#define LCD_STREAM_PIXELS 128
+#endif
+
+/**
+ * @brief Pixel generator for LCD_streamWindow()
+ * @param buf Buffer to fill
+ * @param first Index of buf[0] in the window, row-major (x = first % w, y = first / w)
+ * @param n Pixels to write, at most LCD_STREAM_PIXELS
+ * @param ctx Caller's context pointer
+ */
+typedef void (*LCDproducer)(uint16_t *buf, uint32_t first, uint16_t n, void *ctx);
+
+/**
+ * @brief Open a window for streaming
+ * @param x X coordinate of the window
+ * @param y Y coordinate of the window
+ * @param w Width in pixels
+ * @param h Height in pixels
+ * @note Pixels fill the window row by row, like LCD_WriteBitmap()
+ */
+void LCD_beginWrite(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Add pixels to the open window
+ * @param buf RGB565 pixels; copied, so the buffer can be reused on return
+ * @param n Number of pixels, any size
+ */
+void LCD_pushPixels(const uint16_t *buf, uint32_t n);
+
+/**
+ * @brief Send what is left, wait for it to reach the panel and close the window
+ */
+void LCD_endWrite();
+
+/**
+ * @brief Stream a whole window from a generator
+ * @param x X coordinate of the window
+ * @param y Y coordinate of the window
+ * @param w Width in pixels
+ * @param h Height in pixels
+ * @param producer Called for each buffer in turn; fills one while the other is sent
+ * @param ctx Passed to the producer
+ * @note Nothing is copied: the producer writes straight into the line buffers.
+ */
+void LCD_streamWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, LCDproducer producer, void *ctx);
+
+#endif
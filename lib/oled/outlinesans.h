@@ -0,0 +1,645 @@
+// OutlineSans outline font, converted with tools/ttf2outline.py
+// Units per em 96, 95 glyphs, 3178 points, 9930 bytes
+// Source font: Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1.
+// Renamed on conversion, as the source license requires for modified versions
+
+#ifndef OUTLINESANS_H
+#define OUTLINESANS_H
+
+#include "gfxoutline.h"
+
+const GFXoutlinePoint OutlineSansPoints[] = {
+    {21, 69, 1}, {21, 41, 1}, {21, 39, 0}, {20, 35, 0}, {20, 31, 0}, {20, 26, 0},
+    {19, 24, 1}, {14, 24, 1}, {13, 26, 0}, {13, 31, 0}, {13, 35, 0}, {13, 39, 0},
+    {13, 41, 1}, {13, 69, 3}, {10, 5, 1}, {10, 7, 0}, {11, 9, 0}, {13, 10, 0},
+    {15, 11, 0}, {16, 11, 1}, {18, 11, 0}, {20, 10, 0}, {22, 9, 0}, {22, 7, 0},
+    {22, 5, 1}, {22, 4, 0}, {22, 2, 0}, {20, 0, 0}, {18, -1, 0}, {16, -1, 1},
+    {15, -1, 0}, {13, 0, 0}, {11, 2, 0}, {10, 4, 2}, {15, 69, 1}, {15, 55, 1},
+    {14, 47, 1}, {14, 46, 0}, {12, 44, 0}, {11, 44, 1}, {10, 44, 0}, {8, 46, 0},
+    {8, 47, 1}, {7, 55, 1}, {7, 69, 3}, {31, 69, 1}, {31, 55, 1}, {30, 47, 1},
+    {30, 46, 0}, {28, 44, 0}, {27, 44, 1}, {26, 44, 0}, {24, 46, 0}, {24, 47, 1},
+    {23, 55, 1}, {23, 69, 3}, {38, 20, 1}, {34, 0, 1}, {30, 0, 1}, {29, 0, 0},
+    {27, 2, 0}, {27, 3, 1}, {27, 3, 0}, {27, 4, 1}, {31, 20, 1}, {19, 20, 1},
+    {16, 3, 1}, {15, 1, 0}, {13, 0, 0}, {12, 0, 1}, {8, 0, 1}, {12, 20, 1},
+    {5, 20, 1}, {4, 20, 0}, {3, 21, 0}, {3, 23, 1}, {3, 23, 0}, {3, 24, 0},
+    {3, 24, 1}, {3, 27, 1}, {13, 27, 1}, {16, 42, 1}, {5, 42, 1}, {5, 46, 1},
+    {6, 47, 0}, {7, 49, 0}, {9, 49, 1}, {17, 49, 1}, {20, 66, 1}, {21, 67, 0},
+    {23, 69, 0}, {24, 69, 1}, {28, 69, 1}, {24, 49, 1}, {36, 49, 1}, {40, 69, 1},
+    {44, 69, 1}, {45, 69, 0}, {46, 67, 0}, {46, 66, 1}, {46, 66, 0}, {46, 66, 1},
+    {43, 49, 1}, {53, 49, 1}, {52, 45, 1}, {52, 44, 0}, {50, 42, 0}, {49, 42, 1},
+    {42, 42, 1}, {39, 27, 1}, {47, 27, 1}, {49, 27, 0}, {50, 25, 0}, {50, 24, 1},
+    {50, 24, 0}, {50, 23, 0}, {50, 23, 1}, {49, 20, 3}, {20, 27, 1}, {32, 27, 1},
+    {35, 42, 1}, {23, 42, 3}, {24, -1, 1}, {18, 0, 0}, {9, 5, 0}, {5, 8, 1},
+    {8, 12, 1}, {8, 13, 0}, {9, 13, 0}, {10, 13, 1}, {11, 13, 0}, {13, 12, 0},
+    {16, 9, 0}, {21, 7, 0}, {24, 7, 1}, {26, 32, 1}, {23, 33, 0}, {16, 36, 0},
+    {11, 40, 0}, {8, 46, 0}, {8, 51, 1}, {8, 54, 0}, {11, 61, 0}, {16, 66, 0},
+    {24, 69, 0}, {29, 69, 1}, {29, 76, 1}, {29, 77, 0}, {31, 79, 0}, {32, 79, 1},
+    {35, 79, 1}, {34, 69, 1}, {39, 69, 0}, {46, 65, 0}, {49, 62, 1}, {47, 59, 1},
+    {46, 57, 0}, {45, 57, 1}, {44, 57, 0}, {42, 58, 0}, {40, 60, 0}, {36, 62, 0},
+    {34, 62, 1}, {32, 39, 1}, {35, 38, 0}, {42, 35, 0}, {48, 31, 0}, {51, 25, 0},
+    {51, 21, 1}, {51, 17, 0}, {48, 9, 0}, {42, 3, 0}, {34, 0, 0}, {29, -1, 1},
+    {29, -9, 1}, {29, -10, 0}, {27, -11, 0}, {26, -11, 1}, {23, -11, 3}, {43, 20, 1},
+    {43, 22, 0}, {41, 25, 0}, {38, 28, 0}, {34, 30, 0}, {31, 30, 1}, {30, 7, 1},
+    {33, 7, 0}, {38, 9, 0}, {41, 12, 0}, {43, 17, 2}, {16, 51, 1}, {16, 49, 0},
+    {18, 46, 0}, {21, 43, 0}, {24, 41, 0}, {27, 40, 1}, {28, 62, 1}, {25, 62, 0},
+    {20, 60, 0}, {18, 57, 0}, {16, 53, 2}, {34, 52, 1}, {34, 48, 0}, {31, 42, 0},
+    {27, 37, 0}, {22, 35, 0}, {19, 35, 1}, {15, 35, 0}, {10, 37, 0}, {6, 42, 0},
+    {3, 48, 0}, {3, 52, 1}, {3, 56, 0}, {6, 63, 0}, {10, 67, 0}, {15, 69, 0},
+    {19, 69, 1}, {22, 69, 0}, {28, 67, 0}, {32, 63, 0}, {34, 56, 2}, {27, 52, 1},
+    {27, 55, 0}, {26, 60, 0}, {24, 63, 0}, {20, 64, 0}, {19, 64, 1}, {17, 64, 0},
+    {14, 63, 0}, {11, 60, 0}, {10, 55, 0}, {10, 52, 1}, {10, 49, 0}, {11, 45, 0},
+    {14, 42, 0}, {17, 41, 0}, {19, 41, 1}, {20, 41, 0}, {24, 42, 0}, {26, 45, 0},
+    {27, 49, 2}, {58, 67, 1}, {59, 68, 0}, {60, 69, 0}, {61, 69, 1}, {67, 69, 1},
+    {17, 1, 1}, {17, 1, 0}, {15, 0, 0}, {14, 0, 1}, {8, 0, 3}, {72, 16, 1},
+    {72, 12, 0}, {69, 6, 0}, {65, 1, 0}, {60, -1, 0}, {57, -1, 1}, {53, -1, 0},
+    {48, 1, 0}, {44, 6, 0}, {42, 12, 0}, {42, 16, 1}, {42, 20, 0}, {44, 27, 0},
+    {48, 31, 0}, {53, 34, 0}, {57, 34, 1}, {60, 34, 0}, {66, 31, 0}, {70, 27, 0},
+    {72, 20, 2}, {65, 16, 1}, {65, 19, 0}, {64, 24, 0}, {62, 27, 0}, {59, 28, 0},
+    {57, 28, 1}, {55, 28, 0}, {52, 27, 0}, {50, 24, 0}, {48, 19, 0}, {48, 16, 1},
+    {48, 13, 0}, {50, 9, 0}, {52, 6, 0}, {55, 5, 0}, {57, 5, 1}, {59, 5, 0},
+    {62, 6, 0}, {64, 9, 0}, {65, 13, 2}, {32, 70, 1}, {35, 70, 0}, {42, 67, 0},
+    {46, 63, 0}, {49, 58, 0}, {49, 55, 1}, {44, 54, 1}, {44, 54, 0}, {43, 54, 1},
+    {43, 54, 0}, {42, 54, 0}, {41, 55, 1}, {41, 57, 0}, {40, 59, 0}, {37, 61, 0},
+    {34, 63, 0}, {32, 63, 1}, {29, 63, 0}, {25, 61, 0}, {23, 59, 0}, {21, 55, 0},
+    {21, 53, 1}, {21, 51, 0}, {22, 48, 0}, {24, 45, 0}, {26, 42, 0}, {28, 40, 1},
+    {48, 20, 1}, {50, 23, 0}, {52, 30, 0}, {52, 33, 1}, {52, 34, 0}, {53, 35, 0},
+    {54, 35, 1}, {59, 35, 1}, {59, 30, 0}, {56, 19, 0}, {53, 15, 1}, {67, 0, 1},
+    {59, 0, 1}, {58, 0, 0}, {56, 1, 0}, {55, 2, 1}, {48, 9, 1}, {43, 4, 0},
+    {32, -1, 0}, {25, -1, 1}, {21, -1, 0}, {13, 2, 0}, {7, 7, 0}, {4, 14, 0},
+    {4, 18, 1}, {4, 22, 0}, {6, 28, 0}, {10, 33, 0}, {16, 37, 0}, {19, 38, 1},
+    {16, 42, 0}, {13, 49, 0}, {13, 53, 1}, {13, 56, 0}, {16, 62, 0}, {21, 67, 0},
+    {27, 70, 2}, {13, 19, 1}, {13, 16, 0}, {15, 11, 0}, {19, 8, 0}, {23, 6, 0},
+    {26, 6, 1}, {31, 6, 0}, {40, 10, 0}, {43, 13, 1}, {23, 34, 1}, {18, 31, 0},
+    {13, 24, 2}, {15, 69, 1}, {15, 55, 1}, {14, 47, 1}, {14, 46, 0}, {12, 44, 0},
+    {11, 44, 1}, {10, 44, 0}, {8, 46, 0}, {8, 47, 1}, {7, 55, 1}, {7, 69, 3},
+    {14, 30, 1}, {14, 20, 0}, {19, 1, 0}, {24, -8, 1}, {24, -9, 0}, {25, -10, 0},
+    {25, -10, 1}, {25, -11, 0}, {24, -11, 0}, {23, -12, 1}, {20, -14, 1}, {16, -9, 0},
+    {11, 2, 0}, {8, 13, 0}, {6, 24, 0}, {6, 30, 1}, {6, 36, 0}, {8, 47, 0},
+    {11, 58, 0}, {16, 69, 0}, {20, 74, 1}, {23, 72, 1}, {24, 72, 0}, {25, 71, 0},
+    {25, 70, 1}, {25, 70, 0}, {24, 69, 1}, {19, 60, 0}, {14, 40, 2}, {14, 30, 1},
+    {14, 40, 0}, {9, 60, 0}, {4, 69, 1}, {4, 70, 0}, {4, 70, 1}, {4, 71, 0},
+    {4, 72, 0}, {5, 72, 1}, {9, 74, 1}, {12, 69, 0}, {17, 58, 0}, {20, 47, 0},
+    {22, 36, 0}, {22, 30, 1}, {22, 24, 0}, {20, 13, 0}, {17, 2, 0}, {12, -9, 0},
+    {9, -14, 1}, {5, -12, 1}, {4, -11, 0}, {4, -10, 1}, {4, -10, 0}, {4, -9, 0},
+    {4, -8, 1}, {9, 1, 0}, {14, 20, 2}, {17, 41, 1}, {17, 51, 1}, {17, 52, 0},
+    {17, 53, 0}, {18, 54, 1}, {17, 53, 0}, {15, 52, 1}, {7, 47, 1}, {5, 51, 1},
+    {13, 56, 1}, {15, 57, 0}, {16, 57, 1}, {15, 57, 0}, {14, 57, 0}, {13, 58, 1},
+    {5, 63, 1}, {7, 66, 1}, {15, 62, 1}, {17, 61, 0}, {18, 59, 1}, {17, 60, 0},
+    {17, 62, 0}, {17, 63, 1}, {17, 72, 1}, {21, 72, 1}, {21, 63, 1}, {21, 61, 0},
+    {21, 59, 1}, {21, 60, 0}, {22, 61, 0}, {23, 62, 1}, {31, 66, 1}, {34, 63, 1},
+    {25, 58, 1}, {24, 58, 0}, {23, 57, 0}, {22, 57, 1}, {23, 57, 0}, {24, 56, 0},
+    {25, 56, 1}, {34, 51, 1}, {31, 47, 1}, {23, 52, 1}, {22, 53, 0}, {21, 54, 0},
+    {20, 54, 1}, {21, 53, 0}, {21, 51, 1}, {21, 41, 3}, {31, 56, 1}, {31, 35, 1},
+    {51, 35, 1}, {51, 29, 1}, {31, 29, 1}, {31, 8, 1}, {24, 8, 1}, {24, 29, 1},
+    {5, 29, 1}, {5, 35, 1}, {24, 35, 1}, {24, 56, 3}, {5, 6, 1}, {5, 7, 0},
+    {5, 9, 0}, {7, 10, 0}, {9, 11, 0}, {10, 11, 1}, {12, 11, 0}, {14, 10, 0},
+    {15, 8, 0}, {16, 6, 0}, {16, 5, 1}, {16, 2, 0}, {15, -2, 0}, {13, -7, 0},
+    {9, -11, 0}, {7, -13, 1}, {6, -12, 1}, {5, -11, 0}, {5, -10, 1}, {5, -10, 0},
+    {6, -9, 1}, {6, -8, 0}, {8, -7, 0}, {9, -4, 0}, {10, -2, 0}, {11, 0, 1},
+    {10, 0, 1}, {9, 0, 0}, {7, 1, 0}, {5, 2, 0}, {5, 5, 2}, {5, 32, 1},
+    {29, 32, 1}, {29, 25, 1}, {5, 25, 3}, {4, 5, 1}, {4, 7, 0}, {5, 9, 0},
+    {7, 10, 0}, {9, 11, 0}, {10, 11, 1}, {11, 11, 0}, {14, 10, 0}, {15, 9, 0},
+    {16, 7, 0}, {16, 5, 1}, {16, 4, 0}, {15, 2, 0}, {14, 0, 0}, {11, -1, 0},
+    {10, -1, 1}, {9, -1, 0}, {7, 0, 0}, {5, 2, 0}, {4, 4, 2}, {8, -1, 1},
+    {7, -3, 0}, {4, -4, 0}, {3, -4, 1}, {-1, -4, 1}, {28, 68, 1}, {29, 69, 0},
+    {31, 71, 0}, {33, 71, 1}, {36, 71, 3}, {53, 34, 1}, {53, 25, 0}, {49, 12, 0},
+    {42, 4, 0}, {33, -1, 0}, {28, -1, 1}, {23, -1, 0}, {13, 4, 0}, {7, 12, 0},
+    {3, 25, 0}, {3, 34, 1}, {3, 43, 0}, {7, 57, 0}, {13, 65, 0}, {23, 70, 0},
+    {28, 70, 1}, {33, 70, 0}, {42, 65, 0}, {49, 57, 0}, {53, 43, 2}, {44, 34, 1},
+    {44, 42, 0}, {41, 53, 0}, {37, 59, 0}, {31, 62, 0}, {28, 62, 1}, {25, 62, 0},
+    {19, 59, 0}, {14, 53, 0}, {12, 42, 0}, {12, 34, 1}, {12, 26, 0}, {14, 16, 0},
+    {19, 9, 0}, {25, 6, 0}, {28, 6, 1}, {31, 6, 0}, {37, 9, 0}, {41, 16, 0},
+    {44, 26, 2}, {14, 7, 1}, {29, 7, 1}, {29, 53, 1}, {29, 56, 0}, {29, 58, 1},
+    {16, 47, 1}, {16, 47, 0}, {15, 46, 0}, {15, 46, 1}, {14, 46, 0}, {13, 47, 0},
+    {12, 48, 1}, {10, 51, 1}, {30, 69, 1}, {37, 69, 1}, {37, 7, 1}, {51, 7, 1},
+    {51, 0, 1}, {14, 0, 3}, {29, 70, 1}, {33, 70, 0}, {41, 67, 0}, {46, 62, 0},
+    {49, 55, 0}, {49, 50, 1}, {49, 47, 0}, {47, 40, 0}, {43, 34, 0}, {38, 28, 0},
+    {35, 25, 1}, {17, 7, 1}, {19, 7, 0}, {23, 8, 0}, {25, 8, 1}, {48, 8, 1},
+    {49, 8, 0}, {51, 6, 0}, {51, 5, 1}, {51, 0, 1}, {5, 0, 1}, {5, 3, 1},
+    {5, 4, 0}, {6, 6, 0}, {7, 7, 1}, {29, 29, 1}, {31, 31, 0}, {36, 37, 0},
+    {39, 42, 0}, {41, 47, 0}, {41, 50, 1}, {41, 53, 0}, {39, 58, 0}, {35, 61, 0},
+    {31, 62, 0}, {28, 62, 1}, {26, 62, 0}, {21, 61, 0}, {18, 58, 0}, {16, 54, 0},
+    {15, 52, 1}, {15, 51, 0}, {13, 49, 0}, {12, 49, 1}, {12, 49, 0}, {11, 49, 0},
+    {11, 49, 1}, {6, 50, 1}, {7, 55, 0}, {11, 62, 0}, {17, 67, 0}, {24, 70, 2},
+    {30, 70, 1}, {34, 70, 0}, {42, 67, 0}, {47, 62, 0}, {50, 56, 0}, {50, 52, 1},
+    {50, 49, 0}, {48, 44, 0}, {45, 40, 0}, {41, 37, 0}, {38, 36, 1}, {45, 34, 0},
+    {51, 26, 0}, {51, 20, 1}, {51, 15, 0}, {48, 7, 0}, {42, 2, 0}, {33, -1, 0},
+    {28, -1, 1}, {23, -1, 0}, {15, 2, 0}, {10, 7, 0}, {6, 13, 0}, {5, 17, 1},
+    {9, 19, 1}, {10, 19, 0}, {11, 19, 1}, {12, 19, 0}, {13, 18, 0}, {14, 17, 1},
+    {14, 17, 0}, {14, 17, 1}, {15, 15, 0}, {17, 12, 0}, {20, 9, 0}, {25, 7, 0},
+    {28, 7, 1}, {32, 7, 0}, {37, 9, 0}, {41, 13, 0}, {43, 17, 0}, {43, 19, 1},
+    {43, 22, 0}, {41, 27, 0}, {37, 30, 0}, {31, 32, 0}, {25, 32, 1}, {25, 38, 1},
+    {30, 38, 0}, {36, 40, 0}, {40, 43, 0}, {41, 48, 0}, {41, 50, 1}, {41, 53, 0},
+    {40, 58, 0}, {36, 61, 0}, {32, 62, 0}, {29, 62, 1}, {27, 62, 0}, {22, 61, 0},
+    {19, 58, 0}, {17, 54, 0}, {16, 52, 1}, {16, 51, 0}, {14, 49, 0}, {13, 49, 1},
+    {13, 49, 0}, {12, 49, 0}, {12, 49, 1}, {7, 50, 1}, {8, 55, 0}, {12, 62, 0},
+    {18, 67, 0}, {25, 70, 2}, {43, 25, 1}, {54, 25, 1}, {54, 20, 1}, {54, 19, 0},
+    {53, 18, 0}, {52, 18, 1}, {43, 18, 1}, {43, 0, 1}, {36, 0, 1}, {36, 18, 1},
+    {5, 18, 1}, {4, 18, 0}, {3, 19, 0}, {3, 20, 1}, {2, 24, 1}, {35, 69, 1},
+    {43, 69, 3}, {36, 53, 1}, {36, 54, 0}, {36, 57, 0}, {36, 59, 1}, {11, 25, 1},
+    {36, 25, 3}, {47, 65, 1}, {47, 63, 0}, {45, 61, 0}, {42, 61, 1}, {20, 61, 1},
+    {17, 43, 1}, {23, 44, 0}, {27, 44, 1}, {32, 44, 0}, {41, 41, 0}, {46, 35, 0},
+    {49, 28, 0}, {49, 23, 1}, {49, 18, 0}, {45, 9, 0}, {39, 3, 0}, {30, -1, 0},
+    {24, -1, 1}, {21, -1, 0}, {16, 0, 0}, {11, 2, 0}, {7, 5, 0}, {5, 6, 1},
+    {8, 10, 1}, {9, 11, 0}, {10, 11, 1}, {11, 11, 0}, {13, 10, 0}, {17, 8, 0},
+    {22, 7, 0}, {25, 7, 1}, {28, 7, 0}, {34, 9, 0}, {38, 13, 0}, {40, 19, 0},
+    {40, 23, 1}, {40, 26, 0}, {39, 31, 0}, {35, 35, 0}, {29, 37, 0}, {25, 37, 1},
+    {23, 37, 0}, {17, 36, 0}, {14, 35, 1}, {9, 37, 1}, {14, 69, 1}, {47, 69, 3},
+    {31, 42, 1}, {35, 42, 0}, {43, 39, 0}, {48, 34, 0}, {52, 27, 0}, {52, 22, 1},
+    {52, 17, 0}, {48, 9, 0}, {42, 3, 0}, {33, -1, 0}, {28, -1, 1}, {23, -1, 0},
+    {14, 3, 0}, {8, 9, 0}, {5, 17, 0}, {5, 23, 1}, {5, 27, 0}, {9, 37, 0},
+    {14, 43, 1}, {31, 67, 1}, {32, 68, 0}, {34, 69, 0}, {36, 69, 1}, {43, 69, 1},
+    {19, 39, 1}, {22, 40, 0}, {28, 42, 2}, {13, 21, 1}, {13, 18, 0}, {15, 12, 0},
+    {19, 8, 0}, {24, 6, 0}, {28, 6, 1}, {31, 6, 0}, {37, 9, 0}, {41, 12, 0},
+    {43, 18, 0}, {43, 21, 1}, {43, 24, 0}, {41, 30, 0}, {37, 34, 0}, {32, 36, 0},
+    {28, 36, 1}, {25, 36, 0}, {19, 33, 0}, {16, 29, 0}, {13, 24, 2}, {52, 69, 1},
+    {52, 65, 1}, {52, 63, 0}, {51, 61, 0}, {51, 60, 1}, {22, 3, 1}, {22, 2, 0},
+    {20, 0, 0}, {18, 0, 1}, {12, 0, 1}, {41, 57, 1}, {41, 58, 0}, {42, 60, 0},
+    {43, 61, 1}, {7, 61, 1}, {7, 61, 0}, {5, 62, 0}, {5, 63, 1}, {5, 69, 3},
+    {28, -1, 1}, {23, -1, 0}, {14, 2, 0}, {8, 7, 0}, {5, 14, 0}, {5, 19, 1},
+    {5, 25, 0}, {12, 34, 0}, {18, 36, 1}, {13, 38, 0}, {7, 46, 0}, {7, 51, 1},
+    {7, 55, 0}, {10, 62, 0}, {15, 67, 0}, {23, 70, 0}, {28, 70, 1}, {32, 70, 0},
+    {40, 67, 0}, {46, 62, 0}, {49, 55, 0}, {49, 51, 1}, {49, 46, 0}, {43, 38, 0},
+    {38, 36, 1}, {44, 34, 0}, {51, 25, 0}, {51, 19, 1}, {51, 14, 0}, {48, 7, 0},
+    {41, 2, 0}, {33, -1, 2}, {28, 6, 1}, {31, 6, 0}, {36, 8, 0}, {40, 11, 0},
+    {42, 16, 0}, {42, 19, 1}, {42, 23, 0}, {40, 28, 0}, {36, 31, 0}, {31, 32, 0},
+    {28, 32, 1}, {25, 32, 0}, {20, 31, 0}, {16, 28, 0}, {13, 23, 0}, {13, 19, 1},
+    {13, 16, 0}, {15, 11, 0}, {19, 8, 0}, {24, 6, 2}, {28, 39, 1}, {31, 39, 0},
+    {36, 41, 0}, {39, 45, 0}, {40, 49, 0}, {40, 51, 1}, {40, 54, 0}, {39, 58, 0},
+    {36, 61, 0}, {31, 63, 0}, {28, 63, 1}, {25, 63, 0}, {20, 61, 0}, {17, 58, 0},
+    {15, 54, 0}, {15, 51, 1}, {15, 49, 0}, {17, 45, 0}, {20, 41, 0}, {24, 39, 2},
+    {26, 28, 1}, {22, 28, 0}, {16, 31, 0}, {10, 36, 0}, {7, 43, 0}, {7, 48, 1},
+    {7, 52, 0}, {10, 60, 0}, {17, 66, 0}, {25, 70, 0}, {30, 70, 1}, {35, 70, 0},
+    {43, 66, 0}, {49, 60, 0}, {52, 52, 0}, {52, 47, 1}, {52, 44, 0}, {51, 39, 0},
+    {49, 34, 0}, {46, 29, 0}, {44, 26, 1}, {27, 2, 1}, {26, 1, 0}, {24, 0, 0},
+    {23, 0, 1}, {15, 0, 1}, {36, 27, 1}, {37, 29, 0}, {38, 31, 0}, {39, 33, 1},
+    {37, 30, 0}, {30, 28, 2}, {44, 48, 1}, {44, 52, 0}, {41, 57, 0}, {38, 60, 0},
+    {33, 62, 0}, {30, 62, 1}, {27, 62, 0}, {21, 60, 0}, {18, 57, 0}, {16, 52, 0},
+    {16, 49, 1}, {16, 45, 0}, {18, 40, 0}, {21, 37, 0}, {26, 35, 0}, {29, 35, 1},
+    {33, 35, 0}, {38, 37, 0}, {42, 41, 0}, {44, 46, 2}, {6, 5, 1}, {6, 7, 0},
+    {7, 9, 0}, {9, 10, 0}, {11, 11, 0}, {12, 11, 1}, {13, 11, 0}, {16, 10, 0},
+    {17, 9, 0}, {18, 7, 0}, {18, 5, 1}, {18, 4, 0}, {17, 2, 0}, {16, 0, 0},
+    {13, -1, 0}, {12, -1, 1}, {11, -1, 0}, {9, 0, 0}, {7, 2, 0}, {6, 4, 2},
+    {6, 41, 1}, {6, 43, 0}, {7, 45, 0}, {9, 46, 0}, {11, 47, 0}, {12, 47, 1},
+    {13, 47, 0}, {16, 46, 0}, {17, 45, 0}, {18, 43, 0}, {18, 41, 1}, {18, 40, 0},
+    {17, 38, 0}, {16, 36, 0}, {13, 35, 0}, {12, 35, 1}, {11, 35, 0}, {9, 36, 0},
+    {7, 38, 0}, {6, 40, 2}, {6, 6, 1}, {6, 7, 0}, {7, 9, 0}, {9, 10, 0},
+    {11, 11, 0}, {12, 11, 1}, {14, 11, 0}, {16, 10, 0}, {17, 8, 0}, {18, 6, 0},
+    {18, 5, 1}, {18, 2, 0}, {17, -2, 0}, {14, -7, 0}, {11, -11, 0}, {9, -13, 1},
+    {7, -12, 1}, {7, -11, 0}, {7, -10, 1}, {7, -10, 0}, {8, -9, 1}, {8, -8, 0},
+    {10, -7, 0}, {11, -4, 0}, {12, -2, 0}, {13, 0, 1}, {12, 0, 1}, {11, 0, 0},
+    {9, 1, 0}, {7, 2, 0}, {6, 5, 2}, {6, 41, 1}, {6, 43, 0}, {7, 45, 0},
+    {9, 46, 0}, {11, 47, 0}, {12, 47, 1}, {13, 47, 0}, {16, 46, 0}, {17, 45, 0},
+    {18, 43, 0}, {18, 41, 1}, {18, 40, 0}, {17, 38, 0}, {16, 36, 0}, {13, 35, 0},
+    {12, 35, 1}, {11, 35, 0}, {9, 36, 0}, {7, 38, 0}, {6, 40, 2}, {7, 34, 1},
+    {44, 53, 1}, {44, 47, 1}, {44, 46, 0}, {43, 45, 0}, {43, 45, 1}, {21, 34, 1},
+    {20, 33, 0}, {18, 33, 0}, {17, 32, 1}, {18, 32, 0}, {20, 31, 0}, {21, 31, 1},
+    {43, 20, 1}, {43, 19, 0}, {44, 18, 0}, {44, 17, 1}, {44, 11, 1}, {7, 31, 3},
+    {7, 28, 1}, {48, 28, 1}, {48, 21, 1}, {7, 21, 3}, {7, 44, 1}, {48, 44, 1},
+    {48, 37, 1}, {7, 37, 3}, {11, 11, 1}, {11, 17, 1}, {11, 18, 0}, {12, 19, 0},
+    {13, 20, 1}, {35, 31, 1}, {36, 31, 0}, {38, 32, 0}, {39, 32, 1}, {38, 33, 0},
+    {36, 33, 0}, {35, 34, 1}, {13, 45, 1}, {12, 45, 0}, {11, 46, 0}, {11, 47, 1},
+    {11, 53, 1}, {49, 34, 1}, {49, 31, 3}, {2, 63, 1}, {3, 64, 0}, {7, 67, 0},
+    {11, 68, 0}, {16, 70, 0}, {19, 70, 1}, {23, 70, 0}, {29, 67, 0}, {34, 63, 0},
+    {36, 58, 0}, {36, 54, 1}, {36, 50, 0}, {34, 45, 0}, {31, 41, 0}, {27, 38, 0},
+    {24, 36, 0}, {21, 33, 0}, {21, 31, 1}, {20, 24, 1}, {14, 24, 1}, {14, 32, 1},
+    {14, 35, 0}, {16, 38, 0}, {19, 40, 0}, {23, 43, 0}, {26, 46, 0}, {28, 51, 0},
+    {28, 54, 1}, {28, 56, 0}, {27, 59, 0}, {24, 61, 0}, {20, 63, 0}, {18, 63, 1},
+    {15, 63, 0}, {11, 61, 0}, {8, 59, 0}, {6, 58, 0}, {6, 58, 1}, {5, 58, 0},
+    {4, 59, 3}, {11, 5, 1}, {11, 7, 0}, {12, 9, 0}, {14, 10, 0}, {16, 11, 0},
+    {17, 11, 1}, {18, 11, 0}, {20, 10, 0}, {22, 9, 0}, {23, 7, 0}, {23, 5, 1},
+    {23, 4, 0}, {22, 2, 0}, {20, 0, 0}, {18, -1, 0}, {17, -1, 1}, {16, -1, 0},
+    {14, 0, 0}, {12, 2, 0}, {11, 4, 2}, {56, 9, 1}, {52, 9, 0}, {48, 13, 0},
+    {47, 16, 1}, {44, 12, 0}, {38, 9, 0}, {34, 9, 1}, {31, 9, 0}, {27, 11, 0},
+    {24, 14, 0}, {23, 19, 0}, {23, 22, 1}, {23, 26, 0}, {26, 34, 0}, {32, 41, 0},
+    {41, 45, 0}, {47, 45, 1}, {50, 45, 0}, {55, 44, 0}, {57, 43, 1}, {53, 26, 1},
+    {52, 22, 0}, {52, 20, 1}, {52, 18, 0}, {53, 16, 0}, {54, 15, 0}, {56, 14, 0},
+    {57, 14, 1}, {60, 14, 0}, {64, 17, 0}, {67, 22, 0}, {69, 29, 0}, {69, 33, 1},
+    {69, 40, 0}, {65, 50, 0}, {57, 56, 0}, {47, 60, 0}, {41, 60, 1}, {35, 60, 0},
+    {24, 55, 0}, {15, 46, 0}, {10, 34, 0}, {10, 27, 1}, {10, 19, 0}, {16, 7, 0},
+    {24, -2, 0}, {36, -6, 0}, {43, -6, 1}, {51, -6, 0}, {62, -3, 0}, {66, 0, 1},
+    {67, 0, 0}, {67, 0, 1}, {68, 0, 0}, {69, -1, 1}, {70, -4, 1}, {65, -8, 0},
+    {52, -11, 0}, {43, -11, 1}, {35, -11, 0}, {21, -6, 0}, {10, 4, 0}, {4, 18, 0},
+    {4, 27, 1}, {4, 32, 0}, {7, 42, 0}, {12, 51, 0}, {18, 58, 0}, {27, 62, 0},
+    {36, 65, 0}, {41, 65, 1}, {46, 65, 0}, {54, 63, 0}, {62, 60, 0}, {68, 54, 0},
+    {73, 47, 0}, {75, 38, 0}, {75, 33, 1}, {75, 28, 0}, {72, 19, 0}, {67, 13, 0},
+    {60, 9, 2}, {36, 15, 1}, {37, 15, 0}, {40, 16, 0}, {43, 18, 0}, {45, 22, 0},
+    {46, 25, 1}, {50, 39, 1}, {48, 40, 0}, {46, 40, 1}, {42, 40, 0}, {36, 37, 0},
+    {32, 32, 0}, {29, 26, 0}, {29, 22, 1}, {29, 19, 0}, {32, 15, 2}, {65, 0, 1},
+    {58, 0, 1}, {56, 0, 0}, {55, 1, 0}, {55, 2, 1}, {48, 19, 1}, {17, 19, 1},
+    {11, 2, 1}, {11, 1, 0}, {9, 0, 0}, {8, 0, 1}, {0, 0, 1}, {28, 69, 1},
+    {37, 69, 3}, {20, 26, 1}, {46, 26, 1}, {35, 54, 1}, {34, 56, 0}, {33, 60, 1},
+    {32, 58, 0}, {31, 55, 0}, {31, 53, 3}, {8, 0, 1}, {8, 69, 1}, {30, 69, 1},
+    {37, 69, 0}, {46, 66, 0}, {52, 62, 0}, {55, 55, 0}, {55, 51, 1}, {55, 48, 0},
+    {53, 44, 0}, {50, 40, 0}, {45, 36, 0}, {42, 35, 1}, {49, 34, 0}, {57, 26, 0},
+    {57, 20, 1}, {57, 15, 0}, {54, 8, 0}, {47, 3, 0}, {38, 0, 0}, {33, 0, 3},
+    {18, 31, 1}, {18, 7, 1}, {33, 7, 1}, {37, 7, 0}, {42, 9, 0}, {46, 13, 0},
+    {48, 17, 0}, {48, 20, 1}, {48, 25, 0}, {40, 31, 0}, {32, 31, 3}, {18, 38, 1},
+    {30, 38, 1}, {34, 38, 0}, {40, 40, 0}, {43, 43, 0}, {45, 47, 0}, {45, 50, 1},
+    {45, 56, 0}, {38, 61, 0}, {30, 61, 1}, {18, 61, 3}, {57, 14, 1}, {58, 14, 0},
+    {58, 14, 1}, {62, 10, 1}, {58, 5, 0}, {46, -1, 0}, {37, -1, 1}, {30, -1, 0},
+    {18, 4, 0}, {9, 14, 0}, {4, 27, 0}, {4, 34, 1}, {4, 42, 0}, {9, 55, 0},
+    {18, 64, 0}, {31, 70, 0}, {39, 70, 1}, {46, 70, 0}, {57, 65, 0}, {62, 61, 1},
+    {59, 57, 1}, {58, 56, 0}, {58, 55, 0}, {57, 55, 1}, {56, 55, 0}, {55, 56, 0},
+    {53, 58, 0}, {50, 59, 0}, {47, 61, 0}, {42, 61, 0}, {39, 61, 1}, {33, 61, 0},
+    {24, 58, 0}, {18, 51, 0}, {14, 41, 0}, {14, 34, 1}, {14, 28, 0}, {18, 18, 0},
+    {24, 11, 0}, {33, 7, 0}, {38, 7, 1}, {41, 7, 0}, {46, 8, 0}, {50, 10, 0},
+    {53, 12, 0}, {55, 13, 1}, {56, 14, 2}, {68, 34, 1}, {68, 27, 0}, {63, 14, 0},
+    {54, 5, 0}, {42, 0, 0}, {34, 0, 1}, {8, 0, 1}, {8, 69, 1}, {34, 69, 1},
+    {42, 69, 0}, {54, 64, 0}, {63, 55, 0}, {68, 42, 2}, {58, 34, 1}, {58, 41, 0},
+    {55, 51, 0}, {49, 58, 0}, {40, 61, 0}, {34, 61, 1}, {18, 61, 1}, {18, 8, 1},
+    {34, 8, 1}, {40, 8, 0}, {49, 11, 0}, {55, 18, 0}, {58, 28, 2}, {51, 69, 1},
+    {51, 61, 1}, {18, 61, 1}, {18, 38, 1}, {44, 38, 1}, {44, 31, 1}, {18, 31, 1},
+    {18, 8, 1}, {51, 8, 1}, {51, 0, 1}, {8, 0, 1}, {8, 69, 3}, {51, 69, 1},
+    {51, 61, 1}, {18, 61, 1}, {18, 37, 1}, {46, 37, 1}, {46, 30, 1}, {18, 30, 1},
+    {18, 0, 1}, {8, 0, 1}, {8, 69, 3}, {39, 7, 1}, {42, 7, 0}, {46, 7, 0},
+    {51, 8, 0}, {54, 10, 0}, {56, 11, 1}, {56, 26, 1}, {45, 26, 1}, {44, 26, 0},
+    {43, 27, 0}, {43, 28, 1}, {43, 33, 1}, {65, 33, 1}, {65, 7, 1}, {62, 5, 0},
+    {56, 2, 0}, {50, 0, 0}, {43, -1, 0}, {38, -1, 1}, {31, -1, 0}, {18, 4, 0},
+    {9, 14, 0}, {4, 27, 0}, {4, 34, 1}, {4, 42, 0}, {9, 55, 0}, {18, 64, 0},
+    {31, 70, 0}, {40, 70, 1}, {44, 70, 0}, {51, 68, 0}, {57, 66, 0}, {62, 63, 0},
+    {64, 61, 1}, {61, 57, 1}, {60, 55, 0}, {59, 55, 1}, {58, 55, 0}, {57, 56, 1},
+    {56, 57, 0}, {53, 58, 0}, {49, 60, 0}, {43, 61, 0}, {39, 61, 1}, {33, 61, 0},
+    {24, 58, 0}, {17, 51, 0}, {14, 41, 0}, {14, 34, 1}, {14, 28, 0}, {18, 18, 0},
+    {24, 11, 0}, {33, 7, 2}, {64, 0, 1}, {55, 0, 1}, {55, 31, 1}, {18, 31, 1},
+    {18, 0, 1}, {8, 0, 1}, {8, 69, 1}, {18, 69, 1}, {18, 38, 1}, {55, 38, 1},
+    {55, 69, 1}, {64, 69, 3}, {19, 0, 1}, {10, 0, 1}, {10, 69, 1}, {19, 69, 3},
+    {34, 24, 1}, {34, 18, 0}, {31, 9, 0}, {26, 3, 0}, {18, -1, 0}, {13, -1, 1},
+    {8, -1, 0}, {3, 1, 1}, {3, 2, 0}, {3, 5, 0}, {3, 6, 1}, {4, 7, 0},
+    {5, 8, 0}, {6, 8, 1}, {6, 8, 0}, {9, 7, 0}, {12, 7, 1}, {15, 7, 0},
+    {20, 9, 0}, {23, 13, 0}, {25, 19, 0}, {25, 24, 1}, {25, 69, 1}, {34, 69, 3},
+    {19, 39, 1}, {22, 39, 1}, {24, 39, 0}, {26, 40, 0}, {27, 41, 1}, {50, 67, 1},
+    {51, 68, 0}, {53, 69, 0}, {54, 69, 1}, {62, 69, 1}, {36, 39, 1}, {35, 38, 0},
+    {33, 37, 0}, {32, 36, 1}, {34, 36, 0}, {36, 34, 0}, {37, 33, 1}, {64, 0, 1},
+    {56, 0, 1}, {55, 0, 0}, {54, 0, 0}, {53, 1, 0}, {52, 2, 0}, {52, 2, 1},
+    {28, 29, 1}, {28, 30, 0}, {27, 31, 0}, {26, 31, 0}, {24, 31, 0}, {23, 31, 1},
+    {19, 31, 1}, {19, 0, 1}, {9, 0, 1}, {9, 69, 1}, {19, 69, 3}, {18, 8, 1},
+    {47, 8, 1}, {47, 0, 1}, {8, 0, 1}, {8, 69, 1}, {18, 69, 3}, {42, 25, 1},
+    {43, 24, 0}, {44, 21, 0}, {44, 20, 1}, {45, 21, 0}, {46, 24, 0}, {47, 25, 1},
+    {70, 67, 1}, {70, 68, 0}, {72, 69, 0}, {73, 69, 1}, {80, 69, 1}, {80, 0, 1},
+    {72, 0, 1}, {72, 51, 1}, {72, 52, 0}, {72, 54, 0}, {72, 55, 1}, {48, 12, 1},
+    {47, 10, 0}, {45, 10, 1}, {44, 10, 1}, {42, 10, 0}, {40, 12, 1}, {16, 55, 1},
+    {16, 54, 0}, {17, 52, 0}, {17, 51, 1}, {17, 0, 1}, {8, 0, 1}, {8, 69, 1},
+    {15, 69, 1}, {16, 69, 0}, {18, 68, 0}, {18, 67, 1}, {42, 25, 3}, {13, 69, 1},
+    {14, 69, 0}, {16, 68, 0}, {16, 67, 1}, {56, 15, 1}, {56, 17, 0}, {56, 19, 0},
+    {56, 20, 1}, {56, 69, 1}, {64, 69, 1}, {64, 0, 1}, {59, 0, 1}, {58, 0, 0},
+    {57, 1, 0}, {56, 2, 1}, {16, 53, 1}, {16, 52, 0}, {17, 50, 0}, {17, 49, 1},
+    {17, 0, 1}, {8, 0, 1}, {8, 69, 1}, {13, 69, 3}, {72, 34, 1}, {72, 27, 0},
+    {67, 14, 0}, {58, 4, 0}, {46, -1, 0}, {38, -1, 1}, {31, -1, 0}, {18, 4, 0},
+    {9, 14, 0}, {4, 27, 0}, {4, 34, 1}, {4, 42, 0}, {9, 55, 0}, {18, 64, 0},
+    {31, 70, 0}, {38, 70, 1}, {46, 70, 0}, {58, 64, 0}, {67, 55, 0}, {72, 42, 2},
+    {63, 34, 1}, {63, 41, 0}, {59, 51, 0}, {53, 58, 0}, {44, 61, 0}, {38, 61, 1},
+    {33, 61, 0}, {24, 58, 0}, {17, 51, 0}, {14, 41, 0}, {14, 34, 1}, {14, 28, 0},
+    {17, 18, 0}, {24, 11, 0}, {33, 7, 0}, {38, 7, 1}, {44, 7, 0}, {53, 11, 0},
+    {59, 18, 0}, {63, 28, 2}, {19, 26, 1}, {19, 0, 1}, {9, 0, 1}, {9, 69, 1},
+    {30, 69, 1}, {36, 69, 0}, {46, 66, 0}, {52, 60, 0}, {55, 52, 0}, {55, 47, 1},
+    {55, 43, 0}, {52, 35, 0}, {45, 29, 0}, {36, 26, 0}, {30, 26, 3}, {19, 33, 1},
+    {30, 33, 1}, {34, 33, 0}, {40, 35, 0}, {44, 39, 0}, {46, 44, 0}, {46, 47, 1},
+    {46, 54, 0}, {38, 61, 0}, {30, 61, 1}, {19, 61, 3}, {72, 34, 1}, {72, 30, 0},
+    {70, 21, 0}, {67, 13, 0}, {61, 7, 0}, {58, 5, 1}, {75, -14, 1}, {68, -14, 1},
+    {66, -14, 0}, {63, -13, 0}, {62, -12, 1}, {50, 1, 1}, {47, 0, 0}, {42, -1, 0},
+    {38, -1, 1}, {31, -1, 0}, {18, 4, 0}, {9, 14, 0}, {4, 27, 0}, {4, 34, 1},
+    {4, 42, 0}, {9, 55, 0}, {18, 64, 0}, {31, 70, 0}, {38, 70, 1}, {46, 70, 0},
+    {58, 64, 0}, {67, 55, 0}, {72, 42, 2}, {63, 34, 1}, {63, 41, 0}, {59, 51, 0},
+    {53, 58, 0}, {44, 61, 0}, {38, 61, 1}, {33, 61, 0}, {24, 58, 0}, {17, 51, 0},
+    {14, 41, 0}, {14, 34, 1}, {14, 28, 0}, {17, 18, 0}, {24, 11, 0}, {33, 7, 0},
+    {38, 7, 1}, {44, 7, 0}, {53, 11, 0}, {59, 18, 0}, {63, 28, 2}, {19, 29, 1},
+    {19, 0, 1}, {9, 0, 1}, {9, 69, 1}, {29, 69, 1}, {35, 69, 0}, {45, 66, 0},
+    {51, 61, 0}, {54, 54, 0}, {54, 50, 1}, {54, 46, 0}, {52, 40, 0}, {47, 35, 0},
+    {41, 31, 0}, {37, 30, 1}, {39, 29, 0}, {40, 27, 1}, {60, 0, 1}, {52, 0, 1},
+    {49, 0, 0}, {48, 2, 1}, {30, 27, 1}, {29, 28, 0}, {28, 29, 0}, {26, 29, 3},
+    {19, 35, 1}, {28, 35, 1}, {32, 35, 0}, {39, 37, 0}, {43, 41, 0}, {45, 46, 0},
+    {45, 49, 1}, {45, 55, 0}, {37, 61, 0}, {29, 61, 1}, {19, 61, 3}, {44, 58, 1},
+    {43, 57, 0}, {42, 57, 0}, {41, 57, 1}, {41, 57, 0}, {38, 58, 0}, {35, 60, 0},
+    {30, 62, 0}, {27, 62, 1}, {24, 62, 0}, {19, 60, 0}, {16, 57, 0}, {14, 53, 0},
+    {14, 51, 1}, {14, 48, 0}, {17, 44, 0}, {22, 42, 0}, {28, 40, 0}, {34, 38, 0},
+    {40, 35, 0}, {45, 31, 0}, {47, 25, 0}, {47, 21, 1}, {47, 16, 0}, {44, 8, 0},
+    {38, 3, 0}, {30, -1, 0}, {24, -1, 1}, {18, -1, 0}, {7, 4, 0}, {3, 8, 1},
+    {5, 13, 1}, {6, 13, 0}, {7, 14, 0}, {8, 14, 1}, {9, 14, 0}, {11, 12, 0},
+    {15, 9, 0}, {21, 7, 0}, {25, 7, 1}, {28, 7, 0}, {33, 9, 0}, {37, 12, 0},
+    {39, 17, 0}, {39, 20, 1}, {39, 23, 0}, {36, 27, 0}, {31, 29, 0}, {25, 31, 0},
+    {19, 33, 0}, {13, 36, 0}, {9, 40, 0}, {6, 46, 0}, {6, 51, 1}, {6, 54, 0},
+    {9, 61, 0}, {14, 66, 0}, {22, 70, 0}, {27, 70, 1}, {33, 70, 0}, {42, 66, 0},
+    {46, 62, 3}, {55, 69, 1}, {55, 61, 1}, {33, 61, 1}, {33, 0, 1}, {24, 0, 1},
+    {24, 61, 1}, {1, 61, 1}, {1, 69, 3}, {35, 7, 1}, {39, 7, 0}, {46, 10, 0},
+    {51, 15, 0}, {53, 23, 0}, {53, 27, 1}, {53, 69, 1}, {62, 69, 1}, {62, 27, 1},
+    {62, 21, 0}, {59, 11, 0}, {52, 3, 0}, {41, -1, 0}, {35, -1, 1}, {29, -1, 0},
+    {19, 3, 0}, {11, 11, 0}, {8, 21, 0}, {8, 27, 1}, {8, 69, 1}, {17, 69, 1},
+    {17, 27, 1}, {17, 23, 0}, {19, 16, 0}, {24, 10, 0}, {31, 7, 2}, {0, 69, 1},
+    {8, 69, 1}, {9, 69, 0}, {11, 68, 0}, {11, 67, 1}, {30, 18, 1}, {31, 16, 0},
+    {32, 13, 0}, {33, 11, 1}, {33, 13, 0}, {34, 16, 0}, {35, 18, 1}, {54, 67, 1},
+    {55, 67, 0}, {56, 69, 0}, {57, 69, 1}, {65, 69, 1}, {37, 0, 1}, {28, 0, 3},
+    {1, 69, 1}, {8, 69, 1}, {10, 69, 0}, {11, 68, 0}, {12, 67, 1}, {26, 19, 1},
+    {26, 17, 0}, {27, 14, 0}, {27, 13, 1}, {27, 14, 0}, {28, 18, 0}, {29, 19, 1},
+    {45, 67, 1}, {45, 67, 0}, {47, 69, 0}, {48, 69, 1}, {51, 69, 1}, {52, 69, 0},
+    {53, 68, 0}, {54, 67, 1}, {70, 19, 1}, {71, 16, 0}, {71, 13, 1}, {72, 15, 0},
+    {72, 18, 0}, {72, 19, 1}, {87, 67, 1}, {87, 67, 0}, {89, 69, 0}, {90, 69, 1},
+    {97, 69, 1}, {76, 0, 1}, {67, 0, 1}, {50, 52, 1}, {49, 54, 0}, {49, 56, 1},
+    {49, 55, 0}, {48, 53, 0}, {48, 52, 1}, {30, 0, 1}, {22, 0, 3}, {24, 35, 1},
+    {2, 69, 1}, {11, 69, 1}, {12, 69, 0}, {13, 68, 0}, {13, 67, 1}, {31, 40, 1},
+    {32, 41, 0}, {32, 42, 1}, {49, 67, 1}, {50, 68, 0}, {51, 69, 0}, {51, 69, 1},
+    {60, 69, 1}, {37, 36, 1}, {61, 0, 1}, {52, 0, 1}, {51, 0, 0}, {49, 1, 0},
+    {49, 2, 1}, {31, 31, 1}, {30, 30, 0}, {30, 29, 1}, {12, 2, 1}, {11, 1, 0},
+    {10, 0, 0}, {9, 0, 1}, {1, 0, 3}, {35, 27, 1}, {35, 0, 1}, {26, 0, 1},
+    {26, 27, 1}, {0, 69, 1}, {9, 69, 1}, {10, 69, 0}, {11, 68, 0}, {12, 67, 1},
+    {28, 40, 1}, {28, 38, 0}, {30, 35, 0}, {30, 34, 1}, {31, 35, 0}, {32, 38, 0},
+    {33, 40, 1}, {49, 67, 1}, {49, 67, 0}, {51, 69, 0}, {52, 69, 1}, {60, 69, 3},
+    {56, 69, 1}, {56, 65, 1}, {56, 64, 0}, {55, 62, 1}, {16, 8, 1}, {56, 8, 1},
+    {56, 0, 1}, {4, 0, 1}, {4, 4, 1}, {4, 5, 0}, {5, 6, 1}, {44, 61, 1},
+    {6, 61, 1}, {6, 69, 3}, {7, -14, 1}, {7, 74, 1}, {24, 74, 1}, {24, 70, 1},
+    {24, 69, 0}, {23, 68, 0}, {22, 68, 1}, {14, 68, 1}, {14, -8, 1}, {22, -8, 1},
+    {23, -8, 0}, {24, -9, 0}, {24, -11, 1}, {24, -14, 3}, {-1, 71, 1}, {3, 71, 1},
+    {4, 71, 0}, {7, 69, 0}, {7, 68, 1}, {36, -4, 1}, {32, -4, 1}, {31, -4, 0},
+    {28, -3, 0}, {28, -1, 3}, {4, -11, 1}, {4, -10, 0}, {6, -8, 0}, {7, -8, 1},
+    {15, -8, 1}, {15, 68, 1}, {7, 68, 1}, {6, 68, 0}, {4, 69, 0}, {4, 70, 1},
+    {4, 74, 1}, {22, 74, 1}, {22, -14, 1}, {4, -14, 3}, {25, 69, 1}, {30, 69, 1},
+    {47, 38, 1}, {41, 38, 1}, {40, 38, 0}, {39, 39, 0}, {39, 39, 1}, {30, 56, 1},
+    {29, 57, 0}, {28, 59, 0}, {28, 60, 1}, {27, 58, 0}, {26, 56, 1}, {17, 39, 1},
+    {16, 39, 0}, {15, 38, 0}, {14, 38, 1}, {8, 38, 3}, {38, -8, 1}, {38, -14, 1},
+    {0, -14, 1}, {0, -8, 3}, {10, 70, 1}, {12, 70, 0}, {13, 69, 0}, {14, 67, 1},
+    {21, 56, 1}, {16, 56, 1}, {15, 56, 0}, {14, 56, 0}, {13, 57, 1}, {2, 70, 3},
+    {43, 0, 1}, {39, 0, 1}, {38, 0, 0}, {36, 1, 0}, {36, 2, 1}, {35, 7, 1},
+    {33, 5, 0}, {29, 2, 0}, {25, 0, 0}, {21, -1, 0}, {18, -1, 1}, {15, -1, 0},
+    {10, 1, 0}, {7, 4, 0}, {4, 9, 0}, {4, 12, 1}, {4, 15, 0}, {8, 20, 0},
+    {15, 24, 0}, {26, 27, 0}, {34, 27, 1}, {34, 31, 1}, {34, 37, 0}, {29, 43, 0},
+    {25, 43, 1}, {22, 43, 0}, {17, 41, 0}, {14, 39, 0}, {12, 37, 0}, {11, 37, 1},
+    {10, 37, 0}, {9, 38, 0}, {8, 39, 1}, {7, 42, 1}, {11, 46, 0}, {20, 49, 0},
+    {26, 49, 1}, {30, 49, 0}, {36, 47, 0}, {41, 42, 0}, {43, 35, 0}, {43, 31, 3},
+    {21, 5, 1}, {23, 5, 0}, {27, 6, 0}, {30, 8, 0}, {33, 10, 0}, {34, 12, 1},
+    {34, 22, 1}, {28, 22, 0}, {20, 20, 0}, {15, 18, 0}, {13, 15, 0}, {13, 13, 1},
+    {13, 11, 0}, {14, 8, 0}, {16, 6, 0}, {19, 5, 2}, {7, 0, 1}, {7, 71, 1},
+    {16, 71, 1}, {16, 42, 1}, {19, 45, 0}, {27, 49, 0}, {32, 49, 1}, {36, 49, 0},
+    {43, 46, 0}, {48, 40, 0}, {50, 31, 0}, {50, 25, 1}, {50, 19, 0}, {47, 10, 0},
+    {42, 3, 0}, {34, -1, 0}, {29, -1, 1}, {24, -1, 0}, {18, 3, 0}, {15, 6, 1},
+    {15, 2, 1}, {15, 0, 0}, {13, 0, 3}, {29, 43, 1}, {25, 43, 0}, {19, 39, 0},
+    {16, 35, 1}, {16, 12, 1}, {18, 9, 0}, {24, 6, 0}, {27, 6, 1}, {34, 6, 0},
+    {41, 16, 0}, {41, 25, 1}, {41, 29, 0}, {40, 36, 0}, {37, 41, 0}, {32, 43, 2},
+    {40, 40, 1}, {40, 39, 0}, {39, 39, 0}, {38, 39, 1}, {38, 39, 0}, {36, 40, 0},
+    {33, 42, 0}, {30, 43, 0}, {27, 43, 1}, {23, 43, 0}, {18, 40, 0}, {14, 35, 0},
+    {12, 29, 0}, {12, 24, 1}, {12, 20, 0}, {14, 13, 0}, {18, 8, 0}, {23, 6, 0},
+    {26, 6, 1}, {30, 6, 0}, {34, 7, 0}, {36, 9, 0}, {38, 11, 0}, {39, 11, 1},
+    {40, 11, 0}, {41, 10, 1}, {43, 7, 1}, {40, 3, 0}, {30, -1, 0}, {25, -1, 1},
+    {20, -1, 0}, {13, 3, 0}, {7, 9, 0}, {4, 18, 0}, {4, 24, 1}, {4, 30, 0},
+    {7, 39, 0}, {12, 46, 0}, {21, 49, 0}, {26, 49, 1}, {32, 49, 0}, {39, 46, 0},
+    {42, 43, 3}, {41, 0, 1}, {39, 0, 0}, {39, 2, 1}, {38, 8, 1}, {35, 4, 0},
+    {27, -1, 0}, {22, -1, 1}, {18, -1, 0}, {11, 3, 0}, {6, 9, 0}, {3, 18, 0},
+    {3, 24, 1}, {3, 30, 0}, {6, 39, 0}, {12, 46, 0}, {20, 49, 0}, {24, 49, 1},
+    {29, 49, 0}, {35, 46, 0}, {38, 44, 1}, {38, 71, 1}, {46, 71, 1}, {46, 0, 3},
+    {25, 6, 1}, {29, 6, 0}, {35, 10, 0}, {38, 14, 1}, {38, 37, 1}, {35, 40, 0},
+    {30, 43, 0}, {26, 43, 1}, {20, 43, 0}, {12, 33, 0}, {12, 24, 1}, {12, 19, 0},
+    {14, 13, 0}, {17, 8, 0}, {22, 6, 2}, {26, 49, 1}, {31, 49, 0}, {38, 46, 0},
+    {43, 41, 0}, {46, 33, 0}, {46, 28, 1}, {46, 26, 0}, {46, 24, 0}, {44, 24, 1},
+    {12, 24, 1}, {12, 20, 0}, {14, 13, 0}, {18, 8, 0}, {24, 6, 0}, {27, 6, 1},
+    {31, 6, 0}, {35, 8, 0}, {39, 9, 0}, {41, 11, 0}, {42, 11, 1}, {43, 11, 0},
+    {43, 10, 1}, {46, 7, 1}, {44, 5, 0}, {40, 2, 0}, {35, 0, 0}, {29, -1, 0},
+    {27, -1, 1}, {22, -1, 0}, {13, 3, 0}, {7, 9, 0}, {4, 19, 0}, {4, 25, 1},
+    {4, 30, 0}, {7, 39, 0}, {13, 46, 0}, {21, 49, 2}, {26, 43, 1}, {20, 43, 0},
+    {13, 36, 0}, {12, 30, 1}, {39, 30, 1}, {39, 33, 0}, {37, 38, 0}, {34, 41, 0},
+    {29, 43, 2}, {9, 0, 1}, {9, 41, 1}, {4, 42, 1}, {3, 42, 0}, {1, 43, 0},
+    {1, 44, 1}, {1, 48, 1}, {9, 48, 1}, {9, 52, 1}, {9, 57, 0}, {11, 63, 0},
+    {16, 67, 0}, {22, 70, 0}, {26, 70, 1}, {29, 70, 0}, {32, 69, 1}, {31, 65, 1},
+    {31, 64, 0}, {30, 63, 0}, {29, 63, 1}, {27, 63, 1}, {25, 63, 0}, {21, 62, 0},
+    {19, 59, 0}, {17, 55, 0}, {17, 52, 1}, {17, 48, 1}, {31, 48, 1}, {31, 41, 1},
+    {18, 41, 1}, {18, 0, 3}, {23, 49, 1}, {27, 49, 0}, {32, 48, 0}, {34, 47, 1},
+    {48, 47, 1}, {48, 44, 1}, {48, 42, 0}, {46, 42, 1}, {40, 41, 1}, {42, 38, 0},
+    {42, 34, 1}, {42, 30, 0}, {39, 24, 0}, {34, 20, 0}, {27, 18, 0}, {23, 18, 1},
+    {20, 18, 0}, {17, 19, 1}, {15, 18, 0}, {14, 16, 0}, {14, 15, 1}, {14, 13, 0},
+    {17, 11, 0}, {21, 10, 0}, {27, 10, 0}, {33, 10, 0}, {39, 9, 0}, {44, 6, 0},
+    {46, 2, 0}, {46, -1, 1}, {46, -4, 0}, {43, -10, 0}, {37, -15, 0}, {29, -18, 0},
+    {24, -18, 1}, {18, -18, 0}, {10, -15, 0}, {5, -12, 0}, {2, -7, 0}, {2, -5, 1},
+    {2, -1, 0}, {7, 4, 0}, {11, 5, 1}, {9, 6, 0}, {6, 10, 0}, {6, 12, 1},
+    {6, 13, 0}, {7, 16, 0}, {9, 18, 0}, {11, 20, 0}, {13, 21, 1}, {9, 23, 0},
+    {5, 29, 0}, {5, 34, 1}, {5, 37, 0}, {8, 43, 0}, {13, 47, 0}, {19, 49, 2},
+    {39, -3, 1}, {39, -1, 0}, {37, 1, 0}, {33, 3, 0}, {29, 3, 0}, {24, 3, 0},
+    {18, 4, 0}, {16, 4, 1}, {13, 3, 0}, {10, -1, 0}, {10, -4, 1}, {10, -5, 0},
+    {12, -8, 0}, {15, -10, 0}, {20, -11, 0}, {24, -11, 1}, {27, -11, 0}, {33, -10, 0},
+    {37, -8, 0}, {39, -5, 2}, {23, 24, 1}, {26, 24, 0}, {30, 25, 0}, {33, 28, 0},
+    {34, 31, 0}, {34, 34, 1}, {34, 38, 0}, {29, 43, 0}, {23, 43, 1}, {18, 43, 0},
+    {13, 38, 0}, {13, 34, 1}, {13, 31, 0}, {14, 28, 0}, {17, 25, 0}, {21, 24, 2},
+    {7, 0, 1}, {7, 71, 1}, {16, 71, 1}, {16, 42, 1}, {19, 45, 0}, {26, 49, 0},
+    {31, 49, 1}, {35, 49, 0}, {41, 47, 0}, {45, 42, 0}, {47, 35, 0}, {47, 31, 1},
+    {47, 0, 1}, {39, 0, 1}, {39, 31, 1}, {39, 36, 0}, {34, 43, 0}, {29, 43, 1},
+    {25, 43, 0}, {18, 39, 0}, {16, 36, 1}, {16, 0, 3}, {17, 49, 1}, {17, 0, 1},
+    {8, 0, 1}, {8, 49, 3}, {18, 64, 1}, {18, 63, 0}, {17, 60, 0}, {16, 59, 0},
+    {14, 58, 0}, {12, 58, 1}, {11, 58, 0}, {9, 59, 0}, {7, 60, 0}, {6, 63, 0},
+    {6, 64, 1}, {6, 65, 0}, {7, 67, 0}, {9, 69, 0}, {11, 70, 0}, {12, 70, 1},
+    {14, 70, 0}, {16, 69, 0}, {17, 67, 0}, {18, 65, 2}, {17, 49, 1}, {17, -4, 1},
+    {17, -7, 0}, {15, -12, 0}, {12, -15, 0}, {6, -17, 0}, {3, -17, 1}, {1, -17, 0},
+    {-1, -17, 0}, {-3, -17, 1}, {-2, -12, 1}, {-2, -11, 0}, {-1, -11, 1}, {0, -11, 0},
+    {1, -11, 1}, {5, -11, 0}, {8, -7, 0}, {8, -4, 1}, {8, 49, 3}, {18, 64, 1},
+    {18, 63, 0}, {17, 60, 0}, {16, 59, 0}, {14, 58, 0}, {12, 58, 1}, {11, 58, 0},
+    {9, 59, 0}, {7, 60, 0}, {6, 63, 0}, {6, 64, 1}, {6, 65, 0}, {7, 67, 0},
+    {9, 69, 0}, {11, 70, 0}, {12, 70, 1}, {14, 70, 0}, {16, 69, 0}, {17, 67, 0},
+    {18, 65, 2}, {16, 71, 1}, {16, 29, 1}, {18, 29, 1}, {19, 29, 0}, {20, 30, 0},
+    {21, 30, 1}, {36, 47, 1}, {37, 48, 0}, {39, 49, 0}, {40, 49, 1}, {48, 49, 1},
+    {30, 30, 1}, {29, 29, 0}, {28, 28, 0}, {27, 27, 1}, {28, 26, 0}, {29, 25, 0},
+    {30, 24, 1}, {49, 0, 1}, {41, 0, 1}, {40, 0, 0}, {39, 1, 0}, {38, 2, 1},
+    {22, 22, 1}, {21, 23, 0}, {20, 23, 0}, {18, 23, 1}, {16, 23, 1}, {16, 0, 1},
+    {7, 0, 1}, {7, 71, 3}, {17, 71, 1}, {17, 0, 1}, {8, 0, 1}, {8, 71, 3},
+    {7, 0, 1}, {7, 49, 1}, {12, 49, 1}, {14, 49, 0}, {14, 47, 1}, {15, 42, 1},
+    {18, 45, 0}, {24, 49, 0}, {29, 49, 1}, {34, 49, 0}, {40, 44, 0}, {41, 39, 1},
+    {42, 42, 0}, {46, 46, 0}, {50, 48, 0}, {54, 49, 0}, {57, 49, 1}, {61, 49, 0},
+    {67, 47, 0}, {71, 42, 0}, {73, 35, 0}, {73, 31, 1}, {73, 0, 1}, {64, 0, 1},
+    {64, 31, 1}, {64, 37, 0}, {59, 43, 0}, {55, 43, 1}, {53, 43, 0}, {49, 41, 0},
+    {46, 38, 0}, {44, 34, 0}, {44, 31, 1}, {44, 0, 1}, {36, 0, 1}, {36, 31, 1},
+    {36, 37, 0}, {31, 43, 0}, {26, 43, 1}, {23, 43, 0}, {18, 39, 0}, {16, 36, 1},
+    {16, 0, 3}, {7, 0, 1}, {7, 49, 1}, {12, 49, 1}, {14, 49, 0}, {14, 47, 1},
+    {15, 42, 1}, {18, 45, 0}, {26, 49, 0}, {31, 49, 1}, {35, 49, 0}, {41, 47, 0},
+    {45, 42, 0}, {47, 35, 0}, {47, 31, 1}, {47, 0, 1}, {39, 0, 1}, {39, 31, 1},
+    {39, 36, 0}, {34, 43, 0}, {29, 43, 1}, {25, 43, 0}, {18, 39, 0}, {16, 36, 1},
+    {16, 0, 3}, {27, 49, 1}, {32, 49, 0}, {41, 46, 0}, {47, 39, 0}, {50, 30, 0},
+    {50, 24, 1}, {50, 19, 0}, {47, 9, 0}, {41, 3, 0}, {32, -1, 0}, {27, -1, 1},
+    {21, -1, 0}, {13, 3, 0}, {7, 9, 0}, {3, 19, 0}, {3, 24, 1}, {3, 30, 0},
+    {7, 39, 0}, {13, 46, 0}, {21, 49, 2}, {27, 6, 1}, {34, 6, 0}, {41, 16, 0},
+    {41, 24, 1}, {41, 33, 0}, {34, 43, 0}, {27, 43, 1}, {23, 43, 0}, {18, 40, 0},
+    {14, 35, 0}, {12, 29, 0}, {12, 24, 1}, {12, 20, 0}, {14, 13, 0}, {18, 8, 0},
+    {23, 6, 2}, {7, -16, 1}, {7, 49, 1}, {12, 49, 1}, {14, 49, 0}, {14, 47, 1},
+    {15, 41, 1}, {18, 45, 0}, {26, 49, 0}, {31, 49, 1}, {36, 49, 0}, {42, 46, 0},
+    {47, 40, 0}, {50, 31, 0}, {50, 25, 1}, {50, 19, 0}, {47, 10, 0}, {42, 3, 0},
+    {34, -1, 0}, {29, -1, 1}, {24, -1, 0}, {18, 2, 0}, {16, 5, 1}, {16, -16, 3},
+    {29, 43, 1}, {24, 43, 0}, {18, 39, 0}, {16, 35, 1}, {16, 12, 1}, {18, 9, 0},
+    {24, 6, 0}, {27, 6, 1}, {34, 6, 0}, {41, 16, 0}, {41, 25, 1}, {41, 29, 0},
+    {39, 36, 0}, {36, 41, 0}, {32, 43, 2}, {46, 49, 1}, {46, -16, 1}, {38, -16, 1},
+    {38, 7, 1}, {35, 4, 0}, {27, -1, 0}, {22, -1, 1}, {18, -1, 0}, {11, 3, 0},
+    {6, 9, 0}, {3, 18, 0}, {3, 24, 1}, {3, 30, 0}, {6, 39, 0}, {12, 46, 0},
+    {20, 49, 0}, {24, 49, 1}, {29, 49, 0}, {36, 46, 0}, {38, 43, 1}, {39, 47, 1},
+    {39, 49, 0}, {41, 49, 3}, {25, 6, 1}, {29, 6, 0}, {35, 10, 0}, {38, 14, 1},
+    {38, 37, 1}, {35, 40, 0}, {30, 43, 0}, {26, 43, 1}, {20, 43, 0}, {12, 33, 0},
+    {12, 24, 1}, {12, 19, 0}, {14, 13, 0}, {17, 8, 0}, {22, 6, 2}, {7, 0, 1},
+    {7, 49, 1}, {12, 49, 1}, {13, 49, 0}, {14, 48, 0}, {15, 46, 1}, {15, 39, 1},
+    {18, 44, 0}, {25, 49, 0}, {30, 49, 1}, {32, 49, 0}, {35, 49, 0}, {37, 48, 1},
+    {35, 41, 1}, {35, 40, 0}, {34, 40, 1}, {33, 40, 0}, {31, 41, 0}, {28, 41, 1},
+    {24, 41, 0}, {18, 36, 0}, {16, 31, 1}, {16, 0, 3}, {35, 41, 1}, {34, 40, 0},
+    {33, 40, 1}, {32, 40, 0}, {31, 41, 0}, {28, 42, 0}, {24, 43, 0}, {22, 43, 1},
+    {20, 43, 0}, {16, 42, 0}, {14, 40, 0}, {12, 37, 0}, {12, 36, 1}, {12, 34, 0},
+    {15, 32, 0}, {18, 30, 0}, {23, 28, 0}, {27, 27, 0}, {32, 25, 0}, {35, 22, 0},
+    {38, 18, 0}, {38, 15, 1}, {38, 12, 0}, {35, 6, 0}, {30, 2, 0}, {24, -1, 0},
+    {19, -1, 1}, {14, -1, 0}, {6, 3, 0}, {3, 5, 1}, {5, 8, 1}, {5, 9, 0},
+    {6, 10, 0}, {7, 10, 1}, {8, 10, 0}, {10, 8, 0}, {13, 7, 0}, {17, 5, 0},
+    {20, 5, 1}, {22, 5, 0}, {26, 7, 0}, {28, 9, 0}, {30, 12, 0}, {30, 13, 1},
+    {30, 15, 0}, {27, 18, 0}, {24, 20, 0}, {19, 21, 0}, {15, 23, 0}, {10, 25, 0},
+    {6, 28, 0}, {4, 32, 0}, {4, 35, 1}, {4, 38, 0}, {7, 43, 0}, {11, 47, 0},
+    {17, 49, 0}, {22, 49, 1}, {26, 49, 0}, {34, 46, 0}, {37, 44, 3}, {22, -1, 1},
+    {16, -1, 0}, {10, 6, 0}, {10, 12, 1}, {10, 41, 1}, {4, 41, 1}, {3, 41, 0},
+    {2, 42, 0}, {2, 43, 1}, {2, 47, 1}, {10, 48, 1}, {12, 63, 1}, {12, 64, 0},
+    {13, 64, 0}, {14, 64, 1}, {18, 64, 1}, {18, 48, 1}, {32, 48, 1}, {32, 41, 1},
+    {18, 41, 1}, {18, 12, 1}, {18, 9, 0}, {21, 6, 0}, {24, 6, 1}, {25, 6, 0},
+    {27, 7, 0}, {28, 8, 0}, {29, 9, 0}, {30, 9, 1}, {30, 9, 0}, {31, 8, 1},
+    {34, 4, 1}, {31, 2, 0}, {25, -1, 2}, {14, 49, 1}, {14, 18, 1}, {14, 12, 0},
+    {19, 6, 0}, {25, 6, 1}, {28, 6, 0}, {35, 10, 0}, {38, 13, 1}, {38, 49, 1},
+    {46, 49, 1}, {46, 0, 1}, {41, 0, 1}, {39, 0, 0}, {39, 2, 1}, {38, 7, 1},
+    {35, 4, 0}, {27, -1, 0}, {22, -1, 1}, {18, -1, 0}, {12, 2, 0}, {8, 7, 0},
+    {6, 13, 0}, {6, 18, 1}, {6, 49, 3}, {1, 49, 1}, {8, 49, 1}, {9, 49, 0},
+    {10, 48, 0}, {11, 47, 1}, {23, 16, 1}, {24, 14, 0}, {24, 10, 0}, {25, 9, 1},
+    {25, 10, 0}, {26, 14, 0}, {27, 16, 1}, {39, 47, 1}, {39, 48, 0}, {41, 49, 0},
+    {42, 49, 1}, {48, 49, 1}, {28, 0, 1}, {21, 0, 3}, {1, 49, 1}, {7, 49, 1},
+    {8, 49, 0}, {10, 48, 0}, {10, 47, 1}, {19, 16, 1}, {20, 14, 0}, {20, 11, 0},
+    {21, 9, 1}, {21, 11, 0}, {22, 14, 0}, {23, 16, 1}, {33, 47, 1}, {33, 48, 0},
+    {34, 49, 0}, {35, 49, 1}, {39, 49, 1}, {40, 49, 0}, {41, 48, 0}, {41, 47, 1},
+    {51, 16, 1}, {52, 14, 0}, {53, 11, 0}, {53, 9, 1}, {53, 11, 0}, {54, 14, 0},
+    {54, 16, 1}, {64, 47, 1}, {64, 48, 0}, {66, 49, 0}, {66, 49, 1}, {73, 49, 1},
+    {57, 0, 1}, {50, 0, 1}, {49, 0, 0}, {49, 2, 1}, {38, 35, 1}, {38, 36, 0},
+    {37, 38, 0}, {37, 39, 1}, {37, 38, 0}, {36, 36, 0}, {36, 35, 1}, {25, 2, 1},
+    {24, 0, 0}, {23, 0, 1}, {16, 0, 3}, {18, 25, 1}, {2, 49, 1}, {10, 49, 1},
+    {11, 49, 0}, {12, 48, 0}, {13, 47, 1}, {25, 29, 1}, {25, 30, 0}, {26, 32, 1},
+    {36, 47, 1}, {37, 48, 0}, {38, 49, 0}, {38, 49, 1}, {46, 49, 1}, {30, 25, 1},
+    {47, 0, 1}, {39, 0, 1}, {38, 0, 0}, {36, 1, 0}, {36, 2, 1}, {24, 21, 1},
+    {24, 19, 0}, {23, 18, 1}, {12, 2, 1}, {11, 1, 0}, {10, 0, 0}, {9, 0, 1},
+    {1, 0, 3}, {21, -14, 1}, {21, -15, 0}, {20, -16, 0}, {18, -16, 1}, {12, -16, 1},
+    {21, 3, 1}, {1, 49, 1}, {8, 49, 1}, {9, 49, 0}, {10, 48, 0}, {11, 47, 1},
+    {24, 16, 1}, {24, 15, 0}, {25, 13, 0}, {25, 12, 1}, {25, 13, 0}, {26, 15, 0},
+    {26, 16, 1}, {39, 47, 1}, {39, 48, 0}, {41, 49, 0}, {42, 49, 1}, {48, 49, 3},
+    {41, 45, 1}, {41, 44, 0}, {40, 42, 0}, {40, 42, 1}, {13, 7, 1}, {40, 7, 1},
+    {40, 0, 1}, {3, 0, 1}, {3, 4, 1}, {3, 4, 0}, {4, 6, 0}, {5, 7, 1},
+    {31, 42, 1}, {5, 42, 1}, {5, 49, 1}, {41, 49, 3}, {9, 20, 1}, {9, 23, 0},
+    {5, 27, 0}, {2, 27, 1}, {2, 32, 1}, {5, 32, 0}, {9, 36, 0}, {9, 39, 1},
+    {9, 42, 0}, {8, 46, 0}, {7, 51, 0}, {6, 56, 0}, {6, 58, 1}, {6, 62, 0},
+    {8, 67, 0}, {12, 71, 0}, {18, 74, 0}, {22, 74, 1}, {25, 74, 1}, {25, 70, 1},
+    {25, 69, 0}, {23, 68, 0}, {23, 68, 1}, {22, 68, 1}, {18, 68, 0}, {14, 63, 0},
+    {14, 59, 1}, {14, 56, 0}, {14, 51, 0}, {15, 47, 0}, {16, 42, 0}, {16, 39, 1},
+    {16, 38, 0}, {15, 35, 0}, {13, 32, 0}, {10, 30, 0}, {9, 30, 1}, {10, 29, 0},
+    {13, 28, 0}, {15, 25, 0}, {16, 22, 0}, {16, 20, 1}, {16, 18, 0}, {15, 13, 0},
+    {14, 8, 0}, {14, 3, 0}, {14, 1, 1}, {14, -3, 0}, {18, -8, 0}, {22, -8, 1},
+    {23, -8, 1}, {23, -8, 0}, {25, -9, 0}, {25, -10, 1}, {25, -14, 1}, {22, -14, 1},
+    {18, -14, 0}, {12, -12, 0}, {8, -8, 0}, {6, -2, 0}, {6, 1, 1}, {6, 4, 0},
+    {7, 9, 0}, {8, 13, 0}, {9, 18, 2}, {11, 74, 1}, {18, 74, 1}, {18, -16, 1},
+    {11, -16, 3}, {20, 20, 1}, {20, 18, 0}, {21, 13, 0}, {22, 9, 0}, {23, 4, 0},
+    {23, 1, 1}, {23, -2, 0}, {21, -8, 0}, {17, -12, 0}, {11, -14, 0}, {7, -14, 1},
+    {4, -14, 1}, {4, -10, 1}, {4, -9, 0}, {6, -8, 0}, {6, -8, 1}, {7, -8, 1},
+    {11, -8, 0}, {15, -3, 0}, {15, 1, 1}, {15, 3, 0}, {14, 8, 0}, {14, 13, 0},
+    {13, 18, 0}, {13, 20, 1}, {13, 22, 0}, {14, 25, 0}, {16, 28, 0}, {19, 29, 0},
+    {20, 30, 1}, {19, 30, 0}, {16, 32, 0}, {14, 35, 0}, {13, 38, 0}, {13, 39, 1},
+    {13, 42, 0}, {14, 47, 0}, {14, 51, 0}, {15, 56, 0}, {15, 59, 1}, {15, 63, 0},
+    {11, 68, 0}, {7, 68, 1}, {6, 68, 1}, {6, 68, 0}, {4, 69, 0}, {4, 70, 1},
+    {4, 74, 1}, {7, 74, 1}, {11, 74, 0}, {17, 71, 0}, {21, 67, 0}, {23, 62, 0},
+    {23, 58, 1}, {23, 56, 0}, {22, 51, 0}, {21, 46, 0}, {20, 42, 0}, {20, 39, 1},
+    {20, 36, 0}, {23, 32, 0}, {27, 32, 1}, {27, 27, 1}, {23, 27, 0}, {20, 23, 2},
+    {36, 29, 1}, {40, 29, 0}, {43, 34, 0}, {43, 37, 1}, {50, 37, 1}, {50, 34, 0},
+    {48, 28, 0}, {45, 24, 0}, {40, 22, 0}, {37, 22, 1}, {34, 22, 0}, {30, 24, 0},
+    {25, 26, 0}, {21, 27, 0}, {19, 27, 1}, {16, 27, 0}, {13, 23, 0}, {12, 20, 1},
+    {6, 20, 1}, {6, 23, 0}, {7, 28, 0}, {11, 32, 0}, {16, 34, 0}, {19, 34, 1},
+    {21, 34, 0}, {26, 33, 0}, {31, 31, 0}, {35, 29, 2},
+};
+
+const GFXoutlineGlyph OutlineSansGlyphs[] = {
+    {0, 0, 19}, // 0x20 ' '
+    {0, 34, 33}, // 0x21 '!'
+    {34, 22, 38}, // 0x22 '"'
+    {56, 66, 56}, // 0x23 '#'
+    {122, 79, 56}, // 0x24 '$'
+    {201, 90, 75}, // 0x25 '%'
+    {291, 76, 67}, // 0x26 '&'
+    {367, 11, 22}, // 0x27 '''
+    {378, 29, 29}, // 0x28 '('
+    {407, 28, 29}, // 0x29 ')'
+    {435, 49, 38}, // 0x2A '*'
+    {484, 12, 56}, // 0x2B '+'
+    {496, 31, 20}, // 0x2C ','
+    {527, 4, 33}, // 0x2D '-'
+    {531, 20, 20}, // 0x2E '.'
+    {551, 10, 36}, // 0x2F '/'
+    {561, 40, 56}, // 0x30 '0'
+    {601, 19, 56}, // 0x31 '1'
+    {620, 52, 56}, // 0x32 '2'
+    {672, 74, 56}, // 0x33 '3'
+    {746, 23, 56}, // 0x34 '4'
+    {769, 47, 56}, // 0x35 '5'
+    {816, 47, 56}, // 0x36 '6'
+    {863, 19, 56}, // 0x37 '7'
+    {882, 72, 56}, // 0x38 '8'
+    {954, 52, 56}, // 0x39 '9'
+    {1006, 40, 24}, // 0x3A ':'
+    {1046, 51, 24}, // 0x3B ';'
+    {1097, 19, 56}, // 0x3C '<'
+    {1116, 8, 56}, // 0x3D '='
+    {1124, 19, 56}, // 0x3E '>'
+    {1143, 60, 38}, // 0x3F '?'
+    {1203, 98, 79}, // 0x40 '@'
+    {1301, 22, 65}, // 0x41 'A'
+    {1323, 43, 62}, // 0x42 'B'
+    {1366, 47, 66}, // 0x43 'C'
+    {1413, 26, 72}, // 0x44 'D'
+    {1439, 12, 56}, // 0x45 'E'
+    {1451, 10, 54}, // 0x46 'F'
+    {1461, 53, 70}, // 0x47 'G'
+    {1514, 12, 73}, // 0x48 'H'
+    {1526, 4, 29}, // 0x49 'I'
+    {1530, 24, 43}, // 0x4A 'J'
+    {1554, 35, 65}, // 0x4B 'K'
+    {1589, 6, 49}, // 0x4C 'L'
+    {1595, 36, 88}, // 0x4D 'M'
+    {1631, 23, 73}, // 0x4E 'N'
+    {1654, 40, 77}, // 0x4F 'O'
+    {1694, 26, 59}, // 0x50 'P'
+    {1720, 49, 77}, // 0x51 'Q'
+    {1769, 36, 62}, // 0x52 'R'
+    {1805, 62, 51}, // 0x53 'S'
+    {1867, 8, 57}, // 0x54 'T'
+    {1875, 26, 70}, // 0x55 'U'
+    {1901, 19, 65}, // 0x56 'V'
+    {1920, 41, 98}, // 0x57 'W'
+    {1961, 28, 62}, // 0x58 'X'
+    {1989, 21, 60}, // 0x59 'Y'
+    {2010, 14, 60}, // 0x5A 'Z'
+    {2024, 14, 29}, // 0x5B '['
+    {2038, 10, 36}, // 0x5C 'backslash'
+    {2048, 14, 29}, // 0x5D ']'
+    {2062, 18, 56}, // 0x5E '^'
+    {2080, 4, 38}, // 0x5F '_'
+    {2084, 10, 29}, // 0x60 '`'
+    {2094, 58, 49}, // 0x61 'a'
+    {2152, 38, 54}, // 0x62 'b'
+    {2190, 43, 45}, // 0x63 'c'
+    {2233, 38, 54}, // 0x64 'd'
+    {2271, 46, 50}, // 0x65 'e'
+    {2317, 31, 32}, // 0x66 'f'
+    {2348, 94, 49}, // 0x67 'g'
+    {2442, 22, 53}, // 0x68 'h'
+    {2464, 24, 25}, // 0x69 'i'
+    {2488, 39, 24}, // 0x6A 'j'
+    {2527, 31, 50}, // 0x6B 'k'
+    {2558, 4, 25}, // 0x6C 'l'
+    {2562, 43, 79}, // 0x6D 'm'
+    {2605, 24, 53}, // 0x6E 'n'
+    {2629, 36, 53}, // 0x6F 'o'
+    {2665, 38, 53}, // 0x70 'p'
+    {2703, 38, 54}, // 0x71 'q'
+    {2741, 23, 39}, // 0x72 'r'
+    {2764, 61, 42}, // 0x73 's'
+    {2825, 34, 36}, // 0x74 't'
+    {2859, 24, 53}, // 0x75 'u'
+    {2883, 19, 49}, // 0x76 'v'
+    {2902, 47, 74}, // 0x77 'w'
+    {2949, 28, 48}, // 0x78 'x'
+    {2977, 23, 49}, // 0x79 'y'
+    {3000, 16, 44}, // 0x7A 'z'
+    {3016, 65, 29}, // 0x7B '{'
+    {3081, 4, 29}, // 0x7C '|'
+    {3085, 65, 29}, // 0x7D '}'
+    {3150, 28, 56}, // 0x7E '~'
+};
+
+const GFXoutlineFont OutlineSans = {
+    OutlineSansPoints, OutlineSansGlyphs, 0x20, 0x7E, 96, 95, -20};
+
+#endif // OUTLINESANS_H
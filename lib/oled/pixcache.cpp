@@ -0,0 +1,125 @@
+// Write-combining pixel cache for framebuffer-less mode
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Pixels are appended to a small buffer as long as they continue the current
+// window in panel (row-major) order:
+// - horizontal run: (x0 + n, y0)
+// - vertical run:   (x0, y0 + n)  - a window 1 pixel wide
+// - rectangle:      a horizontal run that wraps back to x0 on the next row
+// Anything else closes the window and starts a new one.
+
+#include "pixcache.h"
+#include "readcache.h"
+#include "pico/stdlib.h"
+#include "st7789.h"
+
+enum
+{
+    PC_EMPTY,  // nothing pending
+    PC_SINGLE, // one pixel, direction not yet known
+    PC_HRUN,   // single row, width still growing
+    PC_VRUN,   // single column, height still growing
+    PC_RECT    // width fixed, filling rows in order
+};
+
+static uint16_t pcBuf[PIXCACHE_SIZE];
+static uint16_t pcCount = 0;
+static uint8_t pcMode = PC_EMPTY;
+static int16_t pcX, pcY; // window origin
+static uint16_t pcW, pcH;
+
+static PixCacheStats pcStats = {0, 0};
+
+void LCD_cacheFlush()
+{
+    if (pcMode == PC_EMPTY)
+        return;
+
+    if (pcMode == PC_RECT)
+    {
+        // Full rows first, then the partial last row as its own window
+        uint16_t rows = pcCount / pcW;
+        uint16_t rest = pcCount % pcW;
+        LCD_WriteBitmap(pcX, pcY, pcW, rows, pcBuf);
+        pcStats.windows++;
+        if (rest)
+        {
+            LCD_WriteBitmap(pcX, pcY + rows, rest, 1, pcBuf + rows * pcW);
+            pcStats.windows++;
+        }
+    }
+    else
+    {
+        LCD_WriteBitmap(pcX, pcY, pcW, pcH, pcBuf);
+        pcStats.windows++;
+    }
+
+    pcCount = 0;
+    pcMode = PC_EMPTY;
+}
+
+void __time_critical_func(LCD_cachePixel)(int16_t x, int16_t y, uint16_t col)
+{
+    pcStats.pixels++;
+    LCD_readCacheFill(x, y, 1, 1, col); // Reads must see queued pixels
+
+    switch (pcMode)
+    {
+    case PC_SINGLE:
+        if (x == pcX + 1 && y == pcY)
+        {
+            pcMode = PC_HRUN;
+            pcW = 2;
+        }
+        else if (x == pcX && y == pcY + 1)
+        {
+            pcMode = PC_VRUN;
+            pcH = 2;
+        }
+        else
+            LCD_cacheFlush();
+        break;
+    case PC_HRUN:
+        if (y == pcY && x == pcX + pcW)
+            pcW++;
+        else if (x == pcX && y == pcY + 1)
+            pcMode = PC_RECT; // run wrapped: width is now fixed
+        else
+            LCD_cacheFlush();
+        break;
+    case PC_VRUN:
+        if (x == pcX && y == pcY + pcH)
+            pcH++;
+        else
+            LCD_cacheFlush();
+        break;
+    case PC_RECT:
+        if (x != pcX + (pcCount % pcW) || y != pcY + (pcCount / pcW))
+            LCD_cacheFlush();
+        break;
+    }
+
+    if (pcMode == PC_EMPTY)
+    {
+        pcMode = PC_SINGLE;
+        pcX = x;
+        pcY = y;
+        pcW = pcH = 1;
+    }
+
+    pcBuf[pcCount++] = col;
+
+    if (pcCount == PIXCACHE_SIZE)
+        LCD_cacheFlush();
+}
+
+void LCD_getCacheStats(PixCacheStats *stats)
+{
+    *stats = pcStats;
+}
+
+void LCD_resetCacheStats()
+{
+    pcStats.pixels = 0;
+    pcStats.windows = 0;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file pixcache.h
+ * @brief Write-combining pixel cache for framebuffer-less (direct) mode
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Without a framebuffer every GFX_drawPixel() used to become a complete
+ * CASET/RASET/RAMWR transaction for a single 2-byte pixel. This layer sits
+ * between gfx.cpp and st7789.cpp and merges consecutive pixel writes that form
+ * horizontal runs, vertical runs or small row-major rectangles into a single
+ * window write. Pending pixels are sent when the run breaks, the buffer fills
+ * or the frame ends (GFX_flush()).
+ */
+
+#ifndef PIXCACHE_H
+#define PIXCACHE_H
+
+#include <stdint.h>
+
+/** @brief Number of pixels buffered before a forced window write */
+#ifndef PIXCACHE_SIZE
+#define PIXCACHE_SIZE 64
+#endif
+
+/** @brief Write-combining statistics (since the last LCD_resetCacheStats()) */
+typedef struct
+{
+    uint32_t pixels;  ///< Pixels pushed through LCD_cachePixel()
+    uint32_t windows; ///< Window transactions actually sent to the panel
+} PixCacheStats;
+
+/**
+ * @brief Queue one pixel for the panel, merging it with the pending run if possible
+ * @param x X coordinate (must already be clipped to the display)
+ * @param y Y coordinate (must already be clipped to the display)
+ * @param col 16-bit RGB565 color value
+ */
+void LCD_cachePixel(int16_t x, int16_t y, uint16_t col);
+
+/**
+ * @brief Send any pending pixels to the panel
+ * @note Called by GFX_flush() and before anything that changes the address mapping
+ */
+void LCD_cacheFlush();
+
+/**
+ * @brief Read the write-combining statistics
+ * @param stats Destination for the counters
+ */
+void LCD_getCacheStats(PixCacheStats *stats);
+
+/**
+ * @brief Reset the write-combining statistics
+ */
+void LCD_resetCacheStats();
+
+#endif
@@ -0,0 +1,133 @@
+// Tile cache over panel readback
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Tiles sit on a READCACHE_TILE_W x READCACHE_TILE_H grid. A miss flushes
+// the write-combining cache (so the panel holds every queued pixel), then
+// reads the tile with one RAMRD window into the least recently used slot.
+// Writes are applied to overlapping tiles as they happen, which keeps hits
+// exact without ever invalidating on write.
+
+#include "readcache.h"
+#include "pixcache.h"
+#include "pico/stdlib.h"
+#include "st7789.h"
+
+extern uint16_t _width;  ///< Display width as modified by current rotation
+extern uint16_t _height; ///< Display height as modified by current rotation
+
+typedef struct
+{
+    int16_t x, y;   // Top-left pixel of the tile, -1 when the slot is empty
+    uint16_t w, h;  // Tile size, clipped at the right and bottom edges
+    uint32_t used;  // Last use, for LRU replacement
+    uint16_t px[READCACHE_TILE_W * READCACHE_TILE_H];
+} ReadTile;
+
+static ReadTile rcTiles[READCACHE_TILES];
+static uint8_t rcValid = 0; // Slots holding a tile; 0 makes the write hooks free
+static uint32_t rcClock = 0;
+static ReadCacheStats rcStats = {0, 0, 0};
+static bool rcInit = false;
+
+static void rcReset()
+{
+    for (uint8_t i = 0; i < READCACHE_TILES; i++)
+        rcTiles[i].x = -1;
+    rcValid = 0;
+    rcInit = true;
+}
+
+uint16_t LCD_readPixelCached(int16_t x, int16_t y)
+{
+    if (!rcInit)
+        rcReset();
+
+    int16_t tx = x - x % READCACHE_TILE_W, ty = y - y % READCACHE_TILE_H;
+    ReadTile *slot = &rcTiles[0];
+    for (uint8_t i = 0; i < READCACHE_TILES; i++)
+    {
+        ReadTile *t = &rcTiles[i];
+        if (t->x == tx && t->y == ty)
+        {
+            t->used = ++rcClock;
+            rcStats.hits++;
+            return t->px[(y - ty) * t->w + (x - tx)];
+        }
+        if (t->x < 0 || (slot->x >= 0 && t->used < slot->used))
+            slot = t;
+    }
+
+    if (!LCD_canRead())
+        return 0;
+
+    LCD_cacheFlush(); // The panel must hold every queued pixel before it is read
+    uint16_t w = _width - tx < READCACHE_TILE_W ? _width - tx : READCACHE_TILE_W;
+    uint16_t h = _height - ty < READCACHE_TILE_H ? _height - ty : READCACHE_TILE_H;
+    if (slot->x < 0)
+        rcValid++;
+    slot->x = -1;
+    if (!LCD_ReadBitmap(tx, ty, w, h, slot->px))
+    {
+        rcValid--;
+        return 0;
+    }
+    slot->x = tx;
+    slot->y = ty;
+    slot->w = w;
+    slot->h = h;
+    slot->used = ++rcClock;
+    rcStats.misses++;
+    rcStats.pixelsRead += w * h;
+    return slot->px[(y - ty) * w + (x - tx)];
+}
+
+// Apply a write to every tile it overlaps; bitmap NULL means a solid fill
+static void rcWrite(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap, uint16_t col)
+{
+    if (rcValid == 0)
+        return;
+
+    for (uint8_t i = 0; i < READCACHE_TILES; i++)
+    {
+        ReadTile *t = &rcTiles[i];
+        if (t->x < 0)
+            continue;
+        int16_t x0 = x > t->x ? x : t->x;
+        int16_t y0 = y > t->y ? y : t->y;
+        int16_t x1 = x + w < t->x + t->w ? x + w : t->x + t->w;
+        int16_t y1 = y + h < t->y + t->h ? y + h : t->y + t->h;
+        for (int16_t row = y0; row < y1; row++)
+        {
+            uint16_t *dst = &t->px[(row - t->y) * t->w];
+            for (int16_t c = x0; c < x1; c++)
+                dst[c - t->x] = bitmap ? bitmap[(row - y) * w + (c - x)] : col;
+        }
+    }
+}
+
+void LCD_readCacheUpdate(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap)
+{
+    rcWrite(x, y, w, h, bitmap, 0);
+}
+
+void LCD_readCacheFill(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t col)
+{
+    rcWrite(x, y, w, h, NULL, col);
+}
+
+void LCD_readCacheInvalidate()
+{
+    rcReset();
+}
+
+void LCD_getReadCacheStats(ReadCacheStats *stats)
+{
+    *stats = rcStats;
+}
+
+void LCD_resetReadCacheStats()
+{
+    rcStats.hits = 0;
+    rcStats.misses = 0;
+    rcStats.pixelsRead = 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file readcache.h
+ * @brief Tile cache over panel readback for framebuffer-less (direct) mode
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * Reading the panel (RAMRD) costs a window setup, a bus turnaround and three
+ * bytes per pixel, so read-modify-write drawing such as blending reads whole
+ * tiles at once and keeps a few of them. Every write to the panel, queued or
+ * sent, also updates the cached tiles it overlaps, so a tile never goes
+ * stale and repeated blends over the same area only read the panel once.
+ * Needs read wiring, see LCD_setReadMode().
+ */
+
+#ifndef READCACHE_H
+#define READCACHE_H
+
+#include <stdint.h>
+
+/** @brief Tile width in pixels; tiles are wide because drawing scans rows */
+#ifndef READCACHE_TILE_W
+#define READCACHE_TILE_W 32
+#endif
+
+/** @brief Tile height in pixels */
+#ifndef READCACHE_TILE_H
+#define READCACHE_TILE_H 8
+#endif
+
+/** @brief Number of tiles kept (READCACHE_TILE_W * READCACHE_TILE_H * 2 bytes each) */
+#ifndef READCACHE_TILES
+#define READCACHE_TILES 4
+#endif
+
+/** @brief Read cache statistics (since the last LCD_resetReadCacheStats()) */
+typedef struct
+{
+    uint32_t hits;       ///< Pixels served from a cached tile
+    uint32_t misses;     ///< Tiles read from the panel
+    uint32_t pixelsRead; ///< Pixels read from the panel
+} ReadCacheStats;
+
+/**
+ * @brief Read one pixel, loading its tile from the panel on a miss
+ * @param x X coordinate (must already be clipped to the display)
+ * @param y Y coordinate (must already be clipped to the display)
+ * @return RGB565 color, or 0 if the panel cannot be read
+ */
+uint16_t LCD_readPixelCached(int16_t x, int16_t y);
+
+/**
+ * @brief Keep cached tiles in step with a bitmap written to the panel
+ * @note Called by the driver; only needed when writing around it
+ */
+void LCD_readCacheUpdate(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap);
+
+/**
+ * @brief Keep cached tiles in step with a window filled on the panel
+ * @note Called by the driver and the write-combining cache
+ */
+void LCD_readCacheFill(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t col);
+
+/**
+ * @brief Drop every cached tile
+ * @note Called when the address mapping or read wiring changes
+ */
+void LCD_readCacheInvalidate();
+
+/**
+ * @brief Read the read cache statistics
+ * @param stats Destination for the counters
+ */
+void LCD_getReadCacheStats(ReadCacheStats *stats);
+
+/**
+ * @brief Reset the read cache statistics
+ */
+void LCD_resetReadCacheStats();
+
+#endif
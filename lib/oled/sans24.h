@@ -0,0 +1,304 @@
+// Sans24 24 px, 1 bpp, converted with tools/ttf2aafont.py
+// 95 glyphs, 2269 bitmap bytes
+// Source font: Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1.
+// Renamed on conversion, as the source license requires for modified versions
+
+#ifndef SANS24_H
+#define SANS24_H
+
+#include "gfxfont.h"
+
+const uint8_t Sans24Bitmaps[] = {
+    0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x06, 0x76, 0x00, 0x00, 0xCD,
+    0x9B, 0x36, 0x6C, 0xD1, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x62, 0x01, 0x98,
+    0x0C, 0x60, 0x31, 0x87, 0xFF, 0x8F, 0xFC, 0x0C, 0xC0, 0x23, 0x01, 0x8C,
+    0x1F, 0xFC, 0x7F, 0xF0, 0x62, 0x01, 0x18, 0x0C, 0x60, 0x31, 0x80, 0xC6,
+    0x00, 0x01, 0x00, 0x30, 0x03, 0x01, 0xFC, 0x3F, 0xE7, 0x22, 0x62, 0x06,
+    0x20, 0x62, 0x07, 0xA0, 0x3F, 0x00, 0xFC, 0x07, 0xE0, 0x67, 0x06, 0x30,
+    0x63, 0x06, 0x66, 0x66, 0x7F, 0xC3, 0xF8, 0x04, 0x00, 0x40, 0x04, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0xC6, 0x30, 0x31, 0x84, 0x18, 0x61, 0x8C, 0x18,
+    0x66, 0x06, 0x11, 0x81, 0xCC, 0xC0, 0x3E, 0x60, 0x00, 0x30, 0x00, 0x0C,
+    0xF8, 0x06, 0x66, 0x03, 0x10, 0xC1, 0x8C, 0x30, 0x63, 0x0C, 0x30, 0x43,
+    0x18, 0x19, 0x8C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03,
+    0x9C, 0x01, 0x86, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x1C, 0x00,
+    0x0E, 0x00, 0x0F, 0x83, 0x0C, 0x61, 0x8E, 0x18, 0xC6, 0x06, 0xC3, 0x01,
+    0xE1, 0x80, 0xE0, 0xE0, 0x78, 0x3F, 0xE6, 0x0F, 0xE1, 0x80, 0x00, 0x00,
+    0x0D, 0xB6, 0xD0, 0x00, 0x61, 0x8C, 0x31, 0x86, 0x18, 0x61, 0x86, 0x38,
+    0x61, 0x86, 0x18, 0x61, 0x83, 0x0C, 0x18, 0x60, 0x00, 0x01, 0x86, 0x0C,
+    0x30, 0x61, 0x86, 0x18, 0x61, 0xC7, 0x1C, 0x61, 0x86, 0x18, 0x63, 0x0C,
+    0x61, 0x80, 0x00, 0x00, 0x10, 0x10, 0x76, 0x38, 0x7C, 0xD2, 0x10, 0x10,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x4E, 0xE2, 0x4C, 0x00, 0x01, 0xFB,
+    0xF0, 0x4E, 0xE0, 0x00, 0x40, 0x18, 0x06, 0x00, 0xC0, 0x10, 0x06, 0x00,
+    0xC0, 0x30, 0x06, 0x00, 0x80, 0x30, 0x06, 0x01, 0x80, 0x30, 0x04, 0x01,
+    0x80, 0x30, 0x0C, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFE,
+    0x0E, 0x1C, 0x30, 0x31, 0x80, 0xE6, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80,
+    0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0xC0, 0xE3, 0x03, 0x0E, 0x1C, 0x1F,
+    0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x1F, 0x07, 0x60,
+    0xCC, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+    0x01, 0x80, 0x30, 0x3F, 0xEF, 0xFC, 0x00, 0x01, 0xF8, 0x3F, 0xC7, 0x06,
+    0x60, 0x64, 0x06, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+    0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFC,
+    0x3F, 0xE7, 0x06, 0x60, 0x66, 0x07, 0x00, 0x60, 0x0E, 0x03, 0xC0, 0x7C,
+    0x00, 0xE0, 0x07, 0x00, 0x34, 0x03, 0x60, 0x77, 0x06, 0x3F, 0xC1, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0E, 0x00, 0x78, 0x03, 0x60, 0x19,
+    0x80, 0x66, 0x03, 0x18, 0x18, 0x60, 0xE1, 0x83, 0x06, 0x18, 0x18, 0x7F,
+    0xFD, 0xFF, 0xE0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x03,
+    0xFE, 0x3F, 0xC3, 0x00, 0x30, 0x03, 0x00, 0x20, 0x07, 0xF0, 0x7F, 0xC0,
+    0x0E, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x64, 0x0C, 0x7F, 0xC3,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x70, 0x0E, 0x00, 0xC0,
+    0x18, 0x03, 0xB0, 0x7F, 0xC7, 0x0E, 0x60, 0x7E, 0x03, 0xC0, 0x3E, 0x03,
+    0x60, 0x76, 0x06, 0x3F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xBF,
+    0xFC, 0x00, 0xC0, 0x06, 0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0x80, 0x1C,
+    0x00, 0xC0, 0x0E, 0x00, 0x60, 0x07, 0x00, 0x30, 0x03, 0x80, 0x18, 0x01,
+    0x80, 0x00, 0x00, 0x01, 0xF8, 0x39, 0xC6, 0x06, 0x60, 0x66, 0x06, 0x60,
+    0x67, 0x0E, 0x3F, 0xC3, 0xFC, 0x70, 0xEE, 0x06, 0xE0, 0x7C, 0x07, 0xE0,
+    0x76, 0x06, 0x7F, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE7,
+    0x06, 0x60, 0x36, 0x03, 0x60, 0x36, 0x07, 0x70, 0x73, 0xFE, 0x1F, 0xE0,
+    0x0C, 0x01, 0x80, 0x38, 0x07, 0x00, 0x60, 0x0C, 0x01, 0xC0, 0x67, 0x60,
+    0x00, 0x00, 0x06, 0x76, 0x00, 0x67, 0x60, 0x00, 0x00, 0x06, 0x77, 0x26,
+    0x40, 0x00, 0x00, 0x18, 0x0F, 0x07, 0x81, 0xC0, 0xE0, 0x1E, 0x00, 0xF0,
+    0x07, 0x80, 0x38, 0x01, 0x00, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x00, 0x00,
+    0x7F, 0xE7, 0xFE, 0x00, 0x0C, 0x01, 0xE0, 0x0E, 0x00, 0xF0, 0x07, 0x80,
+    0xF0, 0x78, 0x3C, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0x78,
+    0x06, 0x01, 0x80, 0x60, 0x38, 0x1C, 0x0E, 0x07, 0x01, 0x80, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0xE0, 0xE0, 0x60, 0x0C, 0x30, 0x01, 0x98, 0x00, 0x64, 0x1F, 0x8B,
+    0x0E, 0x63, 0xC6, 0x18, 0xF1, 0x84, 0x3C, 0x41, 0x0F, 0x10, 0xC2, 0xC6,
+    0x31, 0x91, 0xF7, 0xC6, 0x38, 0xC1, 0x80, 0x00, 0x30, 0x00, 0x07, 0x00,
+    0xC0, 0xFF, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+    0x78, 0x00, 0x76, 0x00, 0x33, 0x00, 0x19, 0xC0, 0x1C, 0x60, 0x0C, 0x30,
+    0x0E, 0x0C, 0x06, 0x06, 0x03, 0xFF, 0x83, 0xFF, 0xC1, 0x80, 0x61, 0xC0,
+    0x38, 0xC0, 0x0C, 0x60, 0x07, 0x70, 0x01, 0x80, 0x00, 0x07, 0xFC, 0x3F,
+    0xF9, 0xC0, 0xCE, 0x07, 0x70, 0x3B, 0x81, 0x9C, 0x0C, 0xFF, 0xC7, 0xFE,
+    0x38, 0x39, 0xC0, 0xEE, 0x03, 0x70, 0x1B, 0x80, 0xDC, 0x0E, 0xFF, 0xE7,
+    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF1, 0xC0, 0x67, 0x00, 0x0C,
+    0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+    0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1E, 0x06, 0x1F, 0xFC, 0x0F, 0xE0,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0xC7, 0x01, 0xCE, 0x01, 0xDC,
+    0x01, 0xB8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00,
+    0x7E, 0x00, 0xFC, 0x01, 0xB8, 0x07, 0x70, 0x3C, 0xFF, 0xF1, 0xFF, 0x80,
+    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF,
+    0x9F, 0xF3, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF, 0xFF,
+    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+    0xE0, 0x1F, 0xFB, 0xFE, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
+    0x1C, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xFE, 0x38, 0x0E, 0x70, 0x00,
+    0x60, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x3E,
+    0xE0, 0x3E, 0x60, 0x06, 0x70, 0x06, 0x70, 0x06, 0x3C, 0x0E, 0x1F, 0xFE,
+    0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1B, 0x80, 0x37, 0x00, 0x6E,
+    0x00, 0xDC, 0x01, 0xB8, 0x03, 0x70, 0x06, 0xFF, 0xFD, 0xFF, 0xFB, 0x80,
+    0x37, 0x00, 0x6E, 0x00, 0xDC, 0x01, 0xB8, 0x03, 0x70, 0x06, 0xE0, 0x0D,
+    0xC0, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xC0,
+    0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+    0x1C, 0x0C, 0x0E, 0x7E, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x73, 0x81,
+    0xC7, 0x03, 0x0E, 0x0C, 0x1C, 0x30, 0x38, 0xE0, 0x73, 0x80, 0xFE, 0x01,
+    0xFC, 0x03, 0x9C, 0x07, 0x1C, 0x0E, 0x18, 0x1C, 0x38, 0x38, 0x38, 0x70,
+    0x38, 0xE0, 0x39, 0xC0, 0x38, 0x00, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38,
+    0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03,
+    0x80, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x7E, 0x00, 0x1F, 0xC0,
+    0x0F, 0xF8, 0x03, 0xF6, 0x01, 0xBD, 0xC0, 0xEF, 0x30, 0x33, 0xCE, 0x1C,
+    0xF1, 0x86, 0x3C, 0x33, 0x8F, 0x0C, 0xC3, 0xC1, 0xF0, 0xF0, 0x78, 0x3C,
+    0x0C, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x01, 0x80,
+    0x1B, 0x80, 0x37, 0x80, 0x6F, 0x80, 0xDB, 0x01, 0xB7, 0x03, 0x67, 0x06,
+    0xC7, 0x0D, 0x86, 0x1B, 0x06, 0x36, 0x0E, 0x6C, 0x0E, 0xD8, 0x0F, 0xB0,
+    0x0F, 0x60, 0x1E, 0xC0, 0x1D, 0x80, 0x18, 0x00, 0x80, 0x03, 0xFE, 0x01,
+    0xFF, 0xC0, 0xE0, 0x38, 0x70, 0x07, 0x18, 0x00, 0xCE, 0x00, 0x3B, 0x80,
+    0x0E, 0xE0, 0x01, 0xB8, 0x00, 0x6E, 0x00, 0x1B, 0x80, 0x0E, 0x60, 0x03,
+    0x9C, 0x00, 0xC7, 0x00, 0x70, 0xF0, 0x78, 0x1F, 0xFC, 0x01, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xCE, 0x0E, 0xE0, 0x7E, 0x07, 0xE0,
+    0x7E, 0x07, 0xE0, 0x6E, 0x1E, 0xFF, 0xCF, 0xE0, 0xE0, 0x0E, 0x00, 0xE0,
+    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x80, 0x03, 0xFE, 0x01, 0xFF, 0xC0,
+    0xE0, 0x38, 0x70, 0x07, 0x18, 0x00, 0xCE, 0x00, 0x3B, 0x80, 0x0E, 0xE0,
+    0x01, 0xB8, 0x00, 0x6E, 0x00, 0x1B, 0x80, 0x0E, 0x60, 0x03, 0x9C, 0x00,
+    0xC7, 0x00, 0x70, 0xF0, 0x78, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xE0,
+    0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x60, 0x00, 0x03, 0xFE, 0x0F, 0xFC,
+    0x38, 0x38, 0xE0, 0x63, 0x81, 0xCE, 0x06, 0x38, 0x18, 0xE0, 0xE3, 0xFF,
+    0x0F, 0xF0, 0x38, 0xC0, 0xE3, 0x83, 0x87, 0x0E, 0x0C, 0x38, 0x18, 0xE0,
+    0x73, 0x80, 0xE0, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0x02, 0x70, 0x07, 0x00,
+    0x30, 0x03, 0xC0, 0x1F, 0x00, 0xFC, 0x01, 0xE0, 0x07, 0x00, 0x30, 0x03,
+    0x00, 0x77, 0x06, 0x7F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
+    0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+    0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0x1D, 0x80, 0x3B, 0x00, 0x76,
+    0x00, 0xEC, 0x01, 0xD8, 0x03, 0xB0, 0x07, 0x60, 0x0E, 0xC0, 0x1D, 0x80,
+    0x3B, 0x00, 0x76, 0x00, 0xEE, 0x01, 0x8C, 0x07, 0x1C, 0x1C, 0x1F, 0xF0,
+    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x98, 0x01, 0xCE, 0x00,
+    0xC3, 0x00, 0xE1, 0x80, 0x60, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x18, 0x06,
+    0x1C, 0x03, 0x0C, 0x01, 0xCE, 0x00, 0x66, 0x00, 0x3B, 0x00, 0x0F, 0x80,
+    0x07, 0x80, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C,
+    0x01, 0x98, 0x07, 0x01, 0xCE, 0x07, 0x80, 0xC7, 0x03, 0xC0, 0x61, 0x81,
+    0xB0, 0x70, 0xC1, 0x98, 0x38, 0x70, 0xCC, 0x18, 0x18, 0x63, 0x0C, 0x0C,
+    0x61, 0x8E, 0x07, 0x30, 0xE6, 0x03, 0x98, 0x33, 0x00, 0xD8, 0x1B, 0x80,
+    0x7C, 0x0F, 0x80, 0x3E, 0x03, 0xC0, 0x0E, 0x01, 0xE0, 0x07, 0x00, 0xE0,
+    0x03, 0x80, 0x30, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x30, 0x1C, 0x38, 0x18,
+    0x1C, 0x38, 0x0C, 0x70, 0x0E, 0x60, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x07, 0xC0, 0x0E, 0xE0, 0x0C, 0x70, 0x1C, 0x30, 0x38, 0x38, 0x30, 0x1C,
+    0x70, 0x0C, 0xE0, 0x0E, 0x00, 0x00, 0xE0, 0x0E, 0x70, 0x1C, 0x30, 0x18,
+    0x38, 0x38, 0x18, 0x30, 0x0C, 0x70, 0x0E, 0x60, 0x06, 0xC0, 0x07, 0xC0,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0xFF, 0xE7, 0xFF, 0x80, 0x1C, 0x00,
+    0x60, 0x03, 0x80, 0x1C, 0x00, 0x60, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x03,
+    0x00, 0x1C, 0x00, 0xE0, 0x03, 0x00, 0x1C, 0x00, 0xFF, 0xFB, 0xFF, 0xE0,
+    0x79, 0xE6, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18,
+    0x61, 0x86, 0x18, 0x61, 0xE7, 0x80, 0x40, 0x0C, 0x00, 0x80, 0x18, 0x03,
+    0x00, 0x30, 0x06, 0x00, 0x40, 0x0C, 0x01, 0x80, 0x18, 0x03, 0x00, 0x20,
+    0x06, 0x00, 0xC0, 0x0C, 0x01, 0x80, 0x10, 0x03, 0x00, 0x00, 0xF7, 0xC6,
+    0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0xFF,
+    0xC0, 0x00, 0x00, 0xC0, 0x3C, 0x07, 0x81, 0x98, 0x33, 0x0C, 0x33, 0x86,
+    0x20, 0x40, 0x00, 0x3F, 0xFF, 0xF8, 0x41, 0xC3, 0x06, 0x00, 0x00, 0x0F,
+    0xC7, 0x39, 0x06, 0x01, 0xC0, 0x70, 0xFC, 0xFF, 0x61, 0xF0, 0x7C, 0x1F,
+    0x9F, 0x7C, 0xC0, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x6F, 0xC7, 0x9E, 0x70, 0x66, 0x06, 0x60, 0x76, 0x07, 0x60, 0x76,
+    0x06, 0x60, 0x66, 0x0E, 0x7F, 0xC6, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8,
+    0xF3, 0x18, 0x07, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0E, 0x00, 0xC1,
+    0x1F, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x70, 0x07, 0x00,
+    0x70, 0x07, 0x1F, 0xF3, 0x8F, 0x30, 0x76, 0x07, 0x60, 0x76, 0x07, 0x60,
+    0x76, 0x07, 0x60, 0x77, 0x07, 0x3F, 0xF1, 0xF3, 0x00, 0x00, 0x00, 0x01,
+    0xFC, 0x38, 0xE3, 0x06, 0x60, 0x27, 0xFF, 0x7F, 0xE6, 0x00, 0x60, 0x07,
+    0x00, 0x30, 0x21, 0xFE, 0x0F, 0xC0, 0x00, 0x02, 0x0F, 0x1C, 0x38, 0x30,
+    0x30, 0xFF, 0x7F, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x00, 0x01, 0xFF, 0x39, 0xF6, 0x0C, 0x60, 0xE6, 0x0C, 0x30, 0xC1,
+    0xF8, 0x36, 0x03, 0x00, 0x3F, 0x03, 0xFE, 0x60, 0x66, 0x03, 0x60, 0x67,
+    0x0E, 0x3F, 0xC0, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0,
+    0x1B, 0xE3, 0xCE, 0x60, 0xEC, 0x0D, 0x81, 0xB0, 0x36, 0x06, 0xC0, 0xD8,
+    0x1B, 0x03, 0x60, 0x6C, 0x0C, 0x06, 0x60, 0x00, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x00, 0x61, 0x80, 0x00, 0x01, 0x86, 0x18, 0x61, 0x86, 0x18,
+    0x61, 0x86, 0x18, 0x61, 0x86, 0x3B, 0xC0, 0x00, 0x60, 0x06, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xC6, 0x18, 0x63, 0x06, 0x60, 0x6E,
+    0x07, 0xC0, 0x6E, 0x06, 0x70, 0x63, 0x06, 0x18, 0x60, 0xC6, 0x0E, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x1B, 0xC7,
+    0xC7, 0xBB, 0x79, 0x83, 0x86, 0x60, 0xC1, 0x98, 0x30, 0x66, 0x0C, 0x19,
+    0x83, 0x06, 0x60, 0xC1, 0x98, 0x30, 0x66, 0x0C, 0x19, 0x83, 0x06, 0x60,
+    0xC1, 0x80, 0x00, 0x0D, 0xF1, 0xE7, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B,
+    0x03, 0x60, 0x6C, 0x0D, 0x81, 0xB0, 0x36, 0x06, 0x00, 0x00, 0xFE, 0x0F,
+    0x38, 0x60, 0xE6, 0x03, 0x30, 0x19, 0x80, 0xEC, 0x07, 0x60, 0x33, 0x81,
+    0x8C, 0x1C, 0x7F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x79, 0xC7,
+    0x0E, 0x60, 0x66, 0x06, 0x60, 0x76, 0x07, 0x60, 0x66, 0x06, 0x60, 0xE7,
+    0xFC, 0x6F, 0x86, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01,
+    0xFB, 0x38, 0xF3, 0x07, 0x60, 0x76, 0x07, 0x60, 0x76, 0x07, 0x60, 0x76,
+    0x07, 0x70, 0x73, 0xFF, 0x1F, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70,
+    0x00, 0x00, 0x37, 0x9F, 0xCE, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30,
+    0x18, 0x0C, 0x06, 0x00, 0x00, 0x0F, 0xE7, 0x19, 0x80, 0x60, 0x1E, 0x03,
+    0xE0, 0x3E, 0x01, 0x80, 0x60, 0x19, 0xCE, 0x3F, 0x00, 0x00, 0x00, 0x0C,
+    0x06, 0x03, 0x01, 0x83, 0xF9, 0xFC, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,
+    0x81, 0xC0, 0xE0, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x83, 0xF0,
+    0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1D, 0x83, 0xBF, 0xF3,
+    0xE6, 0x00, 0x00, 0x00, 0x07, 0x01, 0x98, 0x18, 0xE0, 0xC3, 0x0E, 0x18,
+    0x60, 0xE3, 0x03, 0x30, 0x19, 0x80, 0x6C, 0x03, 0xC0, 0x0E, 0x00, 0x60,
+    0x00, 0x00, 0x00, 0x1C, 0x18, 0x19, 0x83, 0x83, 0x30, 0xF0, 0xC6, 0x1A,
+    0x18, 0x63, 0x63, 0x0C, 0xCC, 0xC1, 0x98, 0x98, 0x1B, 0x1B, 0x03, 0xC3,
+    0xC0, 0x78, 0x78, 0x07, 0x07, 0x00, 0xC0, 0xC0, 0x00, 0x06, 0x06, 0x30,
+    0xC3, 0x9C, 0x19, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x1F, 0x81, 0x98, 0x30,
+    0xC7, 0x0E, 0x60, 0x60, 0x00, 0x07, 0x01, 0x98, 0x18, 0xE0, 0xC3, 0x0E,
+    0x18, 0x60, 0x63, 0x03, 0x30, 0x1D, 0x80, 0x78, 0x03, 0xC0, 0x0E, 0x00,
+    0x60, 0x03, 0x00, 0x30, 0x01, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xF8, 0xFF, 0x00, 0xC0, 0x38, 0x0E, 0x01, 0x80, 0x60, 0x1C, 0x07, 0x00,
+    0xC0, 0x3F, 0xE7, 0xFC, 0x04, 0x38, 0xC1, 0x87, 0x06, 0x0C, 0x18, 0x30,
+    0x60, 0xC7, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x61, 0xC1, 0x83, 0x03, 0x81,
+    0x00, 0x4D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xD8, 0x83, 0x83,
+    0x06, 0x18, 0x63, 0x0C, 0x30, 0xC1, 0x87, 0x18, 0xC3, 0x0C, 0x30, 0x61,
+    0x86, 0x33, 0xC8, 0x00, 0x00, 0x01, 0x83, 0x7E, 0x66, 0x7E, 0xC0, 0x00,
+    0x00,
+};
+
+const GFXglyph Sans24Glyphs[] = {
+    {0, 0, 0, 5, 0, 0}, // 0x20 ' '
+    {0, 4, 19, 8, 2, -18}, // 0x21 '!'
+    {10, 7, 7, 10, 1, -18}, // 0x22 '"'
+    {17, 14, 18, 14, 0, -18}, // 0x23 '#'
+    {49, 12, 23, 14, 1, -20}, // 0x24 '$'
+    {84, 18, 19, 19, 0, -18}, // 0x25 '%'
+    {127, 17, 19, 17, 0, -18}, // 0x26 '&'
+    {168, 3, 7, 6, 1, -18}, // 0x27 '''
+    {171, 6, 23, 7, 1, -19}, // 0x28 '('
+    {189, 6, 23, 7, 0, -19}, // 0x29 ')'
+    {207, 8, 9, 10, 1, -19}, // 0x2A '*'
+    {216, 12, 12, 14, 1, -14}, // 0x2B '+'
+    {234, 4, 7, 5, 1, -3}, // 0x2C ','
+    {238, 7, 3, 8, 1, -9}, // 0x2D '-'
+    {241, 4, 4, 5, 1, -3}, // 0x2E '.'
+    {243, 11, 20, 9, -1, -18}, // 0x2F '/'
+    {271, 14, 19, 14, 0, -18}, // 0x30 '0'
+    {305, 11, 18, 14, 2, -18}, // 0x31 '1'
+    {330, 12, 18, 14, 1, -18}, // 0x32 '2'
+    {357, 12, 19, 14, 1, -18}, // 0x33 '3'
+    {386, 14, 18, 14, 0, -18}, // 0x34 '4'
+    {418, 12, 19, 14, 1, -18}, // 0x35 '5'
+    {447, 12, 19, 14, 1, -18}, // 0x36 '6'
+    {476, 13, 18, 14, 1, -18}, // 0x37 '7'
+    {506, 12, 19, 14, 1, -18}, // 0x38 '8'
+    {535, 12, 18, 14, 1, -18}, // 0x39 '9'
+    {562, 4, 13, 6, 1, -12}, // 0x3A ':'
+    {569, 4, 16, 6, 1, -12}, // 0x3B ';'
+    {577, 11, 12, 14, 1, -14}, // 0x3C '<'
+    {594, 12, 6, 14, 1, -11}, // 0x3D '='
+    {603, 11, 12, 14, 2, -14}, // 0x3E '>'
+    {620, 10, 19, 10, 0, -18}, // 0x3F '?'
+    {644, 18, 20, 20, 1, -17}, // 0x40 '@'
+    {689, 17, 18, 16, 0, -18}, // 0x41 'A'
+    {728, 13, 18, 16, 2, -18}, // 0x42 'B'
+    {758, 15, 19, 16, 1, -18}, // 0x43 'C'
+    {794, 15, 18, 18, 2, -18}, // 0x44 'D'
+    {828, 11, 18, 14, 2, -18}, // 0x45 'E'
+    {853, 11, 18, 14, 2, -18}, // 0x46 'F'
+    {878, 16, 19, 18, 1, -18}, // 0x47 'G'
+    {916, 15, 18, 18, 2, -18}, // 0x48 'H'
+    {950, 3, 18, 7, 2, -18}, // 0x49 'I'
+    {957, 9, 19, 11, 0, -18}, // 0x4A 'J'
+    {979, 15, 18, 16, 2, -18}, // 0x4B 'K'
+    {1013, 10, 18, 12, 2, -18}, // 0x4C 'L'
+    {1036, 18, 18, 22, 2, -18}, // 0x4D 'M'
+    {1077, 15, 18, 18, 2, -18}, // 0x4E 'N'
+    {1111, 18, 19, 19, 1, -18}, // 0x4F 'O'
+    {1154, 12, 18, 15, 2, -18}, // 0x50 'P'
+    {1181, 18, 22, 19, 1, -18}, // 0x51 'Q'
+    {1231, 14, 18, 15, 2, -18}, // 0x52 'R'
+    {1263, 12, 19, 13, 0, -18}, // 0x53 'S'
+    {1292, 14, 18, 14, 0, -18}, // 0x54 'T'
+    {1324, 15, 19, 18, 1, -18}, // 0x55 'U'
+    {1360, 17, 18, 16, 0, -18}, // 0x56 'V'
+    {1399, 25, 18, 24, 0, -18}, // 0x57 'W'
+    {1456, 16, 18, 15, 0, -18}, // 0x58 'X'
+    {1492, 16, 18, 15, 0, -18}, // 0x59 'Y'
+    {1528, 14, 18, 15, 1, -18}, // 0x5A 'Z'
+    {1560, 6, 23, 7, 1, -19}, // 0x5B '['
+    {1578, 11, 20, 9, -1, -18}, // 0x5C 'backslash'
+    {1606, 5, 23, 7, 1, -19}, // 0x5D ']'
+    {1621, 11, 9, 14, 1, -18}, // 0x5E '^'
+    {1634, 10, 3, 9, 0, 1}, // 0x5F '_'
+    {1638, 6, 5, 7, 0, -18}, // 0x60 '`'
+    {1642, 10, 14, 12, 1, -13}, // 0x61 'a'
+    {1660, 12, 19, 13, 1, -18}, // 0x62 'b'
+    {1689, 11, 14, 11, 0, -13}, // 0x63 'c'
+    {1709, 12, 19, 13, 0, -18}, // 0x64 'd'
+    {1738, 12, 14, 13, 0, -13}, // 0x65 'e'
+    {1759, 8, 18, 8, 0, -18}, // 0x66 'f'
+    {1777, 12, 18, 12, 0, -13}, // 0x67 'g'
+    {1804, 11, 18, 13, 1, -18}, // 0x68 'h'
+    {1829, 4, 18, 6, 1, -18}, // 0x69 'i'
+    {1838, 6, 23, 6, -1, -18}, // 0x6A 'j'
+    {1856, 12, 18, 13, 1, -18}, // 0x6B 'k'
+    {1883, 4, 18, 6, 1, -18}, // 0x6C 'l'
+    {1892, 18, 13, 20, 1, -13}, // 0x6D 'm'
+    {1922, 11, 13, 13, 1, -13}, // 0x6E 'n'
+    {1940, 13, 14, 13, 0, -13}, // 0x6F 'o'
+    {1963, 12, 18, 13, 1, -13}, // 0x70 'p'
+    {1990, 12, 18, 13, 0, -13}, // 0x71 'q'
+    {2017, 9, 13, 10, 1, -13}, // 0x72 'r'
+    {2032, 10, 14, 10, 0, -13}, // 0x73 's'
+    {2050, 9, 18, 9, 0, -17}, // 0x74 't'
+    {2071, 11, 14, 13, 1, -13}, // 0x75 'u'
+    {2091, 13, 13, 12, 0, -13}, // 0x76 'v'
+    {2113, 19, 13, 18, 0, -13}, // 0x77 'w'
+    {2144, 12, 13, 12, 0, -13}, // 0x78 'x'
+    {2164, 13, 18, 12, 0, -13}, // 0x79 'y'
+    {2194, 11, 13, 11, 0, -13}, // 0x7A 'z'
+    {2212, 7, 23, 7, 0, -19}, // 0x7B '{'
+    {2233, 3, 24, 7, 2, -19}, // 0x7C '|'
+    {2242, 6, 23, 7, 1, -19}, // 0x7D '}'
+    {2260, 12, 6, 14, 1, -10}, // 0x7E '~'
+};
+
+const GFXfont Sans24 = {(uint8_t *)Sans24Bitmaps, (GFXglyph *)Sans24Glyphs, 0x20, 0x7E, 29, 1};
+
+#endif // SANS24_H
@@ -0,0 +1,859 @@
+// Sans24AA 24 px, 4 bpp, converted with tools/ttf2aafont.py
+// 95 glyphs, 8939 bitmap bytes
+// Source font: Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1.
+// Renamed on conversion, as the source license requires for modified versions
+
+#ifndef SANS24AA_H
+#define SANS24AA_H
+
+#include "gfxfont.h"
+
+const uint8_t Sans24AABitmaps[] = {
+    0x03, 0x40, 0x0D, 0xF2, 0x0D, 0xF2, 0x0D, 0xF2, 0x0D, 0xF2, 0x0D, 0xF2,
+    0x0D, 0xF2, 0x0D, 0xF2, 0x0D, 0xF2, 0x0C, 0xF2, 0x0B, 0xF0, 0x09, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xB2, 0x5F, 0xF9, 0x2E, 0xF5,
+    0x01, 0x10, 0x04, 0x20, 0x04, 0x22, 0xF9, 0x02, 0xF9, 0x2F, 0x90, 0x2F,
+    0x92, 0xF9, 0x02, 0xF9, 0x2F, 0x90, 0x2F, 0x91, 0xF8, 0x01, 0xF8, 0x0C,
+    0x50, 0x0C, 0x50, 0x00, 0x00, 0x01, 0x40, 0x00, 0x41, 0x00, 0x00, 0x00,
+    0x0D, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x06, 0xF6, 0x00,
+    0x00, 0x00, 0x4F, 0x70, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x0C,
+    0xF0, 0x00, 0x00, 0x22, 0xBF, 0x32, 0x2E, 0xC2, 0x20, 0x09, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF2, 0x06, 0x88, 0xFD, 0x88, 0xAF, 0xB8, 0x50, 0x00,
+    0x03, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x06, 0xF5, 0x00, 0xAF, 0x10,
+    0x00, 0x00, 0x09, 0xF2, 0x00, 0xDD, 0x00, 0x00, 0x39, 0x9E, 0xF9, 0x99,
+    0xFE, 0x99, 0x40, 0x4D, 0xDF, 0xFD, 0xDE, 0xFE, 0xDD, 0x50, 0x00, 0x2F,
+    0xA0, 0x06, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x09, 0xF3, 0x00, 0x00,
+    0x00, 0x8F, 0x40, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x10, 0x0F, 0xB0,
+    0x00, 0x00, 0x00, 0xEB, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0xDA, 0x10, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFB, 0x20, 0x01, 0xDF, 0xD8,
+    0xFB, 0xCF, 0xE2, 0x08, 0xFA, 0x00, 0xF5, 0x05, 0x80, 0x0D, 0xF2, 0x02,
+    0xF4, 0x00, 0x00, 0x0F, 0xF1, 0x02, 0xF3, 0x00, 0x00, 0x0D, 0xF8, 0x04,
+    0xF2, 0x00, 0x00, 0x07, 0xFF, 0x96, 0xF1, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+    0xF8, 0x30, 0x00, 0x00, 0x04, 0xAE, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x08,
+    0xE9, 0xFF, 0xE1, 0x00, 0x00, 0x08, 0xB0, 0x2D, 0xF8, 0x00, 0x00, 0x09,
+    0xB0, 0x06, 0xFB, 0x00, 0x00, 0x0B, 0x90, 0x05, 0xFA, 0x04, 0x00, 0x0B,
+    0x90, 0x09, 0xF7, 0x7F, 0xB2, 0x0D, 0x80, 0x6F, 0xE1, 0x3D, 0xFF, 0xBE,
+    0xDD, 0xFF, 0x50, 0x01, 0x8D, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x2F,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x64, 0x00, 0x00, 0x00, 0x00, 0x04, 0x30,
+    0x01, 0xBF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0xAF, 0x50, 0x08, 0xF6, 0x14,
+    0xED, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0xB0, 0x00, 0x6F, 0x40, 0x00,
+    0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x70, 0x01, 0xDE, 0x20, 0x00,
+    0x2F, 0x80, 0x00, 0x4F, 0x70, 0x0A, 0xF5, 0x00, 0x00, 0x0E, 0xC0, 0x00,
+    0x7F, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x46, 0xEC, 0x03, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB1, 0x1D, 0xE2, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x42, 0x00, 0xAF, 0x50, 0x15, 0x62, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xF9, 0x05, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x1E,
+    0xC2, 0x18, 0xF6, 0x00, 0x00, 0x01, 0xDE, 0x20, 0x7F, 0x40, 0x00, 0xDC,
+    0x00, 0x00, 0x0A, 0xF5, 0x00, 0x9F, 0x10, 0x00, 0xAF, 0x00, 0x00, 0x6F,
+    0x90, 0x00, 0x9F, 0x20, 0x00, 0xAF, 0x00, 0x03, 0xFC, 0x10, 0x00, 0x6F,
+    0x50, 0x00, 0xEB, 0x00, 0x1D, 0xE3, 0x00, 0x00, 0x1D, 0xE5, 0x4B, 0xF4,
+    0x00, 0x9F, 0x60, 0x00, 0x00, 0x02, 0xCF, 0xFE, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x36, 0x52, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0xA5, 0x5C, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA0, 0x00,
+    0x1E, 0xF2, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x57, 0x10, 0x00,
+    0x00, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xDF, 0xBF, 0xF7, 0x00, 0x00, 0xCB, 0x00, 0x01, 0xEF, 0x60, 0x5F, 0xF7,
+    0x00, 0x1F, 0xB0, 0x00, 0x9F, 0x90, 0x00, 0x5F, 0xF7, 0x05, 0xF8, 0x00,
+    0x0E, 0xF4, 0x00, 0x00, 0x5F, 0xF6, 0xBF, 0x30, 0x00, 0xFF, 0x20, 0x00,
+    0x00, 0x5F, 0xFF, 0xB0, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x7F, 0xF6,
+    0x00, 0x00, 0x8F, 0xE3, 0x00, 0x00, 0x5E, 0xFF, 0xF5, 0x00, 0x01, 0xBF,
+    0xFB, 0x8A, 0xDF, 0xD4, 0x5F, 0xF5, 0x00, 0x01, 0x8E, 0xFF, 0xFD, 0x71,
+    0x00, 0x5F, 0xF5, 0x00, 0x00, 0x02, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x22, 0xF9, 0x2F, 0x92, 0xF9, 0x2F, 0x91, 0xF8, 0x0C, 0x50, 0x00,
+    0x03, 0x40, 0x00, 0x0B, 0xF1, 0x00, 0x5F, 0xA0, 0x00, 0xCF, 0x30, 0x03,
+    0xFC, 0x00, 0x08, 0xF6, 0x00, 0x0C, 0xF2, 0x00, 0x1F, 0xD0, 0x00, 0x3F,
+    0xA0, 0x00, 0x5F, 0x80, 0x00, 0x6F, 0x80, 0x00, 0x6F, 0x80, 0x00, 0x6F,
+    0x80, 0x00, 0x4F, 0x90, 0x00, 0x3F, 0xB0, 0x00, 0x0F, 0xE0, 0x00, 0x0C,
+    0xF2, 0x00, 0x08, 0xF7, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00,
+    0x4F, 0xB0, 0x00, 0x0B, 0xF1, 0x00, 0x02, 0x30, 0x03, 0x30, 0x00, 0x1F,
+    0xC0, 0x00, 0x09, 0xF6, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00,
+    0x5F, 0x90, 0x00, 0x1F, 0xD0, 0x00, 0x0C, 0xF1, 0x00, 0x0A, 0xF4, 0x00,
+    0x08, 0xF5, 0x00, 0x07, 0xF6, 0x00, 0x06, 0xF6, 0x00, 0x07, 0xF6, 0x00,
+    0x08, 0xF5, 0x00, 0x0A, 0xF3, 0x00, 0x0D, 0xF1, 0x00, 0x2F, 0xD0, 0x00,
+    0x6F, 0x80, 0x00, 0xCF, 0x30, 0x03, 0xFC, 0x00, 0x0A, 0xF5, 0x00, 0x1F,
+    0xB0, 0x00, 0x02, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x40,
+    0x00, 0x42, 0x0B, 0x40, 0x60, 0x6E, 0x8C, 0x7C, 0xC2, 0x02, 0xAF, 0xE6,
+    0x00, 0x08, 0xEE, 0xDC, 0x40, 0x9B, 0x2B, 0x46, 0xE3, 0x00, 0x0B, 0x40,
+    0x10, 0x00, 0x07, 0x20, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0xAD,
+    0xDD, 0xDF, 0xFD, 0xDD, 0xDA, 0x8B, 0xBB, 0xBF, 0xEB, 0xBB, 0xB8, 0x00,
+    0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xA0, 0x00, 0x00, 0x6C, 0x60, 0xDF, 0xF0, 0x7F, 0xF0, 0x07,
+    0xB0, 0x1E, 0x40, 0x98, 0x00, 0x10, 0x00, 0x12, 0x22, 0x22, 0x0B, 0xFF,
+    0xFF, 0xF2, 0x8B, 0xBB, 0xBB, 0x10, 0x5C, 0x60, 0xEF, 0xF0, 0xAF, 0xB0,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0x90, 0x00, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0x00, 0x00,
+    0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x00,
+    0x0D, 0xC0, 0x00, 0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x10, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x08, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00,
+    0x00, 0x0B, 0xF1, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x30, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x30, 0x00, 0x00, 0x00,
+    0x04, 0xDF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x4F, 0xFB, 0x77, 0xCF, 0xE3,
+    0x00, 0x01, 0xEF, 0x80, 0x00, 0x09, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0xEF, 0x50, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x1F, 0xF3,
+    0x00, 0x00, 0x00, 0x4F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF1,
+    0x4F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x4F, 0xD0, 0x00, 0x00, 0x00,
+    0x0F, 0xF4, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x2F, 0xF1, 0x00,
+    0x00, 0x00, 0x2F, 0xF1, 0x0F, 0xF3, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x0B,
+    0xF7, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x05, 0xFE, 0x10, 0x00, 0x01, 0xEF,
+    0x40, 0x00, 0xCF, 0xA0, 0x00, 0x1B, 0xFB, 0x00, 0x00, 0x2E, 0xFE, 0xAA,
+    0xEF, 0xD1, 0x00, 0x00, 0x02, 0x9F, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x09, 0xFE,
+    0xEF, 0x40, 0x00, 0x1B, 0xFE, 0x3D, 0xF4, 0x00, 0x05, 0xFC, 0x20, 0xDF,
+    0x40, 0x00, 0x04, 0x10, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40,
+    0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00,
+    0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00,
+    0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00,
+    0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x05, 0x99, 0x9E,
+    0xFB, 0x99, 0x60, 0x8F, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x35, 0x64,
+    0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xE6, 0x00, 0x03, 0xEF, 0xC8, 0x8B,
+    0xFF, 0x70, 0x0C, 0xF9, 0x00, 0x00, 0x7F, 0xF1, 0x3F, 0xE0, 0x00, 0x00,
+    0x0E, 0xF4, 0x39, 0x60, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x70, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xD1, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xD1,
+    0x00, 0x00, 0x00, 0x08, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xE2, 0x00,
+    0x00, 0x00, 0x08, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x25, 0x65,
+    0x10, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xDF, 0xE8, 0x89,
+    0xFF, 0xA0, 0x08, 0xFC, 0x10, 0x00, 0x4F, 0xF3, 0x0E, 0xF3, 0x00, 0x00,
+    0x0B, 0xF6, 0x19, 0x80, 0x00, 0x00, 0x09, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x07, 0xAE,
+    0xE8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFA, 0x20, 0x00, 0x00, 0x00, 0x03,
+    0xAF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFC, 0x4B, 0x40, 0x00, 0x00, 0x05, 0xFC, 0x6F, 0xD0, 0x00, 0x00,
+    0x0A, 0xFA, 0x0E, 0xFA, 0x00, 0x00, 0x7F, 0xF4, 0x04, 0xFF, 0xEA, 0xAD,
+    0xFF, 0x70, 0x00, 0x3B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x12, 0x31,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x3F, 0xD0,
+    0x00, 0x00, 0x00, 0x0A, 0xF6, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xA0,
+    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x10, 0x0F, 0xD0, 0x00, 0x00, 0x1D,
+    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x70, 0x00, 0x0F, 0xD0, 0x00,
+    0x07, 0xFB, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x4F, 0xF5, 0x44, 0x44, 0x4F,
+    0xE4, 0x42, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x17, 0x88, 0x88,
+    0x88, 0x8F, 0xE8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x14, 0x44, 0x44,
+    0x44, 0x30, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xBF, 0xBB, 0xBB,
+    0xBB, 0x60, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFD, 0xEF, 0xFC, 0x70, 0x00, 0x0B, 0xFF, 0xCB, 0xEF,
+    0xFB, 0x10, 0x00, 0x30, 0x00, 0x04, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xD0, 0x2C, 0x60, 0x00, 0x04, 0xEF, 0x50, 0x6F, 0xFE, 0xAA, 0xCF,
+    0xF8, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x22, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0xF4, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x1C, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xC1, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x20,
+    0x00, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x86, 0x87,
+    0x40, 0x00, 0x07, 0xFF, 0xEF, 0xFF, 0xFC, 0x20, 0x1E, 0xFE, 0x62, 0x25,
+    0xDF, 0xD1, 0x6F, 0xE2, 0x00, 0x00, 0x1D, 0xF8, 0x9F, 0x90, 0x00, 0x00,
+    0x07, 0xFC, 0xBF, 0x60, 0x00, 0x00, 0x04, 0xFD, 0x9F, 0x60, 0x00, 0x00,
+    0x05, 0xFC, 0x6F, 0xB0, 0x00, 0x00, 0x0A, 0xF8, 0x0E, 0xF7, 0x00, 0x00,
+    0x7F, 0xE2, 0x04, 0xEF, 0xD9, 0x9D, 0xFF, 0x50, 0x00, 0x3B, 0xFF, 0xFF,
+    0xB3, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7B, 0xBB, 0xBB,
+    0xBB, 0xBC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x63, 0x00, 0x00, 0x00,
+    0x5E, 0xFF, 0xFF, 0xD4, 0x00, 0x05, 0xFF, 0x84, 0x49, 0xFF, 0x40, 0x0E,
+    0xF5, 0x00, 0x00, 0x6F, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF1, 0x4F,
+    0xD0, 0x00, 0x00, 0x0F, 0xF2, 0x1F, 0xF1, 0x00, 0x00, 0x3F, 0xE0, 0x09,
+    0xFB, 0x10, 0x02, 0xCF, 0x70, 0x00, 0x8F, 0xFC, 0xCF, 0xE7, 0x00, 0x01,
+    0x8E, 0xFF, 0xFF, 0xE8, 0x10, 0x1D, 0xFB, 0x30, 0x03, 0xBF, 0xB0, 0x8F,
+    0xC0, 0x00, 0x00, 0x1D, 0xF6, 0xCF, 0x60, 0x00, 0x00, 0x08, 0xFA, 0xDF,
+    0x60, 0x00, 0x00, 0x08, 0xFB, 0xBF, 0x90, 0x00, 0x00, 0x0B, 0xF9, 0x5F,
+    0xF4, 0x00, 0x00, 0x5F, 0xF3, 0x09, 0xFF, 0xB8, 0x8C, 0xFF, 0x80, 0x00,
+    0x5C, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x13, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x65, 0x10, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xF9, 0x00, 0x01,
+    0xDF, 0xD8, 0x68, 0xEF, 0xB0, 0x09, 0xFB, 0x10, 0x00, 0x1D, 0xF5, 0x1F,
+    0xF2, 0x00, 0x00, 0x05, 0xFB, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x3F,
+    0xE0, 0x00, 0x00, 0x03, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0x08, 0xFC, 0x09,
+    0xFD, 0x20, 0x00, 0x6F, 0xF8, 0x01, 0xDF, 0xFC, 0xBD, 0xFF, 0xF2, 0x00,
+    0x17, 0xCE, 0xD9, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x3E, 0xF3, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x80, 0x00, 0x00,
+    0x00, 0x0A, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF2, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0x00, 0x00, 0x00, 0x1B,
+    0xB1, 0x7F, 0xF7, 0x3F, 0xF4, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xB1, 0x7F, 0xF7, 0x3F, 0xF4, 0x01,
+    0x10, 0x1B, 0xB1, 0x7F, 0xF7, 0x3F, 0xF4, 0x01, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xB1, 0x6F, 0xF7, 0x2D,
+    0xF7, 0x00, 0xE3, 0x08, 0xB0, 0x3E, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x18, 0xF2, 0x00, 0x00, 0x01, 0x8E,
+    0xFD, 0x00, 0x00, 0x07, 0xEF, 0xD6, 0x00, 0x00, 0x6E, 0xFE, 0x60, 0x00,
+    0x02, 0xDF, 0xD7, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x81, 0x00, 0x00, 0x00,
+    0x04, 0xCF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x81, 0x00, 0x00,
+    0x00, 0x05, 0xDF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0x3B, 0xBB, 0xBB,
+    0xBB, 0xBB, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2, 0x3B, 0xBB, 0xBB,
+    0xBB, 0xBB, 0xB1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x1D, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xE6, 0x00,
+    0x00, 0x00, 0x00, 0x7E, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xD1,
+    0x00, 0x00, 0x02, 0x9F, 0xFA, 0x10, 0x00, 0x19, 0xFF, 0xB3, 0x00, 0x01,
+    0x8F, 0xFB, 0x40, 0x00, 0x01, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x2D, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65,
+    0x20, 0x00, 0x07, 0xEF, 0xFF, 0xF9, 0x00, 0x6F, 0xD7, 0x68, 0xEF, 0x80,
+    0x06, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00,
+    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x09, 0xFD,
+    0x10, 0x00, 0x01, 0xCF, 0xA1, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00,
+    0x08, 0xF3, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xC3, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x00, 0x00, 0x1E,
+    0xF7, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xDF, 0xFF, 0xFF, 0xB5,
+    0x00, 0x00, 0x00, 0x04, 0xDF, 0xA5, 0x22, 0x36, 0xBF, 0xB1, 0x00, 0x00,
+    0x5F, 0xC2, 0x00, 0x00, 0x00, 0x03, 0xED, 0x10, 0x02, 0xEB, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x2E, 0x90, 0x0B, 0xE1, 0x00, 0x00, 0x03, 0x55, 0x20,
+    0x07, 0xF2, 0x4F, 0x70, 0x00, 0x07, 0xEF, 0xFF, 0xF3, 0x01, 0xF7, 0x9F,
+    0x10, 0x00, 0xBF, 0x92, 0x0B, 0xE0, 0x00, 0xDA, 0xCB, 0x00, 0x08, 0xF6,
+    0x00, 0x0E, 0xA0, 0x00, 0xBB, 0xE9, 0x00, 0x1E, 0xB0, 0x00, 0x3F, 0x70,
+    0x00, 0xCB, 0xF9, 0x00, 0x4F, 0x60, 0x00, 0x7F, 0x30, 0x00, 0xE9, 0xDA,
+    0x00, 0x6F, 0x60, 0x00, 0xBF, 0x00, 0x05, 0xF4, 0xBD, 0x00, 0x4F, 0x90,
+    0x06, 0xFF, 0x10, 0x1D, 0xC0, 0x7F, 0x20, 0x0C, 0xFB, 0xBF, 0x6F, 0xCA,
+    0xED, 0x10, 0x2F, 0x90, 0x01, 0x9B, 0x93, 0x04, 0xBB, 0x71, 0x00, 0x09,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF9, 0x20, 0x00, 0x00, 0x02,
+    0x7E, 0x40, 0x00, 0x00, 0x8F, 0xFC, 0xA8, 0x8A, 0xCF, 0xF8, 0x10, 0x00,
+    0x00, 0x01, 0x6A, 0xCD, 0xDB, 0x96, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFB, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x5F, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0xEF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xE0, 0x09, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00,
+    0x3F, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x30, 0x00, 0xCF, 0x60, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x0D, 0xF6,
+    0x00, 0x00, 0x1F, 0xF3, 0x00, 0x00, 0x04, 0xFF, 0x66, 0x66, 0x66, 0xCF,
+    0x90, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x1F,
+    0xF6, 0x44, 0x44, 0x44, 0x4D, 0xF6, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xC0, 0x00, 0xDF, 0x70, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x30,
+    0x4F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x0A, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xF1, 0x34, 0x44, 0x44, 0x21, 0x00, 0x00, 0x0D,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0xDF, 0xB9, 0x99, 0xAD, 0xFF, 0xA0,
+    0x0D, 0xF6, 0x00, 0x00, 0x07, 0xFF, 0x40, 0xDF, 0x60, 0x00, 0x00, 0x0D,
+    0xF9, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0xBF, 0x90, 0xDF, 0x60, 0x00, 0x00,
+    0x0C, 0xF6, 0x0D, 0xF6, 0x00, 0x00, 0x07, 0xFD, 0x10, 0xDF, 0xA8, 0x88,
+    0x8C, 0xFA, 0x10, 0x0D, 0xFF, 0xFF, 0xFF, 0xFD, 0x82, 0x00, 0xDF, 0x72,
+    0x22, 0x24, 0xAF, 0xE4, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0xDF,
+    0x60, 0x00, 0x00, 0x02, 0xFF, 0x3D, 0xF6, 0x00, 0x00, 0x00, 0x2F, 0xF3,
+    0xDF, 0x60, 0x00, 0x00, 0x06, 0xFF, 0x1D, 0xF6, 0x00, 0x00, 0x06, 0xEF,
+    0x90, 0xDF, 0xED, 0xDD, 0xDF, 0xFF, 0xB1, 0x0D, 0xFF, 0xFF, 0xFF, 0xEB,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x25, 0x66, 0x30, 0x00, 0x00, 0x00, 0x06,
+    0xDF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x1C, 0xFF, 0xEB, 0x9A, 0xDF, 0xFD,
+    0x20, 0x1D, 0xFE, 0x70, 0x00, 0x00, 0x3C, 0xD1, 0x09, 0xFE, 0x40, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x25, 0x00, 0x1D, 0xFF, 0x92, 0x00, 0x01,
+    0x7E, 0xF4, 0x00, 0x1B, 0xFF, 0xFD, 0xDD, 0xFF, 0xF8, 0x00, 0x00, 0x06,
+    0xBF, 0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x32, 0x00, 0x00,
+    0x00, 0x34, 0x44, 0x44, 0x42, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xB5, 0x00, 0x00, 0xDF, 0xDB, 0xBB, 0xBB, 0xEF, 0xFB, 0x10, 0x0D,
+    0xF6, 0x00, 0x00, 0x00, 0x6E, 0xFD, 0x10, 0xDF, 0x60, 0x00, 0x00, 0x00,
+    0x2E, 0xFA, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0xDF, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0x9D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFC, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xED,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFC, 0xDF, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0x8D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF2, 0xDF, 0x60,
+    0x00, 0x00, 0x00, 0x4E, 0xF9, 0x0D, 0xF6, 0x00, 0x00, 0x02, 0x8F, 0xFB,
+    0x00, 0xDF, 0xED, 0xDD, 0xDE, 0xFF, 0xF9, 0x00, 0x0D, 0xFF, 0xFF, 0xFF,
+    0xEC, 0x82, 0x00, 0x00, 0x34, 0x44, 0x44, 0x44, 0x44, 0x2D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF9, 0xDF, 0xDB, 0xBB, 0xBB, 0xBB, 0x7D, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xB9, 0x99, 0x99, 0x91, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xDF,
+    0x84, 0x44, 0x44, 0x40, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x60,
+    0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00,
+    0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xED, 0xDD, 0xDD,
+    0xDD, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x34, 0x44, 0x44, 0x44, 0x44,
+    0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xDF, 0xDB, 0xBB, 0xBB, 0xBB, 0x7D,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0x84, 0x44, 0x44, 0x42, 0x0D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0xDF, 0xB9, 0x99, 0x99, 0x95, 0x0D, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0x60, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x25, 0x66, 0x41, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xB4, 0x00, 0x00, 0x1C, 0xFF, 0xEB, 0x9A, 0xCF, 0xFF, 0x90, 0x01, 0xDF,
+    0xE7, 0x00, 0x00, 0x01, 0x8F, 0x80, 0x0A, 0xFE, 0x40, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x3F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x80,
+    0x00, 0x00, 0x00, 0x44, 0x44, 0x40, 0xDF, 0x80, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0xF2, 0xBF, 0xA0, 0x00, 0x00, 0x01, 0x78, 0x8F, 0xF2, 0x7F, 0xE1,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF2, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0xBF,
+    0xF8, 0x10, 0x00, 0x01, 0x7F, 0xF2, 0x00, 0x19, 0xFF, 0xFC, 0xBB, 0xCF,
+    0xFF, 0xB1, 0x00, 0x00, 0x4A, 0xEF, 0xFF, 0xFE, 0xA4, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x32, 0x10, 0x00, 0x00, 0x34, 0x10, 0x00, 0x00, 0x00, 0x01,
+    0x44, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xDF, 0x60, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0,
+    0xDF, 0x60, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x0D, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xF0, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x0D, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xDF, 0xA8, 0x88, 0x88, 0x88, 0x89,
+    0xFF, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xDF, 0x72, 0x22,
+    0x22, 0x22, 0x25, 0xFF, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0,
+    0xDF, 0x60, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x0D, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xF0, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x0D, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x24, 0x38, 0xFD,
+    0x8F, 0xD8, 0xFD, 0x8F, 0xD8, 0xFD, 0x8F, 0xD8, 0xFD, 0x8F, 0xD8, 0xFD,
+    0x8F, 0xD8, 0xFD, 0x8F, 0xD8, 0xFD, 0x8F, 0xD8, 0xFD, 0x8F, 0xD8, 0xFD,
+    0x00, 0x00, 0x00, 0x34, 0x20, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
+    0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
+    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8,
+    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
+    0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
+    0x00, 0x0D, 0xF7, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xCF, 0xD0,
+    0x2E, 0xBC, 0xFF, 0xE3, 0x03, 0xFF, 0xFF, 0xB3, 0x00, 0x01, 0x23, 0x10,
+    0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x03, 0x42, 0x09, 0xF9, 0x00,
+    0x00, 0x00, 0x0A, 0xFD, 0x10, 0x9F, 0x90, 0x00, 0x00, 0x08, 0xFE, 0x20,
+    0x09, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x9F, 0x90, 0x00, 0x05,
+    0xFF, 0x50, 0x00, 0x09, 0xF9, 0x00, 0x04, 0xEF, 0x70, 0x00, 0x00, 0x9F,
+    0x90, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x09, 0xF9, 0x01, 0xDF, 0xA0, 0x00,
+    0x00, 0x00, 0x9F, 0xDA, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xFC, 0x10, 0x00, 0x00, 0x00, 0x9F, 0xA2, 0x4E, 0xFB, 0x00, 0x00, 0x00,
+    0x09, 0xF9, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x6F,
+    0xF7, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x9F,
+    0x90, 0x00, 0x00, 0x9F, 0xE3, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0xBF,
+    0xD1, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x01, 0xDF, 0xB0, 0x09, 0xF9, 0x00,
+    0x00, 0x00, 0x02, 0xDF, 0xA0, 0x34, 0x10, 0x00, 0x00, 0x00, 0xDF, 0x60,
+    0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00,
+    0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF,
+    0x60, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00,
+    0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00,
+    0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x60,
+    0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0x34,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0xDF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xDF,
+    0xDF, 0x70, 0x00, 0x00, 0x00, 0x05, 0xFC, 0xFF, 0xDF, 0x5F, 0xE1, 0x00,
+    0x00, 0x00, 0x0D, 0xF4, 0xFF, 0xDF, 0x2A, 0xF9, 0x00, 0x00, 0x00, 0x7F,
+    0xB0, 0xFF, 0xDF, 0x22, 0xFF, 0x20, 0x00, 0x01, 0xEF, 0x30, 0xFF, 0xDF,
+    0x20, 0x8F, 0xB0, 0x00, 0x08, 0xFA, 0x00, 0xFF, 0xDF, 0x20, 0x1E, 0xF4,
+    0x00, 0x2F, 0xF2, 0x00, 0xFF, 0xDF, 0x20, 0x06, 0xFC, 0x00, 0xAF, 0x80,
+    0x00, 0xFF, 0xDF, 0x20, 0x00, 0xDF, 0x63, 0xFE, 0x10, 0x00, 0xFF, 0xDF,
+    0x20, 0x00, 0x5F, 0xDB, 0xF7, 0x00, 0x00, 0xFF, 0xDF, 0x20, 0x00, 0x0B,
+    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xDF, 0x20, 0x00, 0x03, 0xFF, 0x60, 0x00,
+    0x00, 0xFF, 0xDF, 0x20, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xFF, 0xDF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0x0D, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xDF, 0xE2, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x0D, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xDF,
+    0xEF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x0D, 0xF6, 0xFF, 0x60, 0x00, 0x00,
+    0x0F, 0xF0, 0xDF, 0x27, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0x0D, 0xF2, 0x0B,
+    0xFD, 0x10, 0x00, 0x0F, 0xF0, 0xDF, 0x20, 0x1D, 0xFB, 0x00, 0x00, 0xFF,
+    0x0D, 0xF2, 0x00, 0x3F, 0xF7, 0x00, 0x0F, 0xF0, 0xDF, 0x20, 0x00, 0x6F,
+    0xF4, 0x00, 0xFF, 0x0D, 0xF2, 0x00, 0x00, 0xAF, 0xE1, 0x0F, 0xF0, 0xDF,
+    0x20, 0x00, 0x01, 0xCF, 0xB0, 0xFF, 0x0D, 0xF2, 0x00, 0x00, 0x02, 0xEF,
+    0x8F, 0xF0, 0xDF, 0x20, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x0D, 0xF2, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0xF0, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0x0D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xF0, 0x00, 0x00, 0x00, 0x25,
+    0x65, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFE, 0x81,
+    0x00, 0x00, 0x00, 0x1C, 0xFF, 0xEB, 0x9A, 0xDF, 0xFD, 0x30, 0x00, 0x01,
+    0xDF, 0xE6, 0x00, 0x00, 0x05, 0xDF, 0xE2, 0x00, 0x09, 0xFE, 0x20, 0x00,
+    0x00, 0x00, 0x1D, 0xFC, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0x40, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xA0, 0xBF,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0xDF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xF0, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xF0, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0xAF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0x7F, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0x90, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0x30, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x3E, 0xFA, 0x00, 0x00,
+    0xBF, 0xF9, 0x20, 0x00, 0x28, 0xEF, 0xD1, 0x00, 0x00, 0x19, 0xFF, 0xFE,
+    0xDD, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x4A, 0xEF, 0xFF, 0xFB, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x44, 0x44, 0x20, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x9F,
+    0xD9, 0x99, 0xBE, 0xFF, 0x70, 0x9F, 0x90, 0x00, 0x00, 0x9F, 0xF3, 0x9F,
+    0x90, 0x00, 0x00, 0x0D, 0xF9, 0x9F, 0x90, 0x00, 0x00, 0x08, 0xFB, 0x9F,
+    0x90, 0x00, 0x00, 0x08, 0xFB, 0x9F, 0x90, 0x00, 0x00, 0x0B, 0xFA, 0x9F,
+    0x90, 0x00, 0x00, 0x6F, 0xF5, 0x9F, 0xB4, 0x44, 0x6A, 0xFF, 0xA0, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x9F, 0xD9, 0x99, 0x85, 0x10, 0x00, 0x9F,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x25, 0x65, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF,
+    0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xEB, 0x9A, 0xDF, 0xFD,
+    0x30, 0x00, 0x01, 0xDF, 0xE6, 0x00, 0x00, 0x05, 0xDF, 0xE2, 0x00, 0x09,
+    0xFE, 0x20, 0x00, 0x00, 0x00, 0x1D, 0xFC, 0x00, 0x2F, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x40, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xA0, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0xDF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0xDF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xF0, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xF0, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0x7F,
+    0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x1F, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0x30, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x3E,
+    0xFA, 0x00, 0x00, 0xBF, 0xF9, 0x20, 0x00, 0x28, 0xEF, 0xD1, 0x00, 0x00,
+    0x19, 0xFF, 0xFE, 0xDD, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x4A, 0xEF,
+    0xFF, 0xFD, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0xBF,
+    0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xD1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x84, 0x24, 0x44, 0x43, 0x20, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x9F, 0xD9, 0x99, 0xBF, 0xFF,
+    0x60, 0x00, 0x9F, 0x90, 0x00, 0x01, 0xAF, 0xF1, 0x00, 0x9F, 0x90, 0x00,
+    0x00, 0x1E, 0xF6, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x9F,
+    0x90, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x4F, 0xF2,
+    0x00, 0x9F, 0x90, 0x00, 0x06, 0xEF, 0x80, 0x00, 0x9F, 0xED, 0xDD, 0xFF,
+    0xF7, 0x00, 0x00, 0x9F, 0xED, 0xDF, 0xFB, 0x10, 0x00, 0x00, 0x9F, 0x90,
+    0x05, 0xFF, 0x40, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x9F, 0xE1, 0x00, 0x00,
+    0x9F, 0x90, 0x00, 0x1C, 0xFB, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x03, 0xFF,
+    0x70, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x6F, 0xF3, 0x00, 0x9F, 0x90, 0x00,
+    0x00, 0x0A, 0xFD, 0x10, 0x9F, 0x90, 0x00, 0x00, 0x01, 0xDF, 0xA0, 0x00,
+    0x00, 0x14, 0x65, 0x30, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFD, 0x50, 0x00,
+    0x8F, 0xFB, 0x89, 0xDF, 0xF4, 0x03, 0xFF, 0x40, 0x00, 0x06, 0xB0, 0x07,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFE, 0x20, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE7, 0x20, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xFB, 0x60, 0x00, 0x00, 0x02, 0x9E, 0xFF, 0xFE, 0x40, 0x00,
+    0x00, 0x00, 0x49, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x04,
+    0x30, 0x00, 0x00, 0x0A, 0xF9, 0x1E, 0xF7, 0x10, 0x00, 0x7F, 0xF3, 0x1A,
+    0xFF, 0xEC, 0xBE, 0xFF, 0x70, 0x00, 0x5B, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+    0x00, 0x12, 0x31, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x7B, 0xBB, 0xBC, 0xFF, 0xCB,
+    0xBB, 0xB8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x04,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0x34, 0x22, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x0B, 0xF9, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x92, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x92, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x2F, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x92, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x2F,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x92, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x0B, 0xF9, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x91, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x0F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0x80, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x06, 0xFF, 0x40, 0x00,
+    0x00, 0x0A, 0xFE, 0x00, 0x0C, 0xFE, 0x60, 0x00, 0x2A, 0xFF, 0x50, 0x00,
+    0x1C, 0xFF, 0xFD, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0x07, 0xDF, 0xFF, 0xFB,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x13, 0x21, 0x00, 0x00, 0x00, 0x34, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x19, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xE0, 0x3F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x00,
+    0xCF, 0x90, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x20, 0x06, 0xFE, 0x10, 0x00,
+    0x00, 0x00, 0xBF, 0xB0, 0x00, 0x1E, 0xF6, 0x00, 0x00, 0x00, 0x2F, 0xF4,
+    0x00, 0x00, 0x9F, 0xC0, 0x00, 0x00, 0x08, 0xFD, 0x00, 0x00, 0x03, 0xFF,
+    0x30, 0x00, 0x00, 0xDF, 0x70, 0x00, 0x00, 0x0C, 0xF9, 0x00, 0x00, 0x4F,
+    0xF1, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0x60, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x08, 0xFC, 0x00,
+    0x8F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0x0D, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x94, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFE, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0x20, 0x00, 0x00, 0x00,
+    0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x34, 0x19, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xF1, 0x5F, 0xF4, 0x00, 0x00,
+    0x00, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0x08, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x0A, 0xFC, 0x00,
+    0x00, 0x00, 0xDF, 0xBF, 0x70, 0x00, 0x00, 0x4F, 0xF2, 0x00, 0x5F, 0xF2,
+    0x00, 0x00, 0x4F, 0xC5, 0xFC, 0x00, 0x00, 0x08, 0xFC, 0x00, 0x01, 0xFF,
+    0x60, 0x00, 0x08, 0xF7, 0x0E, 0xF2, 0x00, 0x00, 0xDF, 0x80, 0x00, 0x0B,
+    0xFB, 0x00, 0x00, 0xDF, 0x20, 0xAF, 0x70, 0x00, 0x2F, 0xF3, 0x00, 0x00,
+    0x7F, 0xF1, 0x00, 0x4F, 0xC0, 0x05, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00,
+    0x02, 0xFF, 0x50, 0x09, 0xF7, 0x00, 0x0E, 0xF3, 0x00, 0xBF, 0x80, 0x00,
+    0x00, 0x0C, 0xF9, 0x00, 0xEF, 0x20, 0x00, 0xAF, 0x80, 0x1F, 0xF4, 0x00,
+    0x00, 0x00, 0x7F, 0xE0, 0x4F, 0xB0, 0x00, 0x05, 0xFD, 0x05, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0x39, 0xF7, 0x00, 0x00, 0x1F, 0xF3, 0xAF, 0x90,
+    0x00, 0x00, 0x00, 0x0D, 0xF8, 0xEF, 0x20, 0x00, 0x00, 0xAF, 0x8E, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xDF, 0xB0, 0x00, 0x00, 0x05, 0xFD, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xAF,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0x10, 0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x40,
+    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x90, 0x07, 0xFF, 0x30, 0x00,
+    0x00, 0x09, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x4F, 0xF3, 0x00,
+    0x00, 0x2E, 0xF8, 0x00, 0x01, 0xDF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0x30,
+    0x09, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x4F, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x2E, 0xF8, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1,
+    0x9F, 0xD1, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x1D, 0xF9, 0x00, 0x00,
+    0x00, 0x0C, 0xFA, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xE1, 0x00,
+    0x00, 0xAF, 0xD1, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x00, 0x2E, 0xF9, 0x00,
+    0x0C, 0xFA, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x8F, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xD1, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x14, 0x40,
+    0x7F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x0D, 0xF9, 0x00, 0x00,
+    0x00, 0x08, 0xFE, 0x10, 0x04, 0xFF, 0x30, 0x00, 0x00, 0x2F, 0xF6, 0x00,
+    0x00, 0xAF, 0xC0, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x2E, 0xF6, 0x00,
+    0x04, 0xFF, 0x30, 0x00, 0x00, 0x07, 0xFE, 0x10, 0x0C, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x80, 0x7F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF3,
+    0xEF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xB0, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x6B, 0xBB, 0xBB, 0xBB, 0xBC, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0xDD, 0xDD,
+    0xDD, 0xDD, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x16, 0x66,
+    0x61, 0x4F, 0xFF, 0xF1, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80,
+    0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80,
+    0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80,
+    0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80,
+    0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80,
+    0x00, 0x4F, 0xFF, 0xE1, 0x28, 0x88, 0x81, 0x19, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x03,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x56, 0x66, 0x3C,
+    0xFF, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8,
+    0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F,
+    0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04,
+    0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00,
+    0x4F, 0x8C, 0xFF, 0xF8, 0x78, 0x88, 0x40, 0x00, 0x00, 0x03, 0x20, 0x00,
+    0x00, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
+    0x00, 0x4F, 0xAC, 0xF1, 0x00, 0x00, 0x0D, 0xF2, 0x4F, 0x90, 0x00, 0x06,
+    0xF9, 0x00, 0xBF, 0x30, 0x01, 0xEE, 0x10, 0x03, 0xFB, 0x00, 0x8F, 0x80,
+    0x00, 0x09, 0xF4, 0x07, 0x70, 0x00, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x66, 0x66, 0x66, 0x66, 0x63,
+    0x26, 0x61, 0x00, 0x0B, 0xFA, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x1D, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x56, 0x40, 0x00, 0x02, 0xBF, 0xFF, 0xFD,
+    0x40, 0x2E, 0xFB, 0x66, 0xBF, 0xE1, 0x08, 0x40, 0x00, 0x0C, 0xF6, 0x00,
+    0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x04, 0x8A,
+    0xBE, 0xF9, 0x06, 0xEF, 0xDA, 0x9A, 0xF9, 0x6F, 0xD3, 0x00, 0x06, 0xF9,
+    0xCF, 0x30, 0x00, 0x06, 0xF9, 0xDF, 0x40, 0x00, 0x1C, 0xF9, 0x8F, 0xD6,
+    0x58, 0xEB, 0xF9, 0x1A, 0xFF, 0xFD, 0x51, 0xE9, 0x00, 0x13, 0x10, 0x00,
+    0x00, 0x19, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0x55, 0x20,
+    0x00, 0x2F, 0xF1, 0xAF, 0xFF, 0xF8, 0x00, 0x2F, 0xFD, 0xC7, 0x69, 0xFF,
+    0x70, 0x2F, 0xF8, 0x00, 0x00, 0x6F, 0xE1, 0x2F, 0xF0, 0x00, 0x00, 0x0E,
+    0xF5, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xF7, 0x2F, 0xF0, 0x00, 0x00, 0x09,
+    0xF8, 0x2F, 0xF0, 0x00, 0x00, 0x0A, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0x0C,
+    0xF6, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF2, 0x2F, 0xF5, 0x00, 0x00, 0xBF,
+    0xA0, 0x2F, 0xEE, 0xB8, 0x8D, 0xFE, 0x20, 0x2F, 0xB3, 0xCF, 0xFF, 0xA2,
+    0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x14, 0x64, 0x10,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x91, 0x00, 0xAF, 0xE8, 0x66, 0xBF, 0x50,
+    0x5F, 0xE2, 0x00, 0x00, 0x30, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x18, 0x30, 0x08, 0xFF, 0xA8, 0x8E,
+    0xF7, 0x00, 0x06, 0xDF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x22, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x96, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x25, 0x63, 0x08, 0xF9,
+    0x00, 0x1A, 0xFF, 0xFF, 0xB9, 0xF9, 0x00, 0xBF, 0xD7, 0x46, 0xCF, 0xF9,
+    0x06, 0xFE, 0x10, 0x00, 0x0B, 0xF9, 0x0B, 0xF7, 0x00, 0x00, 0x08, 0xF9,
+    0x0F, 0xF3, 0x00, 0x00, 0x08, 0xF9, 0x2F, 0xF2, 0x00, 0x00, 0x08, 0xF9,
+    0x2F, 0xF2, 0x00, 0x00, 0x08, 0xF9, 0x1F, 0xF3, 0x00, 0x00, 0x08, 0xF9,
+    0x0D, 0xF7, 0x00, 0x00, 0x09, 0xF9, 0x07, 0xFD, 0x10, 0x00, 0x6F, 0xF9,
+    0x01, 0xDF, 0xEA, 0x9C, 0xE9, 0xF9, 0x00, 0x2B, 0xFF, 0xFB, 0x24, 0xF9,
+    0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x14, 0x64, 0x10, 0x00,
+    0x00, 0x08, 0xEF, 0xFF, 0xE7, 0x00, 0x00, 0xAF, 0xC6, 0x45, 0xCF, 0x80,
+    0x06, 0xFC, 0x10, 0x00, 0x1D, 0xF2, 0x0B, 0xF5, 0x00, 0x00, 0x07, 0xF7,
+    0x0F, 0xF7, 0x66, 0x66, 0x69, 0xF9, 0x2F, 0xFD, 0xDD, 0xDD, 0xDD, 0xD8,
+    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x04, 0x90,
+    0x00, 0x7F, 0xFB, 0x88, 0xCF, 0xE3, 0x00, 0x04, 0xCF, 0xFF, 0xEA, 0x20,
+    0x00, 0x00, 0x01, 0x22, 0x00, 0x00, 0x00, 0x00, 0x15, 0x74, 0x00, 0x06,
+    0xFF, 0xFD, 0x00, 0x3F, 0xF7, 0x42, 0x00, 0x9F, 0x80, 0x00, 0x00, 0xBF,
+    0x50, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xAD, 0xFF, 0xED, 0xDB, 0x49, 0xEF,
+    0xB9, 0x98, 0x00, 0xBF, 0x60, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0xBF,
+    0x60, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0xBF,
+    0x60, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0xBF,
+    0x60, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x36, 0x52, 0x00, 0x00,
+    0x00, 0x4D, 0xFF, 0xFF, 0xB9, 0x98, 0x03, 0xFE, 0x73, 0x49, 0xFF, 0xB7,
+    0x09, 0xF7, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x00, 0x8F, 0x60,
+    0x0A, 0xF5, 0x00, 0x00, 0xAF, 0x40, 0x04, 0xFE, 0x30, 0x06, 0xFD, 0x00,
+    0x00, 0x6F, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0xAD, 0x57, 0x74, 0x00, 0x00,
+    0x05, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB9, 0x88, 0x63, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB1, 0x0A, 0xE4, 0x12, 0x24, 0x7E, 0xF8,
+    0x4F, 0x80, 0x00, 0x00, 0x06, 0xF9, 0x5F, 0xA0, 0x00, 0x00, 0x0A, 0xF5,
+    0x1E, 0xFA, 0x53, 0x35, 0xBF, 0xB0, 0x02, 0xBF, 0xFF, 0xFF, 0xE8, 0x00,
+    0x00, 0x01, 0x46, 0x63, 0x00, 0x00, 0x29, 0x80, 0x00, 0x00, 0x00, 0x04,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x04, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x04, 0xFD, 0x00,
+    0x35, 0x41, 0x00, 0x4F, 0xD2, 0xCF, 0xFF, 0xF6, 0x04, 0xFE, 0xEC, 0x66,
+    0xAF, 0xF4, 0x4F, 0xF7, 0x00, 0x00, 0xAF, 0xA4, 0xFD, 0x00, 0x00, 0x05,
+    0xFC, 0x4F, 0xD0, 0x00, 0x00, 0x4F, 0xD4, 0xFD, 0x00, 0x00, 0x04, 0xFD,
+    0x4F, 0xD0, 0x00, 0x00, 0x4F, 0xD4, 0xFD, 0x00, 0x00, 0x04, 0xFD, 0x4F,
+    0xD0, 0x00, 0x00, 0x4F, 0xD4, 0xFD, 0x00, 0x00, 0x04, 0xFD, 0x4F, 0xD0,
+    0x00, 0x00, 0x4F, 0xD4, 0xFD, 0x00, 0x00, 0x04, 0xFD, 0x05, 0x60, 0x5F,
+    0xF7, 0x5F, 0xF8, 0x06, 0x70, 0x00, 0x00, 0x02, 0x20, 0x0F, 0xF2, 0x0F,
+    0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F,
+    0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x00, 0x05, 0x60,
+    0x00, 0x5F, 0xF7, 0x00, 0x5F, 0xF8, 0x00, 0x06, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x20, 0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2,
+    0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2,
+    0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2,
+    0x00, 0x0F, 0xF2, 0x00, 0x0F, 0xF2, 0x00, 0x1F, 0xF1, 0x24, 0xAF, 0xD0,
+    0x9F, 0xFE, 0x30, 0x26, 0x51, 0x00, 0x19, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0x00, 0x12, 0x10, 0x2F, 0xF0, 0x00, 0x02, 0xEF, 0x50,
+    0x2F, 0xF0, 0x00, 0x2E, 0xF5, 0x00, 0x2F, 0xF0, 0x01, 0xDF, 0x60, 0x00,
+    0x2F, 0xF0, 0x1D, 0xF7, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0x80, 0x00, 0x00,
+    0x2F, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x2F, 0xF4, 0x9F, 0xC0, 0x00, 0x00,
+    0x2F, 0xF0, 0x0C, 0xF9, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xEF, 0x60, 0x00,
+    0x2F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x06, 0xFE, 0x10,
+    0x2F, 0xF0, 0x00, 0x00, 0x9F, 0xC0, 0x09, 0x91, 0x0F, 0xF2, 0x0F, 0xF2,
+    0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2,
+    0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2,
+    0x0F, 0xF2, 0x0F, 0xF2, 0x0F, 0xF2, 0x02, 0x10, 0x04, 0x52, 0x00, 0x01,
+    0x45, 0x30, 0x00, 0x4F, 0x94, 0xEF, 0xFF, 0x50, 0x7F, 0xFF, 0xFB, 0x10,
+    0x4F, 0xDF, 0x96, 0x8F, 0xE6, 0xFA, 0x67, 0xEF, 0x90, 0x4F, 0xF5, 0x00,
+    0x07, 0xFF, 0x80, 0x00, 0x4F, 0xF0, 0x4F, 0xD0, 0x00, 0x02, 0xFF, 0x20,
+    0x00, 0x0F, 0xF3, 0x4F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0D, 0xF4,
+    0x4F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0D, 0xF4, 0x4F, 0xD0, 0x00,
+    0x02, 0xFF, 0x00, 0x00, 0x0D, 0xF4, 0x4F, 0xD0, 0x00, 0x02, 0xFF, 0x00,
+    0x00, 0x0D, 0xF4, 0x4F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0D, 0xF4,
+    0x4F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0D, 0xF4, 0x4F, 0xD0, 0x00,
+    0x02, 0xFF, 0x00, 0x00, 0x0D, 0xF4, 0x4F, 0xD0, 0x00, 0x02, 0xFF, 0x00,
+    0x00, 0x0D, 0xF4, 0x02, 0x10, 0x03, 0x54, 0x10, 0x04, 0xF9, 0x2C, 0xFF,
+    0xFF, 0x60, 0x4F, 0xDE, 0xC6, 0x6A, 0xFF, 0x44, 0xFF, 0x70, 0x00, 0x0A,
+    0xFA, 0x4F, 0xD0, 0x00, 0x00, 0x5F, 0xC4, 0xFD, 0x00, 0x00, 0x04, 0xFD,
+    0x4F, 0xD0, 0x00, 0x00, 0x4F, 0xD4, 0xFD, 0x00, 0x00, 0x04, 0xFD, 0x4F,
+    0xD0, 0x00, 0x00, 0x4F, 0xD4, 0xFD, 0x00, 0x00, 0x04, 0xFD, 0x4F, 0xD0,
+    0x00, 0x00, 0x4F, 0xD4, 0xFD, 0x00, 0x00, 0x04, 0xFD, 0x4F, 0xD0, 0x00,
+    0x00, 0x4F, 0xD0, 0x00, 0x00, 0x04, 0x64, 0x10, 0x00, 0x00, 0x00, 0x8E,
+    0xFF, 0xFF, 0xA2, 0x00, 0x00, 0xAF, 0xE8, 0x66, 0xCF, 0xE2, 0x00, 0x6F,
+    0xE1, 0x00, 0x00, 0xBF, 0xA0, 0x0B, 0xF7, 0x00, 0x00, 0x02, 0xFF, 0x20,
+    0xFF, 0x30, 0x00, 0x00, 0x0D, 0xF5, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0xBF,
+    0x72, 0xFF, 0x20, 0x00, 0x00, 0x0B, 0xF7, 0x0F, 0xF3, 0x00, 0x00, 0x00,
+    0xEF, 0x50, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xF1, 0x04, 0xFE, 0x40, 0x00,
+    0x1C, 0xF9, 0x00, 0x08, 0xFF, 0xA8, 0x9E, 0xFC, 0x10, 0x00, 0x05, 0xCF,
+    0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x02, 0x10,
+    0x03, 0x55, 0x10, 0x00, 0x4F, 0x92, 0xBF, 0xFF, 0xF8, 0x00, 0x4F, 0xDE,
+    0xB6, 0x6A, 0xFF, 0x60, 0x4F, 0xF8, 0x00, 0x00, 0x8F, 0xE0, 0x4F, 0xD0,
+    0x00, 0x00, 0x1F, 0xF3, 0x4F, 0xD0, 0x00, 0x00, 0x0C, 0xF6, 0x4F, 0xD0,
+    0x00, 0x00, 0x0B, 0xF8, 0x4F, 0xD0, 0x00, 0x00, 0x0B, 0xF7, 0x4F, 0xD0,
+    0x00, 0x00, 0x0E, 0xF5, 0x4F, 0xD0, 0x00, 0x00, 0x3F, 0xF1, 0x4F, 0xF5,
+    0x00, 0x01, 0xCF, 0x90, 0x4F, 0xFF, 0xB8, 0x8E, 0xFD, 0x10, 0x4F, 0xD4,
+    0xDF, 0xFF, 0x91, 0x00, 0x4F, 0xD0, 0x02, 0x20, 0x00, 0x00, 0x4F, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x63, 0x00, 0x21, 0x00, 0x1A, 0xFF, 0xFF, 0xB5, 0xF9, 0x00, 0xBF,
+    0xD7, 0x46, 0xCE, 0xF9, 0x06, 0xFE, 0x10, 0x00, 0x0B, 0xF9, 0x0B, 0xF7,
+    0x00, 0x00, 0x08, 0xF9, 0x0F, 0xF3, 0x00, 0x00, 0x08, 0xF9, 0x2F, 0xF2,
+    0x00, 0x00, 0x08, 0xF9, 0x2F, 0xF2, 0x00, 0x00, 0x08, 0xF9, 0x1F, 0xF3,
+    0x00, 0x00, 0x08, 0xF9, 0x0D, 0xF7, 0x00, 0x00, 0x09, 0xF9, 0x07, 0xFD,
+    0x10, 0x00, 0x6F, 0xF9, 0x01, 0xDF, 0xEA, 0x9C, 0xEB, 0xF9, 0x00, 0x2B,
+    0xFF, 0xFB, 0x28, 0xF9, 0x00, 0x00, 0x12, 0x10, 0x08, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x02, 0x10,
+    0x04, 0x63, 0x04, 0xF9, 0x1B, 0xFF, 0xF1, 0x4F, 0xBB, 0xFC, 0xBC, 0x04,
+    0xFF, 0xE3, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00,
+    0x00, 0x4F, 0xD0, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x4F, 0xD0,
+    0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x04,
+    0xFD, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46,
+    0x40, 0x00, 0x00, 0x8F, 0xFF, 0xFE, 0x70, 0x07, 0xFD, 0x64, 0x6C, 0xD0,
+    0x0D, 0xF3, 0x00, 0x00, 0x10, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xFE,
+    0x72, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xC6, 0x00, 0x00, 0x03, 0x8D, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x5E, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x04,
+    0x20, 0x00, 0x0C, 0xF3, 0x1F, 0xF9, 0x66, 0xBF, 0xB0, 0x04, 0xBF, 0xFF,
+    0xE8, 0x10, 0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x04, 0xF9, 0x00,
+    0x00, 0x00, 0x6F, 0x90, 0x00, 0x06, 0xCE, 0xFE, 0xDD, 0xD2, 0x49, 0xCF,
+    0xD9, 0x99, 0x10, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00,
+    0x08, 0xF9, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x08, 0xF9, 0x00,
+    0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x8F,
+    0xA0, 0x01, 0x00, 0x04, 0xFF, 0xAA, 0xE1, 0x00, 0x09, 0xFF, 0xFA, 0x10,
+    0x00, 0x01, 0x31, 0x00, 0x12, 0x10, 0x00, 0x00, 0x12, 0x18, 0xF9, 0x00,
+    0x00, 0x08, 0xF9, 0x8F, 0x90, 0x00, 0x00, 0x8F, 0x98, 0xF9, 0x00, 0x00,
+    0x08, 0xF9, 0x8F, 0x90, 0x00, 0x00, 0x8F, 0x98, 0xF9, 0x00, 0x00, 0x08,
+    0xF9, 0x8F, 0x90, 0x00, 0x00, 0x8F, 0x98, 0xF9, 0x00, 0x00, 0x08, 0xF9,
+    0x8F, 0x90, 0x00, 0x00, 0x8F, 0x97, 0xFA, 0x00, 0x00, 0x08, 0xF9, 0x4F,
+    0xF2, 0x00, 0x05, 0xEF, 0x90, 0xCF, 0xE9, 0x8C, 0xFA, 0xF9, 0x01, 0xBF,
+    0xFF, 0xC3, 0x4F, 0x90, 0x00, 0x13, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00,
+    0x00, 0x00, 0x22, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x2F, 0xF2,
+    0x00, 0x00, 0x0B, 0xF6, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x04,
+    0xFD, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x0D, 0xF4, 0x00, 0x0E, 0xF2, 0x00,
+    0x00, 0x7F, 0xA0, 0x05, 0xFB, 0x00, 0x00, 0x01, 0xFF, 0x10, 0xBF, 0x50,
+    0x00, 0x00, 0x0A, 0xF7, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x4F, 0xD8, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x09, 0xF8, 0x00, 0x00, 0x0D,
+    0xF6, 0x00, 0x00, 0x1F, 0xF1, 0x4F, 0xD0, 0x00, 0x04, 0xFF, 0xB0, 0x00,
+    0x06, 0xFA, 0x00, 0xEF, 0x20, 0x00, 0x8F, 0xDF, 0x10, 0x00, 0xAF, 0x50,
+    0x0A, 0xF7, 0x00, 0x0D, 0xD7, 0xF5, 0x00, 0x0E, 0xF1, 0x00, 0x5F, 0xB0,
+    0x03, 0xF8, 0x2F, 0xA0, 0x04, 0xFB, 0x00, 0x00, 0xFF, 0x10, 0x8F, 0x40,
+    0xCE, 0x00, 0x9F, 0x60, 0x00, 0x0A, 0xF5, 0x0D, 0xD0, 0x07, 0xF5, 0x0D,
+    0xF1, 0x00, 0x00, 0x5F, 0xA3, 0xF8, 0x00, 0x2F, 0xA3, 0xFB, 0x00, 0x00,
+    0x01, 0xFE, 0x7F, 0x40, 0x00, 0xDE, 0x7F, 0x70, 0x00, 0x00, 0x0B, 0xFD,
+    0xD0, 0x00, 0x08, 0xFD, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00,
+    0x3F, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x30, 0x00, 0x00, 0xDF, 0x70,
+    0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x01, 0x21, 0x2E, 0xF6, 0x00, 0x00,
+    0x2F, 0xE2, 0x05, 0xFE, 0x10, 0x00, 0xCF, 0x60, 0x00, 0xAF, 0xA0, 0x08,
+    0xFB, 0x00, 0x00, 0x1D, 0xF5, 0x3F, 0xE1, 0x00, 0x00, 0x04, 0xFE, 0xCF,
+    0x40, 0x00, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFE,
+    0x20, 0x00, 0x00, 0x09, 0xFA, 0x9F, 0xB0, 0x00, 0x00, 0x4F, 0xD1, 0x1D,
+    0xF6, 0x00, 0x01, 0xDF, 0x40, 0x04, 0xFE, 0x20, 0x09, 0xF9, 0x00, 0x00,
+    0xAF, 0xB0, 0x5F, 0xD1, 0x00, 0x00, 0x1E, 0xF6, 0x12, 0x10, 0x00, 0x00,
+    0x00, 0x22, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x2F, 0xF3, 0x00,
+    0x00, 0x0B, 0xF6, 0x00, 0xAF, 0x90, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF,
+    0x10, 0x00, 0x8F, 0x80, 0x00, 0x0C, 0xF7, 0x00, 0x0E, 0xF2, 0x00, 0x00,
+    0x5F, 0xD0, 0x06, 0xFA, 0x00, 0x00, 0x00, 0xEF, 0x50, 0xCF, 0x30, 0x00,
+    0x00, 0x07, 0xFB, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x00, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0x88, 0x88, 0x8B, 0xFE, 0x10, 0x00, 0x00,
+    0x01, 0xDF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F,
+    0xB0, 0x00, 0x00, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x1D, 0xF4, 0x00,
+    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00,
+    0x04, 0xFE, 0x10, 0x00, 0x00, 0x00, 0xDF, 0xC9, 0x99, 0x99, 0x90, 0x2F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x56, 0x10, 0x05, 0xEF, 0xF2,
+    0x01, 0xEE, 0x40, 0x00, 0x5F, 0x80, 0x00, 0x06, 0xF7, 0x00, 0x00, 0x5F,
+    0x80, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xDF, 0x00,
+    0x00, 0x0D, 0xE0, 0x00, 0x16, 0xF9, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x18,
+    0xF8, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x0F, 0xC0,
+    0x00, 0x03, 0xFA, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x06, 0xF7, 0x00, 0x00,
+    0x5F, 0x80, 0x00, 0x01, 0xFE, 0x30, 0x00, 0x05, 0xFF, 0xF1, 0x00, 0x01,
+    0x68, 0x10, 0x16, 0x24, 0xF6, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F,
+    0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F,
+    0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F,
+    0x60, 0x21, 0x65, 0x10, 0x00, 0xEF, 0xF6, 0x00, 0x02, 0xDF, 0x30, 0x00,
+    0x5F, 0x80, 0x00, 0x4F, 0x90, 0x00, 0x5F, 0x80, 0x00, 0x7F, 0x60, 0x00,
+    0x9F, 0x30, 0x00, 0xBF, 0x10, 0x00, 0xBF, 0x10, 0x00, 0x6F, 0x91, 0x00,
+    0x08, 0xF9, 0x00, 0x5F, 0xA2, 0x00, 0xBF, 0x10, 0x00, 0xBF, 0x10, 0x00,
+    0xAF, 0x30, 0x00, 0x7F, 0x60, 0x00, 0x5F, 0x80, 0x00, 0x4F, 0x90, 0x00,
+    0x5F, 0x80, 0x01, 0xCF, 0x40, 0xEF, 0xF8, 0x00, 0x86, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x42, 0x00, 0x69, 0x83, 0x00, 0x05, 0xF7, 0x0B,
+    0xFF, 0xFF, 0xC7, 0x6E, 0xF3, 0x5F, 0xB3, 0x5A, 0xFF, 0xFF, 0x80, 0x9F,
+    0x30, 0x00, 0x15, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const GFXglyph Sans24AAGlyphs[] = {
+    {0, 0, 0, 5, 0, 0}, // 0x20 ' '
+    {0, 4, 19, 8, 2, -18}, // 0x21 '!'
+    {38, 7, 7, 10, 1, -18}, // 0x22 '"'
+    {63, 14, 18, 14, 0, -18}, // 0x23 '#'
+    {189, 12, 23, 14, 1, -20}, // 0x24 '$'
+    {327, 18, 19, 19, 0, -18}, // 0x25 '%'
+    {498, 17, 19, 17, 0, -18}, // 0x26 '&'
+    {660, 3, 7, 6, 1, -18}, // 0x27 '''
+    {671, 6, 23, 7, 1, -19}, // 0x28 '('
+    {740, 6, 23, 7, 0, -19}, // 0x29 ')'
+    {809, 8, 9, 10, 1, -19}, // 0x2A '*'
+    {845, 12, 12, 14, 1, -14}, // 0x2B '+'
+    {917, 4, 7, 5, 1, -3}, // 0x2C ','
+    {931, 7, 3, 8, 1, -9}, // 0x2D '-'
+    {942, 4, 4, 5, 1, -3}, // 0x2E '.'
+    {950, 11, 20, 9, -1, -18}, // 0x2F '/'
+    {1060, 14, 19, 14, 0, -18}, // 0x30 '0'
+    {1193, 11, 18, 14, 2, -18}, // 0x31 '1'
+    {1292, 12, 18, 14, 1, -18}, // 0x32 '2'
+    {1400, 12, 19, 14, 1, -18}, // 0x33 '3'
+    {1514, 14, 18, 14, 0, -18}, // 0x34 '4'
+    {1640, 12, 19, 14, 1, -18}, // 0x35 '5'
+    {1754, 12, 19, 14, 1, -18}, // 0x36 '6'
+    {1868, 13, 18, 14, 1, -18}, // 0x37 '7'
+    {1985, 12, 19, 14, 1, -18}, // 0x38 '8'
+    {2099, 12, 18, 14, 1, -18}, // 0x39 '9'
+    {2207, 4, 13, 6, 1, -12}, // 0x3A ':'
+    {2233, 4, 16, 6, 1, -12}, // 0x3B ';'
+    {2265, 11, 12, 14, 1, -14}, // 0x3C '<'
+    {2331, 12, 6, 14, 1, -11}, // 0x3D '='
+    {2367, 11, 12, 14, 2, -14}, // 0x3E '>'
+    {2433, 10, 19, 10, 0, -18}, // 0x3F '?'
+    {2528, 18, 20, 20, 1, -17}, // 0x40 '@'
+    {2708, 17, 18, 16, 0, -18}, // 0x41 'A'
+    {2861, 13, 18, 16, 2, -18}, // 0x42 'B'
+    {2978, 15, 19, 16, 1, -18}, // 0x43 'C'
+    {3121, 15, 18, 18, 2, -18}, // 0x44 'D'
+    {3256, 11, 18, 14, 2, -18}, // 0x45 'E'
+    {3355, 11, 18, 14, 2, -18}, // 0x46 'F'
+    {3454, 16, 19, 18, 1, -18}, // 0x47 'G'
+    {3606, 15, 18, 18, 2, -18}, // 0x48 'H'
+    {3741, 3, 18, 7, 2, -18}, // 0x49 'I'
+    {3768, 9, 19, 11, 0, -18}, // 0x4A 'J'
+    {3854, 15, 18, 16, 2, -18}, // 0x4B 'K'
+    {3989, 10, 18, 12, 2, -18}, // 0x4C 'L'
+    {4079, 18, 18, 22, 2, -18}, // 0x4D 'M'
+    {4241, 15, 18, 18, 2, -18}, // 0x4E 'N'
+    {4376, 18, 19, 19, 1, -18}, // 0x4F 'O'
+    {4547, 12, 18, 15, 2, -18}, // 0x50 'P'
+    {4655, 18, 22, 19, 1, -18}, // 0x51 'Q'
+    {4853, 14, 18, 15, 2, -18}, // 0x52 'R'
+    {4979, 12, 19, 13, 0, -18}, // 0x53 'S'
+    {5093, 14, 18, 14, 0, -18}, // 0x54 'T'
+    {5219, 15, 19, 18, 1, -18}, // 0x55 'U'
+    {5362, 17, 18, 16, 0, -18}, // 0x56 'V'
+    {5515, 25, 18, 24, 0, -18}, // 0x57 'W'
+    {5740, 16, 18, 15, 0, -18}, // 0x58 'X'
+    {5884, 16, 18, 15, 0, -18}, // 0x59 'Y'
+    {6028, 14, 18, 15, 1, -18}, // 0x5A 'Z'
+    {6154, 6, 23, 7, 1, -19}, // 0x5B '['
+    {6223, 11, 20, 9, -1, -18}, // 0x5C 'backslash'
+    {6333, 5, 23, 7, 1, -19}, // 0x5D ']'
+    {6391, 11, 9, 14, 1, -18}, // 0x5E '^'
+    {6441, 10, 3, 9, 0, 1}, // 0x5F '_'
+    {6456, 6, 5, 7, 0, -18}, // 0x60 '`'
+    {6471, 10, 14, 12, 1, -13}, // 0x61 'a'
+    {6541, 12, 19, 13, 1, -18}, // 0x62 'b'
+    {6655, 11, 14, 11, 0, -13}, // 0x63 'c'
+    {6732, 12, 19, 13, 0, -18}, // 0x64 'd'
+    {6846, 12, 14, 13, 0, -13}, // 0x65 'e'
+    {6930, 8, 18, 8, 0, -18}, // 0x66 'f'
+    {7002, 12, 18, 12, 0, -13}, // 0x67 'g'
+    {7110, 11, 18, 13, 1, -18}, // 0x68 'h'
+    {7209, 4, 18, 6, 1, -18}, // 0x69 'i'
+    {7245, 6, 23, 6, -1, -18}, // 0x6A 'j'
+    {7314, 12, 18, 13, 1, -18}, // 0x6B 'k'
+    {7422, 4, 18, 6, 1, -18}, // 0x6C 'l'
+    {7458, 18, 13, 20, 1, -13}, // 0x6D 'm'
+    {7575, 11, 13, 13, 1, -13}, // 0x6E 'n'
+    {7647, 13, 14, 13, 0, -13}, // 0x6F 'o'
+    {7738, 12, 18, 13, 1, -13}, // 0x70 'p'
+    {7846, 12, 18, 13, 0, -13}, // 0x71 'q'
+    {7954, 9, 13, 10, 1, -13}, // 0x72 'r'
+    {8013, 10, 14, 10, 0, -13}, // 0x73 's'
+    {8083, 9, 18, 9, 0, -17}, // 0x74 't'
+    {8164, 11, 14, 13, 1, -13}, // 0x75 'u'
+    {8241, 13, 13, 12, 0, -13}, // 0x76 'v'
+    {8326, 19, 13, 18, 0, -13}, // 0x77 'w'
+    {8450, 12, 13, 12, 0, -13}, // 0x78 'x'
+    {8528, 13, 18, 12, 0, -13}, // 0x79 'y'
+    {8645, 11, 13, 11, 0, -13}, // 0x7A 'z'
+    {8717, 7, 23, 7, 0, -19}, // 0x7B '{'
+    {8798, 3, 24, 7, 2, -19}, // 0x7C '|'
+    {8834, 6, 23, 7, 1, -19}, // 0x7D '}'
+    {8903, 12, 6, 14, 1, -10}, // 0x7E '~'
+};
+
+const GFXfont Sans24AA = {(uint8_t *)Sans24AABitmaps, (GFXglyph *)Sans24AAGlyphs, 0x20, 0x7E, 29, 4};
+
+#endif // SANS24AA_H
@@ -13,6 +13,9 @@
 //
 
 #include "st7789.h"
+#include "pixcache.h"
+#include "readcache.h"
+#include "lcdqueue.h"
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
 #include "hardware/dma.h"
@@ -40,6 +43,10 @@ int16_t st7789_pinRST = -1;
 
 uint16_t st7789_pinSCK = PICO_DEFAULT_SPI_SCK_PIN;
 uint16_t st7789_pinTX = PICO_DEFAULT_SPI_TX_PIN;
+int16_t st7789_pinRX = -1;
+
+static uint8_t readMode = LCD_READ_NONE;
+static uint readBaud; // SPI clock to restore after a 4-wire read
 
 // uint16_t st7789_pinRST;
 
@@ -232,6 +239,10 @@ void LCD_setRotation(uint8_t m)
 {
     uint8_t madctl = 0;
 
+    LCD_cacheFlush(); // Pending pixels use the old orientation
+    LCD_queueWait();  // So do queued rectangles
+    LCD_readCacheInvalidate();
+
     rotation = m & 3; // can't be higher than 3
 
     switch (rotation)
@@ -319,7 +330,7 @@ void LCD_initDisplay(uint16_t width, uint16_t height)
     LCD_setRotation(2);
 }
 
-void LCD_setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+static void ST7789_SetWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
 
     x += _xstart;
@@ -337,13 +348,19 @@ void LCD_setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
     // row address set
     ST7789_WriteCommand(ST77XX_RASET);
     ST7789_WriteData((uint8_t *)&ya, sizeof(ya));
+}
+
+void __time_critical_func(LCD_setAddrWindow)(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    ST7789_SetWindow(x, y, w, h);
 
     // write to RAM
     ST7789_WriteCommand(ST77XX_RAMWR);
 }
 
-void LCD_WriteBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+void __time_critical_func(LCD_WriteBitmap)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
 {
+    LCD_queueWait(); // Queued rectangles go first
     ST7789_Select();
     LCD_setAddrWindow(x, y, w, h); // Clipped area
     ST7789_RegData();
@@ -365,10 +382,50 @@ void LCD_WriteBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *b
 #endif
 
     ST7789_DeSelect();
+    LCD_readCacheUpdate(x, y, w, h, bitmap);
+}
+
+void __time_critical_func(LCD_FillWindow)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t col)
+{
+    static uint16_t fillColour; // DMA source must outlive this call's stack frame
+
+    LCD_queueWait();
+    ST7789_Select();
+    LCD_setAddrWindow(x, y, w, h);
+    ST7789_RegData();
+    spi_set_format(st7789_spi, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    fillColour = col;
+#ifdef USE_DMA
+    // Same channel as LCD_WriteBitmap() but with a non-incrementing source,
+    // so the constant colour never has to exist in RAM more than once
+    dma_channel_config c = dma_cfg;
+    channel_config_set_read_increment(&c, false);
+    dma_channel_configure(dma_tx, &c,
+                          &spi_get_hw(st7789_spi)->dr,
+                          &fillColour,
+                          (uint32_t)w * h,
+                          true);
+    waitForDMA();
+#else
+    uint16_t line[32];
+    uint32_t n = (uint32_t)w * h;
+    for (uint8_t i = 0; i < 32; i++)
+        line[i] = fillColour;
+    while (n)
+    {
+        uint32_t chunk = n > 32 ? 32 : n;
+        spi_write16_blocking(st7789_spi, line, chunk);
+        n -= chunk;
+    }
+#endif
+
+    ST7789_DeSelect();
+    LCD_readCacheFill(x, y, w, h, col);
 }
 
 void LCD_WritePixel(int x, int y, uint16_t col)
 {
+    LCD_queueWait();
     ST7789_Select();
     LCD_setAddrWindow(x, y, 1, 1); // Clipped area
     ST7789_RegData();
@@ -378,4 +435,158 @@ void LCD_WritePixel(int x, int y, uint16_t col)
     spi_set_format(st7789_spi, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
     spi_write16_blocking(st7789_spi, &col, 1);
     ST7789_DeSelect();
-}
\ No newline at end of file
+    LCD_readCacheFill(x, y, 1, 1, col);
+}
+
+void LCD_setReadMode(uint8_t mode, int16_t rx)
+{
+    if (mode == LCD_READ_4WIRE && rx < 0)
+        mode = LCD_READ_NONE;
+    LCD_queueWait(); // The 4-wire read pin is changed under the bus
+    readMode = mode;
+    st7789_pinRX = rx;
+    if (mode == LCD_READ_4WIRE)
+        gpio_set_function(rx, GPIO_FUNC_SPI);
+    LCD_readCacheInvalidate();
+}
+
+bool LCD_canRead()
+{
+    return readMode != LCD_READ_NONE;
+}
+
+// 3-wire reads: the panel drives SDA on the falling clock edge, so sample it
+// with the clock high. Hand-clocked because the SPI block cannot turn SDA around.
+static uint8_t ST7789_ReadByteSDA()
+{
+    uint8_t v = 0;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        gpio_put(st7789_pinSCK, 1);
+        busy_wait_at_least_cycles(LCD_READ_HALF_CYCLES);
+        v = (v << 1) | gpio_get(st7789_pinTX);
+        gpio_put(st7789_pinSCK, 0);
+        busy_wait_at_least_cycles(LCD_READ_HALF_CYCLES);
+    }
+    return v;
+}
+
+static void ST7789_ReadData(uint8_t *buff, size_t buff_size)
+{
+    if (readMode == LCD_READ_3WIRE)
+    {
+        while (buff_size--)
+            *buff++ = ST7789_ReadByteSDA();
+    }
+    else
+        spi_read_blocking(st7789_spi, 0x00, buff, buff_size);
+}
+
+// Send a read command (CS already low) and turn the bus around for data
+static void ST7789_BeginRead(uint8_t cmd)
+{
+    ST7789_WriteCommand(cmd);
+    ST7789_RegData();
+    if (readMode == LCD_READ_3WIRE)
+    {
+        // Take SCK and SDA from the SPI block; the clock idles low (mode 0)
+        gpio_init(st7789_pinSCK);
+        gpio_set_dir(st7789_pinSCK, GPIO_OUT);
+        gpio_put(st7789_pinSCK, 0);
+        gpio_init(st7789_pinTX); // Input
+    }
+    else
+    {
+        readBaud = spi_get_baudrate(st7789_spi);
+        if (readBaud > LCD_READ_BAUD)
+            spi_set_baudrate(st7789_spi, LCD_READ_BAUD);
+    }
+}
+
+static void ST7789_EndRead()
+{
+    ST7789_DeSelect(); // Ends the read and releases SDA on the panel side
+    if (readMode == LCD_READ_3WIRE)
+    {
+        gpio_set_function(st7789_pinSCK, GPIO_FUNC_SPI);
+        gpio_set_function(st7789_pinTX, GPIO_FUNC_SPI);
+    }
+    else if (readBaud > LCD_READ_BAUD)
+        spi_set_baudrate(st7789_spi, readBaud);
+}
+
+bool LCD_ReadBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    if (readMode == LCD_READ_NONE)
+        return false;
+
+    LCD_queueWait(); // Read what the queue has written, not what was there before
+    ST7789_Select();
+    ST7789_SetWindow(x, y, w, h);
+    ST7789_BeginRead(ST77XX_RAMRD);
+
+    uint8_t raw[48]; // 16 pixels of R, G, B bytes
+    ST7789_ReadData(raw, 1); // 8 dummy clocks before the first pixel
+    uint32_t n = (uint32_t)w * h;
+    while (n)
+    {
+        uint32_t chunk = n > 16 ? 16 : n;
+        ST7789_ReadData(raw, chunk * 3);
+        // Each byte holds a 6-bit component in bits 7..2
+        for (uint32_t i = 0; i < chunk; i++)
+            *bitmap++ = ((raw[3 * i] & 0xF8) << 8) | ((raw[3 * i + 1] & 0xFC) << 3) | (raw[3 * i + 2] >> 3);
+        n -= chunk;
+    }
+
+    ST7789_EndRead();
+    return true;
+}
+
+uint32_t LCD_ReadID()
+{
+    if (readMode == LCD_READ_NONE)
+        return 0;
+
+    LCD_queueWait();
+    ST7789_Select();
+    ST7789_BeginRead(ST77XX_RDDID);
+    // One dummy clock, then 24 bits; read 32 clocks and drop the spare ones
+    uint8_t raw[4];
+    ST7789_ReadData(raw, 4);
+    ST7789_EndRead();
+
+    uint32_t v = ((uint32_t)raw[0] << 24) | ((uint32_t)raw[1] << 16) | ((uint32_t)raw[2] << 8) | raw[3];
+    return (v >> 7) & 0xFFFFFF;
+}
+
+bool LCD_scrollRows(uint16_t offset)
+{
+    return LCD_scrollRegion(0, _height, offset);
+}
+
+bool LCD_scrollRegion(uint16_t y, uint16_t h, uint16_t offset)
+{
+    if (rotation & 1)
+        return false; // MV: the scan direction runs across the picture
+    if (h == 0 || y + h > _height)
+        return false;
+
+    // The scroll area is set to exactly the band's rows, so the picture
+    // wraps within itself and never shows the unused memory rows. In
+    // rotation 0, MY stores the picture bottom-up in memory, so the band
+    // starts lower in memory and the same movement is the opposite offset.
+    const uint16_t memRows = 320;
+    uint16_t top = rotation == 0 ? memRows - _ystart - y - h : _ystart + y;
+    offset %= h;
+    uint16_t start = top + (rotation == 0 ? (h - offset) % h : offset);
+
+    uint8_t area[6] = {(uint8_t)(top >> 8), (uint8_t)top, (uint8_t)(h >> 8), (uint8_t)h,
+                       (uint8_t)((memRows - top - h) >> 8), (uint8_t)(memRows - top - h)};
+    uint8_t vsp[2] = {(uint8_t)(start >> 8), (uint8_t)start};
+
+    LCD_cacheFlush(); // Pending pixels belong to the picture before the move
+    LCD_queueWait();
+    ST7789_SendCommand(ST77XX_VSCRDEF, area, 6);
+    ST7789_SendCommand(ST77XX_VSCSAD, vsp, 2);
+    return true;
+}
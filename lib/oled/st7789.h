@@ -42,9 +42,11 @@
 #define ST77XX_RAMRD 0x2E   ///< Memory read
 
 #define ST77XX_PTLAR 0x30  ///< Partial area
+#define ST77XX_VSCRDEF 0x33 ///< Vertical scrolling definition
 #define ST77XX_TEOFF 0x34  ///< Tearing effect line off
 #define ST77XX_TEON 0x35   ///< Tearing effect line on
 #define ST77XX_MADCTL 0x36 ///< Memory access control
+#define ST77XX_VSCSAD 0x37 ///< Vertical scroll start address
 #define ST77XX_COLMOD 0x3A ///< Pixel format set
 
 // Memory Access Control Register bits
@@ -118,4 +120,82 @@ void LCD_WritePixel(int x, int y, uint16_t col);
  */
 void LCD_WriteBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
 
+/**
+ * @brief Fill a window on the display with a single color
+ * @param x Starting X coordinate
+ * @param y Starting Y coordinate
+ * @param w Width of the window
+ * @param h Height of the window
+ * @param col 16-bit RGB565 color value
+ * @note With USE_DMA the color is streamed from a non-incrementing DMA source
+ */
+void LCD_FillWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t col);
+
+/**
+ * @brief Move the picture up by a number of rows, wrapping around (hardware scroll)
+ * @param offset Rows to move by, 0 to height-1; 0 shows the picture as written
+ * @return false in rotations 1 and 3, where the panel can only scroll sideways
+ * @note Only what the panel shows moves: row y still reads and writes at y,
+ *       and appears on screen at row (y - offset) mod height.
+ */
+bool LCD_scrollRows(uint16_t offset);
+
+/**
+ * @brief Move the picture in a band of rows up by a number of rows, wrapping within the band
+ * @param y First row of the band
+ * @param h Rows in the band; the rows above and below it stay put
+ * @param offset Rows to move by, 0 to h-1
+ * @return false in rotations 1 and 3, or if the band is off the screen
+ * @note As with LCD_scrollRows(), band row r appears at (r - offset) mod h.
+ *       The panel keeps one scroll band, so this replaces any earlier one.
+ */
+bool LCD_scrollRegion(uint16_t y, uint16_t h, uint16_t offset);
+
+// Panel readback wiring (LCD_setReadMode)
+#define LCD_READ_NONE 0  ///< Write-only wiring (default)
+#define LCD_READ_3WIRE 1 ///< SDA is bidirectional: reads turn it around and clock it by hand
+#define LCD_READ_4WIRE 2 ///< Panel SDO wired to an SPI RX (MISO) pin
+
+/** @brief Highest SPI clock used for 4-wire reads (the read cycle is 150 ns minimum) */
+#ifndef LCD_READ_BAUD
+#define LCD_READ_BAUD 6000000
+#endif
+
+/** @brief CPU cycles per half clock when clocking 3-wire reads by hand */
+#ifndef LCD_READ_HALF_CYCLES
+#define LCD_READ_HALF_CYCLES 10
+#endif
+
+/**
+ * @brief Tell the driver how the panel can be read back
+ * @param mode LCD_READ_NONE, LCD_READ_3WIRE or LCD_READ_4WIRE
+ * @param rx SPI RX pin for LCD_READ_4WIRE, otherwise ignored (-1)
+ */
+void LCD_setReadMode(uint8_t mode, int16_t rx);
+
+/**
+ * @brief Whether the panel can be read back
+ */
+bool LCD_canRead();
+
+/**
+ * @brief Read a window of display RAM (RAMRD)
+ * @param x Starting X coordinate
+ * @param y Starting Y coordinate
+ * @param w Width of the window
+ * @param h Height of the window
+ * @param bitmap Destination for w * h RGB565 pixels
+ * @return false if no read wiring is configured
+ * @note The panel returns 18-bit pixels (one 6-bit component per byte, MSB
+ *       aligned) after 8 dummy clocks; they are packed back to RGB565. Pixels
+ *       still queued in the write-combining cache are not flushed here.
+ */
+bool LCD_ReadBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+/**
+ * @brief Read the 24-bit display ID (RDDID: manufacturer, version, driver)
+ * @return ID, or 0 if no read wiring is configured
+ */
+uint32_t LCD_ReadID();
+
 #endif
\ No newline at end of file
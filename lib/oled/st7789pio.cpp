@@ -0,0 +1,225 @@
+// PIO display transmitter
+// Ale Moglia / @bartola-valves valves@bartola.co.uk
+//
+// Two DMA channels: the data channel feeds the state machine's TX FIFO and,
+// when done, chains to the control channel. The control channel copies the
+// next 16-byte control block (read address, write address, count, control)
+// into the data channel's registers, and the final write re-triggers it. An
+// all-zero block is a null trigger and ends the chain.
+//
+// Each rectangle (or the part of one that fits) adds:
+// - a header block of 11 words from streamWords: CASET, RASET and RAMWR with
+//   their parameters, and the header for the pixel burst;
+// - one 16-bit pixel block per row, or a single block when the rows are
+//   contiguous. 16-bit writes to the FIFO are replicated into both halves,
+//   so each pixel is shifted out from the top 16 bits.
+
+#include "st7789pio.h"
+#include "st7789.h"
+#include "pixcache.h"
+#include "readcache.h"
+#include "lcdqueue.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "st7789_tx.pio.h"
+
+extern int16_t _xstart, _ystart;
+extern uint16_t st7789_pinCS, st7789_pinDC, st7789_pinSCK, st7789_pinTX;
+
+#define WORDS_PER_WINDOW 11
+#define MAX_WORDS (WORDS_PER_WINDOW * (LCD_PIO_MAX_BLOCKS / 2) + 1)
+
+typedef struct
+{
+    const volatile void *read;
+    volatile void *write;
+    uint32_t count;
+    uint32_t ctrl;
+} DmaBlock;
+
+static DmaBlock blocks[LCD_PIO_MAX_BLOCKS + 1]; // + the null block
+static uint32_t streamWords[MAX_WORDS];
+static const DmaBlock *chainEnd; // Control channel read address once the chain has run
+
+static PIO txPio;
+static uint txSm, txOffset;
+static int dmaData = -1, dmaCtrl = -1;
+static uint32_t ctrl16, ctrl32; // Data channel control values per transfer size
+static bool pioActive = false;
+
+bool LCD_pioInit(PIO pio, float clkdiv)
+{
+    if (pioActive)
+        return true;
+    if (st7789_pinCS != st7789_pinDC + 1 || !pio_can_add_program(pio, &st7789_tx_program))
+        return false;
+    int sm = pio_claim_unused_sm(pio, false);
+    if (sm < 0)
+        return false;
+
+    LCD_cacheFlush(); // Queued pixels still go out over SPI
+    LCD_queueWait();
+
+    txPio = pio;
+    txSm = sm;
+    txOffset = pio_add_program(pio, &st7789_tx_program);
+    st7789_tx_program_init(pio, sm, txOffset, st7789_pinTX, st7789_pinSCK, st7789_pinDC, clkdiv);
+
+    dmaData = dma_claim_unused_channel(true);
+    dmaCtrl = dma_claim_unused_channel(true);
+
+    dma_channel_config c = dma_channel_get_default_config(dmaData);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    channel_config_set_chain_to(&c, dmaCtrl);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    ctrl16 = channel_config_get_ctrl_value(&c);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    ctrl32 = channel_config_get_ctrl_value(&c);
+    dma_channel_configure(dmaData, &c, &pio->txf[sm], NULL, 0, false);
+
+    // Four words per trigger into the data channel's registers, wrapping every 16 bytes
+    c = dma_channel_get_default_config(dmaCtrl);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, 4);
+    dma_channel_configure(dmaCtrl, &c, &dma_channel_hw_addr(dmaData)->read_addr, blocks, 4, false);
+
+    chainEnd = NULL;
+    pioActive = true;
+    return true;
+}
+
+void LCD_pioRelease()
+{
+    if (!pioActive)
+        return;
+    LCD_pioWait();
+
+    pio_sm_set_enabled(txPio, txSm, false);
+    pio_remove_program(txPio, &st7789_tx_program, txOffset);
+    pio_sm_unclaim(txPio, txSm);
+    dma_channel_unclaim(dmaData);
+    dma_channel_unclaim(dmaCtrl);
+    pioActive = false;
+
+    gpio_set_function(st7789_pinSCK, GPIO_FUNC_SPI);
+    gpio_set_function(st7789_pinTX, GPIO_FUNC_SPI);
+    gpio_init(st7789_pinDC);
+    gpio_set_dir(st7789_pinDC, GPIO_OUT);
+    gpio_put(st7789_pinDC, 1);
+    gpio_init(st7789_pinCS);
+    gpio_set_dir(st7789_pinCS, GPIO_OUT);
+    gpio_put(st7789_pinCS, 1);
+}
+
+bool LCD_pioBusy()
+{
+    if (!pioActive || chainEnd == NULL)
+        return false;
+    if (dma_channel_is_busy(dmaCtrl) || dma_channel_is_busy(dmaData) ||
+        dma_channel_hw_addr(dmaCtrl)->read_addr != (uintptr_t)chainEnd)
+        return true;
+    // The last word is the CS release; once it has run the state machine
+    // waits for a header with an empty FIFO
+    return !pio_sm_is_tx_fifo_empty(txPio, txSm) || pio_sm_get_pc(txPio, txSm) != txOffset;
+}
+
+void LCD_pioWait()
+{
+    while (LCD_pioBusy())
+        tight_loop_contents();
+    chainEnd = NULL;
+}
+
+static void setBlock(uint16_t i, const volatile void *read, uint32_t count, uint32_t ctrl)
+{
+    blocks[i].read = read;
+    blocks[i].write = &txPio->txf[txSm];
+    blocks[i].count = count;
+    blocks[i].ctrl = ctrl;
+}
+
+// CASET/RASET/RAMWR for a window and the header of its pixel burst
+static uint16_t encodeWindow(uint32_t *w, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    x += _xstart;
+    y += _ystart;
+    w[0] = LCD_pioHeader(false, 8, 1);
+    w[1] = (uint32_t)ST77XX_CASET << 24;
+    w[2] = LCD_pioHeader(true, 32, 1);
+    w[3] = ((uint32_t)x << 16) | (x + width - 1);
+    w[4] = LCD_pioHeader(false, 8, 1);
+    w[5] = (uint32_t)ST77XX_RASET << 24;
+    w[6] = LCD_pioHeader(true, 32, 1);
+    w[7] = ((uint32_t)y << 16) | (y + height - 1);
+    w[8] = LCD_pioHeader(false, 8, 1);
+    w[9] = (uint32_t)ST77XX_RAMWR << 24;
+    w[10] = LCD_pioHeader(true, 16, (uint32_t)width * height);
+    return WORDS_PER_WINDOW;
+}
+
+void LCD_pioWriteRects(const LCDrect *rects, uint8_t n)
+{
+    if (!pioActive)
+        return;
+
+    uint8_t r = 0;
+    uint16_t row = 0;
+    while (r < n)
+    {
+        LCD_pioWait(); // The block and word buffers are reused
+
+        uint16_t nb = 0, nw = 0;
+        while (r < n)
+        {
+            const LCDrect *rc = &rects[r];
+            if (rc->w == 0 || rc->h == 0)
+            {
+                r++;
+                continue;
+            }
+            // Keep one block for the CS release
+            uint16_t room = LCD_PIO_MAX_BLOCKS - 1 - nb;
+            if (room < 2 || nw + WORDS_PER_WINDOW + 1 > MAX_WORDS)
+                break;
+
+            bool contiguous = rc->stride == rc->w;
+            uint16_t rows = rc->h - row;
+            if (!contiguous && rows > room - 1)
+                rows = room - 1;
+
+            const uint16_t *src = rc->pixels + (uint32_t)row * rc->stride;
+            setBlock(nb++, &streamWords[nw], WORDS_PER_WINDOW, ctrl32);
+            nw += encodeWindow(&streamWords[nw], rc->x, rc->y + row, rc->w, rows);
+            if (contiguous)
+                setBlock(nb++, src, (uint32_t)rc->w * rows, ctrl16);
+            else
+                for (uint16_t i = 0; i < rows; i++)
+                    setBlock(nb++, src + (uint32_t)i * rc->stride, rc->w, ctrl16);
+
+            row += rows;
+            if (row == rc->h)
+            {
+                r++;
+                row = 0;
+            }
+        }
+        if (nb == 0)
+            break;
+
+        streamWords[nw] = LCD_PIO_END;
+        setBlock(nb++, &streamWords[nw], 1, ctrl32);
+        blocks[nb].read = NULL; // All zero: a null trigger that stops the chain
+        blocks[nb].write = NULL;
+        blocks[nb].count = 0;
+        blocks[nb].ctrl = 0;
+        chainEnd = &blocks[nb + 1];
+        dma_channel_set_read_addr(dmaCtrl, blocks, true);
+    }
+
+    LCD_readCacheInvalidate(); // Written behind the read cache's back
+}
@@ -0,0 +1,89 @@
+/**
+ * @file st7789pio.h
+ * @brief PIO display transmitter: whole multi-rectangle flushes as one DMA chain
+ * @author Ale Moglia
+ * @date 2025
+ *
+ * The SPI path needs the CPU around every command: DC has to be toggled and
+ * the SPI frame size switched between 8-bit commands and 16-bit pixels. The
+ * PIO program in st7789_tx.pio instead reads a tagged word stream in which
+ * each burst carries its own DC level and word size, and a control word
+ * raises CS. The CASET/RASET/RAMWR sequences and the pixel rows of several
+ * rectangles are then described by DMA control blocks: headers come from a
+ * small word buffer, and pixels straight from the caller's buffer. The whole
+ * flush runs without the CPU.
+ *
+ * While the transmitter is active it owns SCK, SDA, DC and CS, so the SPI
+ * calls in st7789.h must not be used until LCD_pioRelease().
+ */
+
+#ifndef ST7789PIO_H
+#define ST7789PIO_H
+
+#include <stdint.h>
+#include "hardware/pio.h"
+
+/** @brief DMA control blocks per chain (16 bytes each); longer jobs run as several chains */
+#ifndef LCD_PIO_MAX_BLOCKS
+#define LCD_PIO_MAX_BLOCKS 64
+#endif
+
+/** @brief Stream control word: raise CS, ending the transaction */
+#define LCD_PIO_END 0x80000000u
+
+/**
+ * @brief Stream header for a burst of payload words
+ * @param dc false for command bytes, true for data
+ * @param bits Bits sent from the top of each payload word, 1..32
+ * @param words Payload words that follow, 1..2^25
+ */
+static inline uint32_t LCD_pioHeader(bool dc, uint8_t bits, uint32_t words)
+{
+    return (dc ? 1u << 30 : 0) | ((uint32_t)(bits - 1) << 25) | (words - 1);
+}
+
+/** @brief A rectangle of pixels to send */
+typedef struct
+{
+    uint16_t x, y, w, h;     ///< Window on the display
+    const uint16_t *pixels;  ///< First pixel of the top row
+    uint16_t stride;         ///< Pixels from one row to the next in the source
+} LCDrect;
+
+/**
+ * @brief Hand the display bus to a PIO state machine
+ * @param pio PIO block to load the program into (pio0 or pio1)
+ * @param clkdiv State machine clock divider; SCK runs at clk_sys / (2 * clkdiv)
+ * @return false if DC and CS are not consecutive GPIOs (DC first), or there
+ *         is no free state machine or program space
+ */
+bool LCD_pioInit(PIO pio, float clkdiv);
+
+/**
+ * @brief Wait for the transmitter to finish and give the pins back to SPI
+ */
+void LCD_pioRelease();
+
+/**
+ * @brief Send rectangles through the transmitter
+ * @param rects Rectangles, sent in order
+ * @param n Number of rectangles
+ * @note Returns as soon as the last chain is started. The rects array can
+ *       be reused straight away, but the pixels are read by DMA and must
+ *       stay untouched until LCD_pioWait(). A job needing more
+ *       than LCD_PIO_MAX_BLOCKS control blocks runs as several chains, and
+ *       the CPU only steps in between them.
+ */
+void LCD_pioWriteRects(const LCDrect *rects, uint8_t n);
+
+/**
+ * @brief Whether a chain is still being sent
+ */
+bool LCD_pioBusy();
+
+/**
+ * @brief Wait until everything queued has reached the panel and CS is high
+ */
+void LCD_pioWait();
+
+#endif
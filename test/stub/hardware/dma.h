@@ -0,0 +1,55 @@
+// Host stand-in for the Pico SDK (see pico/stdlib.h)
+#pragma once
+#include "pico/stdlib.h"
+
+typedef struct
+{
+    uint32_t ctrl;
+} dma_channel_config;
+
+typedef struct
+{
+    volatile uintptr_t read_addr, write_addr, transfer_count, ctrl_trig;
+    volatile uint32_t al1_ctrl, al1_read_addr, al1_write_addr, al1_transfer_count_trig;
+} dma_channel_hw_t;
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8,
+    DMA_SIZE_16,
+    DMA_SIZE_32
+};
+
+#define DMA_SNIFF_CTRL_CALC_VALUE_CRC32 0
+#define DMA_IRQ_0 11
+
+int dma_claim_unused_channel(bool required);
+void dma_channel_unclaim(uint channel);
+dma_channel_config dma_channel_get_default_config(uint channel);
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size);
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to);
+void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits);
+void channel_config_set_sniff_enable(dma_channel_config *c, bool sniff_enable);
+void channel_config_set_irq_quiet(dma_channel_config *c, bool irq_quiet);
+uint32_t channel_config_get_ctrl_value(const dma_channel_config *c);
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger);
+void dma_channel_wait_for_finish_blocking(uint channel);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger);
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger);
+void dma_channel_start(uint channel);
+void dma_channel_abort(uint channel);
+void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+void dma_channel_acknowledge_irq0(uint channel);
+bool dma_channel_get_irq0_status(uint channel);
+dma_channel_hw_t *dma_channel_hw_addr(uint channel);
+void dma_sniffer_enable(uint channel, uint mode, bool force_channel_enable);
+void dma_sniffer_disable();
+void dma_sniffer_set_data_accumulator(uint32_t value);
+uint32_t dma_sniffer_get_data_accumulator();
+void dma_sniffer_set_byte_swap_enabled(bool swap);
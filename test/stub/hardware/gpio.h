@@ -0,0 +1,26 @@
+// Host stand-in for the Pico SDK (see pico/stdlib.h)
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef unsigned int uint;
+
+enum gpio_function
+{
+    GPIO_FUNC_SPI,
+    GPIO_FUNC_SIO,
+    GPIO_FUNC_PIO0,
+    GPIO_FUNC_PIO1,
+    GPIO_FUNC_NULL
+};
+
+#define GPIO_OUT 1
+#define GPIO_IN 0
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+void gpio_set_function(uint gpio, enum gpio_function fn);
+void gpio_pull_up(uint gpio);
+void gpio_disable_pulls(uint gpio);
@@ -0,0 +1,12 @@
+// Host stand-in for the Pico SDK (see pico/stdlib.h)
+#pragma once
+#include "pico/stdlib.h"
+
+typedef void (*irq_handler_t)(void);
+
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+#define DMA_IRQ_0 11
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order);
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_set_enabled(uint num, bool enabled);
@@ -0,0 +1,33 @@
+// Host stand-in for the Pico SDK (see pico/stdlib.h)
+#pragma once
+#include "pico/stdlib.h"
+
+typedef struct spi_inst spi_inst_t;
+
+typedef struct
+{
+    volatile uint32_t cr0, cr1, dr, sr;
+} spi_hw_t;
+
+extern spi_inst_t *spi0, *spi1;
+#define spi_default spi0
+
+typedef int spi_cpol_t;
+typedef int spi_cpha_t;
+typedef int spi_order_t;
+enum { SPI_CPOL_0, SPI_CPOL_1 };
+enum { SPI_CPHA_0, SPI_CPHA_1 };
+enum { SPI_MSB_FIRST, SPI_LSB_FIRST };
+
+uint spi_init(spi_inst_t *spi, uint baudrate);
+void spi_set_format(spi_inst_t *spi, uint data_bits, int cpol, int cpha, int order);
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len);
+int spi_read_blocking(spi_inst_t *spi, uint8_t repeated_tx, uint8_t *dst, size_t len);
+int spi_write_read_blocking(spi_inst_t *spi, const uint8_t *src, uint8_t *dst, size_t len);
+spi_hw_t *spi_get_hw(spi_inst_t *spi);
+uint spi_get_dreq(spi_inst_t *spi, bool is_tx);
+bool spi_is_busy(spi_inst_t *spi);
+uint spi_get_index(spi_inst_t *spi);
+uint spi_get_baudrate(const spi_inst_t *spi);
+uint spi_set_baudrate(spi_inst_t *spi, uint baudrate);
@@ -0,0 +1,9 @@
+// Host stand-in for the Pico SDK (see pico/stdlib.h)
+#pragma once
+#include "pico/stdlib.h"
+
+void __wfe();
+void __sev();
+void __dmb();
+uint32_t save_and_disable_interrupts();
+void restore_interrupts(uint32_t status);
@@ -0,0 +1,12 @@
+// Host stand-in for the Pico SDK (see pico/stdlib.h)
+#pragma once
+#include "pico/stdlib.h"
+
+typedef struct
+{
+    int unused;
+} critical_section_t;
+
+void critical_section_init(critical_section_t *cs);
+void critical_section_enter_blocking(critical_section_t *cs);
+void critical_section_exit(critical_section_t *cs);
@@ -0,0 +1,31 @@
+// Host stand-in for the Pico SDK: only what lib/oled uses. The functions
+// are defined by the emulators in test/support or by the tests themselves.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "hardware/gpio.h"
+
+typedef uint64_t absolute_time_t;
+
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+uint64_t time_us_64();
+uint32_t time_us_32();
+absolute_time_t get_absolute_time();
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to);
+void tight_loop_contents();
+void busy_wait_at_least_cycles(uint32_t cycles);
+void stdio_init_all();
+void panic(const char *fmt, ...);
+
+#define __not_in_flash_func(f) f
+#define __not_in_flash(group)
+#define __time_critical_func(f) f
+#define __uninitialized_ram(name) name
+#define __scratch_x(group)
+#define __in_flash(group)
+
+#define PICO_DEFAULT_SPI_SCK_PIN 18
+#define PICO_DEFAULT_SPI_TX_PIN 19
+#define PICO_DEFAULT_SPI_RX_PIN 16
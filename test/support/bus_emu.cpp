@@ -0,0 +1,524 @@
+// ST7789 bus-level model (see bus_emu.h)
+
+#include <string.h>
+#include <vector>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/spi.h"
+#include "hardware/sync.h"
+#include "bus_emu.h"
+
+uint16_t gram[320][240];
+uint32_t busPanelId = 0x858552;
+int busErrors = 0;
+long busReadBits = 0;
+long busAsyncWords = 0;
+long busIrqCalls = 0;
+int busAsyncStep = 5;
+int busDmaChannels = 16;
+uint16_t busScrollTop = 0, busScrollRows = 320, busScrollStart = 0;
+int busScrollWrites = 0;
+void (*busOnCommand)(uint8_t cmd) = NULL;
+
+// Reads above this clock are out of the panel's spec
+#define BUS_READ_MAX_BAUD 6600000
+
+static bool level[32];
+static int func[32];
+static bool isOut[32];
+static uint baud = 4000000;
+static int spiBits = 8;
+
+// Controller state
+static int cmd = -1, argN = 0;
+static uint8_t args[6];
+static int xs, xe, ys, ye, cx, cy;
+static int byteHi = -1;
+static std::vector<uint8_t> readBits; // Bits the panel will shift out, MSB first
+static size_t readPos = 0;
+static bool reading = false;
+static int sdaBit = 0; // Level the panel drives on SDA in 3-wire reads
+static const int dummyByte = 0x5A;
+
+static void pushByte(uint8_t b)
+{
+    for (int i = 7; i >= 0; i--)
+        readBits.push_back((b >> i) & 1);
+}
+
+// RAMRD: 8 dummy clocks, then 6 bits per component in the top of each byte.
+// RDDID: 1 dummy clock, then 24 bits of ID.
+static void startRead()
+{
+    readBits.clear();
+    readPos = 0;
+    reading = true;
+    if (cmd == 0x2E)
+    {
+        pushByte(dummyByte);
+        int x = xs, y = ys;
+        for (int n = 0; n < (xe - xs + 1) * (ye - ys + 1); n++)
+        {
+            uint16_t c = gram[y][x];
+            int r = c >> 11, g = (c >> 5) & 63, b = c & 31;
+            pushByte(((r << 1) | (r >> 4)) << 2);
+            pushByte(g << 2);
+            pushByte(((b << 1) | (b >> 4)) << 2);
+            if (++x > xe)
+            {
+                x = xs;
+                y++;
+            }
+        }
+    }
+    else if (cmd == 0x04)
+    {
+        readBits.push_back(1);
+        for (int i = 23; i >= 0; i--)
+            readBits.push_back((busPanelId >> i) & 1);
+    }
+}
+
+static int nextBit()
+{
+    busReadBits++;
+    if (baud > BUS_READ_MAX_BAUD)
+        busErrors++;
+    return readPos < readBits.size() ? readBits[readPos++] : 0;
+}
+
+static void panelByte(uint8_t b)
+{
+    if (level[BUS_PIN_CS])
+    {
+        busErrors++; // Not selected
+        return;
+    }
+    if (!level[BUS_PIN_DC])
+    {
+        if (busOnCommand)
+            busOnCommand(b);
+        cmd = b;
+        argN = 0;
+        byteHi = -1;
+        reading = false;
+        if (cmd == 0x2C)
+        {
+            cx = xs;
+            cy = ys;
+        }
+        if (cmd == 0x2E || cmd == 0x04)
+            startRead();
+        return;
+    }
+    if (cmd == 0x2A || cmd == 0x2B)
+    {
+        if (argN < 4)
+            args[argN++] = b;
+        if (argN == 4)
+        {
+            int s = (args[0] << 8) | args[1], e = (args[2] << 8) | args[3];
+            if (cmd == 0x2A)
+            {
+                xs = s;
+                xe = e;
+            }
+            else
+            {
+                ys = s;
+                ye = e;
+            }
+        }
+        return;
+    }
+    if (cmd == 0x33 || cmd == 0x37)
+    {
+        if (argN < 6)
+            args[argN++] = b;
+        if (cmd == 0x33 && argN == 6)
+        {
+            busScrollTop = (args[0] << 8) | args[1];
+            busScrollRows = (args[2] << 8) | args[3];
+            if (busScrollTop + busScrollRows + ((args[4] << 8) | args[5]) != 320)
+                busErrors++; // Areas must add up to the 320 memory lines
+        }
+        if (cmd == 0x37 && argN == 2)
+        {
+            busScrollStart = (args[0] << 8) | args[1];
+            busScrollWrites++;
+            if (busScrollStart < busScrollTop || busScrollStart >= busScrollTop + busScrollRows)
+                busErrors++; // Outside the scroll area
+        }
+        return;
+    }
+    if (cmd == 0x2C)
+    {
+        if (byteHi < 0)
+        {
+            byteHi = b;
+            return;
+        }
+        uint16_t c = (byteHi << 8) | b;
+        byteHi = -1;
+        if (cy <= ye && cy < 320 && cx < 240)
+            gram[cy][cx] = c;
+        if (++cx > xe)
+        {
+            cx = xs;
+            cy++;
+        }
+    }
+}
+
+uint16_t busShown(int x, int y)
+{
+    if (y >= busScrollTop && y < busScrollTop + busScrollRows)
+        y = busScrollTop + (y - busScrollTop + busScrollStart - busScrollTop) % busScrollRows;
+    return gram[y][x];
+}
+
+// ---- SPI ----
+
+spi_inst_t *spi0 = (spi_inst_t *)1, *spi1 = (spi_inst_t *)2;
+static spi_hw_t spiHw;
+
+static bool spiOwnsBus()
+{
+    return func[BUS_PIN_SCK] == GPIO_FUNC_SPI && func[BUS_PIN_TX] == GPIO_FUNC_SPI;
+}
+
+uint spi_init(spi_inst_t *, uint b)
+{
+    baud = b;
+    return b;
+}
+
+void spi_set_format(spi_inst_t *, uint bits, int, int, int)
+{
+    spiBits = bits;
+}
+
+uint spi_get_baudrate(const spi_inst_t *)
+{
+    return baud;
+}
+
+uint spi_set_baudrate(spi_inst_t *, uint b)
+{
+    baud = b;
+    return b;
+}
+
+int spi_write_blocking(spi_inst_t *, const uint8_t *src, size_t n)
+{
+    if (!spiOwnsBus() || busAsyncActive())
+        busErrors++;
+    for (size_t i = 0; i < n; i++)
+        panelByte(src[i]);
+    return n;
+}
+
+int spi_write16_blocking(spi_inst_t *, const uint16_t *src, size_t n)
+{
+    if (!spiOwnsBus() || busAsyncActive())
+        busErrors++;
+    for (size_t i = 0; i < n; i++)
+    {
+        panelByte(src[i] >> 8);
+        panelByte(src[i] & 0xFF);
+    }
+    return n;
+}
+
+int spi_read_blocking(spi_inst_t *, uint8_t, uint8_t *dst, size_t n)
+{
+    if (func[BUS_PIN_RX] != GPIO_FUNC_SPI || !reading)
+        busErrors++;
+    for (size_t i = 0; i < n; i++)
+    {
+        int v = 0;
+        for (int k = 0; k < 8; k++)
+            v = (v << 1) | nextBit();
+        dst[i] = v;
+    }
+    return n;
+}
+
+spi_hw_t *spi_get_hw(spi_inst_t *)
+{
+    return &spiHw;
+}
+
+uint spi_get_dreq(spi_inst_t *, bool)
+{
+    return 0;
+}
+
+bool spi_is_busy(spi_inst_t *)
+{
+    return false;
+}
+
+// ---- GPIO: a rising SCK edge under software control clocks a read bit ----
+
+void gpio_init(uint p)
+{
+    func[p] = GPIO_FUNC_SIO;
+    isOut[p] = false;
+    level[p] = 0;
+}
+
+void gpio_set_dir(uint p, bool out)
+{
+    isOut[p] = out;
+}
+
+void gpio_put(uint p, bool v)
+{
+    if (busAsyncActive() && (p == BUS_PIN_CS || p == BUS_PIN_DC))
+        busErrors++; // Control lines moved under a running transfer
+    bool old = level[p];
+    level[p] = v;
+    if (p == BUS_PIN_CS && v)
+        reading = false;
+    if (p == BUS_PIN_SCK && func[p] == GPIO_FUNC_SIO && v && !old && !level[BUS_PIN_CS])
+    {
+        // 3-wire read: SDA must have been released to the panel
+        if (!reading || isOut[BUS_PIN_TX] || func[BUS_PIN_TX] != GPIO_FUNC_SIO)
+            busErrors++;
+        sdaBit = nextBit();
+    }
+}
+
+bool gpio_get(uint p)
+{
+    return p == BUS_PIN_TX ? sdaBit : level[p];
+}
+
+void gpio_set_function(uint p, enum gpio_function f)
+{
+    func[p] = f;
+}
+
+// ---- Time ----
+
+void busy_wait_at_least_cycles(uint32_t)
+{
+}
+
+void sleep_ms(uint32_t)
+{
+}
+
+void sleep_us(uint64_t)
+{
+}
+
+uint64_t time_us_64()
+{
+    return 0;
+}
+
+absolute_time_t get_absolute_time()
+{
+    return 0;
+}
+
+int64_t absolute_time_diff_us(absolute_time_t, absolute_time_t)
+{
+    return 0;
+}
+
+// ---- DMA: ctrl bit 0 read increment, bit 1 write increment, bits 2-3 size ----
+
+typedef struct
+{
+    bool on;
+    const uint8_t *read;
+    bool readInc;
+    int size;
+    uint32_t count;
+} AsyncChannel;
+
+static int nextChannel = 0;
+static AsyncChannel async[16];
+static bool irqEnabled[16], irqStatus[16];
+static irq_handler_t dmaHandler = NULL;
+static bool nvicEnabled = false;
+static int masked = 0;
+
+bool busAsyncActive()
+{
+    for (int i = 0; i < 16; i++)
+        if (async[i].on)
+            return true;
+    return false;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+    if (nextChannel >= busDmaChannels)
+    {
+        if (required)
+            busErrors++; // The SDK panics
+        return -1;
+    }
+    return nextChannel++;
+}
+
+void dma_channel_unclaim(uint)
+{
+}
+
+dma_channel_config dma_channel_get_default_config(uint)
+{
+    dma_channel_config c = {1 | (2u << 2)};
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size s)
+{
+    c->ctrl = (c->ctrl & ~12u) | ((uint32_t)s << 2);
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool b)
+{
+    c->ctrl = (c->ctrl & ~1u) | b;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool b)
+{
+    c->ctrl = (c->ctrl & ~2u) | (b << 1);
+}
+
+void channel_config_set_dreq(dma_channel_config *, uint)
+{
+}
+
+void channel_config_set_sniff_enable(dma_channel_config *, bool)
+{
+}
+
+void dma_sniffer_enable(uint, uint, bool)
+{
+}
+
+void dma_sniffer_set_data_accumulator(uint32_t)
+{
+}
+
+uint32_t dma_sniffer_get_data_accumulator()
+{
+    return 0;
+}
+
+void dma_channel_configure(uint ch, const dma_channel_config *c, volatile void *write,
+                           const volatile void *read, uint n, bool)
+{
+    bool readInc = c->ctrl & 1, writeInc = c->ctrl & 2;
+    int s = (c->ctrl >> 2) & 3, size = s == 0 ? 1 : s == 1 ? 2 : 4;
+    if (irqEnabled[ch] || (void *)write == (void *)&spiHw.dr)
+    {
+        // A panel transfer: only valid into SPI, with the panel selected for 16-bit data
+        if (async[ch].on || (void *)write != (void *)&spiHw.dr)
+            busErrors++;
+        if (!spiOwnsBus() || level[BUS_PIN_CS] || !level[BUS_PIN_DC] || spiBits != 16)
+            busErrors++;
+        async[ch] = {n > 0, (const uint8_t *)read, readInc, size, n};
+        return;
+    }
+    // Memory to memory: at once
+    char *w = (char *)write;
+    const char *r = (const char *)read;
+    for (uint i = 0; i < n; i++)
+    {
+        memmove(w, r, size);
+        if (writeInc)
+            w += size;
+        if (readInc)
+            r += size;
+    }
+}
+
+void dma_channel_wait_for_finish_blocking(uint ch)
+{
+    while (async[ch].on)
+        tight_loop_contents();
+}
+
+void dma_channel_set_irq0_enabled(uint ch, bool e)
+{
+    irqEnabled[ch] = e;
+}
+
+bool dma_channel_get_irq0_status(uint ch)
+{
+    return irqStatus[ch];
+}
+
+void dma_channel_acknowledge_irq0(uint ch)
+{
+    irqStatus[ch] = false;
+}
+
+void irq_add_shared_handler(uint, irq_handler_t h, uint8_t)
+{
+    dmaHandler = h;
+}
+
+void irq_set_enabled(uint, bool e)
+{
+    nvicEnabled = e;
+}
+
+uint32_t save_and_disable_interrupts()
+{
+    return masked++;
+}
+
+void restore_interrupts(uint32_t s)
+{
+    masked = s;
+}
+
+static void runIrq()
+{
+    if (masked || !nvicEnabled || !dmaHandler)
+        return;
+    for (int i = 0; i < 16; i++)
+        if (irqStatus[i])
+        {
+            busIrqCalls++;
+            dmaHandler();
+            return;
+        }
+}
+
+// Each call is a slice of time: running channels move a few words each,
+// then a pending IRQ is delivered
+void tight_loop_contents()
+{
+    for (int ch = 0; ch < 16; ch++)
+    {
+        AsyncChannel *a = &async[ch];
+        if (!a->on)
+            continue;
+        for (int k = 0; k < busAsyncStep && a->count; k++)
+        {
+            uint16_t v = a->size == 2 ? *(const uint16_t *)a->read : *a->read;
+            panelByte(v >> 8);
+            panelByte(v & 0xFF);
+            busAsyncWords++;
+            if (a->readInc)
+                a->read += a->size;
+            a->count--;
+        }
+        if (!a->count)
+        {
+            a->on = false;
+            irqStatus[ch] = irqEnabled[ch];
+        }
+    }
+    runIrq();
+}
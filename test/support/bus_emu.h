@@ -0,0 +1,41 @@
+// ST7789 model at the bus level, for tests of the panel driver itself.
+// The SPI, GPIO and DMA functions of the SDK are faked here and drive a
+// controller that decodes CASET/RASET/RAMWR and VSCRDEF/VSCSAD and answers
+// RAMRD and RDDID, in 3-wire (bit-banged SDA) and 4-wire (SPI RX) reads alike.
+//
+// DMA channels with IRQ 0 enabled, or writing the SPI data register, run
+// asynchronously: tight_loop_contents() moves a few words per call and
+// raises the IRQ when a channel finishes, so code that waits the way the
+// firmware does sees transfers complete in the background.
+#ifndef BUS_EMU_H
+#define BUS_EMU_H
+
+#include <stdint.h>
+
+#define BUS_PIN_DC 8
+#define BUS_PIN_CS 9
+#define BUS_PIN_RST 6
+#define BUS_PIN_SCK 10
+#define BUS_PIN_TX 11
+#define BUS_PIN_RX 12
+
+extern uint16_t gram[320][240]; // Controller RAM, RGB565
+extern uint32_t busPanelId;     // Returned by RDDID
+extern int busErrors;           // Protocol violations seen (must stay 0)
+extern long busReadBits;        // Bits clocked out of the panel
+extern long busAsyncWords;      // Words moved by asynchronous DMA
+extern long busIrqCalls;        // DMA IRQ handler invocations
+extern int busAsyncStep;        // Words an asynchronous channel moves per step
+extern int busDmaChannels;      // Channels dma_claim_unused_channel() hands out in all
+extern uint16_t busScrollTop, busScrollRows, busScrollStart; // Last VSCRDEF area and VSCSAD line
+extern int busScrollWrites;     // VSCSAD commands seen
+extern void (*busOnCommand)(uint8_t cmd); // Called as each command byte arrives, if set
+
+// True while an asynchronous DMA channel is still sending
+bool busAsyncActive();
+
+// Pixel the glass shows on controller line y, column x: lines in the
+// scroll area show the RAM line VSCSAD puts there, the rest show their own
+uint16_t busShown(int x, int y);
+
+#endif
@@ -0,0 +1,195 @@
+// Panel emulator at the LCD_* call level (see panel_emu.h), with the SDK
+// time and DMA functions the drawing code calls. DMA copies run at once.
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "panel_emu.h"
+
+extern uint16_t _width;  // Set by gfx.cpp from the rotation
+extern uint16_t _height;
+
+uint16_t panel[320 * 320];
+uint8_t emuWrites[320 * 320];
+long emuBytes = 0;
+long emuTx = 0;
+uint64_t emuNow = 0;
+
+void emuReset(uint16_t color)
+{
+    for (int i = 0; i < 320 * 320; i++)
+        panel[i] = color;
+    memset(emuWrites, 0, sizeof(emuWrites));
+    emuBytes = 0;
+    emuTx = 0;
+}
+
+// ---- Panel writes ----
+
+void LCD_WriteBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    emuTx++;
+    emuBytes += 2 * w * h;
+    for (int j = 0; j < h; j++)
+        for (int i = 0; i < w; i++)
+        {
+            panel[(y + j) * _width + x + i] = *bitmap++;
+            emuWrites[(y + j) * _width + x + i]++;
+        }
+}
+
+void LCD_FillWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    emuTx++;
+    emuBytes += 2 * w * h;
+    for (int j = 0; j < h; j++)
+        for (int i = 0; i < w; i++)
+        {
+            panel[(y + j) * _width + x + i] = color;
+            emuWrites[(y + j) * _width + x + i]++;
+        }
+}
+
+void LCD_WritePixel(int x, int y, uint16_t color)
+{
+    emuBytes += 2;
+    panel[y * _width + x] = color;
+    emuWrites[y * _width + x]++;
+}
+
+// Queue entries complete at once, in order
+void LCD_queueBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels, uint16_t stride)
+{
+    for (int j = 0; j < h; j++)
+        LCD_WriteBitmap(x, y + j, w, 1, (uint16_t *)pixels + j * stride);
+}
+
+void LCD_queueFill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    LCD_FillWindow(x, y, w, h, color);
+}
+
+void LCD_queueWait()
+{
+}
+
+// Streamed windows
+static int streamX, streamY, streamW, streamN;
+
+void LCD_beginWrite(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    streamX = x;
+    streamY = y;
+    streamW = w;
+    streamN = 0;
+    (void)h;
+}
+
+void LCD_pushPixels(const uint16_t *pixels, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++, streamN++)
+    {
+        int p = (streamY + streamN / streamW) * _width + streamX + streamN % streamW;
+        panel[p] = pixels[i];
+        emuWrites[p]++;
+    }
+    emuBytes += 2 * n;
+}
+
+void LCD_endWrite()
+{
+}
+
+// ---- No readback ----
+
+bool LCD_canRead()
+{
+    return false;
+}
+
+uint16_t LCD_readPixelCached(int16_t, int16_t)
+{
+    return 0;
+}
+
+bool LCD_ReadBitmap(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t *)
+{
+    return false;
+}
+
+void LCD_readCacheFill(int16_t, int16_t, uint16_t, uint16_t, uint16_t)
+{
+}
+
+void LCD_readCacheUpdate(int16_t, int16_t, uint16_t, uint16_t, const uint16_t *)
+{
+}
+
+void LCD_readCacheInvalidate()
+{
+}
+
+// ---- SDK ----
+
+uint64_t time_us_64()
+{
+    return emuNow;
+}
+
+absolute_time_t get_absolute_time()
+{
+    return emuNow;
+}
+
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to)
+{
+    return (int64_t)(to - from);
+}
+
+static bool dmaReadInc, dmaWriteInc;
+static int dmaSize = 1;
+
+int dma_claim_unused_channel(bool)
+{
+    return 0;
+}
+
+dma_channel_config dma_channel_get_default_config(uint)
+{
+    dma_channel_config c = {0};
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *, enum dma_channel_transfer_size size)
+{
+    dmaSize = size == DMA_SIZE_8 ? 1 : size == DMA_SIZE_16 ? 2 : 4;
+}
+
+void channel_config_set_read_increment(dma_channel_config *, bool incr)
+{
+    dmaReadInc = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *, bool incr)
+{
+    dmaWriteInc = incr;
+}
+
+void dma_channel_configure(uint, const dma_channel_config *, volatile void *write_addr,
+                           const volatile void *read_addr, uint count, bool)
+{
+    char *w = (char *)write_addr;
+    const char *r = (const char *)read_addr;
+    for (uint i = 0; i < count; i++)
+    {
+        memmove(w, r, dmaSize);
+        if (dmaWriteInc)
+            w += dmaSize;
+        if (dmaReadInc)
+            r += dmaSize;
+    }
+}
+
+void dma_channel_wait_for_finish_blocking(uint)
+{
+}
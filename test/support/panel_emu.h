@@ -0,0 +1,17 @@
+// Panel emulator at the LCD_* call level, for tests of the drawing code.
+// panel[] holds what the glass shows, row-major with the rotated width.
+#ifndef PANEL_EMU_H
+#define PANEL_EMU_H
+
+#include <stdint.h>
+
+extern uint16_t panel[320 * 320];
+extern uint8_t emuWrites[320 * 320]; // Times each pixel was written since emuReset()
+extern long emuBytes; // Pixel bytes written to the panel
+extern long emuTx;    // Window writes (bitmap or fill)
+extern uint64_t emuNow; // Value of time_us_64() and get_absolute_time()
+
+// Fill the glass with one color and zero the counters
+void emuReset(uint16_t color);
+
+#endif
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""
+Assemble a .pio file into a header for the host tests, without the SDK's pioasm.
+
+Covers the instructions and directives lib/oled/st7789_tx.pio uses (pull,
+out, jmp, set, mov; .side_set with one bit, .wrap_target, .wrap) and writes
+the same symbols pioasm does: <name>_program_instructions, <name>_program,
+<name>_wrap_target, <name>_wrap, <name>_program_get_default_config(), plus
+the % c-sdk block. Anything else is rejected, so a program that outgrows it
+fails the build instead of being mis-assembled.
+
+Usage:
+    python3 pioasm_lite.py program.pio > program.pio.h
+
+Ale Moglia / @bartola-valves valves@bartola.co.uk
+"""
+
+import re
+import sys
+
+JMP_COND = {"!x": 1, "x--": 2, "!y": 3, "y--": 4, "x!=y": 5, "pin": 6, "!osre": 7}
+OUT_DEST = {"pins": 0, "x": 1, "y": 2, "null": 3, "pindirs": 4, "pc": 5, "isr": 6, "exec": 7}
+SET_DEST = {"pins": 0, "x": 1, "y": 2, "pindirs": 4}
+MOV_DEST = {"pins": 0, "x": 1, "y": 2, "exec": 4, "pc": 5, "isr": 6, "osr": 7}
+MOV_SRC = {"pins": 0, "x": 1, "y": 2, "null": 3, "status": 5, "isr": 6, "osr": 7}
+
+
+def parse(src):
+    name = re.search(r"^\.program (\w+)", src, re.M).group(1)
+    body, _, rest = src.partition("% c-sdk {")
+    csdk = rest.partition("%}")[0]
+    labels, code = {}, []
+    wrap_target, wrap = 0, None
+    for line in body.split(".program", 1)[1].splitlines()[1:]:
+        line = line.split(";")[0].strip()
+        if not line:
+            continue
+        if line.startswith(".side_set"):
+            if line.split()[1:] != ["1"]:
+                raise SystemExit("only .side_set 1 is supported")
+        elif line == ".wrap_target":
+            wrap_target = len(code)
+        elif line == ".wrap":
+            wrap = len(code) - 1
+        elif line.endswith(":"):
+            labels[line[:-1]] = len(code)
+        else:
+            code.append(line)
+    if wrap is None:
+        wrap = len(code) - 1
+    return name, labels, code, wrap_target, wrap, csdk
+
+
+def encode(line, labels):
+    m = re.match(r"(.*?)\s+side\s+([01])$", line)
+    if not m:
+        raise SystemExit("missing side-set: " + line)
+    op, side = m.group(1), int(m.group(2))
+    t = op.replace(",", " ").split()
+    word = side << 12
+    if t[0] == "pull":
+        word |= 0x8080 | (0x20 if "block" in t else 0)
+    elif t[0] == "jmp":
+        cond = JMP_COND[t[1]] if len(t) == 3 else 0
+        word |= (cond << 5) | labels[t[-1]]
+    elif t[0] == "out":
+        word |= 0x6000 | (OUT_DEST[t[1]] << 5) | (int(t[2]) & 31)
+    elif t[0] == "set":
+        word |= 0xE000 | (SET_DEST[t[1]] << 5) | int(t[2], 0)
+    elif t[0] == "mov":
+        word |= 0xA000 | (MOV_DEST[t[1]] << 5) | MOV_SRC[t[2]]
+    else:
+        raise SystemExit("unsupported instruction: " + op)
+    return word
+
+
+def main():
+    if len(sys.argv) != 2:
+        raise SystemExit(__doc__)
+    name, labels, code, wrap_target, wrap, csdk = parse(open(sys.argv[1]).read())
+    print("// Generated by pioasm_lite.py from %s, for host tests only" % sys.argv[1].split("/")[-1])
+    print("#pragma once")
+    print()
+    print("#include \"hardware/pio.h\"")
+    print()
+    print("#define %s_wrap_target %d" % (name, wrap_target))
+    print("#define %s_wrap %d" % (name, wrap))
+    print()
+    print("static const uint16_t %s_program_instructions[] = {" % name)
+    for i, line in enumerate(code):
+        print("    0x%04x, // %2d: %s" % (encode(line, labels), i, line))
+    print("};")
+    print()
+    print("static const struct pio_program %s_program = {%s_program_instructions, %d, -1};"
+          % (name, name, len(code)))
+    print()
+    print("static inline pio_sm_config %s_program_get_default_config(uint offset)" % name)
+    print("{")
+    print("    pio_sm_config c = pio_get_default_sm_config();")
+    print("    sm_config_set_wrap(&c, offset + %s_wrap_target, offset + %s_wrap);" % (name, name))
+    print("    sm_config_set_sideset(&c, 1, false, false);")
+    print("    return c;")
+    print("}")
+    print(csdk)
+
+
+if __name__ == "__main__":
+    main()
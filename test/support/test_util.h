@@ -0,0 +1,26 @@
+// Shared checks for the host tests
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#include <stdio.h>
+
+static int testFailures = 0;
+
+#define CHECK(cond)                                                                    \
+    do                                                                                 \
+    {                                                                                  \
+        if (!(cond))                                                                   \
+        {                                                                              \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);            \
+            testFailures++;                                                            \
+        }                                                                              \
+    } while (0)
+
+// Print the verdict and return the process exit code
+static inline int testResult(const char *name)
+{
+    printf("%s: %s (%d failed checks)\n", name, testFailures ? "FAIL" : "PASS", testFailures);
+    return testFailures ? 1 : 0;
+}
+
+#endif
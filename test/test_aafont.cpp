@@ -0,0 +1,56 @@
+// Anti-aliased glyphs in direct mode on a panel that cannot be read back:
+// transparent text falls back to aliased coverage (half or more of full)
+// instead of painting every partly covered pixel in the text colour
+
+#include "gfx.h"
+#include "pixcache.h"
+#include "sans24aa.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// Glyph pixels at or above the coverage threshold
+static int solidPixels(const GFXfont *font, unsigned char c)
+{
+    const GFXglyph *g = &font->glyph[c - font->first];
+    uint8_t top = (1 << font->bpp) - 1;
+    int n = 0;
+    for (uint32_t i = 0; i < (uint32_t)g->width * g->height; i++)
+    {
+        uint32_t bit = i * font->bpp;
+        uint8_t v = (font->bitmap[g->bitmapOffset + (bit >> 3)] >> (8 - font->bpp - (bit & 7))) & top;
+        n += v >= (top + 1) / 2;
+    }
+    return n;
+}
+
+static int painted(uint16_t col)
+{
+    int n = 0;
+    for (int i = 0; i < 172 * 320; i++)
+        n += panel[i] == col;
+    return n;
+}
+
+int main()
+{
+    GFX_setFont(&Sans24AA);
+    const char *chars = "Ag@W";
+    for (const char *c = chars; *c; c++)
+    {
+        emuReset(0);
+        GFX_drawChar(20, 60, *c, 0xFFFF, 0xFFFF, 1, 1);
+        LCD_cacheFlush();
+        CHECK(painted(0xFFFF) == solidPixels(&Sans24AA, *c));
+        CHECK(painted(0xFFFF) + painted(0) == 172 * 320);
+    }
+
+    // Opaque text still uses the full ramp
+    emuReset(0);
+    GFX_drawChar(20, 60, 'A', 0xFFFF, 0x0000, 1, 1);
+    LCD_cacheFlush();
+    CHECK(painted(0xFFFF) + painted(0) < 172 * 320);
+    return testResult("aafont");
+}
@@ -0,0 +1,159 @@
+// Display arena: releases free exactly what was allocated after the mark,
+// GFX_arenaHolds() tells survivors from new allocations at the same address,
+// neither a release nor a reset frees a live framebuffer, font copies below
+// the framebuffer survive framebuffer re-creation, a display list released
+// with the framebuffer ends deferred mode, turning deferred mode on twice
+// keeps what was recorded, and recorded text is drawn with its font even if
+// the SRAM copy was replaced meanwhile
+
+#include <string.h>
+#include "gfx.h"
+#include "gfxarena.h"
+#include "fontcache.h"
+#include "gfxdefer.h"
+#include "sans24.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 240;
+uint16_t _height = 320;
+
+extern GFXfont *gfxFont;
+
+// Sans24 with every glyph solid, to stand in for another cached font
+static uint8_t solidBitmaps[sizeof(Sans24Bitmaps)];
+
+int main()
+{
+    emuReset(0);
+    GFX_arenaReset();
+
+    void *a = GFX_arenaAlloc(100, GFX_MEM_OTHER);
+    uint32_t genA = GFX_arenaGeneration();
+    size_t mark = GFX_arenaMark();
+    void *b = GFX_arenaAlloc(64, GFX_MEM_OTHER);
+    uint32_t genB = GFX_arenaGeneration();
+    CHECK(a && b);
+    CHECK(GFX_arenaHolds(a, genA) && GFX_arenaHolds(b, genB));
+    CHECK(!GFX_arenaHolds((uint8_t *)a + 4, genA)); // Not the start of an allocation
+
+    // Releasing to the mark frees b only; c reuses b's address
+    GFX_arenaRelease(mark);
+    CHECK(GFX_arenaHolds(a, genA));
+    CHECK(!GFX_arenaHolds(b, genB));
+    void *c = GFX_arenaAlloc(64, GFX_MEM_OTHER);
+    uint32_t genC = GFX_arenaGeneration();
+    CHECK(c == b);
+    CHECK(!GFX_arenaHolds(b, genB));
+    CHECK(GFX_arenaHolds(c, genC));
+
+    GFX_arenaReset();
+    CHECK(!GFX_arenaHolds(a, genA) && !GFX_arenaHolds(c, genC));
+
+    // The largest panel's framebuffer fits
+    CHECK(GFX_createFramebuf());
+    GFX_destroyFramebuf();
+
+    // Releases and resets stop above a live framebuffer: only what was
+    // allocated after it goes, and new allocations never overlap it
+    CHECK(GFX_createFramebuf());
+    uint16_t *fb = gfxFramebuffer;
+    size_t above = GFX_arenaMark();
+    void *d = GFX_arenaAlloc(64, GFX_MEM_OTHER);
+    uint32_t genD = GFX_arenaGeneration();
+    GFX_arenaRelease(0);
+    CHECK(GFX_arenaMark() == above && !GFX_arenaHolds(d, genD));
+    GFX_fillRect(0, 0, 4, 4, 0x2222);
+    CHECK(GFX_arenaAlloc(64, GFX_MEM_OTHER) != NULL);
+    GFX_arenaReset();
+    CHECK(GFX_arenaMark() == above && gfxFramebuffer == fb);
+    void *rest = GFX_arenaAlloc(GFX_ARENA_SIZE - above, GFX_MEM_OTHER);
+    CHECK(rest != NULL);
+    memset(rest, 0, GFX_ARENA_SIZE - above);
+    CHECK(GFX_getRow(3)[3] == 0x2222);
+    GFX_destroyFramebuf();
+    GFX_arenaReset();
+    CHECK(GFX_arenaMark() == 0);
+
+    // A font copied before the framebuffer is kept across destroy/create:
+    // no re-copy, and the arena does not grow
+    GFX_setFontCacheBudget(8 * 1024);
+    GFX_setFontAutoCache(true);
+    GFX_setFont(&Sans24);
+    const GFXfont *copy = gfxFont;
+    CHECK(copy != &Sans24);
+    CHECK(GFX_createFramebuf());
+    size_t used = GFX_arenaMark();
+    size_t fontBytes = GFX_fontCacheUsed();
+    for (int i = 0; i < 5; i++)
+    {
+        GFX_destroyFramebuf();
+        CHECK(GFX_createFramebuf());
+    }
+    CHECK(GFX_arenaMark() == used);
+    CHECK(GFX_fontCacheUsed() == fontBytes);
+    CHECK(gfxFont == copy);
+    CHECK(GFX_fontRamLookup(&Sans24) == copy);
+
+    // Once the arena is reset the copy is gone and text falls back to flash
+    GFX_destroyFramebuf();
+    GFX_setFontAutoCache(false);
+    GFX_arenaReset();
+    CHECK(GFX_fontRamLookup(&Sans24) == &Sans24);
+    CHECK(gfxFont == &Sans24);
+    CHECK(GFX_fontCacheUsed() == 0);
+
+    // The display list goes with the framebuffer: drawing is immediate again
+    CHECK(GFX_createFramebuf());
+    CHECK(GFX_setDeferred(true));
+    GFX_fillRect(0, 0, 20, 20, 0x1111);
+    GFX_destroyFramebuf();
+    CHECK(GFX_createFramebuf());
+    GFX_fillRect(10, 10, 5, 5, 0x1234);
+    CHECK(!gfxDeferActive);
+    CHECK(GFX_getRow(12)[12] == 0x1234);
+    CHECK(GFX_setDeferred(true)); // A new list
+    GFX_fillRect(10, 10, 5, 5, 0x4321);
+    CHECK(gfxDeferActive);
+    CHECK(GFX_setDeferred(false));
+    CHECK(GFX_getRow(12)[12] == 0x4321);
+
+    // Turning it on again while recording keeps the list
+    CHECK(GFX_setDeferred(true));
+    GFX_fillRect(10, 10, 5, 5, 0x5555);
+    CHECK(GFX_setDeferred(true));
+    CHECK(GFX_setDeferred(false));
+    CHECK(GFX_getRow(12)[12] == 0x5555);
+
+    // Text recorded from a cached font, whose slot then holds another font
+    static uint16_t want[40 * 40];
+    GFX_fillScreen(0);
+    GFX_setFont(&Sans24);
+    GFX_drawChar(10, 40, 'g', 0xFFFF, 0, 1, 1);
+    for (int y = 0; y < 40; y++)
+        for (int x = 0; x < 40; x++)
+            want[y * 40 + x] = GFX_getRow(y + 10)[x];
+    GFX_fillScreen(0);
+    GFX_setFontCacheBudget(2 * sizeof(Sans24Bitmaps) + 2048);
+    CHECK(GFX_cacheFontInRam(&Sans24));
+    GFX_setFont(&Sans24);
+    CHECK(gfxFont != &Sans24);
+    CHECK(GFX_setDeferred(true));
+    GFX_drawChar(10, 40, 'g', 0xFFFF, 0, 1, 1);
+    GFX_releaseFontCache();
+    memset(solidBitmaps, 0xFF, sizeof(solidBitmaps));
+    GFXfont solid = Sans24;
+    solid.bitmap = solidBitmaps;
+    CHECK(GFX_cacheFontInRam(&solid));
+    CHECK(GFX_setDeferred(false));
+    int bad = 0;
+    for (int y = 0; y < 40; y++)
+        for (int x = 0; x < 40; x++)
+            bad += GFX_getRow(y + 10)[x] != want[y * 40 + x];
+    CHECK(bad == 0);
+    CHECK(gfxFont == &Sans24);
+    GFX_releaseFontCache();
+    GFX_destroyFramebuf();
+
+    return testResult("arena");
+}
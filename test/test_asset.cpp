@@ -0,0 +1,368 @@
+// Decoded asset cache: hits and evictions follow an LRU model with pins,
+// which also exercises hash deletion; freed gaps are reused first-fit;
+// pinned assets are never disturbed; RLE decoders; prefetching spares the
+// current screen; the pool is only taken by core 0 calls; and emptying the
+// cache waits for a decode running on the other core
+
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "pico/critical_section.h"
+#include "hardware/sync.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxasset.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// Stand-ins for the multicore primitives; a thread plays core 1
+static std::mutex lockMutex;
+
+void critical_section_init(critical_section_t *)
+{
+}
+
+void critical_section_enter_blocking(critical_section_t *)
+{
+    lockMutex.lock();
+}
+
+void critical_section_exit(critical_section_t *)
+{
+    lockMutex.unlock();
+}
+
+void __sev()
+{
+}
+
+void __wfe()
+{
+}
+
+void tight_loop_contents()
+{
+}
+
+// Test pattern decoder: the asset's data pointer holds its ID
+static int decodes = 0;
+static bool patternDecode(const GFXasset *a, void *dst)
+{
+    uint16_t id = (uint16_t)(uintptr_t)a->data;
+    decodes++;
+    if (a->size == 0xBAD)
+        return false;
+    if (a->format == GFX_ASSET_PAL8)
+    {
+        uint16_t *pal = (uint16_t *)dst;
+        for (int i = 0; i < a->colors; i++)
+            pal[i] = id * 7 + i;
+        uint8_t *ix = (uint8_t *)dst + a->colors * 2;
+        for (int i = 0; i < a->width * a->height; i++)
+            ix[i] = (i + id) % a->colors;
+    }
+    else
+    {
+        uint16_t *px = (uint16_t *)dst;
+        for (int i = 0; i < a->width * a->height; i++)
+            px[i] = (uint16_t)(id * 31 + i);
+    }
+    return true;
+}
+
+// Decoder that holds its slot busy until told to finish
+static std::atomic<bool> slowStarted(false), slowGo(false), slowDone(false);
+static bool slowDecode(const GFXasset *a, void *dst)
+{
+    slowStarted = true;
+    while (!slowGo)
+        std::this_thread::yield();
+    bool ok = patternDecode(a, dst);
+    slowDone = true;
+    return ok;
+}
+
+static bool intact(const GFXasset *a, uint16_t id, const GFXsurface *s)
+{
+    if (s == NULL || s->width != a->width || s->height != a->height)
+        return false;
+    if (a->format == GFX_ASSET_PAL8)
+    {
+        for (int i = 0; i < a->colors; i++)
+            if (s->palette[i] != (uint16_t)(id * 7 + i))
+                return false;
+        for (int i = 0; i < a->width * a->height; i++)
+            if (s->indices[i] != (i + id) % a->colors)
+                return false;
+        return s->pixels == NULL;
+    }
+    for (int i = 0; i < a->width * a->height; i++)
+        if (s->pixels[i] != (uint16_t)(id * 31 + i))
+            return false;
+    return true;
+}
+
+static GFXasset table[300];
+
+static void makeAsset(int id, int w, int h, uint8_t format = GFX_ASSET_RGB565, uint16_t colors = 0)
+{
+    table[id] = {(const void *)(uintptr_t)id, 1, (uint16_t)w, (uint16_t)h, format, colors, patternDecode};
+}
+
+static GFXassetStats stats()
+{
+    GFXassetStats s;
+    GFX_getAssetStats(&s);
+    return s;
+}
+
+// Least recently used at the back; pinned entries are skipped for eviction
+static std::list<int> lru;
+static std::map<int, int> pins;
+
+static bool modelUse(int id, size_t capacity)
+{
+    bool in = std::find(lru.begin(), lru.end(), id) != lru.end();
+    if (in)
+        lru.remove(id);
+    else if (lru.size() == capacity)
+    {
+        auto it = lru.end();
+        do
+            --it;
+        while (pins.count(*it));
+        lru.erase(it);
+    }
+    lru.push_front(id);
+    return in;
+}
+
+static void lruModel()
+{
+    GFX_arenaReset();
+    GFX_setAssetCacheBudget(20 * 512);
+    for (int i = 0; i < 200; i++)
+        makeAsset(i, 16, 16); // 512 bytes each
+    GFX_assetSetTable(table, 200);
+    GFX_resetAssetStats();
+    srand(1);
+    uint32_t hits = 0, misses = 0;
+    int bad = 0;
+    for (int step = 0; step < 20000 && bad == 0; step++)
+    {
+        int id = rand() % 3 ? rand() % 30 : rand() % 200;
+        int op = rand() % 20;
+        if (op == 0 && pins.size() < 5)
+        {
+            (modelUse(id, 20) ? hits : misses)++;
+            pins[id]++;
+            bad += !GFX_assetPin(id);
+        }
+        else if (op == 1 && !pins.empty())
+        {
+            auto it = pins.begin();
+            std::advance(it, rand() % pins.size());
+            GFX_assetUnpin(it->first);
+            if (--it->second == 0)
+                pins.erase(it);
+        }
+        else
+        {
+            bool in = modelUse(id, 20);
+            (in ? hits : misses)++;
+            uint32_t before = stats().hits;
+            bad += !intact(&table[id], id, GFX_assetGet(id));
+            bad += stats().hits - before != (uint32_t)in;
+        }
+        bad += GFX_assetCacheUsed() != lru.size() * 512;
+    }
+    CHECK(bad == 0);
+    CHECK(stats().hits == hits && stats().misses == misses && stats().evictions > 0);
+    for (auto &p : pins)
+        for (int k = 0; k < p.second; k++)
+            GFX_assetUnpin(p.first);
+    pins.clear();
+    lru.clear();
+}
+
+int main()
+{
+    emuReset(0);
+    lruModel();
+
+    // More tiny assets than slots: the slots run out before the pool
+    GFX_releaseAssetCache();
+    GFX_resetAssetStats();
+    for (int i = 0; i < 100; i++)
+        makeAsset(i, 2, 2);
+    int bad = 0;
+    for (int r = 0; r < 3; r++)
+        for (int i = 0; i < 40; i++)
+            bad += !intact(&table[i], i, GFX_assetGet(i));
+    CHECK(bad == 0 && stats().hits == 0 && stats().misses == 120);
+    for (int r = 0; r < 3; r++)
+        for (int i = 0; i < GFX_ASSET_SLOTS; i++)
+            GFX_assetGet(i);
+    CHECK(stats().misses == 120 + GFX_ASSET_SLOTS && stats().hits == 2 * GFX_ASSET_SLOTS);
+
+    // First fit: with its neighbours pinned, the coldest asset's gap is reused
+    GFX_setAssetCacheBudget(4 * 512);
+    GFX_releaseAssetCache();
+    for (int i = 0; i < 8; i++)
+        makeAsset(i, 16, 16);
+    const GFXsurface *first = GFX_assetGet(0);
+    const uint16_t *gap = first->pixels;
+    GFX_assetPin(1);
+    GFX_assetGet(2);
+    GFX_assetPin(3);
+    GFX_assetGet(2);
+    const GFXsurface *next = GFX_assetGet(4);
+    CHECK(next != NULL && next->pixels == gap && intact(&table[4], 4, next));
+    CHECK(GFX_assetGet(5) != NULL && intact(&table[1], 1, GFX_assetGet(1)));
+    GFX_assetUnpin(1);
+    GFX_assetUnpin(3);
+
+    // Mixed sizes and formats: pinned contents are never disturbed
+    GFX_setAssetCacheBudget(20 * 512);
+    GFX_releaseAssetCache();
+    GFX_resetAssetStats();
+    for (int i = 0; i < 300; i++)
+        if (i % 3 == 0)
+            makeAsset(i, 1 + rand() % 40, 1 + rand() % 40, GFX_ASSET_PAL8, 1 + rand() % 16);
+        else
+            makeAsset(i, 1 + rand() % 40, 1 + rand() % 30);
+    table[299].size = 0xBAD;
+    GFX_assetSetTable(table, 300);
+    std::map<int, const GFXsurface *> pinned;
+    uint32_t fails = 0;
+    bad = 0;
+    for (int step = 0; step < 30000 && bad == 0; step++)
+    {
+        int id = rand() % 300, op = rand() % 30;
+        if (op == 0 && pinned.size() < 3 && !pinned.count(id))
+        {
+            if (GFX_assetPin(id))
+                pinned[id] = GFX_assetGet(id);
+            else
+                fails++;
+        }
+        else if (op == 1 && !pinned.empty())
+        {
+            GFX_assetUnpin(pinned.begin()->first);
+            pinned.erase(pinned.begin());
+        }
+        else
+        {
+            const GFXsurface *sf = GFX_assetGet(id);
+            if (sf == NULL)
+                fails++;
+            else
+                bad += !intact(&table[id], id, sf);
+        }
+        for (auto &p : pinned)
+            bad += !intact(&table[p.first], p.first, p.second);
+        bad += GFX_assetCacheUsed() > 20 * 512;
+    }
+    CHECK(bad == 0 && stats().failures == fails);
+    for (auto &p : pinned)
+        GFX_assetUnpin(p.first);
+    CHECK(GFX_assetGet(500) == NULL);
+
+    // RLE decoders, drawn clipped into the framebuffer
+    static const uint16_t rle565[] = {3, 0x1111, 5, 0x2222, 8, 0x3333};
+    static uint8_t rlePal[4 + 8] = {0x00, 0xF8, 0xE0, 0x07, 6, 1, 4, 0, 5, 1, 1, 0};
+    static const uint16_t rleBad[] = {3, 0x1111, 20, 0x2222};
+    GFXasset rle[3] = {{rle565, sizeof(rle565), 4, 4, GFX_ASSET_RGB565, 0, GFX_assetDecodeRle},
+                       {rlePal, sizeof(rlePal), 4, 4, GFX_ASSET_PAL8, 2, GFX_assetDecodeRle},
+                       {rleBad, sizeof(rleBad), 4, 4, GFX_ASSET_RGB565, 0, GFX_assetDecodeRle}};
+    GFX_assetSetTable(rle, 3);
+    GFX_resetAssetStats();
+    const GFXsurface *a = GFX_assetGet(0);
+    CHECK(a && a->pixels[2] == 0x1111 && a->pixels[3] == 0x2222 && a->pixels[7] == 0x2222 && a->pixels[15] == 0x3333);
+    const GFXsurface *b = GFX_assetGet(1);
+    CHECK(b && b->palette[1] == 0x07E0 && b->indices[5] == 1 && b->indices[6] == 0 && b->indices[15] == 0);
+    CHECK(GFX_assetGet(2) == NULL && stats().failures == 1);
+    CHECK(GFX_createFramebuf());
+    GFX_fillScreen(0);
+    GFX_drawAsset(1, -1, -2);
+    GFX_drawAsset(0, 170, 318);
+    CHECK(GFX_getRow(0)[0] == 0xF800 && GFX_getRow(0)[2] == 0x07E0 && GFX_getRow(0)[3] == 0);
+    CHECK(GFX_getRow(318)[171] == 0x1111 && GFX_getRow(319)[170] == 0x2222);
+    GFX_destroyFramebuf();
+
+    // Prefetching does not evict what the current screen drew
+    GFX_arenaReset();
+    GFX_setAssetCacheBudget(10 * 512);
+    for (int i = 0; i < 40; i++)
+        makeAsset(i, 16, 16);
+    GFX_assetSetTable(table, 40);
+    GFX_resetAssetStats();
+    for (int i = 0; i < 8; i++)
+        GFX_assetGet(i);
+    uint16_t upcoming[6] = {20, 21, 22, 23, 24, 25};
+    GFX_assetPrefetch(upcoming, 6);
+    while (GFX_assetPrefetchStep())
+        ;
+    CHECK(stats().prefetches == 2 && stats().failures == 4);
+    for (int i = 0; i < 8; i++)
+        GFX_assetGet(i);
+    CHECK(stats().misses == 8 && stats().hits == 8);
+    GFX_assetPrefetch(upcoming, 6); // The screen was drawn in the previous period
+    while (GFX_assetPrefetchStep())
+        ;
+    CHECK(stats().failures == 8);
+    GFX_assetPrefetch(upcoming, 6); // Two periods on it may go
+    while (GFX_assetPrefetchStep())
+        ;
+    CHECK(stats().prefetches == 6);
+
+    // The pool is taken by the table and prefetch calls, never by a prefetch step
+    GFX_arenaReset();
+    GFX_assetSetTable(table, 40);
+    CHECK(GFX_arenaMark() == 10 * 512);
+    GFX_arenaReset();
+    GFX_assetPrefetch(upcoming, 2);
+    CHECK(GFX_arenaMark() == 10 * 512);
+    GFX_arenaReset();
+    GFX_resetAssetStats();
+    CHECK(GFX_assetPrefetchStep() && GFX_arenaMark() == 0 && stats().prefetches == 0);
+
+    // A new budget replaces the newest pool instead of leaking it
+    GFX_assetGet(0);
+    GFX_setAssetCacheBudget(6 * 512);
+    GFX_releaseAssetCache();
+    CHECK(GFX_assetGet(0) != NULL && GFX_arenaMark() == 6 * 512);
+
+    // Emptying the cache while the other core decodes waits for the decode,
+    // so the slot it returns to is not one that was cleared under it
+    GFX_releaseAssetCache();
+    table[24].decode = slowDecode;
+    GFX_assetPrefetch(upcoming + 4, 1);
+    std::thread core1([] { GFX_assetPrefetchStep(); });
+    while (!slowStarted)
+        std::this_thread::yield();
+    std::thread finish([] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        slowGo = true;
+    });
+    GFX_releaseAssetCache();
+    CHECK(slowDone);
+    core1.join();
+    finish.join();
+    CHECK(GFX_assetCacheUsed() == 0);
+    table[24].decode = patternDecode;
+    for (int r = 0; r < 3; r++)
+        for (int i = 0; i < 40; i++)
+            GFX_assetGet(i);
+    CHECK(GFX_assetCacheUsed() <= 6 * 512 && intact(&table[24], 24, GFX_assetGet(24)));
+    return testResult("asset");
+}
@@ -0,0 +1,168 @@
+// Affine blitter: rotated and scaled blits, nearest, bilinear and
+// colour-keyed, match a brute-force inverse map that tests every
+// destination pixel against the source bounds, including sample points
+// exactly on the image edges, pivots on its corners, destination rectangles
+// hanging off the screen and one-pixel sources; a scale of zero or below is
+// refused and draws nothing
+
+#include <stdlib.h>
+#include <string.h>
+#include "gfx.h"
+#include "gfxblit.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static uint16_t pixels[40 * 64];
+static uint16_t expect[320 * 320];
+
+// Fill the screen with a pattern the blit must leave alone where it draws nothing
+static void background()
+{
+    for (int y = 0; y < _height; y++)
+        for (int x = 0; x < _width; x++)
+            GFX_drawPixel(x, y, (uint16_t)(x * 131 + y * 17));
+}
+
+// The blit pixel by pixel: each destination pixel on screen and in the
+// rectangle is mapped with 64-bit arithmetic and drawn only if the source
+// position, and for bilinear the pixel right of and below it, is inside
+static void reference(const GFXimage *src, const GFXaffine *m, int x, int y, int w, int h, uint8_t flags,
+                      uint16_t key)
+{
+    bool bilinear = flags & GFX_BLIT_BILINEAR;
+    int64_t bias = bilinear ? 0x8000 : 0;
+    for (int j = 0; j < _height; j++)
+        for (int i = 0; i < _width; i++)
+            expect[j * _width + i] = GFX_getRow(j)[i];
+    for (int yy = y; yy < y + h; yy++)
+        for (int xx = x; xx < x + w; xx++)
+        {
+            if (xx < 0 || yy < 0 || xx >= _width || yy >= _height)
+                continue;
+            int64_t u = (int64_t)m->a * xx + (int64_t)m->b * yy + m->tx - bias;
+            int64_t v = (int64_t)m->c * xx + (int64_t)m->d * yy + m->ty - bias;
+            if (u < 0 || v < 0)
+                continue;
+            int64_t su = u >> 16, sv = v >> 16;
+            if (su + bilinear >= src->width || sv + bilinear >= src->height)
+                continue;
+            const uint16_t *p = src->pixels + sv * src->stride + su;
+            if ((flags & GFX_BLIT_COLORKEY) && *p == key)
+                continue;
+            uint16_t col = *p;
+            if (bilinear)
+            {
+                uint8_t fx = (u >> 11) & 31, fy = (v >> 11) & 31;
+                col = GFX_blend565(GFX_blend565(p[src->stride + 1], p[src->stride], fx), GFX_blend565(p[1], p[0], fx),
+                                   fy);
+            }
+            expect[yy * _width + xx] = col;
+        }
+}
+
+// Blit over the background and compare the whole screen with the reference
+static int blitErrors(const GFXimage *src, const GFXaffine *m, int x, int y, int w, int h, uint8_t flags,
+                      uint16_t key)
+{
+    background();
+    reference(src, m, x, y, w, h, flags, key);
+    GFX_blitAffine(src, m, x, y, w, h, flags, key);
+    int bad = 0;
+    for (int j = 0; j < _height; j++)
+        bad += memcmp(GFX_getRow(j), expect + j * _width, _width * sizeof(uint16_t)) != 0;
+    return bad;
+}
+
+int main()
+{
+    emuReset(0);
+    CHECK(GFX_createFramebuf());
+
+    // 37x23 image in rows of 40, a few pixels set to the key colour
+    srand(3);
+    for (int i = 0; i < 40 * 64; i++)
+        pixels[i] = rand();
+    for (int i = 0; i < 60; i++)
+        pixels[(rand() % 23) * 40 + rand() % 37] = 0xF81F;
+    GFXimage im = {pixels, 37, 23, 40};
+    GFXimage dot = {pixels, 1, 1, 40};
+
+    static const int16_t angles[] = {0, 90, 180, 270, -90, 33, 147, 301, 719};
+    static const int32_t scales[] = {0x10000, 0x20000, 0x8000, 0x18000, 0x3000, 0x70000};
+    static const int16_t pivots[][2] = {{18, 11}, {0, 0}, {37, 23}, {36, 0}};
+    static const uint8_t modes[] = {GFX_BLIT_NEAREST, GFX_BLIT_BILINEAR, GFX_BLIT_COLORKEY,
+                                    GFX_BLIT_BILINEAR | GFX_BLIT_COLORKEY};
+    int cases = 0, bad = 0;
+    for (int a = 0; a < 9; a++)
+        for (int s = 0; s < 6; s++)
+        {
+            const int16_t *pv = pivots[(a + s) % 4];
+            GFXaffine m;
+            CHECK(GFX_affineRotateScale(&m, angles[a], scales[s], pv[0], pv[1], 86, 160));
+            uint8_t flags = modes[(a * 6 + s) % 4];
+            bad += blitErrors(&im, &m, 0, 0, _width, _height, flags, 0xF81F) != 0;
+            // Destination rectangles cut by each screen edge
+            bad += blitErrors(&im, &m, -30, 120, 100, 90, flags, 0xF81F) != 0;
+            bad += blitErrors(&im, &m, 120, -25, 80, 300, flags, 0xF81F) != 0;
+            bad += blitErrors(&im, &m, 60, 250, 200, 200, flags, 0xF81F) != 0;
+            cases += 4;
+        }
+    CHECK(cases == 216 && bad == 0);
+
+    // Matrices built by hand put sample points exactly on source pixel
+    // edges, the last ones on the right and bottom edges of the image, just
+    // outside: half size, mirrored, and a quarter turn where u is constant
+    // along each row
+    static const GFXaffine exact[] = {{0x20000, 0, 0x10000, 0, 0x20000, 0x10000},
+                                      {-0x20000, 0, 0x10000 * 300, 0, 0x20000, -0x10000 * 101},
+                                      {0, 0x10000, -0x10000 * 30, 0x8000, 0, 0},
+                                      {0, -0x10000, 0x10000 * 200, -0x10000, 0, 0x10000 * 80}};
+    for (int k = 0; k < 4; k++)
+    {
+        CHECK(blitErrors(&im, &exact[k], 0, 0, _width, _height, GFX_BLIT_NEAREST, 0) == 0);
+        CHECK(blitErrors(&im, &exact[k], 0, 0, _width, _height, GFX_BLIT_BILINEAR, 0) == 0);
+    }
+
+    // A one-pixel source: a square block at any scale when nearest, nothing
+    // at all when bilinear, which needs a second pixel to blend with
+    for (int s = 0; s < 6; s++)
+    {
+        GFXaffine m;
+        CHECK(GFX_affineRotateScale(&m, 90 * s, scales[s], 0, 0, 40, 40));
+        CHECK(blitErrors(&dot, &m, 0, 0, _width, _height, GFX_BLIT_NEAREST, 0) == 0);
+        CHECK(blitErrors(&dot, &m, 0, 0, _width, _height, GFX_BLIT_BILINEAR, 0) == 0);
+    }
+
+    // Identity at the origin copies the image exactly
+    GFXaffine id;
+    CHECK(GFX_affineRotateScale(&id, 0, 0x10000, 0, 0, 10, 20));
+    background();
+    GFX_blitAffine(&im, &id, 0, 0, _width, _height, GFX_BLIT_NEAREST, 0);
+    bad = 0;
+    for (int j = 0; j < 23; j++)
+        bad += memcmp(GFX_getRow(20 + j) + 10, pixels + j * 40, 37 * sizeof(uint16_t)) != 0;
+    CHECK(bad == 0 && GFX_getRow(19)[10] == 19 * 17 + 10 * 131 && GFX_getRow(20)[47] == 20 * 17 + 47 * 131);
+
+    // Scale zero or below has no inverse: refused, and the matrix draws nothing
+    static const int32_t badScales[] = {0, -1, -0x10000};
+    for (int s = 0; s < 3; s++)
+    {
+        GFXaffine m;
+        CHECK(!GFX_affineRotateScale(&m, 45, badScales[s], 18, 11, 86, 160));
+        background();
+        reference(&im, &m, 0, 0, _width, _height, GFX_BLIT_NEAREST, 0);
+        GFX_blitAffine(&im, &m, 0, 0, _width, _height, GFX_BLIT_NEAREST, 0);
+        GFX_blitAffine(&im, &m, 0, 0, _width, _height, GFX_BLIT_BILINEAR, 0);
+        bad = 0;
+        for (int j = 0; j < _height; j++)
+            for (int i = 0; i < _width; i++)
+                bad += GFX_getRow(j)[i] != (uint16_t)(i * 131 + j * 17) || expect[j * _width + i] != GFX_getRow(j)[i];
+        CHECK(bad == 0);
+    }
+
+    GFX_destroyFramebuf();
+    return testResult("blit");
+}
@@ -0,0 +1,125 @@
+// Configuration planner: for panels from 135x240 to 240x320, every plan fits
+// its budget, follows the priorities and never loses the framebuffer as the
+// budget grows; GFX_configure() then allocates exactly what was planned
+
+#include "pico/critical_section.h"
+#include "gfx.h"
+#include "gfxconfig.h"
+#include "gfxarena.h"
+#include "gfxdefer.h"
+#include "gfxoutline.h"
+#include "fontcache.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// GFX_configure() empties the asset cache; single-threaded stand-ins for
+// the multicore primitives it links
+void critical_section_init(critical_section_t *)
+{
+}
+
+void critical_section_enter_blocking(critical_section_t *)
+{
+}
+
+void critical_section_exit(critical_section_t *)
+{
+}
+
+void tight_loop_contents()
+{
+}
+
+void __sev()
+{
+}
+
+void __wfe()
+{
+}
+
+static const uint16_t panels[][2] = {{135, 240}, {240, 135}, {170, 320}, {172, 320},
+                                     {240, 240}, {240, 280}, {240, 320}, {320, 240}};
+
+static void checkPlans(uint16_t w, uint16_t h)
+{
+    size_t fb = (size_t)w * h * 2;
+    for (uint8_t prio = 0; prio < 8; prio++)
+    {
+        bool glyphsFirst = (prio & GFX_PRIO_TEXT) && !(prio & GFX_PRIO_FRAMERATE);
+        bool hadFb = false;
+        int bad = 0;
+        for (size_t budget = 0; budget <= 200 * 1024; budget += 512)
+        {
+            GFXconfig c;
+            GFX_planConfig(w, h, budget, prio, &c);
+            size_t sum = c.framebufferBytes + c.fontCacheBytes + c.outlineCacheBytes + c.displayListBytes;
+            size_t glyphs = glyphsFirst ? c.fontCacheBytes + c.outlineCacheBytes : 0;
+
+            bad += sum != c.totalBytes || c.totalBytes > budget;
+            bad += c.framebuffer != (c.framebufferBytes > 0);
+            // The framebuffer goes in whenever it fits, after the glyph caches for text
+            if (glyphsFirst)
+                bad += budget >= fb + GFX_FONT_RAM_BUDGET + GFX_OUTLINE_CACHE_BYTES && !c.framebuffer;
+            else
+                bad += c.framebuffer != (fb <= budget);
+            bad += hadFb && !c.framebuffer;
+            bad += c.flushQueue && !(c.framebuffer && (prio & GFX_PRIO_FRAMERATE));
+            bad += c.deferred && !(prio & GFX_PRIO_LAYERED);
+            if (prio & GFX_PRIO_LAYERED)
+                bad += budget >= GFX_deferBytes() + (c.framebuffer ? fb : 0) + glyphs && !c.deferred;
+            bad += c.fontCacheBytes && c.fontCacheBytes < GFX_CONFIG_MIN_GLYPH_CACHE;
+            bad += c.outlineCacheBytes &&
+                   (c.outlineCacheBytes < GFX_CONFIG_MIN_GLYPH_CACHE || c.outlineCacheBytes % 4);
+            hadFb = c.framebuffer;
+        }
+        if (bad)
+            printf("%ux%u priorities %u: %d bad plans\n", w, h, prio, bad);
+        CHECK(bad == 0);
+    }
+
+    // The default arena holds a framebuffer for every one of these panels
+    GFXconfig c;
+    GFX_planConfig(w, h, GFX_ARENA_SIZE, 0, &c);
+    CHECK(c.framebuffer && c.framebufferBytes == fb && c.totalBytes <= GFX_ARENA_SIZE);
+    GFX_planConfig(w, h, GFX_ARENA_SIZE, GFX_PRIO_FRAMERATE, &c);
+    CHECK(c.framebuffer && c.flushQueue);
+}
+
+int main()
+{
+    emuReset(0);
+    for (const auto &p : panels)
+        checkPlans(p[0], p[1]);
+
+    // Applied on the 172x320 panel: the arena holds exactly what was planned
+    GFXconfig c;
+    GFXmemUsage u;
+    GFX_configure(1 << 20, GFX_PRIO_FRAMERATE | GFX_PRIO_LAYERED);
+    GFX_getConfig(&c);
+    GFX_arenaGetUsage(&u);
+    CHECK(c.framebuffer && gfxFramebuffer != NULL && c.deferred && gfxDeferActive);
+    CHECK(u.consumer[GFX_MEM_FRAMEBUFFER] == c.framebufferBytes);
+    CHECK(u.consumer[GFX_MEM_DISPLAYLIST] == c.displayListBytes);
+    CHECK(GFX_fontCacheBudget() == c.fontCacheBytes);
+    CHECK(GFX_outlineCacheBytes() == c.outlineCacheBytes);
+    GFX_fillScreen(0x1234);
+    GFX_fillRect(3, 3, 20, 20, 0xFFFF);
+    GFX_flush();
+    GFX_flushQueueWait();
+    CHECK(panel[0] == 0x1234 && panel[5 * 172 + 5] == 0xFFFF);
+
+    // A tight budget: direct mode with nothing in the arena
+    GFX_configure(20000, 0);
+    GFX_getConfig(&c);
+    GFX_arenaGetUsage(&u);
+    CHECK(!c.framebuffer && gfxFramebuffer == NULL && !gfxDeferActive && u.used == 0);
+
+    GFX_configure(0, 0);
+    GFX_getConfig(&c);
+    CHECK(c.totalBytes == 0 && GFX_outlineCacheBytes() == 0);
+    return testResult("config");
+}
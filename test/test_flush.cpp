@@ -0,0 +1,73 @@
+// Automatic change detection: GFX_flush() sends exactly the rows that
+// changed, the panel always matches the framebuffer, and lazily cleared rows
+// are hashed from the clear colour without being written
+
+#include <string.h>
+#include "gfx.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// Flush, then compare the glass with the framebuffer in logical order
+static uint32_t flushRows()
+{
+    GFXflushStats st;
+    GFX_resetFlushStats();
+    GFX_flush();
+    GFX_getFlushStats(&st);
+    for (int y = 0; y < _height; y++)
+        CHECK(memcmp(panel + y * _width, GFX_getRow(y), _width * sizeof(uint16_t)) == 0);
+    return st.rowsSent;
+}
+
+int main()
+{
+    emuReset(0xFFFF);
+    CHECK(GFX_createFramebuf());
+    GFX_setAutoDamage(true);
+
+    // A lazy clear is sent whole the first time, and never materialised:
+    // a marker in a raw untouched row survives the flush
+    GFX_fillScreen(0x1234);
+    gfxFramebuffer[0] = 0xBEEF;
+    GFXflushStats st;
+    GFX_resetFlushStats();
+    GFX_flush();
+    GFX_getFlushStats(&st);
+    CHECK(st.rowsSent == _height);
+    CHECK(gfxFramebuffer[0] == 0xBEEF);
+    CHECK(panel[0] == 0x1234);
+
+    // Unchanged frame: nothing goes out
+    GFX_resetFlushStats();
+    GFX_flush();
+    GFX_getFlushStats(&st);
+    CHECK(st.rowsSent == 0);
+
+    // Size-2 text is 16 rows high
+    GFX_setCursor(10, 10);
+    GFX_setTextSize(2);
+    GFX_printf("Hello");
+    uint32_t rows = flushRows();
+    CHECK(rows > 0 && rows <= 16);
+    CHECK(flushRows() == 0);
+
+    // A row drawn back to the clear colour matches its old hash
+    GFX_getRow(250)[3] = 0x1234;
+    CHECK(flushRows() == 0);
+
+    // A direct framebuffer write is caught
+    GFX_getRow(200)[5] = 7;
+    CHECK(flushRows() == 1);
+
+    // Full redraw, then a scroll: every row moves
+    GFX_fillScreen(0);
+    GFX_drawLine(0, 0, _width - 1, _height - 1, 0xFFFF);
+    CHECK(flushRows() == _height);
+    GFX_scrollUp(13);
+    CHECK(flushRows() == _height);
+
+    return testResult("flush");
+}
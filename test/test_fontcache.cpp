@@ -0,0 +1,39 @@
+// SRAM font cache: text renders from the copy while it is cached and from
+// the flash font once the copy is gone
+
+#include <string.h>
+#include "gfx.h"
+#include "fontcache.h"
+#include "gfxarena.h"
+#include "sans24.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+extern GFXfont *gfxFont; // Font GFX_drawChar() renders with
+
+int main()
+{
+    emuReset(0);
+    GFX_setFontCacheBudget(8 * 1024);
+    GFX_setFontAutoCache(true);
+
+    // Selecting the font copies it; the copy has the same glyphs
+    GFX_setFont(&Sans24);
+    CHECK(gfxFont != &Sans24);
+    CHECK(gfxFont->bitmap != Sans24.bitmap);
+    CHECK(memcmp(gfxFont->glyph, Sans24.glyph, sizeof(GFXglyph) * (Sans24.last - Sans24.first + 1)) == 0);
+    CHECK(GFX_fontCacheUsed() > 0);
+
+    // Dropping the cache points text back at flash
+    GFX_releaseFontCache();
+    CHECK(gfxFont == &Sans24);
+    CHECK(GFX_fontCacheUsed() == 0);
+    GFX_setCursor(0, 30);
+    GFX_printf("A");
+    CHECK(GFX_getFont() == &Sans24);
+
+    return testResult("fontcache");
+}
@@ -0,0 +1,157 @@
+// Thick, anti-aliased and poly lines: thick segments cover the pixels whose
+// centres fall inside the analytic quadrilateral, Wu lines put full colour
+// on their end points and one pixel's worth of coverage in every column,
+// round-joined poly lines cover everything within half the width of the
+// path, and anti-aliased poly lines write each shared vertex once
+
+#include <math.h>
+#include <string.h>
+#include "gfx.h"
+#include "gfxline.h"
+#include "pixcache.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// Distance from pixel centre (x, y) to the segment, and the position along it
+static void segmentDistance(double x, double y, const double *s, double *dist, double *along)
+{
+    double dx = s[2] - s[0], dy = s[3] - s[1], len = sqrt(dx * dx + dy * dy);
+    *along = ((x - s[0]) * dx + (y - s[1]) * dy) / len;
+    *dist = fabs((x - s[0]) * dy - (y - s[1]) * dx) / len;
+}
+
+// Pixels that are clearly inside the expected shape but not drawn, or
+// clearly outside it but drawn. margin covers the 1/16 pixel arithmetic.
+static int thickErrors(const double *s, int width, uint8_t cap)
+{
+    const double margin = 0.2;
+    double dx = s[2] - s[0], dy = s[3] - s[1], len = sqrt(dx * dx + dy * dy);
+    double ext = cap == GFX_CAP_SQUARE ? width / 2.0 : 0;
+    int bad = 0;
+    for (int y = 0; y < _height; y++)
+        for (int x = 0; x < _width; x++)
+        {
+            double dist, along;
+            segmentDistance(x, y, s, &dist, &along);
+            bool in = dist < width / 2.0 - margin && along > -ext + margin && along < len + ext - margin;
+            bool out = dist > width / 2.0 + margin || along < -ext - margin || along > len + ext + margin;
+            bool drawn = GFX_getRow(y)[x] != 0;
+            bad += (in && !drawn) || (out && drawn);
+        }
+    return bad;
+}
+
+// Green channel as coverage in 1/63
+static int green(uint16_t c)
+{
+    return (c >> 5) & 63;
+}
+
+int main()
+{
+    emuReset(0);
+    CHECK(GFX_createFramebuf());
+
+    // Thick segments at several angles, widths and caps
+    static const double segs[][4] = {{20, 30, 150, 60},  {40, 300, 60, 20},   {100, 100, 30, 180},
+                                     {10, 200, 160, 200}, {80, 10, 80, 100}, {150, 250, 20, 310}};
+    static const int widths[] = {6, 9, 4, 5, 3, 12};
+    for (int k = 0; k < 6; k++)
+        for (uint8_t cap = GFX_CAP_BUTT; cap <= GFX_CAP_SQUARE; cap++)
+        {
+            GFX_fillScreen(0);
+            const double *s = segs[k];
+            GFX_drawThickLine(s[0], s[1], s[2], s[3], widths[k], cap, 0xFFFF);
+            CHECK(thickErrors(s, widths[k], cap) == 0);
+        }
+
+    // Wu lines: the end points get full colour, the pixels beside them
+    // nothing, and each column (or row, for a steep line) sums to one pixel
+    static const int wu[][4] = {{10, 10, 60, 27}, {150, 40, 100, 20}, {30, 300, 45, 200}};
+    for (int k = 0; k < 3; k++)
+    {
+        const int *l = wu[k];
+        bool steep = abs(l[3] - l[1]) > abs(l[2] - l[0]);
+        GFX_fillScreen(0);
+        GFX_drawLineAA(l[0], l[1], l[2], l[3], 0xFFFF, 0);
+        for (int e = 0; e < 4; e += 2)
+        {
+            CHECK(GFX_getRow(l[e + 1])[l[e]] == 0xFFFF);
+            if (steep)
+                CHECK(GFX_getRow(l[e + 1])[l[e] - 1] == 0 && GFX_getRow(l[e + 1])[l[e] + 1] == 0);
+            else
+                CHECK(GFX_getRow(l[e + 1] - 1)[l[e]] == 0 && GFX_getRow(l[e + 1] + 1)[l[e]] == 0);
+        }
+        int lo = steep ? (l[1] < l[3] ? l[1] : l[3]) : (l[0] < l[2] ? l[0] : l[2]);
+        int hi = steep ? (l[1] < l[3] ? l[3] : l[1]) : (l[0] < l[2] ? l[2] : l[0]);
+        int bad = 0;
+        for (int m = lo; m <= hi; m++)
+        {
+            int sum = 0;
+            for (int n = 0; n < (steep ? _width : _height); n++)
+                sum += green(steep ? GFX_getRow(m)[n] : GFX_getRow(n)[m]);
+            bad += abs(sum - 63) > 2;
+        }
+        CHECK(bad == 0);
+    }
+
+    // Half way between two rows the coverage splits evenly
+    GFX_fillScreen(0);
+    GFX_drawLineAA(0, 0, 2, 1, 0xFFFF, 0);
+    CHECK(GFX_getRow(0)[1] == GFX_blend565(0xFFFF, 0, 16) && GFX_getRow(1)[1] == GFX_blend565(0xFFFF, 0, 16));
+
+    // A round-joined poly line covers all pixels within half its width of
+    // the path, and nothing further out
+    static const GFXpoint path[] = {{20, 20}, {140, 50}, {60, 120}, {150, 200}, {30, 290}};
+    GFX_fillScreen(0);
+    GFX_drawPolyline(path, 5, 7, GFX_CAP_ROUND, 0xFFFF);
+    int bad = 0;
+    for (int y = 0; y < _height; y++)
+        for (int x = 0; x < _width; x++)
+        {
+            double best = 1e9;
+            for (int i = 0; i < 4; i++)
+            {
+                double s[4] = {(double)path[i].x, (double)path[i].y, (double)path[i + 1].x, (double)path[i + 1].y};
+                double dist, along, len = hypot(s[2] - s[0], s[3] - s[1]);
+                segmentDistance(x, y, s, &dist, &along);
+                if (along < 0)
+                    dist = hypot(x - s[0], y - s[1]);
+                else if (along > len)
+                    dist = hypot(x - s[2], y - s[3]);
+                if (dist < best)
+                    best = dist;
+            }
+            bool drawn = GFX_getRow(y)[x] != 0;
+            bad += (best < 3.5 - 0.75 && !drawn) || (best > 3.5 + 0.75 && drawn);
+        }
+    CHECK(bad == 0);
+    GFX_destroyFramebuf();
+
+    // Anti-aliased poly lines in direct mode: every vertex is written once.
+    // Vertices have full coverage, so a second blend would not change the
+    // colour; the panel's write count shows it instead.
+    static const GFXpoint poly[] = {{20, 20}, {120, 35}, {60, 110}, {150, 160}, {25, 250}};
+    emuReset(0);
+    GFX_drawPolylineAA(poly, 5, false, 0x07E0, 0);
+    LCD_cacheFlush();
+    for (int i = 0; i < 5; i++)
+        CHECK(emuWrites[poly[i].y * _width + poly[i].x] == 1 && panel[poly[i].y * _width + poly[i].x] == 0x07E0);
+    emuReset(0);
+    GFX_drawPolylineAA(poly, 5, true, 0x07E0, 0);
+    LCD_cacheFlush();
+    for (int i = 0; i < 5; i++)
+        CHECK(emuWrites[poly[i].y * _width + poly[i].x] == 1);
+
+    // The same segments drawn one by one do write the shared vertices twice
+    emuReset(0);
+    for (int i = 0; i < 4; i++)
+        GFX_drawLineAA(poly[i].x, poly[i].y, poly[i + 1].x, poly[i + 1].y, 0x07E0, 0);
+    LCD_cacheFlush();
+    CHECK(emuWrites[poly[1].y * _width + poly[1].x] == 2 && emuWrites[poly[3].y * _width + poly[3].x] == 2);
+
+    return testResult("line");
+}
@@ -0,0 +1,91 @@
+// Outline glyph cache: cached bitmaps match a fresh rasterisation after
+// eviction and compaction, and a pool allocated before the framebuffer is
+// kept, not allocated again, when the framebuffer is re-created; resizing
+// the pool gives the old one back instead of leaking it
+
+#include <string.h>
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxoutline.h"
+#include "outlinesans.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static uint8_t buf[4096];
+
+int main()
+{
+    emuReset(0);
+    GFX_arenaReset();
+
+    // Enough sizes to evict and compact many times over
+    for (int px = 8; px <= 96; px += 8)
+        for (int c = 0x20; c <= 0x7E; c += 3)
+            GFX_drawOutlineChar(10, 100, &OutlineSans, c, px, 0xFFFF, 0, (c & 1) ? 4 : 1);
+    GFXoutlineCacheStats st;
+    GFX_getOutlineCacheStats(&st);
+    CHECK(st.evictions > 0);
+    CHECK(st.bytes <= GFX_outlineCacheBytes());
+
+    for (int c = 'a'; c <= 'z'; c++)
+    {
+        GFXoutlineBitmap b;
+        const GFXoutlineBitmap *cached = GFX_outlineGlyph(&OutlineSans, c, 20, 4);
+        size_t n = GFX_outlineRasterize(&OutlineSans, c, 20, 4, buf, sizeof(buf), &b);
+        CHECK(cached != NULL && cached->width == b.width && cached->height == b.height);
+        CHECK(cached != NULL && memcmp(cached->bitmap, buf, n) == 0);
+    }
+
+    // Repeated text is served from the cache
+    GFX_drawOutlineText(0, 50, &OutlineSans, "Hello 123", 20, 0xFFFF, 0, 4);
+    GFX_resetOutlineCacheStats();
+    for (int r = 0; r < 5; r++)
+        GFX_drawOutlineText(0, 50, &OutlineSans, "Hello 123", 20, 0xFFFF, 0, 4);
+    GFX_getOutlineCacheStats(&st);
+    CHECK(st.misses == 0 && st.hits > 0);
+
+    // The pool sits below the framebuffer and survives its re-creation
+    CHECK(GFX_createFramebuf());
+    size_t used = GFX_arenaMark();
+    for (int i = 0; i < 4; i++)
+    {
+        GFX_destroyFramebuf();
+        CHECK(GFX_createFramebuf());
+        GFX_resetOutlineCacheStats();
+        GFX_drawOutlineText(0, 50, &OutlineSans, "Hello 123", 20, 0xFFFF, 0, 4);
+        GFX_getOutlineCacheStats(&st);
+        CHECK(st.misses == 0);
+    }
+    CHECK(GFX_arenaMark() == used);
+    GFX_destroyFramebuf();
+
+    // Resizing the newest pool returns it to the arena first
+    GFX_arenaReset();
+    GFX_drawOutlineText(0, 50, &OutlineSans, "Hello", 20, 0xFFFF, 0, 4);
+    CHECK(GFX_arenaMark() == GFX_outlineCacheBytes());
+    for (int i = 0; i < 4; i++)
+    {
+        GFX_setOutlineCacheBytes(i & 1 ? 4096 : 2048);
+        GFX_drawOutlineText(0, 50, &OutlineSans, "Hello", 20, 0xFFFF, 0, 4);
+        CHECK(GFX_arenaMark() == GFX_outlineCacheBytes());
+    }
+
+    // Under another allocation it keeps its size rather than being lost
+    void *above = GFX_arenaAlloc(64, GFX_MEM_OTHER);
+    size_t top = GFX_arenaMark();
+    GFX_setOutlineCacheBytes(1024);
+    GFX_drawOutlineText(0, 50, &OutlineSans, "Hello", 20, 0xFFFF, 0, 4);
+    CHECK(above != NULL && GFX_arenaMark() == top);
+    GFX_getOutlineCacheStats(&st);
+    CHECK(st.entries > 0);
+    GFX_setOutlineCacheBytes(0);
+    GFX_resetOutlineCacheStats();
+    GFX_drawOutlineText(0, 50, &OutlineSans, "Hello", 20, 0xFFFF, 0, 4);
+    GFX_getOutlineCacheStats(&st);
+    CHECK(st.hits == 0 && GFX_arenaMark() == top);
+
+    return testResult("outline");
+}
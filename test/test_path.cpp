@@ -0,0 +1,143 @@
+// Bezier paths: flattened curves stay within the tolerance, fills follow the
+// non-zero rule, and a path whose memory was released draws nothing
+
+#include <math.h>
+#include <stdlib.h>
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxpath.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static double segDist(double px, double py, double ax, double ay, double bx, double by)
+{
+    double dx = bx - ax, dy = by - ay, len = dx * dx + dy * dy;
+    double t = len ? ((px - ax) * dx + (py - ay) * dy) / len : 0;
+    t = t < 0 ? 0 : t > 1 ? 1 : t;
+    return hypot(ax + t * dx - px, ay + t * dy - py);
+}
+
+static void square(GFXpath *p, int x0, int y0, int x1, int y1)
+{
+    GFX_pathMoveTo(p, x0, y0);
+    GFX_pathLineTo(p, x1, y0);
+    GFX_pathLineTo(p, x1, y1);
+    GFX_pathLineTo(p, x0, y1);
+    GFX_pathClose(p);
+}
+
+static bool lit(int x, int y)
+{
+    return GFX_getRow(y)[x] != 0;
+}
+
+int main()
+{
+    emuReset(0);
+    GFX_arenaReset();
+    CHECK(GFX_createFramebuf());
+    GFXpath p;
+    CHECK(GFX_pathInit(&p, 400, 8));
+
+    // Random cubics, the first ones tiny: every point of the true curve is
+    // close to the flattened segments
+    srand(3);
+    double worst = 0;
+    for (int t = 0; t < 500; t++)
+    {
+        int x0 = rand() % 172, y0 = rand() % 320, a = rand() % 172, b = rand() % 320;
+        int c = rand() % 172, d = rand() % 320, x1 = rand() % 172, y1 = rand() % 320;
+        if (t < 100)
+        {
+            a = x0 + rand() % 9 - 4;
+            b = y0 + rand() % 9 - 4;
+            c = a + rand() % 9 - 4;
+            d = b + rand() % 9 - 4;
+            x1 = c + rand() % 9 - 4;
+            y1 = d + rand() % 9 - 4;
+        }
+        GFX_pathReset(&p);
+        GFX_pathMoveTo(&p, x0, y0);
+        GFX_pathCubicTo(&p, a, b, c, d, x1, y1);
+        CHECK(p.segments <= GFX_PATH_MAX_STEPS);
+        for (int k = 0; k <= 200 && p.count > 1; k++)
+        {
+            double s = k / 200.0, u = 1 - s;
+            double x = u * u * u * x0 + 3 * u * u * s * a + 3 * u * s * s * c + s * s * s * x1;
+            double y = u * u * u * y0 + 3 * u * u * s * b + 3 * u * s * s * d + s * s * s * y1;
+            double best = 1e9;
+            for (int i = 0; i + 1 < p.count; i++)
+            {
+                double dd = segDist(x, y, p.pts[i].x / 16.0, p.pts[i].y / 16.0,
+                                    p.pts[i + 1].x / 16.0, p.pts[i + 1].y / 16.0);
+                best = dd < best ? dd : best;
+            }
+            worst = best > worst ? best : worst;
+        }
+    }
+    CHECK(worst < 0.5);
+
+    // A circle from four cubics fills everything inside it
+    GFX_fillScreen(0);
+    int cx = 86, cy = 160, r = 50, k = (int)lround(0.5523 * r);
+    GFX_pathReset(&p);
+    GFX_pathMoveTo(&p, cx + r, cy);
+    GFX_pathCubicTo(&p, cx + r, cy + k, cx + k, cy + r, cx, cy + r);
+    GFX_pathCubicTo(&p, cx - k, cy + r, cx - r, cy + k, cx - r, cy);
+    GFX_pathCubicTo(&p, cx - r, cy - k, cx - k, cy - r, cx, cy - r);
+    GFX_pathCubicTo(&p, cx + k, cy - r, cx + r, cy - k, cx + r, cy);
+    GFX_pathClose(&p);
+    GFX_fillPath(&p, 0xFFFF);
+    int wrong = 0;
+    for (int y = 0; y < _height; y++)
+        for (int x = 0; x < _width; x++)
+        {
+            double dd = hypot(x - cx, y - cy);
+            wrong += fabs(dd - r) > 0.7 && lit(x, y) != (dd < r);
+        }
+    CHECK(wrong == 0);
+
+    // Non-zero rule: a nested square wound the same way is filled, one
+    // wound the other way is a hole; edges are half open
+    GFX_fillScreen(0);
+    GFX_pathReset(&p);
+    square(&p, 10, 10, 60, 60);
+    square(&p, 20, 20, 50, 50);
+    square(&p, 100, 10, 150, 60);
+    GFX_pathMoveTo(&p, 110, 20);
+    GFX_pathLineTo(&p, 110, 50);
+    GFX_pathLineTo(&p, 140, 50);
+    GFX_pathLineTo(&p, 140, 20);
+    GFX_pathClose(&p);
+    GFX_fillPath(&p, 0xFFFF);
+    CHECK(lit(35, 35) && !lit(125, 35) && lit(125, 15));
+    CHECK(lit(10, 10) && lit(59, 59) && !lit(60, 60));
+
+    // Points beyond the capacity set overflow
+    GFXpath q;
+    CHECK(GFX_pathInit(&q, 10, 1));
+    GFX_pathMoveTo(&q, 0, 0);
+    GFX_pathCubicTo(&q, 170, 0, 0, 300, 170, 300);
+    CHECK(q.overflow && q.count == 10);
+
+    // Re-creating the framebuffer releases both paths
+    GFX_destroyFramebuf();
+    CHECK(GFX_createFramebuf());
+    GFX_fillScreen(0x1111);
+    GFX_resolveClear();
+    CHECK(!GFX_pathValid(&p));
+    GFX_pathReset(&p);
+    square(&p, 0, 0, 100, 100);
+    CHECK(p.overflow && p.count == 0);
+    GFX_fillPath(&q, 0xFFFF);
+    GFX_strokePath(&q, 3, GFX_CAP_ROUND, 0xFFFF);
+    bool untouched = true;
+    for (int i = 0; i < _width * _height; i++)
+        untouched &= gfxFramebuffer[i] == 0x1111;
+    CHECK(untouched);
+
+    return testResult("path");
+}
@@ -0,0 +1,580 @@
+// PIO display transmitter, simulated at the instruction level: the DMA chain
+// built by st7789pio.cpp feeds the state machine's TX FIFO, st7789_tx.pio
+// runs one instruction per cycle with its side-set, and the resulting pin
+// trace is decoded by an SPI panel. Panel RAM must match the rectangles,
+// with CS, DC and SDA only changing while SCK is low.
+
+#include <string.h>
+#include <vector>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "st7789pio.h"
+#include "st7789_tx.pio.h"
+#include "test_util.h"
+
+int16_t _xstart = 34, _ystart = 0;
+uint16_t st7789_pinCS = 9, st7789_pinDC = 8, st7789_pinSCK = 10, st7789_pinTX = 11;
+
+// What the transmitter needs from the rest of the driver
+void LCD_cacheFlush()
+{
+}
+
+void LCD_queueWait()
+{
+}
+
+static int invalidations = 0;
+void LCD_readCacheInvalidate()
+{
+    invalidations++;
+}
+
+void gpio_set_function(uint, enum gpio_function)
+{
+}
+
+void gpio_init(uint)
+{
+}
+
+void gpio_set_dir(uint, bool)
+{
+}
+
+void gpio_put(uint, bool)
+{
+}
+
+static int errors = 0; // Protocol violations: must stay 0
+
+// ---- Panel: decodes bytes from the pin trace ----
+
+static uint16_t gram[320][240];
+static int bitCount = 0;
+static uint8_t shift = 0;
+static int cmd = -1;
+static std::vector<uint8_t> params;
+static int colStart, colEnd, rowStart, rowEnd, wx, wy;
+static bool inRam = false, haveHi = false;
+static uint8_t hiByte;
+static bool pins[32];
+static long cycles = 0, bitsOut = 0;
+
+static void panelByte(uint8_t b, bool dc)
+{
+    if (!dc)
+    {
+        cmd = b;
+        params.clear();
+        haveHi = false;
+        inRam = b == 0x2C;
+        wx = colStart;
+        wy = rowStart;
+        return;
+    }
+    if (inRam)
+    {
+        if (!haveHi)
+        {
+            hiByte = b;
+            haveHi = true;
+            return;
+        }
+        haveHi = false;
+        if (wy > rowEnd || wx >= 240 || wy >= 320)
+        {
+            errors++; // Past the window
+            return;
+        }
+        gram[wy][wx] = hiByte << 8 | b;
+        if (++wx > colEnd)
+        {
+            wx = colStart;
+            wy++;
+        }
+        return;
+    }
+    params.push_back(b);
+    if (params.size() == 4)
+    {
+        int a = params[0] << 8 | params[1], e = params[2] << 8 | params[3];
+        if (cmd == 0x2A)
+        {
+            colStart = a;
+            colEnd = e;
+        }
+        else if (cmd == 0x2B)
+        {
+            rowStart = a;
+            rowEnd = e;
+        }
+        else
+            errors++;
+    }
+}
+
+static void setPin(uint p, bool v)
+{
+    bool old = pins[p];
+    if (old == v)
+        return;
+    if (p != st7789_pinSCK && pins[st7789_pinSCK])
+        errors++; // Mode 0: lines only change while SCK is low
+    pins[p] = v;
+    if (p == st7789_pinSCK && v)
+    {
+        if (pins[st7789_pinCS])
+        {
+            errors++; // Clocked while not selected
+            return;
+        }
+        shift = shift << 1 | pins[st7789_pinTX];
+        bitsOut++;
+        if (++bitCount == 8)
+        {
+            panelByte(shift, pins[st7789_pinDC]);
+            bitCount = 0;
+        }
+    }
+    if (p == st7789_pinCS && v)
+    {
+        if (bitCount)
+            errors++; // Deselected mid-byte
+        bitCount = 0;
+    }
+}
+
+// ---- PIO: one state machine ----
+
+static pio_hw_t pioHw;
+PIO pio0 = &pioHw, pio1 = &pioHw;
+static const uint16_t *program;
+static pio_sm_config smConfig;
+static uint32_t fifo[8];
+static int fifoHead = 0, fifoCount = 0;
+static uint pc;
+static uint32_t regX, regY, regISR, regOSR;
+
+uint pio_add_program(PIO, const pio_program_t *p)
+{
+    program = p->instructions;
+    return 0;
+}
+
+bool pio_can_add_program(PIO, const pio_program_t *)
+{
+    return true;
+}
+
+void pio_remove_program(PIO, const pio_program_t *, uint)
+{
+}
+
+int pio_claim_unused_sm(PIO, bool)
+{
+    return 0;
+}
+
+void pio_sm_unclaim(PIO, uint)
+{
+}
+
+pio_sm_config pio_get_default_sm_config()
+{
+    pio_sm_config c;
+    memset(&c, 0, sizeof(c));
+    return c;
+}
+
+void sm_config_set_wrap(pio_sm_config *c, uint target, uint wrap)
+{
+    c->wrap_target = target;
+    c->wrap = wrap;
+}
+
+void sm_config_set_sideset(pio_sm_config *c, uint bits, bool, bool)
+{
+    c->side_bits = bits;
+}
+
+void sm_config_set_out_pins(pio_sm_config *c, uint base, uint n)
+{
+    c->out_base = base;
+    c->out_count = n;
+}
+
+void sm_config_set_set_pins(pio_sm_config *c, uint base, uint n)
+{
+    c->set_base = base;
+    c->set_count = n;
+}
+
+void sm_config_set_sideset_pins(pio_sm_config *c, uint base)
+{
+    c->side_base = base;
+}
+
+void sm_config_set_out_shift(pio_sm_config *c, bool right, bool, uint)
+{
+    c->out_right = right;
+}
+
+void sm_config_set_fifo_join(pio_sm_config *, int)
+{
+}
+
+void sm_config_set_clkdiv(pio_sm_config *, float)
+{
+}
+
+void pio_sm_init(PIO, uint, uint offset, const pio_sm_config *c)
+{
+    smConfig = *c;
+    pc = offset;
+}
+
+void pio_sm_set_enabled(PIO, uint, bool)
+{
+}
+
+void pio_sm_set_consecutive_pindirs(PIO, uint, uint, uint, bool)
+{
+}
+
+void pio_sm_set_pins_with_mask(PIO, uint, uint32_t values, uint32_t mask)
+{
+    for (int i = 0; i < 32; i++)
+        if (mask >> i & 1)
+            pins[i] = values >> i & 1;
+}
+
+void pio_gpio_init(PIO, uint)
+{
+}
+
+uint pio_get_dreq(PIO, uint, bool)
+{
+    return 0;
+}
+
+bool pio_sm_is_tx_fifo_empty(PIO, uint)
+{
+    return fifoCount == 0;
+}
+
+uint32_t pio_sm_get_pc(PIO, uint)
+{
+    return pc;
+}
+
+// Execute one instruction; a pull on an empty FIFO stalls with the side-set applied
+static void pioStep()
+{
+    uint16_t ins = program[pc];
+    uint op = ins >> 13, side = ins >> 12 & 1, arg1 = ins >> 5 & 7, arg2 = ins & 31;
+    uint next = pc == smConfig.wrap ? smConfig.wrap_target : pc + 1;
+
+    if (op == 4)
+    {
+        if (!(ins & 0x80))
+        {
+            errors++; // push is not expected
+            return;
+        }
+        if (fifoCount == 0)
+        {
+            setPin(smConfig.side_base, side);
+            return;
+        }
+        regOSR = fifo[fifoHead];
+        fifoHead = (fifoHead + 1) % 8;
+        fifoCount--;
+    }
+    setPin(smConfig.side_base, side);
+
+    switch (op)
+    {
+    case 0: // jmp
+    {
+        bool take = false;
+        switch (arg1)
+        {
+        case 0:
+            take = true;
+            break;
+        case 1:
+            take = regX == 0;
+            break;
+        case 2:
+            take = regX-- != 0;
+            break;
+        case 4:
+            take = regY-- != 0;
+            break;
+        default:
+            errors++;
+        }
+        if (take)
+            next = arg2;
+        break;
+    }
+    case 3: // out, MSB first
+    {
+        uint n = arg2 ? arg2 : 32;
+        uint32_t v = n == 32 ? regOSR : regOSR >> (32 - n);
+        regOSR = n == 32 ? 0 : regOSR << n;
+        if (arg1 == 0)
+            setPin(smConfig.out_base, v & 1);
+        else if (arg1 == 1)
+            regX = v;
+        else if (arg1 == 2)
+            regY = v;
+        else if (arg1 == 6)
+            regISR = v;
+        else
+            errors++;
+        break;
+    }
+    case 4: // pull, done above
+        break;
+    case 5: // mov y, isr is the only one used
+        if (arg1 == 2 && (arg2 & 7) == 6)
+            regY = regISR;
+        else
+            errors++;
+        break;
+    case 7: // set pins
+        for (uint i = 0; i < smConfig.set_count; i++)
+            setPin(smConfig.set_base + i, arg2 >> i & 1);
+        break;
+    default:
+        errors++;
+    }
+    pc = next;
+    cycles++;
+}
+
+// ---- DMA: the data channel into the FIFO and the control block channel ----
+
+typedef struct
+{
+    const volatile void *read;
+    volatile void *write;
+    uint32_t count, ctrl;
+} SimBlock;
+
+static dma_channel_hw_t channels[2];
+static int claimed = 0;
+static bool dataBusy = false;
+static int dataSize = 0;
+static uint32_t dataCount = 0;
+static bool ringSet = false;
+
+int dma_claim_unused_channel(bool)
+{
+    return claimed++;
+}
+
+void dma_channel_unclaim(uint)
+{
+    claimed--;
+}
+
+dma_channel_config dma_channel_get_default_config(uint)
+{
+    dma_channel_config c = {1 | 2u << 2};
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size s)
+{
+    c->ctrl = (c->ctrl & ~0xCu) | (uint32_t)s << 2;
+}
+
+void channel_config_set_read_increment(dma_channel_config *, bool)
+{
+}
+
+void channel_config_set_write_increment(dma_channel_config *, bool)
+{
+}
+
+void channel_config_set_dreq(dma_channel_config *, uint)
+{
+}
+
+void channel_config_set_chain_to(dma_channel_config *, uint)
+{
+}
+
+void channel_config_set_ring(dma_channel_config *, bool write, uint bits)
+{
+    ringSet = write && bits == 4;
+}
+
+uint32_t channel_config_get_ctrl_value(const dma_channel_config *c)
+{
+    return c->ctrl;
+}
+
+void dma_channel_configure(uint n, const dma_channel_config *, volatile void *write, const volatile void *read,
+                           uint count, bool)
+{
+    channels[n].write_addr = (uintptr_t)write;
+    channels[n].read_addr = (uintptr_t)read;
+    if (n == 0)
+        dataCount = count;
+}
+
+dma_channel_hw_t *dma_channel_hw_addr(uint n)
+{
+    return &channels[n];
+}
+
+// The control channel loads the next block into the data channel; a null
+// block ends the chain
+static void controlTrigger()
+{
+    const SimBlock *b = (const SimBlock *)channels[1].read_addr;
+    channels[1].read_addr += sizeof(SimBlock);
+    if (b->ctrl == 0)
+    {
+        dataBusy = false;
+        return;
+    }
+    if ((uintptr_t)b->write != (uintptr_t)&pioHw.txf[0] || b->count == 0)
+        errors++;
+    channels[0].read_addr = (uintptr_t)b->read;
+    dataCount = b->count;
+    dataSize = (b->ctrl >> 2) & 3;
+    dataBusy = b->count > 0;
+}
+
+void dma_channel_set_read_addr(uint n, const volatile void *addr, bool trigger)
+{
+    if (n != 1 || !trigger || dataBusy)
+    {
+        errors++; // Only the control channel is started, and only when idle
+        return;
+    }
+    channels[1].read_addr = (uintptr_t)addr;
+    controlTrigger();
+}
+
+bool dma_channel_is_busy(uint n)
+{
+    return n == 0 && dataBusy;
+}
+
+// One FIFO write when there is room; 16-bit writes fill both halves
+static void dmaStep()
+{
+    if (!dataBusy || fifoCount == 8)
+        return;
+    uint32_t v;
+    if (dataSize == 1)
+    {
+        uint16_t h = *(const uint16_t *)channels[0].read_addr;
+        v = (uint32_t)h << 16 | h;
+        channels[0].read_addr += 2;
+    }
+    else
+    {
+        v = *(const uint32_t *)channels[0].read_addr;
+        channels[0].read_addr += 4;
+    }
+    fifo[(fifoHead + fifoCount) % 8] = v;
+    fifoCount++;
+    if (--dataCount == 0)
+    {
+        dataBusy = false;
+        controlTrigger();
+    }
+}
+
+void tight_loop_contents()
+{
+    for (int i = 0; i < 64; i++)
+    {
+        dmaStep();
+        pioStep();
+    }
+}
+
+// ---- Checks ----
+
+static uint16_t src[320 * 240];
+static uint16_t expect[320][240];
+
+static void expectRect(const LCDrect &r)
+{
+    for (int j = 0; j < r.h; j++)
+        for (int i = 0; i < r.w; i++)
+            expect[r.y + j][r.x + i + _xstart] = r.pixels[j * r.stride + i];
+}
+
+// Panel RAM as expected, no protocol errors, idle with CS high; pixel data
+// keeps SCK busy most of the time
+static void checkPanel(const char *name)
+{
+    int bad = 0;
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 240; x++)
+            bad += gram[y][x] != expect[y][x];
+    if (bad || errors)
+        printf("%s: %d pixels differ, %d bus errors\n", name, bad, errors);
+    CHECK(bad == 0 && errors == 0);
+    CHECK(!LCD_pioBusy() && pins[st7789_pinCS] && fifoCount == 0);
+    CHECK(2 * bitsOut > cycles * 8 / 10);
+    cycles = bitsOut = 0;
+}
+
+int main()
+{
+    for (int i = 0; i < 320 * 240; i++)
+        src[i] = (uint16_t)(i * 2654435761u >> 7);
+    CHECK(LCD_pioInit(pio0, 1.0f));
+    CHECK(ringSet);
+
+    // Contiguous, strided and single-pixel rectangles in one chain
+    LCDrect a[3] = {{0, 0, 172, 10, src, 172}, {5, 50, 20, 30, src + 1000, 172}, {171, 319, 1, 1, src + 7, 1}};
+    LCD_pioWriteRects(a, 3);
+    LCD_pioWait();
+    for (const LCDrect &r : a)
+        expectRect(r);
+    checkPanel("mixed");
+
+    // 200 strided rows need several chains
+    LCDrect big = {10, 20, 100, 200, src + 333, 172};
+    LCD_pioWriteRects(&big, 1);
+    LCD_pioWait();
+    expectRect(big);
+    checkPanel("multi-chain");
+
+    // Many small rectangles; an empty one is skipped
+    std::vector<LCDrect> many;
+    for (int i = 0; i < 50; i++)
+        many.push_back({(uint16_t)(i * 3), (uint16_t)(100 + i * 4), 7, 3, src + i * 97, 7});
+    many.push_back({0, 0, 0, 5, src, 0});
+    LCD_pioWriteRects(many.data(), many.size());
+    LCD_pioWait();
+    for (const LCDrect &r : many)
+        if (r.w && r.h)
+            expectRect(r);
+    checkPanel("many");
+
+    // A full screen runs in the background until waited for
+    LCDrect full = {0, 0, 172, 320, src + 11, 172};
+    LCD_pioWriteRects(&full, 1);
+    CHECK(LCD_pioBusy());
+    LCD_pioWait();
+    expectRect(full);
+    checkPanel("full screen");
+
+    LCD_pioRelease();
+    CHECK(claimed == 0);
+    CHECK(invalidations > 0);
+    return testResult("pio");
+}
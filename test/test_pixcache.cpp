@@ -0,0 +1,136 @@
+// Write-combining pixel cache: a random mix of pixel streams reaches the
+// panel intact, rows, columns and rectangles each go out as one window, and
+// text and lines drawn in direct mode match the framebuffer reference with
+// a fraction of the per-pixel window count
+
+#include <stdlib.h>
+#include <string.h>
+#include "gfx.h"
+#include "pixcache.h"
+#include "sans24.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static uint16_t expect[320 * 320];
+
+// Draw in direct mode through the cache, check that it took at most one
+// window per minRatio pixels (uncached, every pixel is a window), then
+// draw it again into a framebuffer and compare
+static void throughCache(void (*draw)(), uint32_t minRatio)
+{
+    emuReset(0);
+    LCD_resetCacheStats();
+    draw();
+    LCD_cacheFlush();
+    PixCacheStats st;
+    LCD_getCacheStats(&st);
+    CHECK(st.pixels > 100 && st.windows * minRatio <= st.pixels);
+
+    CHECK(GFX_createFramebuf());
+    draw();
+    int bad = 0;
+    for (int j = 0; j < _height; j++)
+        for (int i = 0; i < _width; i++)
+            bad += panel[j * _width + i] != GFX_getRow(j)[i];
+    CHECK(bad == 0);
+    GFX_destroyFramebuf();
+}
+
+static void classicText()
+{
+    GFX_setFont(NULL);
+    GFX_setTextSize(1);
+    GFX_setTextColor(0xFFE0); // No background: glyphs go out pixel by pixel
+    GFX_setCursor(2, 4);
+    GFX_printf("The quick brown fox jumps over the lazy dog 0123456789");
+}
+
+static void fontText()
+{
+    GFX_setFont(&Sans24);
+    GFX_setTextColor(0x07FF);
+    GFX_setCursor(4, 140);
+    GFX_printf("Sans 24");
+    GFX_setFont(NULL);
+}
+
+static void lines()
+{
+    for (int k = 0; k < 12; k++)
+        GFX_drawLine(86, 160, 86 + (k - 6) * 5, k & 1 ? 0 : 319, (uint16_t)(0x0841 * (k + 1))); // Steep
+    for (int k = 0; k < 12; k++)
+        GFX_drawLine(0, 100 + k * 9, 171, 130 + k * 7, (uint16_t)(0x1082 * (k + 1))); // Shallow
+}
+
+int main()
+{
+    emuReset(0);
+    memset(expect, 0, sizeof(expect));
+    LCD_resetCacheStats();
+    srand(1);
+
+    int x = 0, y = 0;
+    for (int n = 0; n < 20000; n++)
+    {
+        switch (rand() % 4)
+        {
+        case 0: // Anywhere
+            x = rand() % _width;
+            y = rand() % _height;
+            break;
+        case 1: // Next pixel of a row
+            x = (x + 1) % _width;
+            break;
+        case 2: // Next pixel of a column
+            y = (y + 1) % _height;
+            break;
+        default: // Start of the next row of a small rectangle
+            x = x < 3 ? 0 : x - 3;
+            y = (y + 1) % _height;
+            break;
+        }
+        uint16_t c = rand();
+        expect[y * _width + x] = c;
+        LCD_cachePixel(x, y, c);
+    }
+    LCD_cacheFlush();
+
+    PixCacheStats st;
+    LCD_getCacheStats(&st);
+    CHECK(memcmp(panel, expect, sizeof(uint16_t) * _width * _height) == 0);
+    CHECK(st.pixels == 20000);
+    CHECK(st.windows < st.pixels);
+
+    // A long row goes out in buffer-sized windows
+    LCD_resetCacheStats();
+    for (int i = 0; i < _width; i++)
+        LCD_cachePixel(i, 5, (uint16_t)i);
+    LCD_cacheFlush();
+    LCD_getCacheStats(&st);
+    CHECK(st.windows == (uint32_t)(_width + PIXCACHE_SIZE - 1) / PIXCACHE_SIZE);
+    for (int i = 0; i < _width; i++)
+        CHECK(panel[5 * _width + i] == i);
+
+    // A column, then a rectangle drawn row by row: one window each
+    LCD_resetCacheStats();
+    for (int j = 0; j < 20; j++)
+        LCD_cachePixel(100, 50 + j, 0x1234);
+    LCD_cacheFlush();
+    for (int j = 0; j < 6; j++)
+        for (int i = 0; i < 8; i++)
+            LCD_cachePixel(10 + i, 100 + j, (uint16_t)(j * 8 + i));
+    LCD_cacheFlush();
+    LCD_getCacheStats(&st);
+    CHECK(st.windows == 2);
+    CHECK(panel[69 * _width + 100] == 0x1234 && panel[105 * _width + 17] == 47);
+
+    // Text and lines drawn through GFX_ in direct mode
+    throughCache(classicText, 6);
+    throughCache(fontText, 3);
+    throughCache(lines, 3);
+
+    return testResult("pixcache");
+}
@@ -0,0 +1,75 @@
+// Adaptive quality: slow frames step the level down to half resolution, and
+// the half-size canvas is reused while it is big enough, grown in place while
+// it is the newest arena allocation and never allocated twice
+
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxquality.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static uint8_t lastShift;
+
+static void paint(const GFXregionView *v, void *ctx)
+{
+    lastShift = v->shift;
+    GFX_fillRect(v->x, v->y, v->w, v->h, *(uint16_t *)ctx);
+}
+
+// One frame that takes 5 ms against the budget
+static void frame()
+{
+    GFX_frameBegin();
+    GFX_drawDynamicRegions();
+    GFX_flush();
+    emuNow += 5000;
+    GFX_frameEnd(true);
+}
+
+int main()
+{
+    emuReset(0);
+    GFX_arenaReset();
+    uint16_t col = 0xF800;
+
+    GFX_setFrameBudget(1000);
+    GFX_addDynamicRegion(10, 10, 40, 40, paint, &col);
+    for (int i = 0; i < 4 * GFX_QUALITY_HOLD_FRAMES && GFX_getQualityLevel() < GFX_QUALITY_HALF; i++)
+        frame();
+    CHECK(GFX_getQualityLevel() == GFX_QUALITY_HALF);
+
+    // Canvas for 20x20 pixels, the only allocation; reused frame after frame
+    frame();
+    CHECK(lastShift == 1 && panel[11 * 172 + 11] == col);
+    size_t small = 20 * 20 * sizeof(uint16_t);
+    CHECK(GFX_arenaMark() == small);
+    for (int i = 0; i < 3; i++)
+        GFX_drawDynamicRegions();
+    CHECK(GFX_arenaMark() == small);
+
+    // A bigger region replaces it while nothing sits above it
+    GFX_addDynamicRegion(60, 60, 80, 80, paint, &col);
+    GFX_drawDynamicRegions();
+    size_t big = 40 * 40 * sizeof(uint16_t);
+    CHECK(lastShift == 1 && GFX_arenaMark() == big);
+
+    // With an allocation above it, a bigger region is drawn at full size instead
+    CHECK(GFX_arenaAlloc(64, GFX_MEM_OTHER) != NULL);
+    size_t top = GFX_arenaMark();
+    GFX_addDynamicRegion(0, 150, 100, 100, paint, &col);
+    col = 0x07E0;
+    GFX_drawDynamicRegions();
+    CHECK(lastShift == 0 && GFX_arenaMark() == top);
+    CHECK(panel[200 * 172 + 50] == col && panel[70 * 172 + 70] == col);
+
+    // Once the arena has released the canvas a new one is allocated
+    GFX_arenaReset();
+    GFX_clearDynamicRegions();
+    GFX_addDynamicRegion(10, 10, 40, 40, paint, &col);
+    GFX_drawDynamicRegions();
+    CHECK(lastShift == 1 && GFX_arenaMark() == small);
+    return testResult("quality");
+}
@@ -0,0 +1,134 @@
+// Background flush queue on the bus-level panel model: entries reach the
+// glass in submission order even when they overlap, blocking writes and
+// direct-mode pixels wait for what is queued ahead of them, and GFX_flush()
+// through the queue leaves the panel equal to the framebuffer
+
+#include <stdlib.h>
+#include <string.h>
+#include "gfx.h"
+#include "st7789.h"
+#include "lcdqueue.h"
+#include "pixcache.h"
+#include "bus_emu.h"
+#include "test_util.h"
+
+extern int16_t _xstart, _ystart; // Panel RAM offset of the visible area
+
+static uint16_t expect[320][240];
+static uint16_t src[172 * 320];
+
+static void expectBitmap(int x, int y, int w, int h, const uint16_t *p, int stride)
+{
+    for (int j = 0; j < h; j++)
+        for (int i = 0; i < w; i++)
+            expect[y + j + _ystart][x + i + _xstart] = p[j * stride + i];
+}
+
+static void expectFill(int x, int y, int w, int h, uint16_t col)
+{
+    for (int j = 0; j < h; j++)
+        for (int i = 0; i < w; i++)
+            expect[y + j + _ystart][x + i + _xstart] = col;
+}
+
+static void expectFramebuffer()
+{
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+            expect[y + _ystart][x + _xstart] = GFX_getRow(y)[x];
+}
+
+// Panel RAM as expected, no protocol errors, queue idle
+static void checkPanel(const char *name)
+{
+    int bad = 0;
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 240; x++)
+            bad += gram[y][x] != expect[y][x];
+    if (bad || busErrors)
+        printf("%s: %d pixels differ, %d bus errors\n", name, bad, busErrors);
+    CHECK(bad == 0 && busErrors == 0);
+    CHECK(!LCD_queueBusy() && !busAsyncActive());
+}
+
+int main()
+{
+    LCD_setPins(BUS_PIN_DC, BUS_PIN_CS, BUS_PIN_RST, BUS_PIN_SCK, BUS_PIN_TX);
+    LCD_setSPIperiph(spi1);
+    LCD_initDisplay(172, 320);
+    LCD_setRotation(0);
+    memcpy(expect, gram, sizeof(gram));
+    for (int i = 0; i < 172 * 320; i++)
+        src[i] = rand();
+
+    // Overlapping fills, packed and strided bitmaps: the later entry wins
+    LCD_queueFill(0, 0, 100, 100, 0x1111);
+    expectFill(0, 0, 100, 100, 0x1111);
+    LCD_queueBitmap(10, 10, 50, 40, src, 172);
+    expectBitmap(10, 10, 50, 40, src, 172);
+    LCD_queueBitmap(30, 30, 20, 20, src + 5000, 20);
+    expectBitmap(30, 30, 20, 20, src + 5000, 20);
+    for (int k = 0; k < 3; k++)
+        tight_loop_contents(); // Partly drained when the next entries arrive
+    LCD_queueFill(40, 0, 10, 120, 0xF800);
+    expectFill(40, 0, 10, 120, 0xF800);
+    LCD_WriteBitmap(45, 5, 10, 10, src + 9000); // Blocking, but still after the queue
+    expectBitmap(45, 5, 10, 10, src + 9000, 10);
+    LCD_queueBitmap(0, 200, 172, 30, src + 100, 172);
+    expectBitmap(0, 200, 172, 30, src + 100, 172);
+    LCD_queueWait();
+    checkPanel("ordering");
+
+    // More entries than slots: submission stalls until the IRQ frees one
+    LCDqueueStats st;
+    LCD_resetQueueStats();
+    for (int i = 0; i < 40; i++)
+    {
+        LCD_queueBitmap(i * 4, i * 7, 9, 5, src + i * 333, 13);
+        expectBitmap(i * 4, i * 7, 9, 5, src + i * 333, 13);
+        if (i % 5 == 0)
+            tight_loop_contents();
+    }
+    LCD_queueWait();
+    LCD_getQueueStats(&st);
+    checkPanel("40 entries");
+    CHECK(st.entries == 40 && st.stalls > 0 && busIrqCalls > 0);
+
+    // Pixels cached in direct mode before an entry go out first
+    GFX_drawPixel(1, 1, 0x0F0F);
+    GFX_drawPixel(2, 1, 0x0F0F);
+    expectFill(1, 1, 2, 1, 0x0F0F);
+    LCD_queueFill(2, 1, 1, 1, 0xAAAA);
+    expectFill(2, 1, 1, 1, 0xAAAA);
+    LCD_queueWait();
+    checkPanel("pixel cache before queue");
+
+    // GFX_flush() through the queue, with lazily cleared rows and the scroll ring
+    CHECK(GFX_createFramebuf());
+    GFX_setFlushQueue(true);
+    GFX_fillScreen(0x0841);
+    GFX_fillRect(10, 10, 50, 50, 0x07E0);
+    GFX_drawLine(0, 300, 171, 100, 0xFFFF);
+    GFX_flush();
+    CHECK(LCD_queueBusy()); // Returns before the rows are on the glass
+    GFX_flushQueueWait();
+    expectFramebuffer();
+    checkPanel("queued flush");
+
+    GFX_scrollUp(37);
+    GFX_fillRect(0, 250, 172, 20, 0x001F);
+    GFX_flush();
+    GFX_flushQueueWait();
+    expectFramebuffer();
+    checkPanel("queued flush after scroll");
+    GFX_setFlushQueue(false);
+    GFX_destroyFramebuf();
+
+    // A transfer that completes as soon as it starts
+    busAsyncStep = 1000000;
+    LCD_queueBitmap(3, 3, 7, 7, src, 9);
+    expectBitmap(3, 3, 7, 7, src, 9);
+    LCD_queueWait();
+    checkPanel("immediate IRQ");
+    return testResult("queue");
+}
@@ -0,0 +1,110 @@
+// Panel readback, for both read wirings, against the bus-level panel model:
+// RAMRD round-trips every RGB565 value, and direct-mode blends, overlapping
+// copies and save-under read what is really on the glass
+
+#include <stdlib.h>
+#include "gfx.h"
+#include "st7789.h"
+#include "readcache.h"
+#include "pixcache.h"
+#include "bus_emu.h"
+#include "test_util.h"
+
+extern int16_t _xstart, _ystart; // Panel RAM offset of the visible area
+
+static uint16_t glass(int x, int y)
+{
+    return gram[y + _ystart][x + _xstart];
+}
+
+static void run(uint8_t mode)
+{
+    LCD_setPins(BUS_PIN_DC, BUS_PIN_CS, BUS_PIN_RST, BUS_PIN_SCK, BUS_PIN_TX);
+    LCD_setSPIperiph(spi1);
+    LCD_initDisplay(172, 320);
+    LCD_setReadMode(mode, mode == LCD_READ_4WIRE ? BUS_PIN_RX : -1);
+    CHECK(LCD_canRead());
+    CHECK(LCD_ReadID() == busPanelId);
+
+    // Random pixels plus the extremes of each channel
+    static uint16_t bm[40 * 30], rb[40 * 30];
+    srand(mode);
+    for (int i = 0; i < 40 * 30; i++)
+        bm[i] = rand();
+    const uint16_t edge[] = {0xFFFF, 0x0000, 0xF800, 0x07E0, 0x001F, 0x0821};
+    for (int i = 0; i < 6; i++)
+        bm[i] = edge[i];
+    LCD_WriteBitmap(5, 7, 40, 30, bm);
+    CHECK(LCD_ReadBitmap(5, 7, 40, 30, rb));
+    int bad = 0;
+    for (int i = 0; i < 40 * 30; i++)
+        bad += rb[i] != bm[i];
+    CHECK(bad == 0);
+
+    // Direct-mode blends read the panel through the tile cache
+    GFX_fillScreen(0x001F);
+    GFX_fillRect(20, 20, 60, 60, 0xF800);
+    LCD_resetReadCacheStats();
+    for (int y = 10; y < 90; y++)
+        for (int x = 10; x < 90; x++)
+            GFX_blendPixel(x, y, 0xFFFF, 16, 0x1234); // bg is ignored with readback
+    LCD_cacheFlush();
+    bad = 0;
+    for (int y = 10; y < 90; y++)
+        for (int x = 10; x < 90; x++)
+        {
+            uint16_t under = (x >= 20 && x < 80 && y >= 20 && y < 80) ? 0xF800 : 0x001F;
+            bad += glass(x, y) != GFX_blend565(0xFFFF, under, 16);
+        }
+    CHECK(bad == 0);
+    ReadCacheStats st;
+    LCD_getReadCacheStats(&st);
+    CHECK(st.hits > st.misses);
+
+    // A second blend sees the first (the cache is written through)
+    GFX_blendPixel(3, 3, 0xFFFF, 16, 0);
+    GFX_blendPixel(3, 3, 0xFFFF, 16, 0);
+    LCD_cacheFlush();
+    CHECK(glass(3, 3) == GFX_blend565(0xFFFF, GFX_blend565(0xFFFF, 0x001F, 16), 16));
+
+    // Overlapping copies in both directions
+    static uint16_t before[320 * 172];
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+            before[y * 172 + x] = glass(x, y);
+    CHECK(GFX_copyRect(10, 10, 100, 100, 30, 25));
+    LCD_cacheFlush();
+    bad = 0;
+    for (int y = 0; y < 100; y++)
+        for (int x = 0; x < 100; x++)
+            bad += glass(30 + x, 25 + y) != before[(10 + y) * 172 + 10 + x];
+    CHECK(bad == 0);
+    CHECK(GFX_copyRect(30, 25, 100, 100, 5, 5));
+    LCD_cacheFlush();
+    bad = 0;
+    for (int y = 0; y < 100; y++)
+        for (int x = 0; x < 100; x++)
+            bad += glass(5 + x, 5 + y) != before[(10 + y) * 172 + 10 + x];
+    CHECK(bad == 0);
+
+    // Save-under
+    uint16_t saved[16];
+    CHECK(GFX_readRect(5, 5, 4, 4, saved));
+    CHECK(saved[0] == glass(5, 5) && saved[15] == glass(8, 8));
+    CHECK(!GFX_readRect(170, 0, 4, 4, saved));
+    CHECK(busErrors == 0);
+}
+
+int main()
+{
+    run(LCD_READ_3WIRE);
+    run(LCD_READ_4WIRE);
+    CHECK(busReadBits > 0);
+
+    // Without a read path copies are refused
+    LCD_setReadMode(LCD_READ_NONE, -1);
+    CHECK(!LCD_canRead());
+    CHECK(!GFX_copyRect(0, 0, 5, 5, 1, 1));
+
+    return testResult("readback");
+}
@@ -0,0 +1,97 @@
+// Ring-buffer scrolling: random scrolls and drawing match the old copying
+// scroll on the panel after every flush, and GFX_resolveClear() leaves the
+// framebuffer in linear order
+
+#include <stdlib.h>
+#include <string.h>
+#include "gfx.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// Reference framebuffer, scrolled the way GFX_scrollUp() used to: copy the
+// rows up and clear the exposed ones to black
+static uint16_t ref[320 * 320];
+
+static void refScroll(int n)
+{
+    if (n > _height)
+        n = _height;
+    memmove(ref, ref + _width * n, sizeof(uint16_t) * _width * (_height - n));
+    memset(ref + _width * (_height - n), 0, sizeof(uint16_t) * _width * n);
+}
+
+static void refFill(int x, int y, int w, int h, uint16_t c)
+{
+    for (int j = y; j < y + h; j++)
+        for (int i = x; i < x + w; i++)
+            if (i >= 0 && j >= 0 && i < _width && j < _height)
+                ref[j * _width + i] = c;
+}
+
+int main()
+{
+    emuReset(0);
+    CHECK(GFX_createFramebuf());
+    srand(3);
+    GFX_fillScreen(0);
+    memset(ref, 0, sizeof(ref));
+
+    bool autoDamage = false;
+    for (int step = 0; step < 300; step++)
+    {
+        switch (rand() % 3)
+        {
+        case 0:
+        {
+            int n = rand() % 40;
+            GFX_scrollUp(n);
+            refScroll(n);
+            break;
+        }
+        case 1: // Pixels, some off screen
+            for (int k = 0; k < 50; k++)
+            {
+                int x = rand() % 180, y = rand() % 330;
+                uint16_t c = rand();
+                GFX_drawPixel(x, y, c);
+                refFill(x, y, 1, 1, c);
+            }
+            break;
+        default: // Rectangles, which cross the wrap point once scrolled
+        {
+            int x = rand() % 180, y = rand() % 330, w = 1 + rand() % 60, h = 1 + rand() % 60;
+            uint16_t c = rand();
+            GFX_fillRect(x, y, w, h, c);
+            refFill(x, y, w, h, c);
+            break;
+        }
+        }
+        // Both flush paths must send the ring as two segments
+        if (step % 7 == 0)
+        {
+            autoDamage = !autoDamage;
+            GFX_setAutoDamage(autoDamage);
+        }
+        GFX_flush();
+        if (memcmp(panel, ref, sizeof(uint16_t) * _width * _height) != 0)
+        {
+            printf("panel differs after step %d\n", step);
+            CHECK(false);
+            break;
+        }
+    }
+
+    GFX_resolveClear();
+    CHECK(memcmp(gfxFramebuffer, ref, sizeof(uint16_t) * _width * _height) == 0);
+
+    // A scroll past the height clears the screen
+    GFX_scrollUp(_height + 5);
+    refScroll(_height + 5);
+    GFX_flush();
+    CHECK(memcmp(panel, ref, sizeof(uint16_t) * _width * _height) == 0);
+
+    return testResult("scroll");
+}
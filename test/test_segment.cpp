@@ -0,0 +1,93 @@
+// Segment fields: every pixel a print changes lies inside a damage box, also
+// once the boxes run out and are merged into one, and a field whose arena
+// memory was released draws nothing
+
+#include <string.h>
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxsegment.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static uint16_t before[320][172];
+
+static void snapshot()
+{
+    for (int y = 0; y < 320; y++)
+        memcpy(before[y], GFX_getRow(y), 172 * sizeof(uint16_t));
+}
+
+// Changed pixels outside every damage box
+static int undamaged(const GFXsegField *f)
+{
+    const GFXsegRect *r;
+    uint8_t n = GFX_segmentDamage(f, &r);
+    int bad = 0;
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+        {
+            if (GFX_getRow(y)[x] == before[y][x])
+                continue;
+            uint8_t i = 0;
+            while (i < n && !(x >= r[i].x && x < r[i].x + r[i].w && y >= r[i].y && y < r[i].y + r[i].h))
+                i++;
+            bad += i == n;
+        }
+    return bad;
+}
+
+int main()
+{
+    emuReset(0);
+    GFX_arenaReset();
+    CHECK(GFX_createFramebuf());
+    GFX_fillScreen(0);
+    GFXsegField f;
+    CHECK(GFX_segmentInit(&f, 4, 20, 6, 24, GFX_SEG_14, 0xFFFF, 0x2104, 0));
+    CHECK(GFX_segmentValid(&f));
+    GFX_segmentPrint(&f, "888888");
+    GFX_segmentFlush(&f);
+
+    // A few segments: one box each
+    snapshot();
+    GFX_segmentPrint(&f, "888881");
+    const GFXsegRect *r;
+    CHECK(GFX_segmentDamage(&f, &r) > 1);
+    CHECK(undamaged(&f) == 0);
+    GFX_segmentFlush(&f);
+
+    // More changed segments than boxes: merged into one that covers them all
+    snapshot();
+    GFX_segmentPrint(&f, "1.1.1.1.1.1.");
+    CHECK(GFX_segmentDamage(&f, &r) < GFX_SEG_DAMAGE_RECTS);
+    CHECK(undamaged(&f) == 0);
+    GFX_segmentFlush(&f);
+    snapshot();
+    GFX_segmentPrint(&f, "1.1.1.1.1.1"); // First box: the last point, right of everything
+    GFX_segmentPrint(&f, "888888");
+    CHECK(undamaged(&f) == 0);
+    GFX_segmentFlush(&f);
+    snapshot();
+    GFX_segmentPrint(&f, "WXWXWX");
+    GFX_segmentPrint(&f, "MKMKMK");
+    CHECK(undamaged(&f) == 0);
+    GFX_segmentFlush(&f);
+
+    // Shapes released with the framebuffer: nothing is drawn
+    GFX_destroyFramebuf();
+    CHECK(GFX_createFramebuf());
+    CHECK(!GFX_segmentValid(&f));
+    GFX_fillScreen(0x1111);
+    GFX_resolveClear();
+    GFX_segmentInvalidate(&f);
+    CHECK(GFX_segmentPrint(&f, "123456") == 0);
+    int bad = 0;
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+            bad += GFX_getRow(y)[x] != 0x1111;
+    CHECK(bad == 0);
+    return testResult("segment");
+}
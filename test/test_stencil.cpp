@@ -0,0 +1,344 @@
+// Stencils: a rounded rectangle matches the pixel-centre definition; a
+// scene drawn under a stencil equals the unclipped scene masked by it, in
+// both modes and deferred; an all-clear mask hides everything; copied
+// rectangles are clipped; a stencil the arena released is dropped; and a
+// span-clipped fill is compared with a per-pixel test for cost
+
+#include <string.h>
+#include <stdlib.h>
+#include <chrono>
+#include "pico/critical_section.h"
+#include "hardware/sync.h"
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxasset.h"
+#include "gfxblit.h"
+#include "gfxconfig.h"
+#include "gfxdefer.h"
+#include "gfxstencil.h"
+#include "gfxtile.h"
+#include "pixcache.h"
+#include "sans24aa.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// Single-threaded stand-ins for the multicore primitives
+void critical_section_init(critical_section_t *)
+{
+}
+
+void critical_section_enter_blocking(critical_section_t *)
+{
+}
+
+void critical_section_exit(critical_section_t *)
+{
+}
+
+void __sev()
+{
+}
+
+void __wfe()
+{
+}
+
+void tight_loop_contents()
+{
+}
+
+static const uint16_t BG = 0x0841;
+
+static uint16_t img[32 * 32];
+static uint16_t tilePixels[4 * 16 * 16];
+static uint16_t rgb[30 * 25];
+static uint8_t pal8[2 * 8 + 24 * 20];
+static GFXasset assets[2];
+static uint16_t shotA[320 * 172], shotB[320 * 172];
+
+// Every path that clips: pixels, spans, fills, lines, circles, text with a
+// background, AA text, affine blits, tiles and assets
+static void scene(unsigned seed)
+{
+    srand(seed);
+    for (int i = 0; i < 40; i++)
+        GFX_fillRect(rand() % 200 - 20, rand() % 340 - 10, rand() % 80, rand() % 60, rand());
+    for (int i = 0; i < 2000; i++)
+        GFX_drawPixel(rand() % 180 - 4, rand() % 330 - 5, rand());
+    for (int i = 0; i < 100; i++)
+    {
+        int a = rand() % 200 - 14;
+        GFX_drawSpan(a, a + rand() % 120, rand() % 320, rand());
+    }
+    for (int i = 0; i < 20; i++)
+        GFX_drawFastHLine(rand() % 172 - 30, rand() % 320, rand() % 200, rand());
+    GFX_fillCircle(20, 20, 30, 0xF800);
+    GFX_fillCircle(150, 300, 25, 0x07E0);
+    GFX_drawLine(0, 0, 171, 319, 0xFFFF);
+
+    GFX_setFont(NULL);
+    GFX_setTextSize(2);
+    GFX_setTextColor(0xFFE0);
+    GFX_setTextBack(0x001F);
+    GFX_setCursor(0, 2);
+    GFX_printf("Corner");
+    GFX_setFont(&Sans24AA);
+    GFX_setTextSize(1);
+    GFX_setTextBack(0xFFE0);
+    GFX_setCursor(0, 310);
+    GFX_printf("Mg");
+    GFX_setTextColor(0xFFE0);
+    GFX_setCursor(120, 40);
+    GFX_printf("Qy");
+    GFX_setFont(NULL);
+
+    GFXimage im = {img, 32, 32, 32};
+    GFXaffine m;
+    GFX_affineRotateScale(&m, 30, 0x28000, 16, 16, 10, 160);
+    GFX_blitAffine(&im, &m, -40, 110, 110, 110, GFX_BLIT_COLORKEY, img[0]);
+    GFX_affineRotateScale(&m, -20, 0x20000, 16, 16, 150, 100);
+    GFX_blitAffine(&im, &m, 100, 50, 72, 110, GFX_BLIT_BILINEAR, 0);
+
+    GFXtileset ts = {tilePixels, NULL, NULL, 16, 4};
+    GFXtilemap tm;
+    CHECK(GFX_tilemapInit(&tm, &ts, 4, 3, 140, 250));
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 4; c++)
+            GFX_tilemapSet(&tm, c, r, (r + c) & 3);
+    GFX_tilemapRender(&tm);
+
+    CHECK(GFX_drawAsset(0, -5, -3));
+    CHECK(GFX_drawAsset(1, 160, 290));
+    CHECK(GFX_drawAsset(1, 70, 150));
+}
+
+static void capture(uint16_t *out)
+{
+    if (gfxFramebuffer == NULL)
+        LCD_cacheFlush();
+    for (int y = 0; y < 320; y++)
+        memcpy(out + y * 172, gfxFramebuffer ? GFX_getRow(y) : panel + y * 172, 172 * sizeof(uint16_t));
+}
+
+static void start(bool framebuffer)
+{
+    GFX_setStencil(NULL);
+    GFX_destroyFramebuf();
+    GFX_arenaReset();
+    emuReset(BG);
+    if (framebuffer)
+    {
+        CHECK(GFX_createFramebuf());
+        GFX_fillScreen(BG);
+    }
+    GFX_assetSetTable(assets, 2);
+    GFX_setAssetCacheBudget(4096);
+}
+
+static bool buildRound(GFXstencil *s)
+{
+    return GFX_stencilRoundedRect(s, 172, 320, 34);
+}
+
+// A cut-out, diagonal stripes, a hidden corner and hidden rows at the bottom
+static uint8_t maskBits[22 * 320];
+static bool buildMask(GFXstencil *s)
+{
+    memset(maskBits, 0, sizeof(maskBits));
+    for (int y = 0; y < 300; y++)
+        for (int x = 0; x < 172; x++)
+        {
+            bool on = !(x > 40 && x < 120 && y > 100 && y < 200) && (x + y) % 37 < 30 && !(x < 5 && y < 5);
+            if (on)
+                maskBits[y * 22 + x / 8] |= 0x80 >> (x & 7);
+        }
+    return GFX_stencilFromBitmap(s, maskBits, 172, 320);
+}
+
+// The scene under a stencil is the plain scene where visible and the
+// background elsewhere
+static void compare(bool framebuffer, bool deferred, bool (*build)(GFXstencil *))
+{
+    for (unsigned seed = 1; seed <= 3; seed++)
+    {
+        start(framebuffer);
+        scene(seed);
+        capture(shotA);
+
+        start(framebuffer);
+        GFXstencil s;
+        CHECK(build(&s));
+        CHECK(GFX_setStencil(&s));
+        if (deferred)
+            GFX_setDeferred(true);
+        scene(seed);
+        if (deferred)
+        {
+            GFX_deferResolve();
+            GFX_setDeferred(false);
+        }
+        capture(shotB);
+
+        int wrong = 0, hidden = 0;
+        for (int y = 0; y < 320; y++)
+            for (int x = 0; x < 172; x++)
+            {
+                bool vis = GFX_stencilTest(x, y);
+                wrong += shotB[y * 172 + x] != (vis ? shotA[y * 172 + x] : BG);
+                hidden += !vis && shotA[y * 172 + x] != BG;
+            }
+        CHECK(wrong == 0);
+        CHECK(hidden > 0); // The scene does reach the hidden pixels
+    }
+}
+
+int main()
+{
+    for (int i = 0; i < 32 * 32; i++)
+        img[i] = (uint16_t)(i * 977 + 3);
+    for (int i = 0; i < 4 * 256; i++)
+        tilePixels[i] = (uint16_t)(i * 131 + 7);
+    for (int i = 0; i < 30 * 25; i++)
+        rgb[i] = (uint16_t)(i * 313 + 9);
+    uint16_t palette[8];
+    for (int i = 0; i < 8; i++)
+        palette[i] = (uint16_t)(0x1111 * i + 5);
+    memcpy(pal8, palette, sizeof(palette));
+    for (int i = 0; i < 24 * 20; i++)
+        pal8[16 + i] = (i * 5) % 8;
+    assets[0] = {rgb, sizeof(rgb), 30, 25, GFX_ASSET_RGB565, 0, GFX_assetDecodeRaw};
+    assets[1] = {pal8, sizeof(pal8), 24, 20, GFX_ASSET_PAL8, 8, GFX_assetDecodeRaw};
+
+    // Rounded rectangle against the pixel-centre definition, in one allocation
+    emuReset(BG);
+    GFX_arenaReset();
+    GFXstencil r;
+    CHECK(GFX_stencilRoundedRect(&r, 172, 320, 34));
+    CHECK(GFX_arenaMark() == (GFX_stencilMemory(&r) + 3) / 4 * 4);
+    CHECK(GFX_setStencil(&r));
+    int wrong = 0;
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+        {
+            double cx = x + 0.5, cy = y + 0.5;
+            double ax = cx < 34 ? 34 : cx > 172 - 34 ? 172 - 34 : cx;
+            double ay = cy < 34 ? 34 : cy > 320 - 34 ? 320 - 34 : cy;
+            bool vis = (cx - ax) * (cx - ax) + (cy - ay) * (cy - ay) <= 34.0 * 34;
+            wrong += vis != GFX_stencilTest(x, y);
+        }
+    CHECK(wrong == 0);
+    int d = 0;
+    while (!GFX_stencilTest(d, d))
+        d++;
+    CHECK(d <= 10); // The corner inset on the diagonal fits the old 10 px margin
+    CHECK(!GFX_stencilTest(0, 0) && !GFX_stencilTest(171, 319) && !GFX_stencilTest(5, 400));
+    CHECK(GFX_stencilTest(86, 0) && GFX_stencilTest(0, 160));
+    CHECK(GFX_stencilBoxVisible(34, 0, 100, 320) && !GFX_stencilBoxVisible(0, 0, 20, 20));
+    CHECK(GFX_setStencil(NULL) && GFX_stencilTest(0, 0));
+
+    // A radius larger than the box is limited to half of it
+    GFXstencil small;
+    CHECK(GFX_stencilRoundedRect(&small, 10, 6, 50));
+    GFX_setStencil(&small);
+    CHECK(!GFX_stencilTest(0, 0) && GFX_stencilTest(5, 3) && GFX_stencilTest(0, 3));
+    GFX_setStencil(NULL);
+
+    compare(true, false, buildRound);
+    compare(false, false, buildRound);
+    compare(true, false, buildMask);
+    compare(false, false, buildMask);
+    compare(true, true, buildRound);
+    compare(false, true, buildMask);
+
+    // An all-clear mask builds a stencil that hides every row
+    start(true);
+    GFXstencil none;
+    static const uint8_t clear[22 * 320] = {};
+    CHECK(GFX_stencilFromBitmap(&none, clear, 172, 320));
+    CHECK(none.count == 0 && none.first[0] == 0 && none.first[160] == 0 && none.first[320] == 0);
+    GFX_setStencil(&none);
+    GFX_fillRect(0, 0, 172, 320, 0xF800);
+    GFX_drawPixel(86, 160, 0xF800);
+    CHECK(GFX_getRow(0)[0] == BG && GFX_getRow(160)[86] == BG && GFX_getRow(319)[171] == BG);
+    GFX_setStencil(NULL);
+
+    // Copied rectangles land only on visible pixels, overlapping or not
+    start(true);
+    GFXstencil s;
+    CHECK(buildRound(&s));
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+            GFX_getRow(y)[x] = (uint16_t)(y * 172 + x);
+    capture(shotA);
+    GFX_setStencil(&s);
+    CHECK(GFX_copyRect(10, 40, 100, 60, 0, 0));   // Into the top-left corner
+    CHECK(GFX_copyRect(60, 250, 112, 70, 56, 248)); // Overlapping, into the bottom-right corner
+    capture(shotB);
+    wrong = 0;
+    int copied = 0;
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+        {
+            if (!GFX_stencilTest(x, y))
+                wrong += shotB[y * 172 + x] != shotA[y * 172 + x];
+            else if (x < 100 && y < 60)
+                wrong += shotB[y * 172 + x] != shotA[(y + 40) * 172 + x + 10];
+            else if (x >= 56 && x < 168 && y >= 248 && y < 318)
+            {
+                wrong += shotB[y * 172 + x] != shotA[(y + 2) * 172 + x + 4];
+                copied++;
+            }
+        }
+    CHECK(wrong == 0 && copied > 0);
+    GFX_setStencil(NULL);
+
+    // A stencil built after the framebuffer goes with it, and is not set again
+    start(true);
+    GFXstencil stale;
+    CHECK(buildMask(&stale));
+    GFX_setStencil(&stale);
+    GFX_destroyFramebuf();
+    CHECK(gfxStencil == NULL && !GFX_stencilValid(&stale));
+    CHECK(GFX_createFramebuf());
+    GFX_fillScreen(0x1111);
+    GFX_resolveClear();
+    CHECK(!GFX_setStencil(&stale) && gfxStencil == NULL);
+    GFX_fillRect(0, 0, 172, 320, 0x2222);
+    CHECK(GFX_getRow(0)[0] == 0x2222 && GFX_getRow(319)[171] == 0x2222);
+
+    // So does one built before GFX_configure()
+    GFX_destroyFramebuf();
+    GFX_arenaReset();
+    CHECK(buildRound(&s));
+    GFX_setStencil(&s);
+    GFX_configure(GFX_ARENA_SIZE, 0);
+    CHECK(gfxStencil == NULL && !GFX_stencilValid(&s));
+
+    // Cost: a span-clipped fill against a per-pixel test loop (host timing,
+    // for the ratio only)
+    start(true);
+    CHECK(buildRound(&s));
+    GFX_setStencil(&s);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < 200; k++)
+        GFX_fillRect(0, 0, 172, 320, k);
+    auto t1 = std::chrono::steady_clock::now();
+    for (int k = 0; k < 200; k++)
+        for (int y = 0; y < 320; y++)
+        {
+            uint16_t *row = GFX_getRow(y);
+            for (int x = 0; x < 172; x++)
+                if (GFX_stencilTest(x, y))
+                    row[x] = k;
+        }
+    auto t2 = std::chrono::steady_clock::now();
+    double spans = std::chrono::duration<double, std::micro>(t1 - t0).count() / 200;
+    double perPixel = std::chrono::duration<double, std::micro>(t2 - t1).count() / 200;
+    printf("full-screen fill under a rounded stencil: spans %.1f us, per-pixel test %.1f us\n", spans, perPixel);
+    GFX_setStencil(NULL);
+
+    return testResult("stencil");
+}
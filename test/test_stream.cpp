@@ -0,0 +1,106 @@
+// Streaming window writes on the bus-level panel model: pushes of odd and
+// split sizes, a producer-driven window and a caller buffer reused at once
+// all put exactly their input on the wire while DMA sends the other line
+// buffer, and with no DMA channel free the stream falls back to blocking SPI
+
+#include <stdlib.h>
+#include <string.h>
+#include "st7789.h"
+#include "lcdstream.h"
+#include "bus_emu.h"
+#include "test_util.h"
+
+extern int16_t _xstart, _ystart; // Panel RAM offset of the visible area
+
+static uint16_t src[172 * 320];
+
+// Pixels of the window on the glass that differ from src
+static int wrongPixels(int x, int y, int w, int h)
+{
+    int bad = 0;
+    for (int j = 0; j < h; j++)
+        for (int i = 0; i < w; i++)
+            bad += gram[y + j + _ystart][x + i + _xstart] != src[j * w + i];
+    return bad;
+}
+
+// Push the window's pixels in pieces of awkward sizes from one scratch
+// buffer, which is overwritten as soon as each push returns
+static void pushSplit(int x, int y, int w, int h)
+{
+    static const uint32_t sizes[] = {1, 7, LCD_STREAM_PIXELS - 1, LCD_STREAM_PIXELS, LCD_STREAM_PIXELS + 1,
+                                     3, 2 * LCD_STREAM_PIXELS + 5, 64, 500};
+    static uint16_t scratch[600];
+    uint32_t total = (uint32_t)w * h, done = 0;
+    LCD_beginWrite(x, y, w, h);
+    for (int k = 0; done < total; k++)
+    {
+        uint32_t n = sizes[k % 9];
+        if (n > total - done)
+            n = total - done;
+        memcpy(scratch, src + done, n * sizeof(uint16_t));
+        LCD_pushPixels(scratch, n);
+        memset(scratch, 0xA5, sizeof(scratch));
+        done += n;
+    }
+    LCD_endWrite();
+}
+
+static int produced, overlapped;
+static void producer(uint16_t *buf, uint32_t first, uint16_t n, void *ctx)
+{
+    produced++;
+    overlapped += busAsyncActive(); // The other buffer is still going out
+    memcpy(buf, (const uint16_t *)ctx + first, n * sizeof(uint16_t));
+}
+
+int main()
+{
+    LCD_setPins(BUS_PIN_DC, BUS_PIN_CS, BUS_PIN_RST, BUS_PIN_SCK, BUS_PIN_TX);
+    LCD_setSPIperiph(spi1);
+    LCD_initDisplay(172, 320);
+    LCD_setRotation(0);
+
+    // No channel to claim: blocking SPI, same pixels
+    busDmaChannels = 0;
+    for (int i = 0; i < 172 * 320; i++)
+        src[i] = rand();
+    pushSplit(3, 5, 101, 37);
+    CHECK(wrongPixels(3, 5, 101, 37) == 0 && busAsyncWords == 0);
+    busDmaChannels = 16;
+
+    // Slow DMA, so every push lands while a transfer is in flight
+    busAsyncStep = 1;
+    for (int i = 0; i < 172 * 320; i++)
+        src[i] = rand();
+    pushSplit(3, 5, 101, 37);
+    CHECK(wrongPixels(3, 5, 101, 37) == 0 && busAsyncWords == 101 * 37);
+
+    // Odd window sizes, down to a single pixel
+    static const int windows[][4] = {{0, 0, 172, 320}, {171, 319, 1, 1}, {10, 20, 1, 200}, {50, 60, 13, 11}};
+    for (int s = 0; s < 3; s++)
+    {
+        busAsyncStep = s == 0 ? 1 : s == 1 ? 5 : 1000000;
+        for (int k = 0; k < 4; k++)
+        {
+            const int *r = windows[k];
+            for (int i = 0; i < r[2] * r[3]; i++)
+                src[i] = rand();
+            pushSplit(r[0], r[1], r[2], r[3]);
+            CHECK(wrongPixels(r[0], r[1], r[2], r[3]) == 0);
+        }
+    }
+
+    // A producer fills one line buffer while the other is sent
+    busAsyncStep = 1;
+    for (int i = 0; i < 172 * 320; i++)
+        src[i] = rand();
+    produced = overlapped = 0;
+    LCD_streamWindow(7, 9, 77, 55, producer, src);
+    CHECK(wrongPixels(7, 9, 77, 55) == 0);
+    CHECK(produced == (77 * 55 + LCD_STREAM_PIXELS - 1) / LCD_STREAM_PIXELS && overlapped == produced - 1);
+    CHECK(!busAsyncActive());
+
+    CHECK(busErrors == 0);
+    return testResult("stream");
+}
@@ -0,0 +1,118 @@
+// Text boxes: after any random sequence of edits and scrolls, the
+// incremental screen update matches a full redraw, with and without a
+// framebuffer; a box whose memory was released refuses edits
+
+#include <stdlib.h>
+#include <string.h>
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxtextbox.h"
+#include "pixcache.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static uint16_t snap[320 * 320];
+static const char *words[] = {"a", "bb", "hello", "world", "supercalifragilistic",
+                              "x\n", "\n", "  ", "ok.", "0123456789"};
+
+static uint16_t pixelAt(bool fb, int i)
+{
+    return fb ? GFX_getRow(i / _width)[i % _width] : panel[i];
+}
+
+static int run(bool fb, int seed)
+{
+    int bad = 0;
+    srand(seed);
+    GFX_arenaReset();
+    if (fb)
+        CHECK(GFX_createFramebuf());
+    GFXtextbox tb;
+    CHECK(GFX_textboxInit(&tb, 10, 20, 100, 90, NULL, 1, 300, 40));
+    GFX_textboxSetAutoScroll(&tb, seed & 1);
+    GFX_textboxSetAlign(&tb, seed % 3);
+
+    for (int step = 0; step < 400; step++)
+    {
+        const char *w = words[rand() % 10];
+        switch (rand() % 6)
+        {
+        case 0:
+        case 1:
+            GFX_textboxAppend(&tb, w);
+            break;
+        case 2:
+            GFX_textboxInsert(&tb, rand() % (tb.len + 1), w);
+            break;
+        case 3:
+            GFX_textboxDelete(&tb, rand() % (tb.len + 1), rand() % 8);
+            break;
+        case 4:
+            GFX_textboxScrollTo(&tb, rand() % tb.lines);
+            break;
+        default: // Whole new text with one character inserted
+        {
+            char buf[302];
+            int p = rand() % (tb.len + 1);
+            memcpy(buf, tb.text, p);
+            buf[p] = 'Q';
+            memcpy(buf + p + 1, tb.text + p, tb.len - p);
+            buf[tb.len + 1] = 0;
+            if (tb.len < 290)
+                GFX_textboxSetText(&tb, buf);
+            break;
+        }
+        }
+        LCD_cacheFlush();
+        for (int i = 0; i < _width * _height; i++)
+            snap[i] = pixelAt(fb, i);
+        GFX_textboxDraw(&tb);
+        LCD_cacheFlush();
+        int i = 0;
+        while (i < _width * _height && pixelAt(fb, i) == snap[i])
+            i++;
+        if (i < _width * _height && bad++ < 3)
+            printf("%s seed %d step %d: pixel %d,%d differs from a full redraw\n",
+                   fb ? "framebuffer" : "direct", seed, step, i % _width, i / _width);
+    }
+    if (fb)
+        GFX_destroyFramebuf();
+    return bad;
+}
+
+int main()
+{
+    emuReset(0);
+    for (int seed = 0; seed < 12; seed++)
+    {
+        CHECK(run(true, seed) == 0);
+        CHECK(run(false, seed) == 0);
+    }
+
+    // A box allocated after the framebuffer goes when the framebuffer is
+    // re-created, and must not write into the new one
+    GFX_arenaReset();
+    CHECK(GFX_createFramebuf());
+    GFXtextbox tb;
+    CHECK(GFX_textboxInit(&tb, 0, 0, 100, 40, NULL, 1, 100, 8));
+    CHECK(GFX_textboxSetText(&tb, "hello"));
+    CHECK(GFX_textboxValid(&tb));
+    GFX_destroyFramebuf();
+    CHECK(GFX_createFramebuf());
+    GFX_fillScreen(0x1111);
+    GFX_resolveClear();
+    CHECK(!GFX_textboxValid(&tb));
+    CHECK(!GFX_textboxSetText(&tb, "world"));
+    CHECK(!GFX_textboxInsert(&tb, 0, "x"));
+    GFX_textboxAppend(&tb, "more");
+    GFX_textboxDraw(&tb);
+    bool untouched = true;
+    for (int i = 0; i < _width * _height; i++)
+        untouched &= gfxFramebuffer[i] == 0x1111;
+    CHECK(untouched);
+
+    return testResult("textbox");
+}
@@ -0,0 +1,63 @@
+// Tile maps: only changed cells are redrawn, a failed init leaves the arena
+// as it was, and a map whose memory was released refuses to be used
+
+#include <string.h>
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxtile.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+static uint16_t tilePixels[3 * 8 * 8];
+
+int main()
+{
+    emuReset(0);
+    for (int t = 0; t < 3; t++)
+        for (int i = 0; i < 64; i++)
+            tilePixels[t * 64 + i] = (uint16_t)(t * 0x1000 + i);
+    GFXtileset tiles = {tilePixels, NULL, NULL, 8, 3};
+
+    GFX_arenaReset();
+    CHECK(GFX_createFramebuf());
+    GFXtilemap tm;
+    CHECK(GFX_tilemapInit(&tm, &tiles, 10, 5, 4, 8));
+    CHECK(GFX_tilemapValid(&tm));
+    CHECK(GFX_tilemapRender(&tm) == 50);
+    CHECK(GFX_tilemapRender(&tm) == 0);
+
+    GFX_tilemapSet(&tm, 3, 2, 2);
+    GFX_tilemapSet(&tm, 4, 2, 0); // Unchanged: not dirty
+    CHECK(GFX_tilemapGet(&tm, 3, 2) == 2);
+    CHECK(GFX_tilemapRender(&tm) == 1);
+    CHECK(GFX_getRow(8 + 16)[4 + 24] == 0x2000);
+
+    // Tiles larger than 16 px are rejected before anything is allocated
+    GFXtileset big = {tilePixels, NULL, NULL, 32, 1};
+    size_t used = GFX_arenaMark();
+    GFXtilemap bad;
+    CHECK(!GFX_tilemapInit(&bad, &big, 2, 2, 0, 0));
+    CHECK(!GFX_tilemapValid(&bad));
+    CHECK(GFX_arenaMark() == used);
+
+    // The framebuffer is re-created over the map's memory: the map is stale
+    // and its calls leave the new allocation alone
+    GFX_destroyFramebuf();
+    CHECK(GFX_createFramebuf());
+    CHECK(!GFX_tilemapValid(&tm));
+    GFX_fillScreen(0x1111);
+    GFX_resolveClear();
+    GFX_tilemapInvalidate(&tm);
+    GFX_tilemapSet(&tm, 0, 0, 1);
+    CHECK(GFX_tilemapRender(&tm) == 0);
+    CHECK(GFX_tilemapGet(&tm, 3, 2) == 0);
+    bool untouched = true;
+    for (int i = 0; i < _width * _height; i++)
+        untouched &= gfxFramebuffer[i] == 0x1111;
+    CHECK(untouched);
+
+    return testResult("tile");
+}
@@ -0,0 +1,105 @@
+// Waterfall: rows shifted and written in the framebuffer stay inside the
+// stencil, the panel receives the framebuffer, and a direct-mode ring the
+// arena has released is refused rather than written
+
+#include <string.h>
+#include "gfx.h"
+#include "gfxarena.h"
+#include "gfxstencil.h"
+#include "gfxwaterfall.h"
+#include "lcdstream.h"
+#include "st7789.h"
+#include "panel_emu.h"
+#include "test_util.h"
+
+uint16_t _width = 172;
+uint16_t _height = 320;
+
+// No panel scroll band here, so every region takes a software path
+bool LCD_scrollRegion(uint16_t, uint16_t, uint16_t)
+{
+    return false;
+}
+
+void LCD_streamWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, LCDproducer producer, void *ctx)
+{
+    static uint16_t row[320];
+    for (uint16_t j = 0; j < h; j++)
+    {
+        producer(row, (uint32_t)j * w, w, ctx);
+        LCD_WriteBitmap(x, y + j, w, 1, row);
+    }
+}
+
+static uint16_t colormap[256];
+static uint8_t mask[320 * 22];
+
+int main()
+{
+    emuReset(0);
+    GFX_arenaReset();
+    for (int i = 0; i < 256; i++)
+        colormap[i] = 0x0100 + i;
+    uint8_t mags[64];
+
+    // Columns 50 to 59 hidden on every row
+    for (int y = 0; y < 320; y++)
+        for (int x = 0; x < 172; x++)
+            if (x < 50 || x >= 60)
+                mask[y * 22 + x / 8] |= 0x80 >> (x & 7);
+    CHECK(GFX_createFramebuf());
+    GFX_fillScreen(0x1111);
+    GFX_flush();
+    GFXstencil st;
+    CHECK(GFX_stencilFromBitmap(&st, mask, 172, 320));
+    GFX_setStencil(&st);
+
+    GFXwaterfall wf;
+    CHECK(GFX_waterfallInit(&wf, 10, 20, 100, 40, colormap, GFX_WATERFALL_DOWN));
+    CHECK(GFX_waterfallValid(&wf));
+    for (int n = 0; n < 50; n++)
+    {
+        for (int i = 0; i < 64; i++)
+            mags[i] = n * 5 + i;
+        CHECK(GFX_waterfallPush(&wf, mags, 64) > 0);
+    }
+    int hidden = 0, shown = 0;
+    for (int y = 20; y < 60; y++)
+        for (int x = 10; x < 110; x++)
+        {
+            uint16_t c = GFX_getRow(y)[x];
+            if (x >= 50 && x < 60)
+                hidden += c != 0x1111 || panel[y * 172 + x] != 0x1111;
+            else
+                shown += panel[y * 172 + x] != c;
+        }
+    CHECK(hidden == 0 && shown == 0);
+    // Newest row on top, older rows below it
+    CHECK(GFX_getRow(20)[10] == colormap[(uint8_t)(49 * 5)]);
+    CHECK(GFX_getRow(21)[10] == colormap[(uint8_t)(48 * 5)]);
+    GFX_setStencil(NULL);
+    GFX_destroyFramebuf();
+    CHECK(!GFX_waterfallValid(&wf)); // Shifted in a framebuffer that is gone
+
+    // Direct mode ring, then the arena is released under it
+    GFX_arenaReset();
+    emuReset(0x1111);
+    CHECK(GFX_waterfallInit(&wf, 10, 20, 100, 40, colormap, GFX_WATERFALL_UP));
+    CHECK(GFX_waterfallMemory(&wf) == 100 * 40);
+    CHECK(GFX_waterfallPush(&wf, mags, 64) > 0);
+    CHECK(panel[59 * 172 + 10] == colormap[mags[0]]);
+    GFX_arenaReset();
+    CHECK(!GFX_waterfallValid(&wf));
+    uint8_t *other = (uint8_t *)GFX_arenaAlloc(100 * 40, GFX_MEM_OTHER);
+    memset(other, 0xAA, 100 * 40);
+    CHECK(GFX_waterfallPush(&wf, mags, 64) == 0);
+    int changed = 0;
+    for (int i = 0; i < 100 * 40; i++)
+        changed += other[i] != 0xAA;
+    CHECK(changed == 0 && panel[59 * 172 + 10] == colormap[mags[0]]);
+
+    // A region that does not fit is never valid
+    CHECK(!GFX_waterfallInit(&wf, 100, 20, 100, 40, colormap, GFX_WATERFALL_UP));
+    CHECK(!GFX_waterfallValid(&wf));
+    return testResult("waterfall");
+}
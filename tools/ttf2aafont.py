@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""
+Convert a TrueType font into a GFXfont header, 1-bpp or anti-aliased.
+
+Glyph outlines are rasterised with 4x4 (1 and 2 bpp) or 8x8 (4 bpp)
+samples per pixel using the nonzero winding rule. The coverage is then
+quantised to 2 or 16 levels. Anti-aliased bitmaps pack 2 or 4 bits per
+pixel MSB first, rows running on without padding, the same layout as
+1-bpp GFXfont bitmaps. The glyph table and metrics follow the Adafruit
+conventions, so the same converter also gives a 1-bpp font with identical
+metrics to compare against.
+
+Usage:
+    python3 tools/ttf2aafont.py Font.ttf FontName px bpp [first last] > name.h
+
+px is the size of the em in pixels and bpp is 1, 2 or 4.
+
+Ale Moglia / @bartola-valves valves@bartola.co.uk
+"""
+
+import math
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ttf2outline import cmap_format4, glyph_contours, name_string, tables  # noqa: E402
+
+CURVE_STEPS = 8
+
+
+def flatten(contour, scale):
+    """Closed polyline in pixel units (y up) from TrueType quadratic points."""
+    pts = [(x * scale, y * scale, on) for x, y, on in contour]
+    # Make every other point on-curve by inserting implied midpoints
+    full = []
+    for i, p in enumerate(pts):
+        q = pts[(i + 1) % len(pts)]
+        full.append(p)
+        if not p[2] and not q[2]:
+            full.append(((p[0] + q[0]) / 2, (p[1] + q[1]) / 2, True))
+    k = next(i for i, p in enumerate(full) if p[2])
+    full = full[k:] + full[:k]
+
+    out = []
+    i = 0
+    while i < len(full):
+        p = full[i]
+        q = full[(i + 1) % len(full)]
+        out.append((p[0], p[1]))
+        if not q[2]:
+            r = full[(i + 2) % len(full)]
+            for s in range(1, CURVE_STEPS):
+                t = s / CURVE_STEPS
+                a, b, c = (1 - t) ** 2, 2 * t * (1 - t), t * t
+                out.append((a * p[0] + b * q[0] + c * r[0], a * p[1] + b * q[1] + c * r[1]))
+            i += 2
+        else:
+            i += 1
+    return out
+
+
+def rasterise(polys, x0, y1, w, h, ss):
+    """Coverage 0..1 for each pixel of a w*h box with top left corner (x0, y1)."""
+    cover = [[0] * w for _ in range(h)]
+    edges = []
+    for poly in polys:
+        for i, a in enumerate(poly):
+            b = poly[(i + 1) % len(poly)]
+            if a[1] != b[1]:
+                edges.append((a, b))
+    for sy in range(h * ss):
+        y = y1 - (sy + 0.5) / ss
+        xs = []
+        for a, b in edges:
+            lo, hi = (a, b) if a[1] < b[1] else (b, a)
+            if lo[1] <= y < hi[1]:
+                x = a[0] + (y - a[1]) * (b[0] - a[0]) / (b[1] - a[1])
+                xs.append((x, 1 if b[1] > a[1] else -1))
+        xs.sort()
+        row = cover[sy // ss]
+        wind = 0
+        for j, (x, d) in enumerate(xs):
+            wind += d
+            if wind == 0 or j + 1 == len(xs):
+                continue
+            # Sample columns whose centres fall inside [x, next x)
+            xa, xb = x, xs[j + 1][0]
+            c0 = max(0, math.ceil((xa - x0) * ss - 0.5))
+            c1 = min(w * ss, math.ceil((xb - x0) * ss - 0.5))
+            for c in range(c0, c1):
+                row[c // ss] += 1
+    n = ss * ss
+    return [[v / n for v in r] for r in cover]
+
+
+def pack(levels, bpp):
+    out, acc, bits = [], 0, 0
+    for v in levels:
+        acc = (acc << bpp) | v
+        bits += bpp
+        if bits == 8:
+            out.append(acc)
+            acc, bits = 0, 0
+    if bits:
+        out.append(acc << (8 - bits))
+    return out
+
+
+def main():
+    if len(sys.argv) < 5:
+        raise SystemExit(__doc__)
+    path, name, px, bpp = sys.argv[1], sys.argv[2], int(sys.argv[3]), int(sys.argv[4])
+    first = int(sys.argv[5], 0) if len(sys.argv) > 5 else 0x20
+    last = int(sys.argv[6], 0) if len(sys.argv) > 6 else 0x7E
+    if bpp not in (1, 2, 4):
+        raise SystemExit("bpp must be 1, 2 or 4")
+    ss = 8 if bpp == 4 else 4
+    top = (1 << bpp) - 1
+
+    data = open(path, "rb").read()
+    t = tables(data)
+    upem = struct.unpack_from(">H", t["head"], 18)[0]
+    long_loca = struct.unpack_from(">h", t["head"], 50)[0]
+    nglyphs = struct.unpack_from(">H", t["maxp"], 4)[0]
+    ascender, descender, line_gap = struct.unpack_from(">hhh", t["hhea"], 4)
+    nmetrics = struct.unpack_from(">H", t["hhea"], 34)[0]
+    if long_loca:
+        loca = struct.unpack_from(">%dI" % (nglyphs + 1), t["loca"], 0)
+    else:
+        loca = [2 * v for v in struct.unpack_from(">%dH" % (nglyphs + 1), t["loca"], 0)]
+    cmap = cmap_format4(t["cmap"])
+    scale = px / upem
+
+    bitmap, glyphs = [], []
+    for c in range(first, last + 1):
+        gi = cmap.get(c, 0)
+        adv = struct.unpack_from(">H", t["hmtx"], 4 * min(gi, nmetrics - 1))[0]
+        contours = glyph_contours(t["glyf"], loca, gi)
+        if contours is None:
+            sys.stderr.write("warning: 0x%02X is a composite glyph, left empty\n" % c)
+            contours = []
+        polys = [flatten(k, scale) for k in contours if len(k) >= 3]
+        w = h = x0 = y1 = 0
+        if polys:
+            xs = [p[0] for poly in polys for p in poly]
+            ys = [p[1] for poly in polys for p in poly]
+            x0, y1 = math.floor(min(xs)), math.ceil(max(ys))
+            w, h = math.ceil(max(xs)) - x0, y1 - math.floor(min(ys))
+        if w > 255 or h > 255:
+            raise SystemExit("0x%02X is larger than 255 pixels" % c)
+
+        offset = len(bitmap)
+        if w and h:
+            cover = rasterise(polys, x0, y1, w, h, ss)
+            if bpp == 1:
+                levels = [1 if v >= 0.5 else 0 for r in cover for v in r]
+            else:
+                levels = [min(top, int(v * top + 0.5)) for r in cover for v in r]
+            bitmap.extend(pack(levels, bpp))
+        if len(bitmap) > 0xFFFF:
+            raise SystemExit("bitmap data passes 64 KB at 0x%02X" % c)
+        glyphs.append((offset, w, h, min(255, round(adv * scale)), x0, -y1, c))
+
+    y_advance = round((ascender - descender + line_gap) * scale)
+    print("// %s %d px, %d bpp, converted with tools/ttf2aafont.py" % (name, px, bpp))
+    print("// %d glyphs, %d bitmap bytes" % (len(glyphs), len(bitmap)))
+    notice = name_string(t["name"], 0)
+    if notice:
+        print("// Source font: %s" % notice)
+        print("// Renamed on conversion, as the source license requires for modified versions")
+    print()
+    print("#ifndef %s_H" % name.upper())
+    print("#define %s_H" % name.upper())
+    print()
+    print("#include \"gfxfont.h\"")
+    print()
+    print("const uint8_t %sBitmaps[] = {" % name)
+    for i in range(0, len(bitmap), 12):
+        print("    %s," % ", ".join("0x%02X" % b for b in bitmap[i:i + 12]))
+    print("};")
+    print()
+    print("const GFXglyph %sGlyphs[] = {" % name)
+    for off, w, h, adv, xo, yo, c in glyphs:
+        ch = chr(c) if c != 0x5C else "backslash"
+        print("    {%d, %d, %d, %d, %d, %d}, // 0x%02X '%s'" % (off, w, h, adv, xo, yo, c, ch))
+    print("};")
+    print()
+    print("const GFXfont %s = {(uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, 0x%02X, 0x%02X, %d, %d};"
+          % (name, name, name, first, last, y_advance, bpp))
+    print()
+    print("#endif // %s_H" % name.upper())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+Convert a TrueType font into a GFXoutlineFont header for lib/oled/gfxoutline.h.
+
+TrueType glyphs are already quadratic, so contours are copied as they are:
+coordinates are rescaled to a small em (int8 per axis) and each point keeps
+its on/off-curve flag. Only simple glyphs are supported; composite glyphs are
+written as empty glyphs with a warning.
+
+Usage:
+    python3 tools/ttf2outline.py Font.ttf OutlineName [first last em] > name.h
+
+Ale Moglia / @bartola-valves valves@bartola.co.uk
+"""
+
+import struct
+import sys
+
+ON_CURVE = 0x01
+CONTOUR_END = 0x02
+
+
+def tables(data):
+    num = struct.unpack_from(">H", data, 4)[0]
+    out = {}
+    for i in range(num):
+        tag, _, off, length = struct.unpack_from(">4sIII", data, 12 + 16 * i)
+        out[tag.decode("latin-1")] = data[off:off + length]
+    return out
+
+
+def cmap_format4(cmap):
+    """Character code -> glyph index from the Windows Unicode BMP subtable."""
+    count = struct.unpack_from(">H", cmap, 2)[0]
+    for i in range(count):
+        plat, enc, off = struct.unpack_from(">HHI", cmap, 4 + 8 * i)
+        if (plat, enc) in ((3, 1), (0, 3)) and struct.unpack_from(">H", cmap, off)[0] == 4:
+            break
+    else:
+        raise SystemExit("no format 4 cmap subtable")
+
+    seg2 = struct.unpack_from(">H", cmap, off + 6)[0]
+    ends = off + 14
+    starts = ends + seg2 + 2
+    deltas = starts + seg2
+    ranges = deltas + seg2
+    mapping = {}
+    for s in range(seg2 // 2):
+        end = struct.unpack_from(">H", cmap, ends + 2 * s)[0]
+        start = struct.unpack_from(">H", cmap, starts + 2 * s)[0]
+        delta = struct.unpack_from(">h", cmap, deltas + 2 * s)[0]
+        roff = struct.unpack_from(">H", cmap, ranges + 2 * s)[0]
+        for c in range(start, min(end, 0xFFFE) + 1):
+            if roff == 0:
+                g = (c + delta) & 0xFFFF
+            else:
+                p = ranges + 2 * s + roff + 2 * (c - start)
+                g = struct.unpack_from(">H", cmap, p)[0]
+                if g:
+                    g = (g + delta) & 0xFFFF
+            mapping[c] = g
+    return mapping
+
+
+def name_string(name, ident):
+    """First English or Unicode string with the given name ID, or ''."""
+    count, strings = struct.unpack_from(">HH", name, 2)
+    for i in range(count):
+        plat, enc, lang, nid, length, off = struct.unpack_from(">6H", name, 6 + 12 * i)
+        if nid != ident:
+            continue
+        raw = name[strings + off:strings + off + length]
+        if plat == 3 or plat == 0:
+            return raw.decode("utf-16-be")
+        if plat == 1 and lang == 0:
+            return raw.decode("latin-1")
+    return ""
+
+
+def glyph_contours(glyf, loca, index):
+    """List of contours, each a list of (x, y, on_curve) in font units."""
+    start, end = loca[index], loca[index + 1]
+    if start == end:
+        return []
+    g = glyf[start:end]
+    ncont = struct.unpack_from(">h", g, 0)[0]
+    if ncont < 0:
+        return None  # Composite
+    ends = struct.unpack_from(">%dH" % ncont, g, 10)
+    npts = ends[-1] + 1 if ncont else 0
+    p = 10 + 2 * ncont
+    p += 2 + struct.unpack_from(">H", g, p)[0]  # Skip instructions
+
+    flags = []
+    while len(flags) < npts:
+        f = g[p]
+        p += 1
+        flags.append(f)
+        if f & 0x08:
+            flags.extend([f] * g[p])
+            p += 1
+
+    def coords(short_bit, same_bit):
+        nonlocal p
+        vals, v = [], 0
+        for f in flags:
+            if f & short_bit:
+                d = g[p]
+                p += 1
+                v += d if f & same_bit else -d
+            elif not f & same_bit:
+                v += struct.unpack_from(">h", g, p)[0]
+                p += 2
+            vals.append(v)
+        return vals
+
+    xs = coords(0x02, 0x10)
+    ys = coords(0x04, 0x20)
+    contours, first = [], 0
+    for e in ends:
+        contours.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(first, e + 1)])
+        first = e + 1
+    return contours
+
+
+def quantise(contour, scale):
+    pts = [(round(x * scale), round(y * scale), on) for x, y, on in contour]
+    # Start on an on-curve point; insert one if the contour is all off-curve
+    k = next((i for i, q in enumerate(pts) if q[2]), None)
+    if k is None:
+        a, b = pts[0], pts[1]
+        pts.insert(1, ((a[0] + b[0]) // 2, (a[1] + b[1]) // 2, True))
+        k = 1
+    pts = pts[k:] + pts[:k]
+    # Rounding can make neighbours coincide
+    out = []
+    for q in pts:
+        if not out or (q[0], q[1]) != (out[-1][0], out[-1][1]) or q[2] != out[-1][2]:
+            out.append(q)
+    return out if len(out) >= 3 else []
+
+
+def main():
+    if len(sys.argv) < 3:
+        raise SystemExit(__doc__)
+    path, name = sys.argv[1], sys.argv[2]
+    first = int(sys.argv[3], 0) if len(sys.argv) > 3 else 0x20
+    last = int(sys.argv[4], 0) if len(sys.argv) > 4 else 0x7E
+    em = int(sys.argv[5]) if len(sys.argv) > 5 else 96
+
+    data = open(path, "rb").read()
+    t = tables(data)
+    upem = struct.unpack_from(">H", t["head"], 18)[0]
+    long_loca = struct.unpack_from(">h", t["head"], 50)[0]
+    nglyphs = struct.unpack_from(">H", t["maxp"], 4)[0]
+    ascender, descender = struct.unpack_from(">hh", t["hhea"], 4)
+    nmetrics = struct.unpack_from(">H", t["hhea"], 34)[0]
+    if long_loca:
+        loca = struct.unpack_from(">%dI" % (nglyphs + 1), t["loca"], 0)
+    else:
+        loca = [2 * v for v in struct.unpack_from(">%dH" % (nglyphs + 1), t["loca"], 0)]
+    cmap = cmap_format4(t["cmap"])
+    scale = em / upem
+
+    points, glyphs = [], []
+    for c in range(first, last + 1):
+        gi = cmap.get(c, 0)
+        adv = struct.unpack_from(">H", t["hmtx"], 4 * min(gi, nmetrics - 1))[0]
+        contours = glyph_contours(t["glyf"], loca, gi)
+        if contours is None:
+            sys.stderr.write("warning: 0x%02X is a composite glyph, left empty\n" % c)
+            contours = []
+        offset = len(points)
+        for contour in contours:
+            q = quantise(contour, scale)
+            for i, (x, y, on) in enumerate(q):
+                if not -128 <= x <= 127 or not -128 <= y <= 127:
+                    raise SystemExit("0x%02X does not fit int8 at em %d" % (c, em))
+                flags = (ON_CURVE if on else 0) | (CONTOUR_END if i == len(q) - 1 else 0)
+                points.append((x, y, flags))
+        count = len(points) - offset
+        if count > 255:
+            raise SystemExit("0x%02X has more than 255 points" % c)
+        glyphs.append((offset, count, min(255, round(adv * scale)), c))
+
+    print("// %s outline font, converted with tools/ttf2outline.py" % name)
+    print("// Units per em %d, %d glyphs, %d points, %d bytes"
+          % (em, len(glyphs), len(points), 3 * len(points) + 4 * len(glyphs) + 16))
+    notice = name_string(t["name"], 0)
+    if notice:
+        print("// Source font: %s" % notice)
+        print("// Renamed on conversion, as the source license requires for modified versions")
+    print()
+    print("#ifndef %s_H" % name.upper())
+    print("#define %s_H" % name.upper())
+    print()
+    print("#include \"gfxoutline.h\"")
+    print()
+    print("const GFXoutlinePoint %sPoints[] = {" % name)
+    for i in range(0, len(points), 6):
+        row = ", ".join("{%d, %d, %d}" % p for p in points[i:i + 6])
+        print("    %s," % row)
+    print("};")
+    print()
+    print("const GFXoutlineGlyph %sGlyphs[] = {" % name)
+    for off, count, adv, c in glyphs:
+        ch = chr(c) if c != 0x5C else "backslash"
+        print("    {%d, %d, %d}, // 0x%02X '%s'" % (off, count, adv, c, ch))
+    print("};")
+    print()
+    print("const GFXoutlineFont %s = {" % name)
+    print("    %sPoints, %sGlyphs, 0x%02X, 0x%02X, %d, %d, %d};"
+          % (name, name, first, last, em, round(ascender * scale), round(descender * scale)))
+    print()
+    print("#endif // %s_H" % name.upper())
+
+
+if __name__ == "__main__":
+    main()